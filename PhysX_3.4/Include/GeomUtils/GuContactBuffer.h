@@ -39,16 +39,37 @@ namespace physx
 namespace Gu
 {
 
+	// Independent pieces of work split out of a single contact pair. runJob() is called once for each index in [0, nbJobs)
+	// and may be called from any thread.
+	class NarrowPhaseJob
+	{
+	public:
+		virtual void	runJob(PxU32 jobIndex)	= 0;
+	protected:
+		virtual			~NarrowPhaseJob()		{}
+	};
+
+	// Runs the jobs of a NarrowPhaseJob, possibly on several threads. run() returns once all the jobs have completed.
+	class NarrowPhaseJobDispatcher
+	{
+	public:
+		virtual void	run(NarrowPhaseJob& job, PxU32 nbJobs)	= 0;
+	protected:
+		virtual			~NarrowPhaseJobDispatcher()				{}
+	};
+
 	struct NarrowPhaseParams
 	{
 		PX_FORCE_INLINE	NarrowPhaseParams(PxReal contactDistance, PxReal meshContactMargin, PxReal toleranceLength) :
 				mContactDistance(contactDistance),
 				mMeshContactMargin(meshContactMargin),
-				mToleranceLength(toleranceLength)	{}
+				mToleranceLength(toleranceLength),
+				mJobDispatcher(NULL)	{}
 
-		PxReal	mContactDistance;
-		PxReal	mMeshContactMargin;	// PT: Margin used to generate mesh contacts. Temp & unclear, should be removed once GJK is default path.
-		PxReal	mToleranceLength;	// PT: copy of PxTolerancesScale::length
+		PxReal						mContactDistance;
+		PxReal						mMeshContactMargin;	// PT: Margin used to generate mesh contacts. Temp & unclear, should be removed once GJK is default path.
+		PxReal						mToleranceLength;	// PT: copy of PxTolerancesScale::length
+		NarrowPhaseJobDispatcher*	mJobDispatcher;		// Optional. Lets expensive pairs spread their work over several threads. NULL runs everything on the calling thread.
 	};
 
 //sizeof(SavedContactData)/sizeof(PxU32) = 17, 1088/17 = 64 triangles in the local array
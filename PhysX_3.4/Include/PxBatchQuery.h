@@ -46,6 +46,7 @@ namespace physx
 class PxBoxGeometry;
 class PxSphereGeometry;
 struct PxQueryCache;
+class PxBaseTask;
 
 /**
 \brief Batched queries object. This is used to perform several queries at the same time. 
@@ -63,6 +64,26 @@ class PX_DEPRECATED PxBatchQuery
 	*/
 	virtual	void							execute() = 0;
 
+	/**
+	\brief Executes batched queries in parallel using the scene's task manager.
+
+	The queries are split into chunks which are run as tasks on the scene's CPU dispatcher. Results are written
+	to the buffers of PxBatchQueryMemory, as for execute(). The call returns as soon as the tasks have been submitted.
+
+	\param[in] completionTask This task will have its refcount incremented in executeAsync(), then decremented once
+	all queries of the batch have completed. So the task will not run until the application also calls removeReference().
+	If the batch is empty the refcount is left untouched.
+
+	\note The scene must not be modified, fetchResults() must not be called, and the result buffers must not be accessed until
+	completionTask runs.
+	\note The results and the layout of the touch buffers are the same as with execute(). If the touch buffers are too small
+	to hold maxTouchHits for every query of the batch, the queries run in a single task.
+	\note If PVD is connected and transmitting scene queries, the queries are executed serially on the calling thread.
+
+	@see execute() PxScene::getTaskManager() PxBatchQueryMemory
+	*/
+	virtual	void							executeAsync(physx::PxBaseTask* completionTask) = 0;
+
 	/**
 	\brief Gets the prefilter shader in use for this scene query.
 
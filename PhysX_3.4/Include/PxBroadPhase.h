@@ -145,6 +145,7 @@ namespace physx
 		PxBroadPhaseRegion	region;				//!< User-provided region data
 		PxU32				nbStaticObjects;	//!< Number of static objects in the region
 		PxU32				nbDynamicObjects;	//!< Number of dynamic objects in the region
+		PxU32				nbOverlaps;			//!< Number of overlaps reported by the region during the last update
 		bool				active;				//!< True if region is currently used, i.e. it has not been removed
 		bool				overlap;			//!< True if region overlaps other regions (regions that are just touching are not considering overlapping)
 	};
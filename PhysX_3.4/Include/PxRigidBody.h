@@ -125,6 +125,13 @@ struct PxRigidBodyFlag
 
 		/**
 		\brief Register a rigid body to dynamicly adjust contact offset based on velocity. This can be used to achieve a CCD effect.
+
+		The contact offset of the body's shapes is inflated each step by the distance the body is predicted to travel (including gravity),
+		so the regular narrow phase generates speculative contacts ahead of the body and the solver clamps the approach velocity
+		against them (see PxSceneDesc::ccdMaxSeparation). Such bodies do not take part in the sweep-based CCD passes unless they
+		touch a body that has PxRigidBodyFlag::eENABLE_CCD raised, which makes this a cheaper option for debris and fast projectiles.
+
+		\note This flag cannot be combined with PxRigidBodyFlag::eENABLE_CCD on the same body.
 		*/
 		eENABLE_SPECULATIVE_CCD 			= (1 << 5),
 
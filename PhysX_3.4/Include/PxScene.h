@@ -37,6 +37,8 @@
 #include "PxVisualizationParameter.h"
 #include "PxSceneDesc.h"
 #include "PxSimulationStatistics.h"
+#include "PxTaskGraph.h"
+#include "PxSceneMemory.h"
 #include "PxQueryReport.h"
 #include "PxQueryFiltering.h"
 #include "PxClient.h"
@@ -1259,6 +1261,12 @@ class PxScene
 	*/
 	virtual PxFrictionType::Enum getFrictionType() const = 0;
 
+	/**
+	\brief Return the solver type.
+	@see PxSolverType, PxSceneDesc::solverType
+	*/
+	virtual PxSolverType::Enum getSolverType() const = 0;
+
 	//@}
 	/************************************************************************************************/
 
@@ -1328,6 +1336,81 @@ class PxScene
 	@see PxSimulationStatistics
 	*/
 	virtual	void				getSimulationStatistics(PxSimulationStatistics& stats) const = 0;
+
+	/**
+	\brief Enables or disables recording of the task graph of each simulation step.
+
+	When enabled, every internal simulation task records its start and end time, the thread it ran on and the tasks
+	depending on it. At the end of each step the dependency graph is reconstructed and its critical path computed.
+	Recording costs a few timer reads per task and is meant for profiling only.
+
+	\note Do not use this method while the simulation is running.
+
+	\param[in] enable True to enable recording.
+	\param[in] maxNbEvents Maximum number of task executions recorded per step. Executions beyond that are counted in PxTaskGraphFrame::nbDroppedEvents.
+
+	@see getTaskGraphFrame() PxTaskGraphFrame PxTaskGraphExt::writeChromeTrace()
+	*/
+	virtual	void				setTaskGraphRecording(bool enable, PxU32 maxNbEvents = 4096) = 0;
+
+	/**
+	\brief Retrieves the task graph recorded during the last simulation step.
+
+	The returned event array is owned by the scene and stays valid until the next simulation step starts or recording is disabled.
+
+	\note Do not use this method while the simulation is running.
+
+	\param[out] frame The recorded task graph.
+	\return False if task graph recording is disabled or no step has been recorded yet.
+
+	@see setTaskGraphRecording() PxTaskGraphFrame
+	*/
+	virtual	bool				getTaskGraphFrame(PxTaskGraphFrame& frame) const = 0;
+
+	/**
+	\brief Enables or disables tracking of the memory allocated on behalf of the scene.
+
+	When enabled, allocations made by the simulation tasks of the scene and by the PxScene calls which simulate, fetch
+	results, add or remove objects and run scene queries are recorded per PxSceneMemoryCategory. Each simulation stage
+	and scene query charges its allocations to its own category. Tracking adds a few atomic operations and a lock of
+	one of several shards to every allocation and deallocation of the SDK, and is meant for diagnostics.
+
+	Disabling tracking discards the recorded statistics. Enabling it again starts from zero. Blocks allocated before
+	tracking was enabled are ignored when they are freed, and a container created before and grown afterwards is only
+	charged for its new buffer. Use PxSceneFlag::eENABLE_MEMORY_TRACKING to track a scene from its creation.
+
+	\note Do not use this method while the simulation is running. Enabling or disabling tracking registers an allocation
+	listener with the foundation, which is not safe while other scenes simulate.
+
+	\param[in] enable True to enable tracking.
+
+	@see getMemoryStats() setMemoryBudget() PxSceneMemoryStats
+	*/
+	virtual	void				setMemoryTracking(bool enable) = 0;
+
+	/**
+	\brief Retrieves the memory statistics recorded for the scene.
+
+	\param[out] stats The memory statistics.
+	\return False if memory tracking is disabled.
+
+	@see setMemoryTracking() PxSceneMemoryStats
+	*/
+	virtual	bool				getMemoryStats(PxSceneMemoryStats& stats) const = 0;
+
+	/**
+	\brief Sets a limit on the memory allocated on behalf of the scene.
+
+	The callback is invoked when a tracked allocation would take the live bytes of the scene above the budget, before
+	the memory is requested from the allocator. The budget
+	is only enforced while memory tracking is enabled, and is kept when tracking is disabled and enabled again.
+
+	\param[in] budget The budget in bytes, or 0 to remove it.
+	\param[in] callback The callback to invoke when the budget is exceeded, or NULL to only count these events.
+
+	@see setMemoryTracking() PxSceneMemoryBudgetCallback PxSceneMemoryStats.nbBudgetExceeded
+	*/
+	virtual	void				setMemoryBudget(PxU64 budget, PxSceneMemoryBudgetCallback* callback) = 0;
 	
 	
 	//@}
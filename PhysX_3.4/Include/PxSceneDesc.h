@@ -132,6 +132,37 @@ than patch friction for scenarios with many contact points.
 		};
 	};
 
+
+/**
+\brief Enum for selecting the type of solver used for simulation.
+
+#PxSolverType::ePGS selects the default iterative sequential impulse solver. Each position iteration solves all constraints again for the
+full time step, so long chains of joints need many iterations to stop stretching.
+
+#PxSolverType::eSUBSTEPPED_JOINTS selects a substepping solver for joints. It is not a temporal Gauss-Seidel (TGS) solver: bodies are
+not integrated per substep and contacts are not substepped, so it does not make contacts more stable. Each position iteration of an
+island becomes a substep of the time step: the joints are prepared for the substep, and after each substep the bodies' motion is
+accumulated and the hard joint rows re-evaluate their geometric errors from it. The stiffness of joint chains then comes from the
+substeps, so far fewer position iterations are needed than with ePGS. Joint drives, springs and rows with a velocity target are not
+re-evaluated.
+
+Contacts and friction are not substepped. They are prepared once for the full time step, their separation is not re-evaluated between
+substeps, and they are solved once per substep like the other constraints. As the bodies are integrated with the average velocity of
+the substeps, contact and friction impulses applied in later substeps move the bodies less than with ePGS, so scenes dominated by
+contacts (e.g. stacking) can show more penetration than with ePGS at the same iteration count. The velocity iterations are solved as
+with ePGS.
+
+\note eSUBSTEPPED_JOINTS is only supported by PxFrictionType::ePATCH. Islands containing articulations, or using another friction type, fall back to ePGS.
+*/
+	struct PxSolverType
+	{
+		enum Enum
+		{
+			ePGS,				//!< Projected Gauss-Seidel iterative solver
+			eSUBSTEPPED_JOINTS	//!< ePGS with joint errors re-evaluated between position iterations
+		};
+	};
+
 /**
 \brief flags for configuring properties of the scene
 
@@ -382,6 +413,44 @@ struct PxSceneFlag
 		*/
 		eENABLE_ENHANCED_DETERMINISM = (1<<20),
 
+		/**
+		\brief Lets the MBP broad-phase lay out and rebalance its regions automatically.
+
+		When this flag is set and the scene uses PxBroadPhaseType::eMBP, a first region enclosing the initial objects is created
+		if no region has been added by the user. When objects leave the bounds of the region layout, the regions on that side
+		are enlarged. The broad-phase then tracks per-region object counts (including sleeping objects) and overlap counts, and
+		incrementally splits crowded regions and merges sparse neighbouring ones. At most one split or merge is performed
+		every few frames so that the cost is amortized.
+
+		Regions created by the broad-phase inherit the user data of the region they replace. Region handles returned by
+		PxScene::addBroadPhaseRegion() may be invalidated by the automatic layout, so PxScene::getBroadPhaseRegions() should
+		be used to inspect the current layout. Objects in gaps between user-defined regions, or leaving the layout once the
+		maximum number of regions is reached, are still reported as out-of-bounds.
+
+		Note that this flag is not mutable and must be set at scene creation. It is ignored by other broad-phase types.
+
+		<b>Default</b> false
+
+		@see PxBroadPhaseType PxSimulationStatistics.nbBroadPhaseRegions PxBroadPhaseRegionInfo
+		*/
+		eENABLE_ADAPTIVE_BROADPHASE_REGIONS = (1<<21),
+
+		/**
+		\brief Enables memory tracking from the creation of the scene.
+
+		Same as calling PxScene::setMemoryTracking(true) on the new scene, except that the allocations made while the scene
+		is created are recorded as well. Blocks allocated before tracking is enabled are never recorded, so when they are
+		freed or grown later the statistics only see the new blocks. Set this flag for totals that cover all the memory
+		of the scene.
+
+		Note that this flag is not mutable and must be set at scene creation.
+
+		<b>Default</b> false
+
+		@see PxScene::setMemoryTracking() PxScene::getMemoryStats()
+		*/
+		eENABLE_MEMORY_TRACKING = (1<<22),
+
 		eMUTABLE_FLAGS = eENABLE_ACTIVE_ACTORS|eENABLE_ACTIVETRANSFORMS|eEXCLUDE_KINEMATICS_FROM_ACTIVE_ACTORS
 	};
 };
@@ -648,6 +717,17 @@ public:
 	*/
 	PxFrictionType::Enum frictionType;
 
+	/**
+	\brief Selects the solver algorithm to use for simulation.
+
+	\note solverType cannot be modified after the scene has been created.
+
+	<b>Default:</b> PxSolverType::ePGS
+
+	@see PxSolverType, PxScene::getSolverType
+	*/
+	PxSolverType::Enum solverType;
+
 	/**
 	\brief A contact with a relative velocity below this will not bounce. A typical value for simulation.
 	stability is about 0.2 * gravity.
@@ -695,6 +775,44 @@ public:
 
 	PxReal solverOffsetSlop;
 
+	/**
+	\brief Residual tolerance for early termination of the solver iterations.
+
+	When non-zero, every island stops iterating once no constraint impulse changed by more than this value during an iteration, instead of
+	always running the full position and velocity iteration counts of its bodies. The iteration counts remain the upper bound. The first
+	friction iteration, the last position iteration and the first and last velocity iterations are always run.
+
+	The tolerance is an impulse, so it should be scaled with the mass and velocity range of the scene.
+
+	\note Only supported by PxFrictionType::ePATCH. Islands containing articulations always run all iterations.
+
+	<b>Range:</b> [0, PX_MAX_F32)<br>
+	<b>Default:</b> 0.0 (disabled)
+
+	@see PxSimulationStatistics.nbSolverIslandsTerminatedEarly
+	*/
+	PxReal solverResidualTolerance;
+
+	/**
+	\brief Motion below which a pair replays its previous contacts instead of running contact generation.
+
+	When non-zero, each pair remembers the world poses of its two shapes the last time its contacts were generated. While both shapes
+	moved less than this distance since then, and the pair's contact distance is unchanged, the narrow phase skips contact generation
+	and reuses the previous frame's contacts as they are. The contacts are in world space, so a pair whose shapes move together still
+	runs contact generation. Rotation is converted to a distance using the offset between the two shapes as lever arm.
+
+	This trades contact accuracy for narrow phase time in large resting or slowly creeping piles. Replayed contacts keep their previous
+	separation, so the threshold should stay well below the contact offset of the shapes.
+
+	\note Pairs with contact modification enabled always run contact generation.
+
+	<b>Range:</b> [0, PX_MAX_F32)<br>
+	<b>Default:</b> 0.0 (disabled)
+
+	@see PxSimulationStatistics.nbDiscreteContactPairsReplayed
+	*/
+	PxReal contactReplayThreshold;
+
 	/**
 	\brief Flags used to select scene options.
 
@@ -791,7 +909,7 @@ public:
 
 	<b>Range:</b> [0, PX_MAX_U32]<br>
 
-	@see PxPhysics::createScene PxScene::setNbContactDataBlocks 
+	@see PxPhysics::createScene PxScene::setNbContactDataBlocks PxSimulationStatistics.peakContactDataBlocks
 	*/
 	PxU32					nbContactDataBlocks;
 
@@ -968,10 +1086,13 @@ PX_INLINE PxSceneDesc::PxSceneDesc(const PxTolerancesScale& scale):
 	broadPhaseCallback					(NULL),
 
 	frictionType						(PxFrictionType::ePATCH),
+	solverType							(PxSolverType::ePGS),
 	bounceThresholdVelocity				(0.2f * scale.speed),
 	frictionOffsetThreshold				(0.04f * scale.length),
 	ccdMaxSeparation					(0.04f * scale.length),
 	solverOffsetSlop					(0.0f),
+	solverResidualTolerance				(0.0f),
+	contactReplayThreshold				(0.0f),
 
 	flags								(PxSceneFlag::eENABLE_PCM),
 
@@ -1029,6 +1150,11 @@ PX_INLINE bool PxSceneDesc::isValid() const
 		return false;
 	if(frictionOffsetThreshold < 0.0f)
 		return false;
+
+	if(solverResidualTolerance < 0.0f)
+		return false;
+	if(contactReplayThreshold < 0.0f)
+		return false;
 	if(ccdMaxSeparation < 0.0f)
 		return false;
 
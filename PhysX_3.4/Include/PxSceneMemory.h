@@ -0,0 +1,159 @@
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Copyright (c) 2008-2018 NVIDIA Corporation. All rights reserved.
+// Copyright (c) 2004-2008 AGEIA Technologies, Inc. All rights reserved.
+// Copyright (c) 2001-2004 NovodeX AG. All rights reserved.  
+
+
+#ifndef PX_SCENE_MEMORY_H
+#define PX_SCENE_MEMORY_H
+/** \addtogroup physics
+@{
+*/
+
+#include "PxPhysXConfig.h"
+
+#if !PX_DOXYGEN
+namespace physx
+{
+#endif
+
+class PxScene;
+
+/**
+\brief Subsystems scene allocations are attributed to.
+
+Each simulation stage and scene query charges the allocations it makes, including those of the containers it uses, to
+its category. Work on behalf of the scene which does not belong to a stage, e.g. adding and removing objects, is
+charged to eOTHER.
+
+@see PxSceneMemoryStats PxScene::setMemoryTracking()
+*/
+struct PxSceneMemoryCategory
+{
+	enum Enum
+	{
+		eBROAD_PHASE,	//!< Broad phase and aggregate bounds management
+		eNARROW_PHASE,	//!< Contact managers, contact generation and contact streams
+		eSOLVER,		//!< Constraint preparation, solver and integration
+		eISLANDS,		//!< Island generation and sleeping
+		eCCD,			//!< Continuous collision detection
+		eSCENE_QUERY,	//!< Scene query structures and queries
+		eOTHER,			//!< Everything else, e.g. scene and actor management
+
+		eCOUNT
+	};
+};
+
+/**
+\brief Memory used by a scene, as recorded by the scene's memory tracker.
+
+Only allocations made while the SDK runs on behalf of the scene are recorded: simulation tasks of the scene, and
+the PxScene calls which simulate, fetch results, add or remove objects and run scene queries. Memory allocated before
+tracking was enabled is not included, see PxSceneFlag::eENABLE_MEMORY_TRACKING.
+
+@see PxScene::setMemoryTracking() PxScene::getMemoryStats()
+*/
+struct PxSceneMemoryStats
+{
+	/**
+	\brief Number of bytes currently allocated, per category.
+	*/
+	PxU64	liveBytes[PxSceneMemoryCategory::eCOUNT];
+
+	/**
+	\brief Highest number of bytes allocated at any time since tracking was enabled, per category.
+	*/
+	PxU64	peakBytes[PxSceneMemoryCategory::eCOUNT];
+
+	/**
+	\brief Number of bytes currently allocated, all categories.
+	*/
+	PxU64	totalLiveBytes;
+
+	/**
+	\brief Highest number of bytes allocated at any time since tracking was enabled, all categories.
+	*/
+	PxU64	totalPeakBytes;
+
+	/**
+	\brief Number of allocations made during the last completed simulation step, from one simulate() or collide() call to the next.
+
+	A non-zero value in a steady state means the simulation keeps allocating and freeing heap memory.
+	*/
+	PxU32	nbFrameAllocations;
+
+	/**
+	\brief Number of bytes allocated during the last completed simulation step.
+	*/
+	PxU64	frameAllocatedBytes;
+
+	/**
+	\brief The budget set with PxScene::setMemoryBudget(), or 0 if there is none.
+	*/
+	PxU64	budget;
+
+	/**
+	\brief Number of times the budget callback was invoked since tracking was enabled.
+	*/
+	PxU32	nbBudgetExceeded;
+};
+
+/**
+\brief Callback invoked when the memory allocated for a scene is about to exceed its budget.
+
+@see PxScene::setMemoryBudget()
+*/
+class PxSceneMemoryBudgetCallback
+{
+public:
+	/**
+	\brief Called when an allocation is about to take the scene's live bytes above its budget.
+
+	The callback is invoked before the memory is requested from the allocator, on the thread requesting it. It is
+	invoked once each time the budget is crossed, and is armed again once the live bytes drop back below the budget.
+
+	\note This may be called from any simulation thread, and while SDK internal locks are held. The implementation
+	must be thread safe and must not call back into the SDK.
+
+	\param[in] scene The scene exceeding its budget.
+	\param[in] category The category of the allocation crossing the budget.
+	\param[in] size The size of that allocation in bytes.
+	\param[in] liveBytes The number of bytes allocated for the scene, including that allocation.
+	\param[in] budget The budget of the scene.
+	*/
+	virtual void onBudgetExceeded(PxScene& scene, PxSceneMemoryCategory::Enum category, size_t size, PxU64 liveBytes, PxU64 budget) = 0;
+
+protected:
+	virtual ~PxSceneMemoryBudgetCallback() {}
+};
+
+#if !PX_DOXYGEN
+} // namespace physx
+#endif
+
+/** @} */
+#endif
@@ -120,6 +120,24 @@ public:
 		eTRIGGER_PAIRS
 	};
 
+	/**
+	\brief Number of constraint partitions for which the solver barrier wait time is reported individually.
+	@see solverPartitionWaitTime
+	*/
+	enum
+	{
+		eMAX_SOLVER_BARRIER_PARTITIONS = 32
+	};
+
+	/**
+	\brief Number of CCD passes for which the time is reported individually.
+	@see ccdPassTime
+	*/
+	enum
+	{
+		eMAX_CCD_PASSES = 8
+	};
+
 
 //objects:
 	/**
@@ -191,6 +209,29 @@ public:
 	*/
 	PxU32   peakConstraintMemory;
 
+	/**
+	\brief The peak number of 16K contact data blocks in use during the current simulation step
+
+	This includes the blocks held by the narrow phase thread arenas. Use it to size PxSceneDesc::nbContactDataBlocks
+	so that the pool never needs to allocate during a simulation step.
+
+	@see PxSceneDesc.nbContactDataBlocks PxScene::getMaxNbContactDataBlocksUsed()
+	*/
+	PxU32	peakContactDataBlocks;
+
+	/**
+	\brief The number of 16K contact data blocks held by the per-thread narrow phase arenas at the end of the narrow phase
+	*/
+	PxU32	nbNarrowPhaseArenaBlocks;
+
+	/**
+	\brief The number of 16K blocks the narrow phase thread arenas fetched from the shared pool in the current simulation step
+
+	A non-zero value in a steady state means the contact stream usage is still growing, or that the work is landing on
+	different threads from frame to frame.
+	*/
+	PxU32	nbNarrowPhaseArenaOverflowBlocks;
+
 //broadphase:
 	/**
 	\brief Get number of broadphase volumes of a certain type added for the current simulation step.
@@ -291,6 +332,11 @@ public:
 	*/
 	PxU32	nbDiscreteContactPairsWithContacts;
 
+	/**
+	\brief Total number of (non CCD) pairs that replayed the previous frame's contacts because both shapes moved less than PxSceneDesc::contactReplayThreshold (<=nbDiscreteContactPairsTotal)
+	*/
+	PxU32	nbDiscreteContactPairsReplayed;
+
 	/**
 	\brief Number of new pairs found by BP this frame
 	*/
@@ -316,6 +362,174 @@ public:
 	*/
 	PxU32	nbPartitions;
 
+	/**
+	\brief Number of active broad-phase regions this frame
+
+	\note Only reported by PxBroadPhaseType::eMBP.
+	*/
+	PxU32	nbBroadPhaseRegions;
+
+	/**
+	\brief Number of broad-phase regions split by the adaptive region layout this frame
+
+	@see PxSceneFlag::eENABLE_ADAPTIVE_BROADPHASE_REGIONS
+	*/
+	PxU32	nbBroadPhaseRegionSplits;
+
+	/**
+	\brief Number of broad-phase region merges performed by the adaptive region layout this frame
+
+	@see PxSceneFlag::eENABLE_ADAPTIVE_BROADPHASE_REGIONS
+	*/
+	PxU32	nbBroadPhaseRegionMerges;
+
+	/**
+	\brief Largest number of objects found in a single broad-phase region this frame
+
+	\note Per-region figures are available through PxScene::getBroadPhaseRegions().
+	*/
+	PxU32	maxNbBroadPhaseRegionObjects;
+
+	/**
+	\brief Largest number of overlaps reported by a single broad-phase region this frame
+
+	\note Per-region figures are available through PxScene::getBroadPhaseRegions().
+	*/
+	PxU32	maxNbBroadPhaseRegionOverlaps;
+
+	/**
+	\brief Time in microseconds that parallel solver threads spent waiting for each constraint partition to become available this frame
+
+	Entry i is the time spent before starting to solve partition i, summed over all threads, iterations and islands. Waits on partitions 
+	past the last entry are added to the last entry. Large values point at partitions that do not split evenly across the worker threads, 
+	or at workers that were descheduled while holding solver work.
+
+	\note Only islands solved by more than one thread contribute.
+	\note Waits on the friction partitions of PxFrictionType::eONE_DIRECTIONAL and eTWO_DIRECTIONAL are reported in solverFrictionPartitionWaitTime.
+
+	@see nbPartitions nbSolverBarrierYields solverFrictionPartitionWaitTime
+	*/
+	PxU32	solverPartitionWaitTime[eMAX_SOLVER_BARRIER_PARTITIONS];
+
+	/**
+	\brief Time in microseconds that parallel solver threads spent waiting for each friction constraint partition to become available this frame
+
+	Only the patch friction models (PxFrictionType::eONE_DIRECTIONAL and eTWO_DIRECTIONAL) solve friction in partitions of their own.
+	Entry i is accumulated in the same way as solverPartitionWaitTime, for friction partition i.
+
+	@see solverPartitionWaitTime PxFrictionType
+	*/
+	PxU32	solverFrictionPartitionWaitTime[eMAX_SOLVER_BARRIER_PARTITIONS];
+
+	/**
+	\brief Time in microseconds that parallel solver threads spent waiting for each other around saving the body velocities between the position and velocity iterations this frame
+	*/
+	PxU32	solverVelocitySaveWaitTime;
+
+	/**
+	\brief Number of times a parallel solver thread had to wait for the other solver threads this frame
+	*/
+	PxU32	nbSolverBarrierWaits;
+
+	/**
+	\brief Number of times a waiting solver thread gave up its core this frame because the work it was waiting for stopped progressing
+	*/
+	PxU32	nbSolverBarrierYields;
+
+	/**
+	\brief Number of islands solved this frame
+	*/
+	PxU32	nbSolverIslands;
+
+	/**
+	\brief Number of islands that stopped iterating before reaching their iteration count this frame
+
+	\note Always 0 unless PxSceneDesc::solverResidualTolerance is set.
+
+	@see PxSceneDesc.solverResidualTolerance
+	*/
+	PxU32	nbSolverIslandsTerminatedEarly;
+
+	/**
+	\brief Position iterations actually run this frame, summed over all islands
+
+	Compare against nbSolverIslands and maxSolverPositionIterations to see how much early termination saved.
+	*/
+	PxU32	solverPositionIterations;
+
+	/**
+	\brief Velocity iterations actually run this frame, summed over all islands
+	*/
+	PxU32	solverVelocityIterations;
+
+	/**
+	\brief Largest number of position iterations run by a single island this frame
+	*/
+	PxU32	maxSolverPositionIterations;
+
+	/**
+	\brief Largest number of velocity iterations run by a single island this frame
+	*/
+	PxU32	maxSolverVelocityIterations;
+
+	/**
+	\brief Number of constraint partitions solved this frame, summed over all islands
+
+	Constraints in the same partition share no dynamic body and are solved in parallel. The parallel solver synchronizes
+	its threads between partitions, so nbSolverPartitions/nbSolverIslands is the average number of such synchronization
+	points per iteration.
+	*/
+	PxU32	nbSolverPartitions;
+
+	/**
+	\brief Largest number of constraint partitions of a single island this frame
+	*/
+	PxU32	maxSolverPartitions;
+
+	/**
+	\brief Number of partitions removed this frame by moving the constraints of partitions too small to fill a batch into other partitions
+	*/
+	PxU32	nbSolverMergedPartitions;
+
+	/**
+	\brief Number of constraint batches solved this frame
+
+	The solver processes constraints in batches of up to 4. nbSolverBatchedConstraints/(4*nbSolverConstraintBatches) is the average batch fill.
+	*/
+	PxU32	nbSolverConstraintBatches;
+
+	/**
+	\brief Number of constraints in the batches counted by nbSolverConstraintBatches
+	*/
+	PxU32	nbSolverBatchedConstraints;
+
+	/**
+	\brief Number of CCD passes that swept pairs this frame
+
+	@see PxSceneDesc.ccdMaxPasses ccdPassTime
+	*/
+	PxU32	nbCCDPasses;
+
+	/**
+	\brief Time in microseconds spent in each CCD pass this frame
+
+	Entry i covers the pair setup, sweeps, island advancement and contact notification of pass i, but not the CCD broad phase that 
+	precedes it. Passes past the last entry are added to the last entry.
+	*/
+	PxU32	ccdPassTime[eMAX_CCD_PASSES];
+
+	/**
+	\brief Number of CCD pairs swept this frame, summed over all CCD passes
+	*/
+	PxU32	nbCCDSweeps;
+
+	/**
+	\brief Number of CCD pairs not swept this frame because neither body was advanced or hit anything in the previous CCD pass
+
+	@see nbCCDSweeps
+	*/
+	PxU32	nbCCDSkippedSweeps;
+
 	PxSimulationStatistics() :
 		nbActiveConstraints					(0),
 		nbActiveDynamicBodies				(0),
@@ -328,14 +542,40 @@ public:
 		compressedContactSize				(0),
 		requiredContactConstraintMemory		(0),
 		peakConstraintMemory				(0),
+		peakContactDataBlocks				(0),
+		nbNarrowPhaseArenaBlocks			(0),
+		nbNarrowPhaseArenaOverflowBlocks	(0),
 		nbDiscreteContactPairsTotal			(0),
 		nbDiscreteContactPairsWithCacheHits	(0),
 		nbDiscreteContactPairsWithContacts	(0),
+		nbDiscreteContactPairsReplayed		(0),
 		nbNewPairs							(0),
 		nbLostPairs							(0),
 		nbNewTouches						(0),
 		nbLostTouches						(0),
 		nbPartitions						(0),
+		nbBroadPhaseRegions					(0),
+		nbBroadPhaseRegionSplits			(0),
+		nbBroadPhaseRegionMerges			(0),
+		maxNbBroadPhaseRegionObjects		(0),
+		maxNbBroadPhaseRegionOverlaps		(0),
+		solverVelocitySaveWaitTime			(0),
+		nbSolverBarrierWaits				(0),
+		nbSolverBarrierYields				(0),
+		nbSolverIslands						(0),
+		nbSolverIslandsTerminatedEarly		(0),
+		solverPositionIterations			(0),
+		solverVelocityIterations			(0),
+		maxSolverPositionIterations			(0),
+		maxSolverVelocityIterations			(0),
+		nbSolverPartitions					(0),
+		maxSolverPartitions					(0),
+		nbSolverMergedPartitions			(0),
+		nbSolverConstraintBatches			(0),
+		nbSolverBatchedConstraints			(0),
+		nbCCDPasses							(0),
+		nbCCDSweeps							(0),
+		nbCCDSkippedSweeps					(0),
 		particlesGpuMeshCacheSize			(0),
 		particlesGpuMeshCacheUsed			(0),
 		particlesGpuMeshCacheHitrate		(0.0f)
@@ -361,6 +601,17 @@ public:
 		{
 			nbShapes[i] = 0;
 		}
+
+		for(PxU32 i=0; i < eMAX_SOLVER_BARRIER_PARTITIONS; i++)
+		{
+			solverPartitionWaitTime[i] = 0;
+			solverFrictionPartitionWaitTime[i] = 0;
+		}
+
+		for(PxU32 i=0; i < eMAX_CCD_PASSES; i++)
+		{
+			ccdPassTime[i] = 0;
+		}
 	}
 
 
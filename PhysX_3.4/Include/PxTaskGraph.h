@@ -0,0 +1,141 @@
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Copyright (c) 2008-2018 NVIDIA Corporation. All rights reserved.
+// Copyright (c) 2004-2008 AGEIA Technologies, Inc. All rights reserved.
+// Copyright (c) 2001-2004 NovodeX AG. All rights reserved.  
+
+
+#ifndef PX_TASK_GRAPH_H
+#define PX_TASK_GRAPH_H
+/** \addtogroup physics
+@{
+*/
+
+#include "PxPhysXConfig.h"
+
+#if !PX_DOXYGEN
+namespace physx
+{
+#endif
+
+/**
+\brief A single task execution recorded during a simulation step.
+
+Times are given in microseconds, relative to the start of the first task recorded in the step.
+
+@see PxTaskGraphFrame PxScene::setTaskGraphRecording()
+*/
+struct PxTaskGraphEvent
+{
+	/**
+	\brief Name of the task, as returned by PxBaseTask::getName().
+	*/
+	const char*	name;
+
+	/**
+	\brief Time at which the task started running.
+	*/
+	PxReal		startTime;
+
+	/**
+	\brief Time at which the task finished running.
+	*/
+	PxReal		endTime;
+
+	/**
+	\brief Index of the thread which ran the task. Threads are numbered in the order in which they first ran a task during the step.
+	*/
+	PxU32		threadIndex;
+
+	/**
+	\brief Index of the event preceding this one on the longest dependency chain leading to it, or 0xffffffff if there is none.
+
+	This is either the last continuation dependency to finish, or the task which spawned this one.
+	*/
+	PxU32		criticalPredecessor;
+
+	/**
+	\brief True if the event lies on the critical path of the step.
+	*/
+	bool		onCriticalPath;
+};
+
+/**
+\brief The recorded task graph of a simulation step.
+
+The critical path is the longest chain of dependent task work in the step, i.e. the step duration
+with an unlimited number of worker threads and no scheduling overhead. totalWork / criticalPathLength
+gives the average parallelism available in the step, totalWork / (wallTime * nbThreads) the fraction
+of the worker threads' time spent running tasks.
+
+@see PxTaskGraphEvent PxScene::getTaskGraphFrame()
+*/
+struct PxTaskGraphFrame
+{
+	/**
+	\brief The recorded task executions, sorted by start time.
+	*/
+	const PxTaskGraphEvent*	events;
+
+	/**
+	\brief Number of entries in events.
+	*/
+	PxU32					nbEvents;
+
+	/**
+	\brief Number of task executions which could not be recorded because the event buffer was full.
+
+	@see PxScene::setTaskGraphRecording()
+	*/
+	PxU32					nbDroppedEvents;
+
+	/**
+	\brief Number of distinct threads which ran tasks during the step.
+	*/
+	PxU32					nbThreads;
+
+	/**
+	\brief Time in microseconds from the start of the first task to the end of the last task.
+	*/
+	PxReal					wallTime;
+
+	/**
+	\brief Sum of the durations of all recorded tasks, in microseconds.
+	*/
+	PxReal					totalWork;
+
+	/**
+	\brief Length of the critical path in microseconds.
+	*/
+	PxReal					criticalPathLength;
+};
+
+#if !PX_DOXYGEN
+} // namespace physx
+#endif
+
+/** @} */
+#endif
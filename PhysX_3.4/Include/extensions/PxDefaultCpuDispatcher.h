@@ -42,6 +42,79 @@ namespace physx
 {
 #endif
 
+/**
+\brief Selects how the default CPU dispatcher distributes tasks among its worker threads.
+
+@see PxDefaultCpuDispatcherCreate()
+*/
+struct PxDefaultCpuDispatcherQueueMode
+{
+	enum Enum
+	{
+		/**
+		\brief Tasks are pushed to a job list shared by all workers. Workers which run out of jobs steal
+		from the other workers' local lists in fixed order.
+		*/
+		eSHARED_QUEUE,
+
+		/**
+		\brief Each worker owns a lock-free work-stealing deque. Tasks submitted from a worker thread are
+		pushed to that worker's deque, idle workers steal from randomly selected victims. Tasks submitted
+		from other threads, or which do not fit into a full deque, go to the shared job list.
+
+		\note Recommended for machines with many cores, where contention on the shared job list dominates.
+		*/
+		eWORK_STEALING
+	};
+};
+
+/**
+\brief Selects what an idle worker thread of the default CPU dispatcher does while it waits for new tasks.
+
+The spin count passed to PxDefaultCpuDispatcherCreate() bounds the number of times an idle worker polls the
+task queues before it yields or goes to sleep. Spinning reduces the latency between a task submission and its
+execution, at the cost of burning CPU time that other threads could use.
+
+@see PxDefaultCpuDispatcherCreate()
+*/
+struct PxDefaultCpuDispatcherWaitForWorkMode
+{
+	enum Enum
+	{
+		/**
+		\brief Idle workers keep polling the task queues and never give up their time slice.
+
+		\note Only use this when each worker has a dedicated core.
+		*/
+		eSPIN,
+
+		/**
+		\brief Idle workers poll spinCount times, then yield their time slice between polls.
+		*/
+		eSPIN_THEN_YIELD,
+
+		/**
+		\brief Idle workers poll spinCount times, then sleep until a task is submitted.
+
+		Each submitted task wakes at most one sleeping worker.
+		*/
+		eSPIN_THEN_PARK
+	};
+};
+
+/**
+\brief Idle and wake-up counters of the default CPU dispatcher, accumulated over all worker threads since creation.
+
+@see PxDefaultCpuDispatcher::getStatistics()
+*/
+struct PxDefaultCpuDispatcherStatistics
+{
+	PxU64	nbSpins;	//!< Number of times an idle worker polled the task queues without finding a task.
+	PxU64	nbYields;	//!< Number of times an idle worker yielded its time slice.
+	PxU64	nbParks;	//!< Number of times an idle worker went to sleep.
+	PxU64	nbWakes;	//!< Number of times a sleeping worker was woken up by a task submission.
+};
+
 /**
 \brief A default implementation for a CPU task dispatcher.
 
@@ -74,6 +147,27 @@ public:
 	\return True if tasks should be profiled.
 	*/
 	virtual bool getRunProfiled() const = 0;
+
+	/**
+	\brief Returns the queue mode the dispatcher was created with.
+
+	\return The queue mode.
+
+	@see PxDefaultCpuDispatcherCreate() PxDefaultCpuDispatcherQueueMode
+	*/
+	virtual PxDefaultCpuDispatcherQueueMode::Enum getQueueMode() const = 0;
+
+	/**
+	\brief Retrieves the idle and wake-up counters of the worker threads.
+
+	\note The counters are updated by the worker threads without synchronization, values read while
+	the dispatcher is busy may be slightly out of date.
+
+	\param[out] stats The accumulated counters.
+
+	@see PxDefaultCpuDispatcherStatistics PxDefaultCpuDispatcherWaitForWorkMode
+	*/
+	virtual void getStatistics(PxDefaultCpuDispatcherStatistics& stats) const = 0;
 };
 
 
@@ -82,13 +176,19 @@ public:
 
 \param[in] numThreads Number of worker threads the dispatcher should use.
 \param[in] affinityMasks Array with affinity mask for each thread. If not defined, default masks will be used.
+\param[in] queueMode How tasks are distributed among the worker threads.
+\param[in] waitForWorkMode What idle worker threads do while waiting for tasks.
+\param[in] spinCount Number of times an idle worker polls the task queues before it yields or sleeps. Ignored for PxDefaultCpuDispatcherWaitForWorkMode::eSPIN.
 
 \note numThreads may be zero in which case no worker thread are initialized and
 simulation tasks will be executed on the thread that calls PxScene::simulate()
 
-@see PxDefaultCpuDispatcher
+@see PxDefaultCpuDispatcher PxDefaultCpuDispatcherQueueMode PxDefaultCpuDispatcherWaitForWorkMode
 */
-PxDefaultCpuDispatcher* PxDefaultCpuDispatcherCreate(PxU32 numThreads, PxU32* affinityMasks = NULL);
+PxDefaultCpuDispatcher* PxDefaultCpuDispatcherCreate(PxU32 numThreads, PxU32* affinityMasks = NULL,
+													 PxDefaultCpuDispatcherQueueMode::Enum queueMode = PxDefaultCpuDispatcherQueueMode::eSHARED_QUEUE,
+													 PxDefaultCpuDispatcherWaitForWorkMode::Enum waitForWorkMode = PxDefaultCpuDispatcherWaitForWorkMode::eSPIN_THEN_PARK,
+													 PxU32 spinCount = 0);
 
 #if !PX_DOXYGEN
 } // namespace physx
@@ -61,6 +61,7 @@
 #include "extensions/PxClothMeshQuadifier.h"
 #include "extensions/PxMassProperties.h"
 #include "extensions/PxSceneQueryExt.h"
+#include "extensions/PxTaskGraphExt.h"
 
 /** \brief Initialize the PhysXExtensions library. 
 
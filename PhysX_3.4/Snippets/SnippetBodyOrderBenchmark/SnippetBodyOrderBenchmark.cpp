@@ -0,0 +1,194 @@
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Copyright (c) 2008-2018 NVIDIA Corporation. All rights reserved.
+// Copyright (c) 2004-2008 AGEIA Technologies, Inc. All rights reserved.
+// Copyright (c) 2001-2004 NovodeX AG. All rights reserved.  
+
+// ****************************************************************************
+// This snippet measures how fast the solver gets through a large pile of
+// bodies whose memory layout has no relation to their position. 20480 boxes
+// are created in a shuffled order and dropped onto the ground, where they
+// settle into one large island. The solver reaches the bodies through the
+// contact constraints, so the order in which the solver bodies of an island
+// are laid out decides whether consecutive constraints touch neighbouring
+// memory or jump around the body pool.
+//
+// The pile is stepped on a single thread with a low and a high number of
+// position iterations. Everything except the solver iterations costs the same
+// in both runs, so the difference in step time gives the cost of one solver
+// iteration over the whole pile, which is the part that depends on the body
+// order.
+// ****************************************************************************
+
+#include <stdlib.h>
+
+#include "PxPhysicsAPI.h"
+
+#include "../SnippetUtils/SnippetUtils.h"
+#include "../SnippetCommon/SnippetPrint.h"
+
+using namespace physx;
+
+PxDefaultAllocator		gAllocator;
+PxDefaultErrorCallback	gErrorCallback;
+
+PxFoundation*			gFoundation = NULL;
+PxPhysics*				gPhysics	= NULL;
+PxDefaultCpuDispatcher*	gDispatcher = NULL;
+PxMaterial*				gMaterial	= NULL;
+
+const PxU32				gPileSize			= 32;	// boxes per side of each layer
+const PxU32				gNbLayers			= 20;
+const PxU32				gNbBodies			= gPileSize*gPileSize*gNbLayers;
+const PxU32				gLowIterations		= 4;
+const PxU32				gHighIterations		= 36;
+const PxU32				gNbSettleSteps		= 60;
+const PxU32				gNbTimedSteps		= 30;
+
+// Creates the boxes in a shuffled order, so that neither the actor nor the node indices follow their position.
+static PxScene* createPile()
+{
+	PxSceneDesc sceneDesc(gPhysics->getTolerancesScale());
+	sceneDesc.gravity = PxVec3(0.0f, -9.81f, 0.0f);
+	sceneDesc.cpuDispatcher	= gDispatcher;
+	sceneDesc.filterShader	= PxDefaultSimulationFilterShader;
+	PxScene* scene = gPhysics->createScene(sceneDesc);
+
+	scene->addActor(*PxCreatePlane(*gPhysics, PxPlane(0,1,0,0), *gMaterial));
+
+	PxU32* order = new PxU32[gNbBodies];
+	for(PxU32 i=0; i<gNbBodies; i++)
+		order[i] = i;
+	srand(42);
+	for(PxU32 i=gNbBodies-1; i>0; i--)
+	{
+		const PxU32 j = PxU32(rand())%(i+1);
+		const PxU32 tmp = order[i];
+		order[i] = order[j];
+		order[j] = tmp;
+	}
+
+	PxShape* shape = gPhysics->createShape(PxBoxGeometry(0.5f, 0.5f, 0.5f), *gMaterial);
+	for(PxU32 i=0; i<gNbBodies; i++)
+	{
+		// the layers are slightly offset against each other so that the boxes tumble into a pile
+		const PxU32 index = order[i];
+		const PxU32 layer = index/(gPileSize*gPileSize);
+		const PxReal offset = (layer & 1) ? 0.5f : 0.0f;
+		const PxVec3 pos(	PxReal(index%gPileSize) - PxReal(gPileSize)*0.5f + offset,
+							0.5f + PxReal(layer)*1.2f,
+							PxReal((index/gPileSize)%gPileSize) - PxReal(gPileSize)*0.5f + offset);
+		PxRigidDynamic* body = gPhysics->createRigidDynamic(PxTransform(pos));
+		body->attachShape(*shape);
+		PxRigidBodyExt::updateMassAndInertia(*body, 1.0f);
+		// keep the pile awake so that every step solves the same constraints
+		body->setSleepThreshold(0.0f);
+		body->setSolverIterationCounts(gLowIterations, 1);
+		scene->addActor(*body);
+	}
+	shape->release();
+	delete[] order;
+
+	for(PxU32 i=0; i<gNbSettleSteps; i++)
+	{
+		scene->simulate(1.0f/60.0f);
+		scene->fetchResults(true);
+	}
+
+	return scene;
+}
+
+static void setIterations(PxScene* scene, PxU32 nbPositionIterations)
+{
+	const PxU32 nbActors = scene->getNbActors(PxActorTypeFlag::eRIGID_DYNAMIC);
+	for(PxU32 i=0; i<nbActors; i++)
+	{
+		PxActor* actor;
+		scene->getActors(PxActorTypeFlag::eRIGID_DYNAMIC, &actor, 1, i);
+		static_cast<PxRigidDynamic*>(actor)->setSolverIterationCounts(nbPositionIterations, 1);
+	}
+}
+
+// Returns the duration of the fastest step, in milliseconds. The pile keeps shifting a little, so the fastest step is
+// a steadier measure than the average.
+static PxReal runSteps(PxScene* scene, PxU32 nbPositionIterations)
+{
+	setIterations(scene, nbPositionIterations);
+	// one untimed step to let the solver pick up the new iteration counts
+	scene->simulate(1.0f/60.0f);
+	scene->fetchResults(true);
+
+	PxU64 minTime = ~PxU64(0);
+	for(PxU32 i=0; i<gNbTimedSteps; i++)
+	{
+		const PxU64 startTime = SnippetUtils::getCurrentTimeCounterValue();
+		scene->simulate(1.0f/60.0f);
+		scene->fetchResults(true);
+		minTime = PxMin(minTime, SnippetUtils::getCurrentTimeCounterValue() - startTime);
+	}
+	return SnippetUtils::getElapsedTimeInMilliseconds(minTime);
+}
+
+void initPhysics()
+{
+	gFoundation = PxCreateFoundation(PX_FOUNDATION_VERSION, gAllocator, gErrorCallback);
+	gPhysics = PxCreatePhysics(PX_PHYSICS_VERSION, *gFoundation, PxTolerancesScale());
+	gMaterial = gPhysics->createMaterial(0.5f, 0.5f, 0.0f);
+	gDispatcher = PxDefaultCpuDispatcherCreate(0);
+}
+
+void cleanupPhysics()
+{
+	gDispatcher->release();
+	gPhysics->release();
+	gFoundation->release();
+
+	printf("SnippetBodyOrderBenchmark done.\n");
+}
+
+int snippetMain(int, const char*const*)
+{
+	initPhysics();
+
+	PxScene* scene = createPile();
+
+	const PxReal lowTime = runSteps(scene, gLowIterations);
+	const PxReal highTime = runSteps(scene, gHighIterations);
+
+	PxSimulationStatistics stats;
+	scene->getSimulationStatistics(stats);
+
+	const PxReal iterationTime = (highTime - lowTime)/PxReal(gHighIterations - gLowIterations);
+	printf("%d bodies, %d contact pairs\n", gNbBodies, stats.nbDiscreteContactPairsTotal);
+	printf("%.3f ms/step at %d iterations, %.3f ms/step at %d iterations, %.3f ms per solver iteration\n",
+		double(lowTime), gLowIterations, double(highTime), gHighIterations, double(iterationTime));
+
+	scene->release();
+
+	cleanupPhysics();
+
+	return 0;
+}
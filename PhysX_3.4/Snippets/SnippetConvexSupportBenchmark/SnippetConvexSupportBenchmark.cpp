@@ -0,0 +1,289 @@
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Copyright (c) 2008-2018 NVIDIA Corporation. All rights reserved.
+// Copyright (c) 2004-2008 AGEIA Technologies, Inc. All rights reserved.
+// Copyright (c) 2001-2004 NovodeX AG. All rights reserved.  
+
+// ****************************************************************************
+// This snippet measures how fast the support mapping of large convex hulls is.
+// Round hulls with 32, 64, 128 and 255 vertices are cooked from rings of
+// points on a sphere. Hulls above the gauss map limit (32 vertices by default)
+// carry hill climbing data. The SDK searches hulls of up to 32 vertices with a
+// 4-wide brute force search and larger hulls by hill climbing.
+//
+// Each hull size is measured in two ways:
+// - Overlap queries between two copies of the hull at a fixed set of random
+//   poses where the hulls are just touching or just apart. The query is a
+//   plain GJK run, which calls the support mapping of both hulls in every
+//   iteration, so the time per query follows its cost.
+// - A pile of hulls dropped onto the ground with PCM, stepped on a single
+//   thread. Rolling hulls keep changing their relative poses, so the PCM
+//   convex path has to rerun GJK.
+// ****************************************************************************
+
+#include <stdlib.h>
+
+#include "PxPhysicsAPI.h"
+
+#include "../SnippetUtils/SnippetUtils.h"
+#include "../SnippetCommon/SnippetPrint.h"
+
+using namespace physx;
+
+PxDefaultAllocator		gAllocator;
+PxDefaultErrorCallback	gErrorCallback;
+
+PxFoundation*			gFoundation = NULL;
+PxPhysics*				gPhysics	= NULL;
+PxCooking*				gCooking	= NULL;
+PxDefaultCpuDispatcher*	gDispatcher = NULL;
+PxMaterial*				gMaterial	= NULL;
+
+const PxU32				gHullRings[]		= { 4, 8, 8, 15 };		// 32, 64, 128 and 255 vertices
+const PxU32				gHullSegments[]		= { 8, 8, 16, 17 };
+const PxReal			gHullRadius			= 0.5f;
+const PxU32				gNbQueryPoses		= 4096;
+const PxU32				gNbQueryPasses		= 20;
+const PxU32				gPileSize			= 16;	// hulls per side of each layer
+const PxU32				gNbLayers			= 4;
+const PxU32				gNbPileSteps		= 180;
+
+static PxReal randFloat(PxReal loVal, PxReal hiVal)
+{
+	return loVal + (PxReal(rand())/PxReal(RAND_MAX))*(hiVal - loVal);
+}
+
+static PxQuat randRotation()
+{
+	// uniform enough for a benchmark: normalized random quaternion
+	PxQuat q(randFloat(-1.0f, 1.0f), randFloat(-1.0f, 1.0f), randFloat(-1.0f, 1.0f), randFloat(-1.0f, 1.0f));
+	if(q.magnitudeSquared() < 1e-4f)
+		q = PxQuat(PxIdentity);
+	return q.getNormalized();
+}
+
+static void addPolygon(const PxVec3* verts, const PxU32* polygonIndices, PxU32 nbPolygonVerts, PxHullPolygon* polygons, PxU32& nbPolygons,
+					   PxU32* indices, PxU32& nbIndices)
+{
+	PxVec3 normal = (verts[polygonIndices[1]] - verts[polygonIndices[0]]).cross(verts[polygonIndices[2]] - verts[polygonIndices[0]]);
+	normal.normalize();
+
+	PxHullPolygon& polygon = polygons[nbPolygons++];
+	polygon.mPlane[0]	= normal.x;
+	polygon.mPlane[1]	= normal.y;
+	polygon.mPlane[2]	= normal.z;
+	polygon.mPlane[3]	= -normal.dot(verts[polygonIndices[0]]);
+	polygon.mNbVerts	= PxU16(nbPolygonVerts);
+	polygon.mIndexBase	= PxU16(nbIndices);
+	for(PxU32 i=0; i<nbPolygonVerts; i++)
+		indices[nbIndices++] = polygonIndices[i];
+}
+
+// Cooks a round hull from nbRings rings of nbSegments vertices each, stacked along a sphere. Computing the hull from the points
+// would triangulate it and run into the limit of 255 polygons long before 255 vertices, so the polygons are given directly:
+// neighbouring rings form planar quads and the outer rings are closed by two caps.
+static PxConvexMesh* createRoundHull(PxU32 nbRings, PxU32 nbSegments)
+{
+	const PxU32 nbVerts = nbRings*nbSegments;
+	PxVec3* verts = new PxVec3[nbVerts];
+	for(PxU32 i=0; i<nbRings; i++)
+	{
+		const PxReal theta = PxPi*(PxReal(i) + 0.5f)/PxReal(nbRings);
+		for(PxU32 j=0; j<nbSegments; j++)
+		{
+			const PxReal phi = PxTwoPi*PxReal(j)/PxReal(nbSegments);
+			verts[i*nbSegments + j] = PxVec3(PxSin(theta)*PxCos(phi), PxCos(theta), PxSin(theta)*PxSin(phi))*gHullRadius;
+		}
+	}
+
+	PxHullPolygon* polygons = new PxHullPolygon[(nbRings - 1)*nbSegments + 2];
+	PxU32* indices = new PxU32[(nbRings - 1)*nbSegments*4 + nbSegments*2];
+	PxU32* polygonIndices = new PxU32[nbSegments];
+	PxU32 nbPolygons = 0;
+	PxU32 nbIndices = 0;
+
+	// caps, wound counter-clockwise seen from outside
+	for(PxU32 j=0; j<nbSegments; j++)
+		polygonIndices[j] = nbSegments - 1 - j;
+	addPolygon(verts, polygonIndices, nbSegments, polygons, nbPolygons, indices, nbIndices);
+	for(PxU32 j=0; j<nbSegments; j++)
+		polygonIndices[j] = (nbRings - 1)*nbSegments + j;
+	addPolygon(verts, polygonIndices, nbSegments, polygons, nbPolygons, indices, nbIndices);
+
+	for(PxU32 i=0; i<nbRings-1; i++)
+	{
+		for(PxU32 j=0; j<nbSegments; j++)
+		{
+			const PxU32 next = (j + 1)%nbSegments;
+			const PxU32 quad[4] = { i*nbSegments + j, i*nbSegments + next, (i + 1)*nbSegments + next, (i + 1)*nbSegments + j };
+			addPolygon(verts, quad, 4, polygons, nbPolygons, indices, nbIndices);
+		}
+	}
+
+	PxConvexMeshDesc desc;
+	desc.points.data		= verts;
+	desc.points.count		= nbVerts;
+	desc.points.stride		= sizeof(PxVec3);
+	desc.polygons.data		= polygons;
+	desc.polygons.count		= nbPolygons;
+	desc.polygons.stride	= sizeof(PxHullPolygon);
+	desc.indices.data		= indices;
+	desc.indices.count		= nbIndices;
+	desc.indices.stride		= sizeof(PxU32);
+
+	PxConvexMesh* convex = gCooking->createConvexMesh(desc, gPhysics->getPhysicsInsertionCallback());
+	delete[] polygonIndices;
+	delete[] indices;
+	delete[] polygons;
+	delete[] verts;
+	return convex;
+}
+
+// Returns the fastest pass over all poses, in microseconds per query.
+static PxReal runQueries(const PxConvexMeshGeometry& geom, PxU32& nbOverlaps)
+{
+	PxTransform* poses = new PxTransform[gNbQueryPoses];
+	srand(42);
+	for(PxU32 i=0; i<gNbQueryPoses; i++)
+	{
+		// the hulls are just touching or just apart, where GJK needs the most iterations
+		const PxVec3 dir = randRotation().rotate(PxVec3(1.0f, 0.0f, 0.0f));
+		poses[i] = PxTransform(dir*randFloat(1.9f, 2.05f)*gHullRadius, randRotation());
+	}
+
+	const PxTransform pose0(PxIdentity);
+	PxU64 minTime = ~PxU64(0);
+	for(PxU32 pass=0; pass<gNbQueryPasses; pass++)
+	{
+		nbOverlaps = 0;
+		const PxU64 startTime = SnippetUtils::getCurrentTimeCounterValue();
+		for(PxU32 i=0; i<gNbQueryPoses; i++)
+		{
+			if(PxGeometryQuery::overlap(geom, pose0, geom, poses[i]))
+				nbOverlaps++;
+		}
+		minTime = PxMin(minTime, SnippetUtils::getCurrentTimeCounterValue() - startTime);
+	}
+	delete[] poses;
+
+	return SnippetUtils::getElapsedTimeInMilliseconds(minTime)*1000.0f/PxReal(gNbQueryPoses);
+}
+
+// Drops a pile of hulls onto the ground and returns the average step time, in milliseconds.
+static PxReal runPile(const PxConvexMeshGeometry& geom, PxU32& nbPairs)
+{
+	PxSceneDesc sceneDesc(gPhysics->getTolerancesScale());
+	sceneDesc.gravity = PxVec3(0.0f, -9.81f, 0.0f);
+	sceneDesc.cpuDispatcher	= gDispatcher;
+	sceneDesc.filterShader	= PxDefaultSimulationFilterShader;
+	sceneDesc.flags |= PxSceneFlag::eENABLE_PCM;
+	PxScene* scene = gPhysics->createScene(sceneDesc);
+
+	scene->addActor(*PxCreatePlane(*gPhysics, PxPlane(0,1,0,0), *gMaterial));
+
+	srand(42);
+	PxShape* shape = gPhysics->createShape(geom, *gMaterial);
+	for(PxU32 layer=0; layer<gNbLayers; layer++)
+	{
+		// the layers are offset against each other so that the hulls roll off one another
+		const PxReal offset = (layer & 1) ? 0.5f : 0.0f;
+		for(PxU32 i=0; i<gPileSize; i++)
+		{
+			for(PxU32 j=0; j<gPileSize; j++)
+			{
+				const PxVec3 pos(	(PxReal(i) - PxReal(gPileSize)*0.5f + offset)*2.1f*gHullRadius,
+									gHullRadius + PxReal(layer)*2.4f*gHullRadius,
+									(PxReal(j) - PxReal(gPileSize)*0.5f + offset)*2.1f*gHullRadius);
+				PxRigidDynamic* body = gPhysics->createRigidDynamic(PxTransform(pos, randRotation()));
+				body->attachShape(*shape);
+				PxRigidBodyExt::updateMassAndInertia(*body, 1.0f);
+				scene->addActor(*body);
+			}
+		}
+	}
+	shape->release();
+
+	nbPairs = 0;
+	const PxU64 startTime = SnippetUtils::getCurrentTimeCounterValue();
+	for(PxU32 i=0; i<gNbPileSteps; i++)
+	{
+		scene->simulate(1.0f/60.0f);
+		scene->fetchResults(true);
+
+		PxSimulationStatistics stats;
+		scene->getSimulationStatistics(stats);
+		nbPairs = PxMax(nbPairs, stats.nbDiscreteContactPairsTotal);
+	}
+	const PxReal time = SnippetUtils::getElapsedTimeInMilliseconds(SnippetUtils::getCurrentTimeCounterValue() - startTime);
+
+	scene->release();
+
+	return time/PxReal(gNbPileSteps);
+}
+
+void initPhysics()
+{
+	gFoundation = PxCreateFoundation(PX_FOUNDATION_VERSION, gAllocator, gErrorCallback);
+	gPhysics = PxCreatePhysics(PX_PHYSICS_VERSION, *gFoundation, PxTolerancesScale());
+	gCooking = PxCreateCooking(PX_PHYSICS_VERSION, *gFoundation, PxCookingParams(PxTolerancesScale()));
+	gMaterial = gPhysics->createMaterial(0.5f, 0.5f, 0.0f);
+	gDispatcher = PxDefaultCpuDispatcherCreate(0);
+}
+
+void cleanupPhysics()
+{
+	gDispatcher->release();
+	gCooking->release();
+	gPhysics->release();
+	gFoundation->release();
+
+	printf("SnippetConvexSupportBenchmark done.\n");
+}
+
+int snippetMain(int, const char*const*)
+{
+	initPhysics();
+
+	for(PxU32 i=0; i<sizeof(gHullRings)/sizeof(gHullRings[0]); i++)
+	{
+		PxConvexMesh* convex = createRoundHull(gHullRings[i], gHullSegments[i]);
+		const PxConvexMeshGeometry geom(convex);
+
+		PxU32 nbOverlaps;
+		const PxReal queryTime = runQueries(geom, nbOverlaps);
+		PxU32 nbPairs;
+		const PxReal pileTime = runPile(geom, nbPairs);
+
+		printf("%d vertices: %.3f us per overlap query (%d of %d overlap), %.3f ms/step for a pile of %d hulls (%d contact pairs)\n",
+			convex->getNbVertices(), double(queryTime), nbOverlaps, gNbQueryPoses, double(pileTime), gPileSize*gPileSize*gNbLayers, nbPairs);
+
+		convex->release();
+	}
+
+	cleanupPhysics();
+
+	return 0;
+}
@@ -0,0 +1,163 @@
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Copyright (c) 2008-2018 NVIDIA Corporation. All rights reserved.
+// Copyright (c) 2004-2008 AGEIA Technologies, Inc. All rights reserved.
+// Copyright (c) 2001-2004 NovodeX AG. All rights reserved.  
+
+
+// ****************************************************************************
+// This snippet measures how the simulation scales with the number of worker
+// threads of the default CPU dispatcher, for both of its queue modes. The
+// same scene of box piles is simulated with 0, 1, 2, 4 ... worker threads
+// (up to the number of physical cores, or the count passed on the command
+// line) and the average time per step is printed for the shared queue and
+// the work-stealing queue. Sleeping is disabled so that every step does the
+// same amount of work.
+// ****************************************************************************
+
+#include <stdlib.h>
+
+#include "PxPhysicsAPI.h"
+
+#include "../SnippetUtils/SnippetUtils.h"
+#include "../SnippetCommon/SnippetPrint.h"
+
+using namespace physx;
+
+PxDefaultAllocator		gAllocator;
+PxDefaultErrorCallback	gErrorCallback;
+
+PxFoundation*			gFoundation = NULL;
+PxPhysics*				gPhysics	= NULL;
+PxMaterial*				gMaterial	= NULL;
+
+const PxU32				gNbPiles		= 16;
+const PxU32				gPileSize		= 10;
+const PxU32				gNbWarmupSteps	= 60;
+const PxU32				gNbTimedSteps	= 120;
+
+static void createPile(PxScene& scene, const PxVec3& pos, PxU32 size, PxReal halfExtent)
+{
+	PxShape* shape = gPhysics->createShape(PxBoxGeometry(halfExtent, halfExtent, halfExtent), *gMaterial);
+	for(PxU32 i=0; i<size; i++)
+	{
+		for(PxU32 j=0; j<size-i; j++)
+		{
+			for(PxU32 k=0; k<size-i; k++)
+			{
+				const PxVec3 localPos(PxReal(j*2) - PxReal(size-i), PxReal(i*2+1), PxReal(k*2) - PxReal(size-i));
+				PxRigidDynamic* body = gPhysics->createRigidDynamic(PxTransform(pos + localPos*halfExtent));
+				body->attachShape(*shape);
+				body->setSleepThreshold(0.0f);
+				PxRigidBodyExt::updateMassAndInertia(*body, 10.0f);
+				scene.addActor(*body);
+			}
+		}
+	}
+	shape->release();
+}
+
+// Returns the average duration of a simulation step, in milliseconds.
+static PxReal runScene(PxU32 nbThreads, PxDefaultCpuDispatcherQueueMode::Enum queueMode)
+{
+	PxDefaultCpuDispatcher* dispatcher = PxDefaultCpuDispatcherCreate(nbThreads, NULL, queueMode);
+
+	PxSceneDesc sceneDesc(gPhysics->getTolerancesScale());
+	sceneDesc.gravity		= PxVec3(0.0f, -9.81f, 0.0f);
+	sceneDesc.cpuDispatcher	= dispatcher;
+	sceneDesc.filterShader	= PxDefaultSimulationFilterShader;
+	PxScene* scene = gPhysics->createScene(sceneDesc);
+
+	PxRigidStatic* groundPlane = PxCreatePlane(*gPhysics, PxPlane(0,1,0,0), *gMaterial);
+	scene->addActor(*groundPlane);
+
+	const PxU32 nbPilesPerRow = 4;
+	for(PxU32 i=0; i<gNbPiles; i++)
+		createPile(*scene, PxVec3(PxReal(i%nbPilesPerRow)*30.0f, 0.0f, PxReal(i/nbPilesPerRow)*30.0f), gPileSize, 1.0f);
+
+	for(PxU32 i=0; i<gNbWarmupSteps; i++)
+	{
+		scene->simulate(1.0f/60.0f);
+		scene->fetchResults(true);
+	}
+
+	const PxU64 startTime = SnippetUtils::getCurrentTimeCounterValue();
+	for(PxU32 i=0; i<gNbTimedSteps; i++)
+	{
+		scene->simulate(1.0f/60.0f);
+		scene->fetchResults(true);
+	}
+	const PxU64 elapsedTime = SnippetUtils::getCurrentTimeCounterValue() - startTime;
+
+	scene->release();
+	dispatcher->release();
+
+	return SnippetUtils::getElapsedTimeInMilliseconds(elapsedTime)/PxReal(gNbTimedSteps);
+}
+
+void initPhysics()
+{
+	gFoundation = PxCreateFoundation(PX_FOUNDATION_VERSION, gAllocator, gErrorCallback);
+	gPhysics = PxCreatePhysics(PX_PHYSICS_VERSION, *gFoundation, PxTolerancesScale());
+	gMaterial = gPhysics->createMaterial(0.5f, 0.5f, 0.1f);
+}
+
+void cleanupPhysics()
+{
+	gPhysics->release();
+	gFoundation->release();
+
+	printf("SnippetDispatcherBenchmark done.\n");
+}
+
+int snippetMain(int argc, const char*const* argv)
+{
+	initPhysics();
+
+	const PxU32 nbCores = SnippetUtils::getNbPhysicalCores();
+	PxU32 maxThreads = nbCores == 0 ? 1 : nbCores;
+	if(argc > 1)
+		maxThreads = PxMax(PxU32(atoi(argv[1])), 1u);
+
+	printf("%d piles of %d bodies, %d timed steps\n", gNbPiles, gPileSize*(gPileSize+1)*(2*gPileSize+1)/6, gNbTimedSteps);
+	printf("threads   shared queue (ms/step)   work stealing (ms/step)\n");
+
+	PxU32 nbThreads = 0;
+	for(;;)
+	{
+		const PxReal sharedTime = runScene(nbThreads, PxDefaultCpuDispatcherQueueMode::eSHARED_QUEUE);
+		const PxReal stealingTime = runScene(nbThreads, PxDefaultCpuDispatcherQueueMode::eWORK_STEALING);
+		printf("%7d   %22.3f   %23.3f\n", nbThreads, double(sharedTime), double(stealingTime));
+
+		if(nbThreads == maxThreads)
+			break;
+		nbThreads = nbThreads ? PxMin(nbThreads*2, maxThreads) : 1;
+	}
+
+	cleanupPhysics();
+
+	return 0;
+}
@@ -0,0 +1,320 @@
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Copyright (c) 2008-2018 NVIDIA Corporation. All rights reserved.
+// Copyright (c) 2004-2008 AGEIA Technologies, Inc. All rights reserved.
+// Copyright (c) 2001-2004 NovodeX AG. All rights reserved.  
+
+// ****************************************************************************
+// This snippet measures how long the island manager takes to re-validate
+// islands that lost edges. Long chains of touching boxes float in zero gravity,
+// and in every step a few boxes are lifted out of each chain while the ones of
+// the previous step are put back. Each chain is merged into one island and cut
+// into several long islands again in every step. Finding out whether the two
+// sides of a cut are still connected means walking along the chain, which is
+// the expensive case for the island manager.
+//
+// The scene is driven by a dispatcher that wraps the default CPU dispatcher and
+// timestamps the third-pass island generation tasks. The wall-clock time from
+// the start of the first of these tasks to the end of the last one is reported
+// per step. The scene is run twice: once with the real worker count, which
+// lets the islands be repaired by several tasks, and once with the dispatcher
+// reporting a single worker, which makes the island manager use its serial
+// path. The same worker threads run the tasks in both cases.
+//
+// The parallel repair is only compiled in when the SDK is built with
+// IG_PARALLEL_ISLAND_REPAIR defined to 1, see PxsIslandSim.cpp. Otherwise both
+// runs use the serial path.
+// ****************************************************************************
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "PxPhysicsAPI.h"
+
+#include "../SnippetUtils/SnippetUtils.h"
+#include "../SnippetCommon/SnippetPrint.h"
+
+using namespace physx;
+
+PxDefaultAllocator		gAllocator;
+PxDefaultErrorCallback	gErrorCallback;
+
+PxFoundation*			gFoundation = NULL;
+PxPhysics*				gPhysics	= NULL;
+PxMaterial*				gMaterial	= NULL;
+
+const PxU32				gNbChains		= 32;
+const PxU32				gChainLength	= 1024;
+const PxU32				gCutSpacing		= 128;	// boxes between two cuts of a chain
+const PxU32				gNbBodies		= gNbChains*gChainLength;
+const PxU32				gNbWarmupSteps	= 20;
+const PxU32				gNbTimedSteps	= 100;
+const PxU32				gMaxTimedTasks	= 8192;
+
+// Runs a task and records when the island generation tasks start and end.
+class TimedTask : public PxBaseTask
+{
+public:
+	void set(PxBaseTask& task, class TimingDispatcher& dispatcher)
+	{
+		mTask = &task;
+		mDispatcher = &dispatcher;
+		setContextId(task.getContextId());
+	}
+
+	virtual void		run();
+	virtual const char*	getName()			const	{ return mTask->getName();			}
+	virtual void		addReference()				{ mTask->addReference();			}
+	virtual void		removeReference()			{ mTask->removeReference();			}
+	virtual int32_t		getReference()		const	{ return mTask->getReference();		}
+	virtual void		release()					{ mTask->release();					}
+
+private:
+	PxBaseTask*					mTask;
+	class TimingDispatcher*		mDispatcher;
+};
+
+class TimingDispatcher : public PxCpuDispatcher
+{
+public:
+	TimingDispatcher(PxDefaultCpuDispatcher& dispatcher, PxU32 reportedWorkerCount) :
+		mDispatcher(dispatcher), mReportedWorkerCount(reportedWorkerCount), mNbTasks(0)
+	{
+		mMutex = SnippetUtils::mutexCreate();
+		resetFrame();
+	}
+
+	~TimingDispatcher()
+	{
+		SnippetUtils::mutexRelease(mMutex);
+	}
+
+	virtual void submitTask(PxBaseTask& task)
+	{
+		const PxI32 index = SnippetUtils::atomicIncrement(&mNbTasks) - 1;
+		if(index >= PxI32(gMaxTimedTasks))
+		{
+			// out of wrappers, run the task untimed
+			mDispatcher.submitTask(task);
+			return;
+		}
+		mTasks[index].set(task, *this);
+		mDispatcher.submitTask(mTasks[index]);
+	}
+
+	virtual uint32_t getWorkerCount() const
+	{
+		return mReportedWorkerCount;
+	}
+
+	// Must be called between two steps, when no task is in flight.
+	void resetFrame()
+	{
+		mNbTasks = 0;
+		mIslandGenStart = ~PxU64(0);
+		mIslandGenEnd = 0;
+	}
+
+	// Duration of the third-pass island generation of the last step, in milliseconds.
+	PxReal getIslandGenTime() const
+	{
+		return mIslandGenEnd > mIslandGenStart ? SnippetUtils::getElapsedTimeInMilliseconds(mIslandGenEnd - mIslandGenStart) : 0.0f;
+	}
+
+	void recordIslandGenTask(PxU64 start, PxU64 end)
+	{
+		SnippetUtils::mutexLock(mMutex);
+		mIslandGenStart = PxMin(mIslandGenStart, start);
+		mIslandGenEnd = PxMax(mIslandGenEnd, end);
+		SnippetUtils::mutexUnlock(mMutex);
+	}
+
+private:
+	PxDefaultCpuDispatcher&		mDispatcher;
+	const PxU32					mReportedWorkerCount;
+	SnippetUtils::Mutex*		mMutex;
+	volatile PxI32				mNbTasks;
+	PxU64						mIslandGenStart;
+	PxU64						mIslandGenEnd;
+	TimedTask					mTasks[gMaxTimedTasks];
+};
+
+static bool isIslandGenTask(const char* name)
+{
+	return !strcmp(name, "ThirdPassIslandGenTask") || !strcmp(name, "IslandRepairTask") || !strcmp(name, "ThirdPassFinishTask");
+}
+
+void TimedTask::run()
+{
+	if(!isIslandGenTask(mTask->getName()))
+	{
+		mTask->run();
+		return;
+	}
+
+	const PxU64 start = SnippetUtils::getCurrentTimeCounterValue();
+	mTask->run();
+	mDispatcher->recordIslandGenTask(start, SnippetUtils::getCurrentTimeCounterValue());
+}
+
+static PxVec3 getGridPosition(PxU32 index)
+{
+	return PxVec3(PxReal(index%gChainLength), 0.0f, PxReal(index/gChainLength)*4.0f);
+}
+
+static void createChains(PxScene& scene, PxRigidDynamic** bodies)
+{
+	PxShape* shape = gPhysics->createShape(PxBoxGeometry(0.5f, 0.5f, 0.5f), *gMaterial);
+	for(PxU32 i=0; i<gNbBodies; i++)
+	{
+		PxRigidDynamic* body = gPhysics->createRigidDynamic(PxTransform(getGridPosition(i)));
+		body->attachShape(*shape);
+		body->setSleepThreshold(0.0f);
+		PxRigidBodyExt::updateMassAndInertia(*body, 1.0f);
+		scene.addActor(*body);
+		bodies[i] = body;
+	}
+	shape->release();
+}
+
+// In each step, a few boxes are lifted out of every chain. They move along the chain from step to step.
+static bool isLifted(PxU32 index, PxU32 step)
+{
+	return ((index%gChainLength) + step*37)%gCutSpacing == 0;
+}
+
+// Lifts the boxes of the current step out of each chain and puts the previous ones back. Lifting the boxes cuts the
+// chain into several islands, and putting them back merges them again, so every step splits long islands.
+static void updateChains(PxRigidDynamic** bodies, PxU32 step)
+{
+	for(PxU32 i=0; i<gNbBodies; i++)
+	{
+		const bool lifted = isLifted(i, step);
+		if(!lifted && (step == 0 || !isLifted(i, step-1)))
+			continue;
+
+		PxRigidDynamic* body = bodies[i];
+		body->setGlobalPose(PxTransform(getGridPosition(i) + PxVec3(0.0f, lifted ? 2.0f : 0.0f, 0.0f)));
+		body->setLinearVelocity(PxVec3(0.0f));
+		body->setAngularVelocity(PxVec3(0.0f));
+	}
+}
+
+struct Timings
+{
+	PxReal	islandGenTime;	// ms per step
+	PxReal	stepTime;		// ms per step
+};
+
+static Timings runScene(PxDefaultCpuDispatcher& workers, PxU32 reportedWorkerCount)
+{
+	TimingDispatcher* dispatcher = new TimingDispatcher(workers, reportedWorkerCount);
+
+	PxSceneDesc sceneDesc(gPhysics->getTolerancesScale());
+	sceneDesc.gravity		= PxVec3(0.0f);
+	sceneDesc.cpuDispatcher	= dispatcher;
+	sceneDesc.filterShader	= PxDefaultSimulationFilterShader;
+	// the chains are rows of boxes with equal coordinates, which the default sweep-and-prune handles poorly
+	sceneDesc.broadPhaseType = PxBroadPhaseType::eMBP;
+	PxScene* scene = gPhysics->createScene(sceneDesc);
+
+	const PxVec3 chainsEnd = getGridPosition(gNbBodies-1);
+	PxBounds3 regions[16];
+	const PxU32 nbRegions = PxBroadPhaseExt::createRegionsFromWorldBounds(regions, PxBounds3(PxVec3(-4.0f), chainsEnd + PxVec3(4.0f)), 4);
+	for(PxU32 i=0; i<nbRegions; i++)
+	{
+		PxBroadPhaseRegion region;
+		region.bounds = regions[i];
+		region.userData = NULL;
+		scene->addBroadPhaseRegion(region);
+	}
+
+	PxRigidDynamic** bodies = new PxRigidDynamic*[gNbBodies];
+	createChains(*scene, bodies);
+
+	Timings timings = { 0.0f, 0.0f };
+	PxU64 elapsedTime = 0;
+	for(PxU32 i=0; i<gNbWarmupSteps+gNbTimedSteps; i++)
+	{
+		updateChains(bodies, i);
+		dispatcher->resetFrame();
+
+		const PxU64 startTime = SnippetUtils::getCurrentTimeCounterValue();
+		scene->simulate(1.0f/60.0f);
+		scene->fetchResults(true);
+		if(i >= gNbWarmupSteps)
+		{
+			elapsedTime += SnippetUtils::getCurrentTimeCounterValue() - startTime;
+			timings.islandGenTime += dispatcher->getIslandGenTime();
+		}
+	}
+	timings.islandGenTime /= PxReal(gNbTimedSteps);
+	timings.stepTime = SnippetUtils::getElapsedTimeInMilliseconds(elapsedTime)/PxReal(gNbTimedSteps);
+
+	delete[] bodies;
+	scene->release();
+	delete dispatcher;
+
+	return timings;
+}
+
+void initPhysics()
+{
+	gFoundation = PxCreateFoundation(PX_FOUNDATION_VERSION, gAllocator, gErrorCallback);
+	gPhysics = PxCreatePhysics(PX_PHYSICS_VERSION, *gFoundation, PxTolerancesScale());
+	gMaterial = gPhysics->createMaterial(0.5f, 0.5f, 0.0f);
+}
+
+void cleanupPhysics()
+{
+	gPhysics->release();
+	gFoundation->release();
+
+	printf("SnippetIslandSplitBenchmark done.\n");
+}
+
+int snippetMain(int argc, const char*const* argv)
+{
+	initPhysics();
+
+	// the island repair needs at least two workers, the worker count can be passed on the command line
+	PxU32 nbThreads = PxMax(SnippetUtils::getNbPhysicalCores(), 2u);
+	if(argc > 1)
+		nbThreads = PxMax(PxU32(atoi(argv[1])), 2u);
+	PxDefaultCpuDispatcher* workers = PxDefaultCpuDispatcherCreate(nbThreads);
+
+	const Timings serial = runScene(*workers, 1);
+	const Timings parallel = runScene(*workers, nbThreads);
+
+	printf("%d chains of %d boxes, %d worker threads, %d timed steps\n", gNbChains, gChainLength, nbThreads, gNbTimedSteps);
+	printf("serial island repair:   %8.3f ms/step island generation, %8.3f ms/step total\n", double(serial.islandGenTime), double(serial.stepTime));
+	printf("parallel island repair: %8.3f ms/step island generation, %8.3f ms/step total\n", double(parallel.islandGenTime), double(parallel.stepTime));
+
+	workers->release();
+	cleanupPhysics();
+
+	return 0;
+}
@@ -0,0 +1,244 @@
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Copyright (c) 2008-2018 NVIDIA Corporation. All rights reserved.
+// Copyright (c) 2004-2008 AGEIA Technologies, Inc. All rights reserved.
+// Copyright (c) 2001-2004 NovodeX AG. All rights reserved.  
+
+// ****************************************************************************
+// This snippet measures how contact generation for a few large shapes moving
+// over a detailed triangle mesh scales with the number of worker threads. Two
+// boxes and two convex hulls, each several meters wide, glide over a flat
+// ground mesh made of 5cm cells, so every pair overlaps thousands of triangles.
+// They float just above the ground, within their contact offset and without
+// gravity, so that they keep moving and every pair regenerates its contacts in
+// every step instead of catching on triangle edges and coming to rest. With
+// PCM, the narrow phase hands the triangles of such a pair beyond the first
+// few hundred to all workers in ranges of 128, instead of running the whole
+// pair on a single worker.
+//
+// The same scene is stepped with 0 (everything runs on the calling thread), 1,
+// 2 and 4 worker threads. There are only four mesh pairs, so without the split
+// the step time could not drop below the time of the largest pair, no matter
+// how many workers are available.
+// ****************************************************************************
+
+#include "PxPhysicsAPI.h"
+
+#include "../SnippetUtils/SnippetUtils.h"
+#include "../SnippetCommon/SnippetPrint.h"
+
+using namespace physx;
+
+PxDefaultAllocator		gAllocator;
+PxDefaultErrorCallback	gErrorCallback;
+
+PxFoundation*			gFoundation = NULL;
+PxPhysics*				gPhysics	= NULL;
+PxCooking*				gCooking	= NULL;
+PxMaterial*				gMaterial	= NULL;
+PxTriangleMesh*			gMesh		= NULL;
+PxConvexMesh*			gConvex		= NULL;
+
+const PxU32				gGridSize			= 512;		// cells per side of the ground mesh
+const PxReal			gCellSize			= 0.05f;
+const PxReal			gShapeSize			= 2.0f;		// half width of the boxes and radius of the hulls
+const PxReal			gHoverHeight		= 0.05f;	// gap between the shapes and the ground
+const PxReal			gContactOffset		= 0.1f;
+const PxU32				gWorkerCounts[]		= { 0, 1, 2, 4 };
+const PxU32				gNbSettleSteps		= 30;
+const PxU32				gNbTimedSteps		= 30;
+
+// Flat ground made of gGridSize*gGridSize square cells, two triangles each.
+static PxTriangleMesh* createGroundMesh()
+{
+	const PxU32 nbVertsPerSide = gGridSize + 1;
+	const PxU32 nbVerts = nbVertsPerSide*nbVertsPerSide;
+	const PxU32 nbTriangles = gGridSize*gGridSize*2;
+	const PxReal offset = PxReal(gGridSize)*gCellSize*0.5f;
+
+	PxVec3* verts = new PxVec3[nbVerts];
+	for(PxU32 i=0; i<nbVertsPerSide; i++)
+	{
+		for(PxU32 j=0; j<nbVertsPerSide; j++)
+			verts[i*nbVertsPerSide + j] = PxVec3(PxReal(i)*gCellSize - offset, 0.0f, PxReal(j)*gCellSize - offset);
+	}
+
+	PxU32* indices = new PxU32[nbTriangles*3];
+	PxU32* index = indices;
+	for(PxU32 i=0; i<gGridSize; i++)
+	{
+		for(PxU32 j=0; j<gGridSize; j++)
+		{
+			const PxU32 v0 = i*nbVertsPerSide + j;
+			const PxU32 v1 = v0 + 1;
+			const PxU32 v2 = v0 + nbVertsPerSide;
+			const PxU32 v3 = v2 + 1;
+			*index++ = v0;	*index++ = v1;	*index++ = v2;
+			*index++ = v1;	*index++ = v3;	*index++ = v2;
+		}
+	}
+
+	PxTriangleMeshDesc meshDesc;
+	meshDesc.points.data		= verts;
+	meshDesc.points.count		= nbVerts;
+	meshDesc.points.stride		= sizeof(PxVec3);
+	meshDesc.triangles.data		= indices;
+	meshDesc.triangles.count	= nbTriangles;
+	meshDesc.triangles.stride	= sizeof(PxU32)*3;
+
+	PxCookingParams params = gCooking->getParams();
+	params.midphaseDesc = PxMeshMidPhase::eBVH34;
+	gCooking->setParams(params);
+
+	PxTriangleMesh* mesh = gCooking->createTriangleMesh(meshDesc, gPhysics->getPhysicsInsertionCallback());
+	delete[] indices;
+	delete[] verts;
+	return mesh;
+}
+
+// Flat round slab, so that its whole bottom face touches the ground.
+static PxConvexMesh* createSlab()
+{
+	const PxU32 nbSegments = 16;
+	PxVec3 verts[nbSegments*2];
+	for(PxU32 i=0; i<nbSegments; i++)
+	{
+		const PxReal phi = PxTwoPi*PxReal(i)/PxReal(nbSegments);
+		verts[i] = PxVec3(PxCos(phi)*gShapeSize, -0.25f, PxSin(phi)*gShapeSize);
+		verts[i + nbSegments] = PxVec3(PxCos(phi)*gShapeSize, 0.25f, PxSin(phi)*gShapeSize);
+	}
+
+	PxConvexMeshDesc convexDesc;
+	convexDesc.points.data		= verts;
+	convexDesc.points.count		= nbSegments*2;
+	convexDesc.points.stride	= sizeof(PxVec3);
+	convexDesc.flags			= PxConvexFlag::eCOMPUTE_CONVEX;
+
+	return gCooking->createConvexMesh(convexDesc, gPhysics->getPhysicsInsertionCallback());
+}
+
+static PxScene* createScene(PxCpuDispatcher* dispatcher)
+{
+	PxSceneDesc sceneDesc(gPhysics->getTolerancesScale());
+	sceneDesc.gravity = PxVec3(0.0f);
+	sceneDesc.cpuDispatcher	= dispatcher;
+	sceneDesc.filterShader	= PxDefaultSimulationFilterShader;
+	sceneDesc.flags |= PxSceneFlag::eENABLE_PCM;
+	PxScene* scene = gPhysics->createScene(sceneDesc);
+
+	PxRigidStatic* ground = gPhysics->createRigidStatic(PxTransform(PxIdentity));
+	PxShape* groundShape = gPhysics->createShape(PxTriangleMeshGeometry(gMesh), *gMaterial);
+	ground->attachShape(*groundShape);
+	groundShape->release();
+	scene->addActor(*ground);
+
+	const PxBoxGeometry boxGeom(gShapeSize, 0.25f, gShapeSize);
+	const PxConvexMeshGeometry convexGeom(gConvex);
+	for(PxU32 i=0; i<4; i++)
+	{
+		const PxVec3 pos(PxReal(i&1)*3.0f*gShapeSize - 1.5f*gShapeSize, 0.25f + gHoverHeight, PxReal(i>>1)*3.0f*gShapeSize - 1.5f*gShapeSize);
+		PxRigidDynamic* body = gPhysics->createRigidDynamic(PxTransform(pos));
+		PxShape* shape = (i&1) ? gPhysics->createShape(convexGeom, *gMaterial) : gPhysics->createShape(boxGeom, *gMaterial);
+		shape->setContactOffset(gContactOffset);
+		body->attachShape(*shape);
+		shape->release();
+		PxRigidBodyExt::updateMassAndInertia(*body, 1.0f);
+		// the shapes move across the ground, so that the persistent manifolds cannot be reused
+		body->setLinearVelocity(PxVec3(1.0f, 0.0f, 0.0f));
+		body->setSleepThreshold(0.0f);
+		scene->addActor(*body);
+	}
+
+	for(PxU32 i=0; i<gNbSettleSteps; i++)
+	{
+		scene->simulate(1.0f/60.0f);
+		scene->fetchResults(true);
+	}
+
+	return scene;
+}
+
+// Returns the duration of the fastest step, in milliseconds.
+static PxReal runSteps(PxScene* scene)
+{
+	PxU64 minTime = ~PxU64(0);
+	for(PxU32 i=0; i<gNbTimedSteps; i++)
+	{
+		const PxU64 startTime = SnippetUtils::getCurrentTimeCounterValue();
+		scene->simulate(1.0f/60.0f);
+		scene->fetchResults(true);
+		minTime = PxMin(minTime, SnippetUtils::getCurrentTimeCounterValue() - startTime);
+	}
+	return SnippetUtils::getElapsedTimeInMilliseconds(minTime);
+}
+
+void initPhysics()
+{
+	gFoundation = PxCreateFoundation(PX_FOUNDATION_VERSION, gAllocator, gErrorCallback);
+	gPhysics = PxCreatePhysics(PX_PHYSICS_VERSION, *gFoundation, PxTolerancesScale());
+	gCooking = PxCreateCooking(PX_PHYSICS_VERSION, *gFoundation, PxCookingParams(PxTolerancesScale()));
+	gMaterial = gPhysics->createMaterial(0.5f, 0.5f, 0.0f);
+	gMesh = createGroundMesh();
+	gConvex = createSlab();
+}
+
+void cleanupPhysics()
+{
+	gConvex->release();
+	gMesh->release();
+	gCooking->release();
+	gPhysics->release();
+	gFoundation->release();
+
+	printf("SnippetMeshContactBenchmark done.\n");
+}
+
+int snippetMain(int, const char*const*)
+{
+	initPhysics();
+
+	const PxReal cellsPerShape = 2.0f*gShapeSize/gCellSize;
+	printf("%d ground triangles, each shape overlaps about %d of them\n", gMesh->getNbTriangles(), PxU32(cellsPerShape*cellsPerShape*2.0f));
+
+	for(PxU32 i=0; i<sizeof(gWorkerCounts)/sizeof(gWorkerCounts[0]); i++)
+	{
+		PxDefaultCpuDispatcher* dispatcher = PxDefaultCpuDispatcherCreate(gWorkerCounts[i]);
+		PxScene* scene = createScene(dispatcher);
+
+		const PxReal stepTime = runSteps(scene);
+
+		PxSimulationStatistics stats;
+		scene->getSimulationStatistics(stats);
+		printf("%d worker threads: %.3f ms/step (%d contact pairs)\n", gWorkerCounts[i], double(stepTime), stats.nbDiscreteContactPairsTotal);
+
+		scene->release();
+		dispatcher->release();
+	}
+
+	cleanupPhysics();
+
+	return 0;
+}
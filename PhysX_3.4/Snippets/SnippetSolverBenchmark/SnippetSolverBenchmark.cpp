@@ -0,0 +1,177 @@
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Copyright (c) 2008-2018 NVIDIA Corporation. All rights reserved.
+// Copyright (c) 2004-2008 AGEIA Technologies, Inc. All rights reserved.
+// Copyright (c) 2001-2004 NovodeX AG. All rights reserved.  
+
+// ****************************************************************************
+// This snippet measures the throughput of the block contact solver. Two scenes
+// are simulated on a single thread: columns of boxes, where almost every
+// contact pair is between two dynamic bodies, and a field of boxes resting on
+// a static ground plane. Each scene is stepped with a low and a high number of
+// position iterations. Everything except the solver iterations costs the same
+// in both runs, so the difference in step time divided by the number of extra
+// iterations and contact pairs gives the solver throughput in constraints per
+// second. On CPUs with AVX, two 4-wide contact batches are solved in one pass;
+// building the SDK with DY_AVX_SOLVER=0 gives the 4-wide baseline.
+// ****************************************************************************
+
+#include "PxPhysicsAPI.h"
+
+#include "../SnippetUtils/SnippetUtils.h"
+#include "../SnippetCommon/SnippetPrint.h"
+
+using namespace physx;
+
+PxDefaultAllocator		gAllocator;
+PxDefaultErrorCallback	gErrorCallback;
+
+PxFoundation*			gFoundation = NULL;
+PxPhysics*				gPhysics	= NULL;
+PxDefaultCpuDispatcher*	gDispatcher = NULL;
+PxMaterial*				gMaterial	= NULL;
+
+const PxU32				gNbColumns			= 32;	// columns per side in the dynamic scene
+const PxU32				gColumnHeight		= 16;	// boxes per column in the dynamic scene
+const PxU32				gFieldSize			= 128;	// boxes per side in the static scene
+const PxU32				gLowIterations		= 4;
+const PxU32				gHighIterations		= 132;
+const PxU32				gNbSettleSteps		= 30;
+const PxU32				gNbTimedSteps		= 30;
+
+static PxScene* createScene(PxU32 gridSize, PxU32 columnHeight)
+{
+	PxSceneDesc sceneDesc(gPhysics->getTolerancesScale());
+	sceneDesc.gravity = PxVec3(0.0f, -9.81f, 0.0f);
+	sceneDesc.cpuDispatcher	= gDispatcher;
+	sceneDesc.filterShader	= PxDefaultSimulationFilterShader;
+	PxScene* scene = gPhysics->createScene(sceneDesc);
+
+	scene->addActor(*PxCreatePlane(*gPhysics, PxPlane(0,1,0,0), *gMaterial));
+
+	PxShape* shape = gPhysics->createShape(PxBoxGeometry(0.5f, 0.5f, 0.5f), *gMaterial);
+	for(PxU32 i=0; i<gridSize; i++)
+	{
+		for(PxU32 j=0; j<gridSize; j++)
+		{
+			for(PxU32 k=0; k<columnHeight; k++)
+			{
+				const PxVec3 pos((PxReal(i) - PxReal(gridSize)*0.5f)*2.0f, 0.5f + PxReal(k), (PxReal(j) - PxReal(gridSize)*0.5f)*2.0f);
+				PxRigidDynamic* body = gPhysics->createRigidDynamic(PxTransform(pos));
+				body->attachShape(*shape);
+				PxRigidBodyExt::updateMassAndInertia(*body, 1.0f);
+				// keep the stacks awake so that every step solves the same constraints
+				body->setSleepThreshold(0.0f);
+				scene->addActor(*body);
+			}
+		}
+	}
+	shape->release();
+
+	return scene;
+}
+
+static void setIterations(PxScene* scene, PxU32 nbPositionIterations)
+{
+	const PxU32 nbActors = scene->getNbActors(PxActorTypeFlag::eRIGID_DYNAMIC);
+	for(PxU32 i=0; i<nbActors; i++)
+	{
+		PxActor* actor;
+		scene->getActors(PxActorTypeFlag::eRIGID_DYNAMIC, &actor, 1, i);
+		static_cast<PxRigidDynamic*>(actor)->setSolverIterationCounts(nbPositionIterations, 1);
+	}
+}
+
+// Returns the average duration of a step, in milliseconds.
+static PxReal runSteps(PxScene* scene, PxU32 nbPositionIterations)
+{
+	setIterations(scene, nbPositionIterations);
+	for(PxU32 i=0; i<gNbSettleSteps; i++)
+	{
+		scene->simulate(1.0f/60.0f);
+		scene->fetchResults(true);
+	}
+
+	PxU64 elapsedTime = 0;
+	for(PxU32 i=0; i<gNbTimedSteps; i++)
+	{
+		const PxU64 startTime = SnippetUtils::getCurrentTimeCounterValue();
+		scene->simulate(1.0f/60.0f);
+		scene->fetchResults(true);
+		elapsedTime += SnippetUtils::getCurrentTimeCounterValue() - startTime;
+	}
+	return SnippetUtils::getElapsedTimeInMilliseconds(elapsedTime)/PxReal(gNbTimedSteps);
+}
+
+static void runBenchmark(const char* name, PxU32 gridSize, PxU32 columnHeight)
+{
+	PxScene* scene = createScene(gridSize, columnHeight);
+
+	const PxReal lowTime = runSteps(scene, gLowIterations);
+	const PxReal highTime = runSteps(scene, gHighIterations);
+
+	PxSimulationStatistics stats;
+	scene->getSimulationStatistics(stats);
+	const PxU32 nbPairs = stats.nbDiscreteContactPairsTotal;
+
+	// one contact pair is one solver constraint per iteration
+	const double extraConstraints = double(nbPairs)*double(gHighIterations - gLowIterations);
+	const double throughput = extraConstraints/(double(highTime - lowTime)*1e-3);
+
+	printf("%s: %d contact pairs, %.3f ms/step at %d iterations, %.3f ms/step at %d iterations, %.1f M constraints/s\n",
+		name, nbPairs, double(lowTime), gLowIterations, double(highTime), gHighIterations, throughput*1e-6);
+
+	scene->release();
+}
+
+void initPhysics()
+{
+	gFoundation = PxCreateFoundation(PX_FOUNDATION_VERSION, gAllocator, gErrorCallback);
+	gPhysics = PxCreatePhysics(PX_PHYSICS_VERSION, *gFoundation, PxTolerancesScale());
+	gMaterial = gPhysics->createMaterial(0.5f, 0.5f, 0.0f);
+	gDispatcher = PxDefaultCpuDispatcherCreate(0);
+}
+
+void cleanupPhysics()
+{
+	gDispatcher->release();
+	gPhysics->release();
+	gFoundation->release();
+
+	printf("SnippetSolverBenchmark done.\n");
+}
+
+int snippetMain(int, const char*const*)
+{
+	initPhysics();
+
+	runBenchmark("dynamic", gNbColumns, gColumnHeight);
+	runBenchmark("static", gFieldSize, 1);
+
+	cleanupPhysics();
+
+	return 0;
+}
@@ -0,0 +1,477 @@
+# Makefile generated by XPJ for LINUX32
+-include Makefile.custom
+ProjectName = SnippetConvexSupportBenchmark
+SnippetConvexSupportBenchmark_cppfiles   += ./../../SnippetCommon/ClassicMain.cpp
+SnippetConvexSupportBenchmark_cppfiles   += ./../../SnippetConvexSupportBenchmark/SnippetConvexSupportBenchmark.cpp
+
+SnippetConvexSupportBenchmark_cpp_debug_dep    = $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/debug/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.P, $(SnippetConvexSupportBenchmark_cppfiles)))))
+SnippetConvexSupportBenchmark_cc_debug_dep    = $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.debug.P, $(SnippetConvexSupportBenchmark_ccfiles)))))
+SnippetConvexSupportBenchmark_c_debug_dep      = $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/debug/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.P, $(SnippetConvexSupportBenchmark_cfiles)))))
+SnippetConvexSupportBenchmark_debug_dep      = $(SnippetConvexSupportBenchmark_cpp_debug_dep) $(SnippetConvexSupportBenchmark_cc_debug_dep) $(SnippetConvexSupportBenchmark_c_debug_dep)
+-include $(SnippetConvexSupportBenchmark_debug_dep)
+SnippetConvexSupportBenchmark_cpp_checked_dep    = $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/checked/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.P, $(SnippetConvexSupportBenchmark_cppfiles)))))
+SnippetConvexSupportBenchmark_cc_checked_dep    = $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.checked.P, $(SnippetConvexSupportBenchmark_ccfiles)))))
+SnippetConvexSupportBenchmark_c_checked_dep      = $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/checked/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.P, $(SnippetConvexSupportBenchmark_cfiles)))))
+SnippetConvexSupportBenchmark_checked_dep      = $(SnippetConvexSupportBenchmark_cpp_checked_dep) $(SnippetConvexSupportBenchmark_cc_checked_dep) $(SnippetConvexSupportBenchmark_c_checked_dep)
+-include $(SnippetConvexSupportBenchmark_checked_dep)
+SnippetConvexSupportBenchmark_cpp_profile_dep    = $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/profile/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.P, $(SnippetConvexSupportBenchmark_cppfiles)))))
+SnippetConvexSupportBenchmark_cc_profile_dep    = $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.profile.P, $(SnippetConvexSupportBenchmark_ccfiles)))))
+SnippetConvexSupportBenchmark_c_profile_dep      = $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/profile/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.P, $(SnippetConvexSupportBenchmark_cfiles)))))
+SnippetConvexSupportBenchmark_profile_dep      = $(SnippetConvexSupportBenchmark_cpp_profile_dep) $(SnippetConvexSupportBenchmark_cc_profile_dep) $(SnippetConvexSupportBenchmark_c_profile_dep)
+-include $(SnippetConvexSupportBenchmark_profile_dep)
+SnippetConvexSupportBenchmark_cpp_release_dep    = $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/release/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.P, $(SnippetConvexSupportBenchmark_cppfiles)))))
+SnippetConvexSupportBenchmark_cc_release_dep    = $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.release.P, $(SnippetConvexSupportBenchmark_ccfiles)))))
+SnippetConvexSupportBenchmark_c_release_dep      = $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/release/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.P, $(SnippetConvexSupportBenchmark_cfiles)))))
+SnippetConvexSupportBenchmark_release_dep      = $(SnippetConvexSupportBenchmark_cpp_release_dep) $(SnippetConvexSupportBenchmark_cc_release_dep) $(SnippetConvexSupportBenchmark_c_release_dep)
+-include $(SnippetConvexSupportBenchmark_release_dep)
+SnippetConvexSupportBenchmark_debug_hpaths    := 
+SnippetConvexSupportBenchmark_debug_hpaths    += ./../../../Include
+SnippetConvexSupportBenchmark_debug_hpaths    += ./../../../../PxShared/include
+SnippetConvexSupportBenchmark_debug_hpaths    += ./../../../../PxShared/src/foundation/include
+SnippetConvexSupportBenchmark_debug_hpaths    += ./../../../../PxShared/src/fastxml/include
+SnippetConvexSupportBenchmark_debug_lpaths    := 
+SnippetConvexSupportBenchmark_debug_lpaths    += ./../../../Lib/linux32
+SnippetConvexSupportBenchmark_debug_lpaths    += ./../../lib/linux32
+SnippetConvexSupportBenchmark_debug_lpaths    += ./../../../Bin/linux32
+SnippetConvexSupportBenchmark_debug_lpaths    += ./../../../../PxShared/lib/linux32
+SnippetConvexSupportBenchmark_debug_lpaths    += ./../../../../PxShared/bin/linux32
+SnippetConvexSupportBenchmark_debug_lpaths    += ./../../lib/linux32
+SnippetConvexSupportBenchmark_debug_defines   := $(SnippetConvexSupportBenchmark_custom_defines)
+SnippetConvexSupportBenchmark_debug_defines   += PHYSX_PROFILE_SDK
+SnippetConvexSupportBenchmark_debug_defines   += RENDER_SNIPPET
+SnippetConvexSupportBenchmark_debug_defines   += _DEBUG
+SnippetConvexSupportBenchmark_debug_defines   += PX_DEBUG=1
+SnippetConvexSupportBenchmark_debug_defines   += PX_CHECKED=1
+SnippetConvexSupportBenchmark_debug_defines   += PX_SUPPORT_PVD=1
+SnippetConvexSupportBenchmark_debug_libraries := 
+SnippetConvexSupportBenchmark_debug_libraries += SnippetRenderDEBUG
+SnippetConvexSupportBenchmark_debug_libraries += SnippetUtilsDEBUG
+SnippetConvexSupportBenchmark_debug_libraries += PhysX3DEBUG_x86
+SnippetConvexSupportBenchmark_debug_libraries += PhysX3CookingDEBUG_x86
+SnippetConvexSupportBenchmark_debug_libraries += PhysX3CharacterKinematicDEBUG_x86
+SnippetConvexSupportBenchmark_debug_libraries += PhysX3ExtensionsDEBUG
+SnippetConvexSupportBenchmark_debug_libraries += PhysX3VehicleDEBUG
+SnippetConvexSupportBenchmark_debug_libraries += PxPvdSDKDEBUG_x86
+SnippetConvexSupportBenchmark_debug_libraries += PhysX3CommonDEBUG_x86
+SnippetConvexSupportBenchmark_debug_libraries += PxFoundationDEBUG_x86
+SnippetConvexSupportBenchmark_debug_libraries += PxTaskDEBUG
+SnippetConvexSupportBenchmark_debug_libraries += PsFastXmlDEBUG
+SnippetConvexSupportBenchmark_debug_libraries += SnippetUtilsDEBUG
+SnippetConvexSupportBenchmark_debug_libraries += SnippetRenderDEBUG
+SnippetConvexSupportBenchmark_debug_libraries += GL
+SnippetConvexSupportBenchmark_debug_libraries += GLU
+SnippetConvexSupportBenchmark_debug_libraries += glut
+SnippetConvexSupportBenchmark_debug_libraries += X11
+SnippetConvexSupportBenchmark_debug_libraries += rt
+SnippetConvexSupportBenchmark_debug_libraries += pthread
+SnippetConvexSupportBenchmark_debug_common_cflags	:= $(SnippetConvexSupportBenchmark_custom_cflags)
+SnippetConvexSupportBenchmark_debug_common_cflags    += -MMD
+SnippetConvexSupportBenchmark_debug_common_cflags    += $(addprefix -D, $(SnippetConvexSupportBenchmark_debug_defines))
+SnippetConvexSupportBenchmark_debug_common_cflags    += $(addprefix -I, $(SnippetConvexSupportBenchmark_debug_hpaths))
+SnippetConvexSupportBenchmark_debug_common_cflags  += -m32
+SnippetConvexSupportBenchmark_debug_common_cflags  += -Werror -m32 -fPIC -msse2 -mfpmath=sse -malign-double -fno-exceptions -fno-rtti -fvisibility=hidden -fvisibility-inlines-hidden
+SnippetConvexSupportBenchmark_debug_common_cflags  += -Wall -Wextra -Wstrict-aliasing=2 -fdiagnostics-show-option
+SnippetConvexSupportBenchmark_debug_common_cflags  += -Wno-uninitialized
+SnippetConvexSupportBenchmark_debug_common_cflags  += -g3 -gdwarf-2
+SnippetConvexSupportBenchmark_debug_cflags	:= $(SnippetConvexSupportBenchmark_debug_common_cflags)
+SnippetConvexSupportBenchmark_debug_cppflags	:= $(SnippetConvexSupportBenchmark_debug_common_cflags)
+SnippetConvexSupportBenchmark_debug_lflags    := $(SnippetConvexSupportBenchmark_custom_lflags)
+SnippetConvexSupportBenchmark_debug_lflags    += $(addprefix -L, $(SnippetConvexSupportBenchmark_debug_lpaths))
+SnippetConvexSupportBenchmark_debug_lflags    += -Wl,--start-group $(addprefix -l, $(SnippetConvexSupportBenchmark_debug_libraries)) -Wl,--end-group
+SnippetConvexSupportBenchmark_debug_lflags  += -lrt
+SnippetConvexSupportBenchmark_debug_lflags  += -Wl,-rpath ./
+SnippetConvexSupportBenchmark_debug_lflags  += -m32
+SnippetConvexSupportBenchmark_debug_objsdir  = $(OBJS_DIR)/SnippetConvexSupportBenchmark_debug
+SnippetConvexSupportBenchmark_debug_cpp_o    = $(addprefix $(SnippetConvexSupportBenchmark_debug_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.o, $(SnippetConvexSupportBenchmark_cppfiles)))))
+SnippetConvexSupportBenchmark_debug_cc_o    = $(addprefix $(SnippetConvexSupportBenchmark_debug_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.o, $(SnippetConvexSupportBenchmark_ccfiles)))))
+SnippetConvexSupportBenchmark_debug_c_o      = $(addprefix $(SnippetConvexSupportBenchmark_debug_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.o, $(SnippetConvexSupportBenchmark_cfiles)))))
+SnippetConvexSupportBenchmark_debug_obj      = $(SnippetConvexSupportBenchmark_debug_cpp_o) $(SnippetConvexSupportBenchmark_debug_cc_o) $(SnippetConvexSupportBenchmark_debug_c_o)
+SnippetConvexSupportBenchmark_debug_bin      := ./../../../Bin/linux32/SnippetConvexSupportBenchmarkDEBUG
+
+clean_SnippetConvexSupportBenchmark_debug: 
+	@$(ECHO) clean SnippetConvexSupportBenchmark debug
+	@$(RMDIR) $(SnippetConvexSupportBenchmark_debug_objsdir)
+	@$(RMDIR) $(SnippetConvexSupportBenchmark_debug_bin)
+	@$(RMDIR) $(DEPSDIR)/SnippetConvexSupportBenchmark/debug
+
+build_SnippetConvexSupportBenchmark_debug: postbuild_SnippetConvexSupportBenchmark_debug
+postbuild_SnippetConvexSupportBenchmark_debug: mainbuild_SnippetConvexSupportBenchmark_debug
+	@cp -u "../../../../PxShared/bin/linux32/libPxFoundationDEBUG_x86.so" "../../../Bin/linux32/libPxFoundationDEBUG_x86.so"; cp -u "../../../../PxShared/bin/linux32/libPxPvdSDKDEBUG_x86.so" "../../../Bin/linux32/libPxPvdSDKDEBUG_x86.so"
+mainbuild_SnippetConvexSupportBenchmark_debug: prebuild_SnippetConvexSupportBenchmark_debug $(SnippetConvexSupportBenchmark_debug_bin)
+prebuild_SnippetConvexSupportBenchmark_debug:
+
+$(SnippetConvexSupportBenchmark_debug_bin): $(SnippetConvexSupportBenchmark_debug_obj) build_SnippetRender_debug build_SnippetUtils_debug 
+	mkdir -p `dirname ./../../../Bin/linux32/SnippetConvexSupportBenchmarkDEBUG`
+	$(CCLD) $(SnippetConvexSupportBenchmark_debug_obj) $(SnippetConvexSupportBenchmark_debug_lflags) -o $(SnippetConvexSupportBenchmark_debug_bin) 
+	$(ECHO) building $@ complete!
+
+SnippetConvexSupportBenchmark_debug_DEPDIR = $(dir $(@))/$(*F)
+$(SnippetConvexSupportBenchmark_debug_cpp_o): $(SnippetConvexSupportBenchmark_debug_objsdir)/%.o:
+	$(ECHO) SnippetConvexSupportBenchmark: compiling debug $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetConvexSupportBenchmark_debug_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cppfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetConvexSupportBenchmark_debug_cppflags) -c $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetConvexSupportBenchmark_debug_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cppfiles)) -o $@
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetConvexSupportBenchmark_debug_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cppfiles))))))
+	cp $(SnippetConvexSupportBenchmark_debug_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetConvexSupportBenchmark_debug_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cppfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetConvexSupportBenchmark_debug_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetConvexSupportBenchmark_debug_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cppfiles))))).P; \
+	  rm -f $(SnippetConvexSupportBenchmark_debug_DEPDIR).d
+
+$(SnippetConvexSupportBenchmark_debug_cc_o): $(SnippetConvexSupportBenchmark_debug_objsdir)/%.o:
+	$(ECHO) SnippetConvexSupportBenchmark: compiling debug $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetConvexSupportBenchmark_debug_objsdir),, $@))), $(SnippetConvexSupportBenchmark_ccfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetConvexSupportBenchmark_debug_cppflags) -c $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetConvexSupportBenchmark_debug_objsdir),, $@))), $(SnippetConvexSupportBenchmark_ccfiles)) -o $@
+	mkdir -p $(dir $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetConvexSupportBenchmark_debug_objsdir),, $@))), $(SnippetConvexSupportBenchmark_ccfiles))))))
+	cp $(SnippetConvexSupportBenchmark_debug_DEPDIR).d $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetConvexSupportBenchmark_debug_objsdir),, $@))), $(SnippetConvexSupportBenchmark_ccfiles))))).debug.P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetConvexSupportBenchmark_debug_DEPDIR).d >> $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetConvexSupportBenchmark_debug_objsdir),, $@))), $(SnippetConvexSupportBenchmark_ccfiles))))).debug.P; \
+	  rm -f $(SnippetConvexSupportBenchmark_debug_DEPDIR).d
+
+$(SnippetConvexSupportBenchmark_debug_c_o): $(SnippetConvexSupportBenchmark_debug_objsdir)/%.o:
+	$(ECHO) SnippetConvexSupportBenchmark: compiling debug $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetConvexSupportBenchmark_debug_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cfiles))...
+	mkdir -p $(dir $(@))
+	$(CC) $(SnippetConvexSupportBenchmark_debug_cflags) -c $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetConvexSupportBenchmark_debug_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cfiles)) -o $@ 
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetConvexSupportBenchmark_debug_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cfiles))))))
+	cp $(SnippetConvexSupportBenchmark_debug_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetConvexSupportBenchmark_debug_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetConvexSupportBenchmark_debug_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetConvexSupportBenchmark_debug_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cfiles))))).P; \
+	  rm -f $(SnippetConvexSupportBenchmark_debug_DEPDIR).d
+
+SnippetConvexSupportBenchmark_checked_hpaths    := 
+SnippetConvexSupportBenchmark_checked_hpaths    += ./../../../Include
+SnippetConvexSupportBenchmark_checked_hpaths    += ./../../../../PxShared/include
+SnippetConvexSupportBenchmark_checked_hpaths    += ./../../../../PxShared/src/foundation/include
+SnippetConvexSupportBenchmark_checked_hpaths    += ./../../../../PxShared/src/fastxml/include
+SnippetConvexSupportBenchmark_checked_lpaths    := 
+SnippetConvexSupportBenchmark_checked_lpaths    += ./../../../Lib/linux32
+SnippetConvexSupportBenchmark_checked_lpaths    += ./../../lib/linux32
+SnippetConvexSupportBenchmark_checked_lpaths    += ./../../../Bin/linux32
+SnippetConvexSupportBenchmark_checked_lpaths    += ./../../../../PxShared/lib/linux32
+SnippetConvexSupportBenchmark_checked_lpaths    += ./../../../../PxShared/bin/linux32
+SnippetConvexSupportBenchmark_checked_lpaths    += ./../../lib/linux32
+SnippetConvexSupportBenchmark_checked_defines   := $(SnippetConvexSupportBenchmark_custom_defines)
+SnippetConvexSupportBenchmark_checked_defines   += PHYSX_PROFILE_SDK
+SnippetConvexSupportBenchmark_checked_defines   += RENDER_SNIPPET
+SnippetConvexSupportBenchmark_checked_defines   += NDEBUG
+SnippetConvexSupportBenchmark_checked_defines   += PX_CHECKED=1
+SnippetConvexSupportBenchmark_checked_defines   += PX_SUPPORT_PVD=1
+SnippetConvexSupportBenchmark_checked_libraries := 
+SnippetConvexSupportBenchmark_checked_libraries += SnippetRenderCHECKED
+SnippetConvexSupportBenchmark_checked_libraries += SnippetUtilsCHECKED
+SnippetConvexSupportBenchmark_checked_libraries += PhysX3CHECKED_x86
+SnippetConvexSupportBenchmark_checked_libraries += PhysX3CookingCHECKED_x86
+SnippetConvexSupportBenchmark_checked_libraries += PhysX3CharacterKinematicCHECKED_x86
+SnippetConvexSupportBenchmark_checked_libraries += PhysX3ExtensionsCHECKED
+SnippetConvexSupportBenchmark_checked_libraries += PhysX3VehicleCHECKED
+SnippetConvexSupportBenchmark_checked_libraries += PxPvdSDKCHECKED_x86
+SnippetConvexSupportBenchmark_checked_libraries += PhysX3CommonCHECKED_x86
+SnippetConvexSupportBenchmark_checked_libraries += PxFoundationCHECKED_x86
+SnippetConvexSupportBenchmark_checked_libraries += PxTaskCHECKED
+SnippetConvexSupportBenchmark_checked_libraries += PsFastXmlCHECKED
+SnippetConvexSupportBenchmark_checked_libraries += SnippetUtilsCHECKED
+SnippetConvexSupportBenchmark_checked_libraries += SnippetRenderCHECKED
+SnippetConvexSupportBenchmark_checked_libraries += GL
+SnippetConvexSupportBenchmark_checked_libraries += GLU
+SnippetConvexSupportBenchmark_checked_libraries += glut
+SnippetConvexSupportBenchmark_checked_libraries += X11
+SnippetConvexSupportBenchmark_checked_libraries += rt
+SnippetConvexSupportBenchmark_checked_libraries += pthread
+SnippetConvexSupportBenchmark_checked_common_cflags	:= $(SnippetConvexSupportBenchmark_custom_cflags)
+SnippetConvexSupportBenchmark_checked_common_cflags    += -MMD
+SnippetConvexSupportBenchmark_checked_common_cflags    += $(addprefix -D, $(SnippetConvexSupportBenchmark_checked_defines))
+SnippetConvexSupportBenchmark_checked_common_cflags    += $(addprefix -I, $(SnippetConvexSupportBenchmark_checked_hpaths))
+SnippetConvexSupportBenchmark_checked_common_cflags  += -m32
+SnippetConvexSupportBenchmark_checked_common_cflags  += -Werror -m32 -fPIC -msse2 -mfpmath=sse -malign-double -fno-exceptions -fno-rtti -fvisibility=hidden -fvisibility-inlines-hidden
+SnippetConvexSupportBenchmark_checked_common_cflags  += -Wall -Wextra -Wstrict-aliasing=2 -fdiagnostics-show-option
+SnippetConvexSupportBenchmark_checked_common_cflags  += -Wno-uninitialized
+SnippetConvexSupportBenchmark_checked_common_cflags  += -g3 -gdwarf-2 -O3 -fno-strict-aliasing
+SnippetConvexSupportBenchmark_checked_cflags	:= $(SnippetConvexSupportBenchmark_checked_common_cflags)
+SnippetConvexSupportBenchmark_checked_cppflags	:= $(SnippetConvexSupportBenchmark_checked_common_cflags)
+SnippetConvexSupportBenchmark_checked_lflags    := $(SnippetConvexSupportBenchmark_custom_lflags)
+SnippetConvexSupportBenchmark_checked_lflags    += $(addprefix -L, $(SnippetConvexSupportBenchmark_checked_lpaths))
+SnippetConvexSupportBenchmark_checked_lflags    += -Wl,--start-group $(addprefix -l, $(SnippetConvexSupportBenchmark_checked_libraries)) -Wl,--end-group
+SnippetConvexSupportBenchmark_checked_lflags  += -lrt
+SnippetConvexSupportBenchmark_checked_lflags  += -Wl,-rpath ./
+SnippetConvexSupportBenchmark_checked_lflags  += -m32
+SnippetConvexSupportBenchmark_checked_objsdir  = $(OBJS_DIR)/SnippetConvexSupportBenchmark_checked
+SnippetConvexSupportBenchmark_checked_cpp_o    = $(addprefix $(SnippetConvexSupportBenchmark_checked_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.o, $(SnippetConvexSupportBenchmark_cppfiles)))))
+SnippetConvexSupportBenchmark_checked_cc_o    = $(addprefix $(SnippetConvexSupportBenchmark_checked_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.o, $(SnippetConvexSupportBenchmark_ccfiles)))))
+SnippetConvexSupportBenchmark_checked_c_o      = $(addprefix $(SnippetConvexSupportBenchmark_checked_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.o, $(SnippetConvexSupportBenchmark_cfiles)))))
+SnippetConvexSupportBenchmark_checked_obj      = $(SnippetConvexSupportBenchmark_checked_cpp_o) $(SnippetConvexSupportBenchmark_checked_cc_o) $(SnippetConvexSupportBenchmark_checked_c_o)
+SnippetConvexSupportBenchmark_checked_bin      := ./../../../Bin/linux32/SnippetConvexSupportBenchmarkCHECKED
+
+clean_SnippetConvexSupportBenchmark_checked: 
+	@$(ECHO) clean SnippetConvexSupportBenchmark checked
+	@$(RMDIR) $(SnippetConvexSupportBenchmark_checked_objsdir)
+	@$(RMDIR) $(SnippetConvexSupportBenchmark_checked_bin)
+	@$(RMDIR) $(DEPSDIR)/SnippetConvexSupportBenchmark/checked
+
+build_SnippetConvexSupportBenchmark_checked: postbuild_SnippetConvexSupportBenchmark_checked
+postbuild_SnippetConvexSupportBenchmark_checked: mainbuild_SnippetConvexSupportBenchmark_checked
+	@cp -u "../../../../PxShared/bin/linux32/libPxFoundationCHECKED_x86.so" "../../../Bin/linux32/libPxFoundationCHECKED_x86.so"; cp -u "../../../../PxShared/bin/linux32/libPxPvdSDKCHECKED_x86.so" "../../../Bin/linux32/libPxPvdSDKCHECKED_x86.so"
+mainbuild_SnippetConvexSupportBenchmark_checked: prebuild_SnippetConvexSupportBenchmark_checked $(SnippetConvexSupportBenchmark_checked_bin)
+prebuild_SnippetConvexSupportBenchmark_checked:
+
+$(SnippetConvexSupportBenchmark_checked_bin): $(SnippetConvexSupportBenchmark_checked_obj) build_SnippetRender_checked build_SnippetUtils_checked 
+	mkdir -p `dirname ./../../../Bin/linux32/SnippetConvexSupportBenchmarkCHECKED`
+	$(CCLD) $(SnippetConvexSupportBenchmark_checked_obj) $(SnippetConvexSupportBenchmark_checked_lflags) -o $(SnippetConvexSupportBenchmark_checked_bin) 
+	$(ECHO) building $@ complete!
+
+SnippetConvexSupportBenchmark_checked_DEPDIR = $(dir $(@))/$(*F)
+$(SnippetConvexSupportBenchmark_checked_cpp_o): $(SnippetConvexSupportBenchmark_checked_objsdir)/%.o:
+	$(ECHO) SnippetConvexSupportBenchmark: compiling checked $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetConvexSupportBenchmark_checked_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cppfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetConvexSupportBenchmark_checked_cppflags) -c $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetConvexSupportBenchmark_checked_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cppfiles)) -o $@
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetConvexSupportBenchmark_checked_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cppfiles))))))
+	cp $(SnippetConvexSupportBenchmark_checked_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetConvexSupportBenchmark_checked_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cppfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetConvexSupportBenchmark_checked_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetConvexSupportBenchmark_checked_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cppfiles))))).P; \
+	  rm -f $(SnippetConvexSupportBenchmark_checked_DEPDIR).d
+
+$(SnippetConvexSupportBenchmark_checked_cc_o): $(SnippetConvexSupportBenchmark_checked_objsdir)/%.o:
+	$(ECHO) SnippetConvexSupportBenchmark: compiling checked $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetConvexSupportBenchmark_checked_objsdir),, $@))), $(SnippetConvexSupportBenchmark_ccfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetConvexSupportBenchmark_checked_cppflags) -c $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetConvexSupportBenchmark_checked_objsdir),, $@))), $(SnippetConvexSupportBenchmark_ccfiles)) -o $@
+	mkdir -p $(dir $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetConvexSupportBenchmark_checked_objsdir),, $@))), $(SnippetConvexSupportBenchmark_ccfiles))))))
+	cp $(SnippetConvexSupportBenchmark_checked_DEPDIR).d $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetConvexSupportBenchmark_checked_objsdir),, $@))), $(SnippetConvexSupportBenchmark_ccfiles))))).checked.P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetConvexSupportBenchmark_checked_DEPDIR).d >> $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetConvexSupportBenchmark_checked_objsdir),, $@))), $(SnippetConvexSupportBenchmark_ccfiles))))).checked.P; \
+	  rm -f $(SnippetConvexSupportBenchmark_checked_DEPDIR).d
+
+$(SnippetConvexSupportBenchmark_checked_c_o): $(SnippetConvexSupportBenchmark_checked_objsdir)/%.o:
+	$(ECHO) SnippetConvexSupportBenchmark: compiling checked $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetConvexSupportBenchmark_checked_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cfiles))...
+	mkdir -p $(dir $(@))
+	$(CC) $(SnippetConvexSupportBenchmark_checked_cflags) -c $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetConvexSupportBenchmark_checked_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cfiles)) -o $@ 
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetConvexSupportBenchmark_checked_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cfiles))))))
+	cp $(SnippetConvexSupportBenchmark_checked_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetConvexSupportBenchmark_checked_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetConvexSupportBenchmark_checked_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetConvexSupportBenchmark_checked_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cfiles))))).P; \
+	  rm -f $(SnippetConvexSupportBenchmark_checked_DEPDIR).d
+
+SnippetConvexSupportBenchmark_profile_hpaths    := 
+SnippetConvexSupportBenchmark_profile_hpaths    += ./../../../Include
+SnippetConvexSupportBenchmark_profile_hpaths    += ./../../../../PxShared/include
+SnippetConvexSupportBenchmark_profile_hpaths    += ./../../../../PxShared/src/foundation/include
+SnippetConvexSupportBenchmark_profile_hpaths    += ./../../../../PxShared/src/fastxml/include
+SnippetConvexSupportBenchmark_profile_lpaths    := 
+SnippetConvexSupportBenchmark_profile_lpaths    += ./../../../Lib/linux32
+SnippetConvexSupportBenchmark_profile_lpaths    += ./../../lib/linux32
+SnippetConvexSupportBenchmark_profile_lpaths    += ./../../../Bin/linux32
+SnippetConvexSupportBenchmark_profile_lpaths    += ./../../../../PxShared/lib/linux32
+SnippetConvexSupportBenchmark_profile_lpaths    += ./../../../../PxShared/bin/linux32
+SnippetConvexSupportBenchmark_profile_lpaths    += ./../../lib/linux32
+SnippetConvexSupportBenchmark_profile_defines   := $(SnippetConvexSupportBenchmark_custom_defines)
+SnippetConvexSupportBenchmark_profile_defines   += PHYSX_PROFILE_SDK
+SnippetConvexSupportBenchmark_profile_defines   += RENDER_SNIPPET
+SnippetConvexSupportBenchmark_profile_defines   += NDEBUG
+SnippetConvexSupportBenchmark_profile_defines   += PX_PROFILE=1
+SnippetConvexSupportBenchmark_profile_defines   += PX_SUPPORT_PVD=1
+SnippetConvexSupportBenchmark_profile_libraries := 
+SnippetConvexSupportBenchmark_profile_libraries += SnippetRenderPROFILE
+SnippetConvexSupportBenchmark_profile_libraries += SnippetUtilsPROFILE
+SnippetConvexSupportBenchmark_profile_libraries += PhysX3PROFILE_x86
+SnippetConvexSupportBenchmark_profile_libraries += PhysX3CookingPROFILE_x86
+SnippetConvexSupportBenchmark_profile_libraries += PhysX3CharacterKinematicPROFILE_x86
+SnippetConvexSupportBenchmark_profile_libraries += PhysX3ExtensionsPROFILE
+SnippetConvexSupportBenchmark_profile_libraries += PhysX3VehiclePROFILE
+SnippetConvexSupportBenchmark_profile_libraries += PxPvdSDKPROFILE_x86
+SnippetConvexSupportBenchmark_profile_libraries += PhysX3CommonPROFILE_x86
+SnippetConvexSupportBenchmark_profile_libraries += PxFoundationPROFILE_x86
+SnippetConvexSupportBenchmark_profile_libraries += PxTaskPROFILE
+SnippetConvexSupportBenchmark_profile_libraries += PsFastXmlPROFILE
+SnippetConvexSupportBenchmark_profile_libraries += SnippetUtilsPROFILE
+SnippetConvexSupportBenchmark_profile_libraries += SnippetRenderPROFILE
+SnippetConvexSupportBenchmark_profile_libraries += GL
+SnippetConvexSupportBenchmark_profile_libraries += GLU
+SnippetConvexSupportBenchmark_profile_libraries += glut
+SnippetConvexSupportBenchmark_profile_libraries += X11
+SnippetConvexSupportBenchmark_profile_libraries += rt
+SnippetConvexSupportBenchmark_profile_libraries += pthread
+SnippetConvexSupportBenchmark_profile_common_cflags	:= $(SnippetConvexSupportBenchmark_custom_cflags)
+SnippetConvexSupportBenchmark_profile_common_cflags    += -MMD
+SnippetConvexSupportBenchmark_profile_common_cflags    += $(addprefix -D, $(SnippetConvexSupportBenchmark_profile_defines))
+SnippetConvexSupportBenchmark_profile_common_cflags    += $(addprefix -I, $(SnippetConvexSupportBenchmark_profile_hpaths))
+SnippetConvexSupportBenchmark_profile_common_cflags  += -m32
+SnippetConvexSupportBenchmark_profile_common_cflags  += -Werror -m32 -fPIC -msse2 -mfpmath=sse -malign-double -fno-exceptions -fno-rtti -fvisibility=hidden -fvisibility-inlines-hidden
+SnippetConvexSupportBenchmark_profile_common_cflags  += -Wall -Wextra -Wstrict-aliasing=2 -fdiagnostics-show-option
+SnippetConvexSupportBenchmark_profile_common_cflags  += -Wno-uninitialized
+SnippetConvexSupportBenchmark_profile_common_cflags  += -O3 -fno-strict-aliasing
+SnippetConvexSupportBenchmark_profile_cflags	:= $(SnippetConvexSupportBenchmark_profile_common_cflags)
+SnippetConvexSupportBenchmark_profile_cppflags	:= $(SnippetConvexSupportBenchmark_profile_common_cflags)
+SnippetConvexSupportBenchmark_profile_lflags    := $(SnippetConvexSupportBenchmark_custom_lflags)
+SnippetConvexSupportBenchmark_profile_lflags    += $(addprefix -L, $(SnippetConvexSupportBenchmark_profile_lpaths))
+SnippetConvexSupportBenchmark_profile_lflags    += -Wl,--start-group $(addprefix -l, $(SnippetConvexSupportBenchmark_profile_libraries)) -Wl,--end-group
+SnippetConvexSupportBenchmark_profile_lflags  += -lrt
+SnippetConvexSupportBenchmark_profile_lflags  += -Wl,-rpath ./
+SnippetConvexSupportBenchmark_profile_lflags  += -m32
+SnippetConvexSupportBenchmark_profile_objsdir  = $(OBJS_DIR)/SnippetConvexSupportBenchmark_profile
+SnippetConvexSupportBenchmark_profile_cpp_o    = $(addprefix $(SnippetConvexSupportBenchmark_profile_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.o, $(SnippetConvexSupportBenchmark_cppfiles)))))
+SnippetConvexSupportBenchmark_profile_cc_o    = $(addprefix $(SnippetConvexSupportBenchmark_profile_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.o, $(SnippetConvexSupportBenchmark_ccfiles)))))
+SnippetConvexSupportBenchmark_profile_c_o      = $(addprefix $(SnippetConvexSupportBenchmark_profile_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.o, $(SnippetConvexSupportBenchmark_cfiles)))))
+SnippetConvexSupportBenchmark_profile_obj      = $(SnippetConvexSupportBenchmark_profile_cpp_o) $(SnippetConvexSupportBenchmark_profile_cc_o) $(SnippetConvexSupportBenchmark_profile_c_o)
+SnippetConvexSupportBenchmark_profile_bin      := ./../../../Bin/linux32/SnippetConvexSupportBenchmarkPROFILE
+
+clean_SnippetConvexSupportBenchmark_profile: 
+	@$(ECHO) clean SnippetConvexSupportBenchmark profile
+	@$(RMDIR) $(SnippetConvexSupportBenchmark_profile_objsdir)
+	@$(RMDIR) $(SnippetConvexSupportBenchmark_profile_bin)
+	@$(RMDIR) $(DEPSDIR)/SnippetConvexSupportBenchmark/profile
+
+build_SnippetConvexSupportBenchmark_profile: postbuild_SnippetConvexSupportBenchmark_profile
+postbuild_SnippetConvexSupportBenchmark_profile: mainbuild_SnippetConvexSupportBenchmark_profile
+	@cp -u "../../../../PxShared/bin/linux32/libPxFoundationPROFILE_x86.so" "../../../Bin/linux32/libPxFoundationPROFILE_x86.so"; cp -u "../../../../PxShared/bin/linux32/libPxPvdSDKPROFILE_x86.so" "../../../Bin/linux32/libPxPvdSDKPROFILE_x86.so"
+mainbuild_SnippetConvexSupportBenchmark_profile: prebuild_SnippetConvexSupportBenchmark_profile $(SnippetConvexSupportBenchmark_profile_bin)
+prebuild_SnippetConvexSupportBenchmark_profile:
+
+$(SnippetConvexSupportBenchmark_profile_bin): $(SnippetConvexSupportBenchmark_profile_obj) build_SnippetRender_profile build_SnippetUtils_profile 
+	mkdir -p `dirname ./../../../Bin/linux32/SnippetConvexSupportBenchmarkPROFILE`
+	$(CCLD) $(SnippetConvexSupportBenchmark_profile_obj) $(SnippetConvexSupportBenchmark_profile_lflags) -o $(SnippetConvexSupportBenchmark_profile_bin) 
+	$(ECHO) building $@ complete!
+
+SnippetConvexSupportBenchmark_profile_DEPDIR = $(dir $(@))/$(*F)
+$(SnippetConvexSupportBenchmark_profile_cpp_o): $(SnippetConvexSupportBenchmark_profile_objsdir)/%.o:
+	$(ECHO) SnippetConvexSupportBenchmark: compiling profile $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetConvexSupportBenchmark_profile_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cppfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetConvexSupportBenchmark_profile_cppflags) -c $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetConvexSupportBenchmark_profile_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cppfiles)) -o $@
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetConvexSupportBenchmark_profile_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cppfiles))))))
+	cp $(SnippetConvexSupportBenchmark_profile_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetConvexSupportBenchmark_profile_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cppfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetConvexSupportBenchmark_profile_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetConvexSupportBenchmark_profile_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cppfiles))))).P; \
+	  rm -f $(SnippetConvexSupportBenchmark_profile_DEPDIR).d
+
+$(SnippetConvexSupportBenchmark_profile_cc_o): $(SnippetConvexSupportBenchmark_profile_objsdir)/%.o:
+	$(ECHO) SnippetConvexSupportBenchmark: compiling profile $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetConvexSupportBenchmark_profile_objsdir),, $@))), $(SnippetConvexSupportBenchmark_ccfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetConvexSupportBenchmark_profile_cppflags) -c $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetConvexSupportBenchmark_profile_objsdir),, $@))), $(SnippetConvexSupportBenchmark_ccfiles)) -o $@
+	mkdir -p $(dir $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetConvexSupportBenchmark_profile_objsdir),, $@))), $(SnippetConvexSupportBenchmark_ccfiles))))))
+	cp $(SnippetConvexSupportBenchmark_profile_DEPDIR).d $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetConvexSupportBenchmark_profile_objsdir),, $@))), $(SnippetConvexSupportBenchmark_ccfiles))))).profile.P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetConvexSupportBenchmark_profile_DEPDIR).d >> $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetConvexSupportBenchmark_profile_objsdir),, $@))), $(SnippetConvexSupportBenchmark_ccfiles))))).profile.P; \
+	  rm -f $(SnippetConvexSupportBenchmark_profile_DEPDIR).d
+
+$(SnippetConvexSupportBenchmark_profile_c_o): $(SnippetConvexSupportBenchmark_profile_objsdir)/%.o:
+	$(ECHO) SnippetConvexSupportBenchmark: compiling profile $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetConvexSupportBenchmark_profile_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cfiles))...
+	mkdir -p $(dir $(@))
+	$(CC) $(SnippetConvexSupportBenchmark_profile_cflags) -c $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetConvexSupportBenchmark_profile_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cfiles)) -o $@ 
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetConvexSupportBenchmark_profile_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cfiles))))))
+	cp $(SnippetConvexSupportBenchmark_profile_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetConvexSupportBenchmark_profile_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetConvexSupportBenchmark_profile_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetConvexSupportBenchmark_profile_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cfiles))))).P; \
+	  rm -f $(SnippetConvexSupportBenchmark_profile_DEPDIR).d
+
+SnippetConvexSupportBenchmark_release_hpaths    := 
+SnippetConvexSupportBenchmark_release_hpaths    += ./../../../Include
+SnippetConvexSupportBenchmark_release_hpaths    += ./../../../../PxShared/include
+SnippetConvexSupportBenchmark_release_hpaths    += ./../../../../PxShared/src/foundation/include
+SnippetConvexSupportBenchmark_release_hpaths    += ./../../../../PxShared/src/fastxml/include
+SnippetConvexSupportBenchmark_release_lpaths    := 
+SnippetConvexSupportBenchmark_release_lpaths    += ./../../../Lib/linux32
+SnippetConvexSupportBenchmark_release_lpaths    += ./../../lib/linux32
+SnippetConvexSupportBenchmark_release_lpaths    += ./../../../Bin/linux32
+SnippetConvexSupportBenchmark_release_lpaths    += ./../../../../PxShared/lib/linux32
+SnippetConvexSupportBenchmark_release_lpaths    += ./../../../../PxShared/bin/linux32
+SnippetConvexSupportBenchmark_release_lpaths    += ./../../lib/linux32
+SnippetConvexSupportBenchmark_release_defines   := $(SnippetConvexSupportBenchmark_custom_defines)
+SnippetConvexSupportBenchmark_release_defines   += PHYSX_PROFILE_SDK
+SnippetConvexSupportBenchmark_release_defines   += RENDER_SNIPPET
+SnippetConvexSupportBenchmark_release_defines   += NDEBUG
+SnippetConvexSupportBenchmark_release_defines   += PX_SUPPORT_PVD=0
+SnippetConvexSupportBenchmark_release_libraries := 
+SnippetConvexSupportBenchmark_release_libraries += SnippetRender
+SnippetConvexSupportBenchmark_release_libraries += SnippetUtils
+SnippetConvexSupportBenchmark_release_libraries += PhysX3_x86
+SnippetConvexSupportBenchmark_release_libraries += PhysX3Cooking_x86
+SnippetConvexSupportBenchmark_release_libraries += PhysX3CharacterKinematic_x86
+SnippetConvexSupportBenchmark_release_libraries += PhysX3Extensions
+SnippetConvexSupportBenchmark_release_libraries += PhysX3Vehicle
+SnippetConvexSupportBenchmark_release_libraries += PxPvdSDK_x86
+SnippetConvexSupportBenchmark_release_libraries += PhysX3Common_x86
+SnippetConvexSupportBenchmark_release_libraries += PxFoundation_x86
+SnippetConvexSupportBenchmark_release_libraries += PxTask
+SnippetConvexSupportBenchmark_release_libraries += PsFastXml
+SnippetConvexSupportBenchmark_release_libraries += SnippetUtils
+SnippetConvexSupportBenchmark_release_libraries += SnippetRender
+SnippetConvexSupportBenchmark_release_libraries += GL
+SnippetConvexSupportBenchmark_release_libraries += GLU
+SnippetConvexSupportBenchmark_release_libraries += glut
+SnippetConvexSupportBenchmark_release_libraries += X11
+SnippetConvexSupportBenchmark_release_libraries += rt
+SnippetConvexSupportBenchmark_release_libraries += pthread
+SnippetConvexSupportBenchmark_release_common_cflags	:= $(SnippetConvexSupportBenchmark_custom_cflags)
+SnippetConvexSupportBenchmark_release_common_cflags    += -MMD
+SnippetConvexSupportBenchmark_release_common_cflags    += $(addprefix -D, $(SnippetConvexSupportBenchmark_release_defines))
+SnippetConvexSupportBenchmark_release_common_cflags    += $(addprefix -I, $(SnippetConvexSupportBenchmark_release_hpaths))
+SnippetConvexSupportBenchmark_release_common_cflags  += -m32
+SnippetConvexSupportBenchmark_release_common_cflags  += -Werror -m32 -fPIC -msse2 -mfpmath=sse -malign-double -fno-exceptions -fno-rtti -fvisibility=hidden -fvisibility-inlines-hidden
+SnippetConvexSupportBenchmark_release_common_cflags  += -Wall -Wextra -Wstrict-aliasing=2 -fdiagnostics-show-option
+SnippetConvexSupportBenchmark_release_common_cflags  += -Wno-uninitialized
+SnippetConvexSupportBenchmark_release_common_cflags  += -O3 -fno-strict-aliasing
+SnippetConvexSupportBenchmark_release_cflags	:= $(SnippetConvexSupportBenchmark_release_common_cflags)
+SnippetConvexSupportBenchmark_release_cppflags	:= $(SnippetConvexSupportBenchmark_release_common_cflags)
+SnippetConvexSupportBenchmark_release_lflags    := $(SnippetConvexSupportBenchmark_custom_lflags)
+SnippetConvexSupportBenchmark_release_lflags    += $(addprefix -L, $(SnippetConvexSupportBenchmark_release_lpaths))
+SnippetConvexSupportBenchmark_release_lflags    += -Wl,--start-group $(addprefix -l, $(SnippetConvexSupportBenchmark_release_libraries)) -Wl,--end-group
+SnippetConvexSupportBenchmark_release_lflags  += -lrt
+SnippetConvexSupportBenchmark_release_lflags  += -Wl,-rpath ./
+SnippetConvexSupportBenchmark_release_lflags  += -m32
+SnippetConvexSupportBenchmark_release_objsdir  = $(OBJS_DIR)/SnippetConvexSupportBenchmark_release
+SnippetConvexSupportBenchmark_release_cpp_o    = $(addprefix $(SnippetConvexSupportBenchmark_release_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.o, $(SnippetConvexSupportBenchmark_cppfiles)))))
+SnippetConvexSupportBenchmark_release_cc_o    = $(addprefix $(SnippetConvexSupportBenchmark_release_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.o, $(SnippetConvexSupportBenchmark_ccfiles)))))
+SnippetConvexSupportBenchmark_release_c_o      = $(addprefix $(SnippetConvexSupportBenchmark_release_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.o, $(SnippetConvexSupportBenchmark_cfiles)))))
+SnippetConvexSupportBenchmark_release_obj      = $(SnippetConvexSupportBenchmark_release_cpp_o) $(SnippetConvexSupportBenchmark_release_cc_o) $(SnippetConvexSupportBenchmark_release_c_o)
+SnippetConvexSupportBenchmark_release_bin      := ./../../../Bin/linux32/SnippetConvexSupportBenchmark
+
+clean_SnippetConvexSupportBenchmark_release: 
+	@$(ECHO) clean SnippetConvexSupportBenchmark release
+	@$(RMDIR) $(SnippetConvexSupportBenchmark_release_objsdir)
+	@$(RMDIR) $(SnippetConvexSupportBenchmark_release_bin)
+	@$(RMDIR) $(DEPSDIR)/SnippetConvexSupportBenchmark/release
+
+build_SnippetConvexSupportBenchmark_release: postbuild_SnippetConvexSupportBenchmark_release
+postbuild_SnippetConvexSupportBenchmark_release: mainbuild_SnippetConvexSupportBenchmark_release
+	@cp -u "../../../../PxShared/bin/linux32/libPxFoundation_x86.so" "../../../Bin/linux32/libPxFoundation_x86.so"; cp -u "../../../../PxShared/bin/linux32/libPxPvdSDK_x86.so" "../../../Bin/linux32/libPxPvdSDK_x86.so"
+mainbuild_SnippetConvexSupportBenchmark_release: prebuild_SnippetConvexSupportBenchmark_release $(SnippetConvexSupportBenchmark_release_bin)
+prebuild_SnippetConvexSupportBenchmark_release:
+
+$(SnippetConvexSupportBenchmark_release_bin): $(SnippetConvexSupportBenchmark_release_obj) build_SnippetRender_release build_SnippetUtils_release 
+	mkdir -p `dirname ./../../../Bin/linux32/SnippetConvexSupportBenchmark`
+	$(CCLD) $(SnippetConvexSupportBenchmark_release_obj) $(SnippetConvexSupportBenchmark_release_lflags) -o $(SnippetConvexSupportBenchmark_release_bin) 
+	$(ECHO) building $@ complete!
+
+SnippetConvexSupportBenchmark_release_DEPDIR = $(dir $(@))/$(*F)
+$(SnippetConvexSupportBenchmark_release_cpp_o): $(SnippetConvexSupportBenchmark_release_objsdir)/%.o:
+	$(ECHO) SnippetConvexSupportBenchmark: compiling release $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetConvexSupportBenchmark_release_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cppfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetConvexSupportBenchmark_release_cppflags) -c $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetConvexSupportBenchmark_release_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cppfiles)) -o $@
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetConvexSupportBenchmark_release_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cppfiles))))))
+	cp $(SnippetConvexSupportBenchmark_release_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetConvexSupportBenchmark_release_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cppfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetConvexSupportBenchmark_release_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetConvexSupportBenchmark_release_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cppfiles))))).P; \
+	  rm -f $(SnippetConvexSupportBenchmark_release_DEPDIR).d
+
+$(SnippetConvexSupportBenchmark_release_cc_o): $(SnippetConvexSupportBenchmark_release_objsdir)/%.o:
+	$(ECHO) SnippetConvexSupportBenchmark: compiling release $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetConvexSupportBenchmark_release_objsdir),, $@))), $(SnippetConvexSupportBenchmark_ccfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetConvexSupportBenchmark_release_cppflags) -c $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetConvexSupportBenchmark_release_objsdir),, $@))), $(SnippetConvexSupportBenchmark_ccfiles)) -o $@
+	mkdir -p $(dir $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetConvexSupportBenchmark_release_objsdir),, $@))), $(SnippetConvexSupportBenchmark_ccfiles))))))
+	cp $(SnippetConvexSupportBenchmark_release_DEPDIR).d $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetConvexSupportBenchmark_release_objsdir),, $@))), $(SnippetConvexSupportBenchmark_ccfiles))))).release.P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetConvexSupportBenchmark_release_DEPDIR).d >> $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetConvexSupportBenchmark_release_objsdir),, $@))), $(SnippetConvexSupportBenchmark_ccfiles))))).release.P; \
+	  rm -f $(SnippetConvexSupportBenchmark_release_DEPDIR).d
+
+$(SnippetConvexSupportBenchmark_release_c_o): $(SnippetConvexSupportBenchmark_release_objsdir)/%.o:
+	$(ECHO) SnippetConvexSupportBenchmark: compiling release $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetConvexSupportBenchmark_release_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cfiles))...
+	mkdir -p $(dir $(@))
+	$(CC) $(SnippetConvexSupportBenchmark_release_cflags) -c $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetConvexSupportBenchmark_release_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cfiles)) -o $@ 
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetConvexSupportBenchmark_release_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cfiles))))))
+	cp $(SnippetConvexSupportBenchmark_release_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetConvexSupportBenchmark_release_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetConvexSupportBenchmark_release_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetConvexSupportBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetConvexSupportBenchmark_release_objsdir),, $@))), $(SnippetConvexSupportBenchmark_cfiles))))).P; \
+	  rm -f $(SnippetConvexSupportBenchmark_release_DEPDIR).d
+
+clean_SnippetConvexSupportBenchmark:  clean_SnippetConvexSupportBenchmark_debug clean_SnippetConvexSupportBenchmark_checked clean_SnippetConvexSupportBenchmark_profile clean_SnippetConvexSupportBenchmark_release
+	rm -rf $(DEPSDIR)
+
+export VERBOSE
+ifndef VERBOSE
+.SILENT:
+endif
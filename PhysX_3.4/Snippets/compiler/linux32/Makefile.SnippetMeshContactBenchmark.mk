@@ -0,0 +1,477 @@
+# Makefile generated by XPJ for LINUX32
+-include Makefile.custom
+ProjectName = SnippetMeshContactBenchmark
+SnippetMeshContactBenchmark_cppfiles   += ./../../SnippetCommon/ClassicMain.cpp
+SnippetMeshContactBenchmark_cppfiles   += ./../../SnippetMeshContactBenchmark/SnippetMeshContactBenchmark.cpp
+
+SnippetMeshContactBenchmark_cpp_debug_dep    = $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/debug/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.P, $(SnippetMeshContactBenchmark_cppfiles)))))
+SnippetMeshContactBenchmark_cc_debug_dep    = $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.debug.P, $(SnippetMeshContactBenchmark_ccfiles)))))
+SnippetMeshContactBenchmark_c_debug_dep      = $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/debug/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.P, $(SnippetMeshContactBenchmark_cfiles)))))
+SnippetMeshContactBenchmark_debug_dep      = $(SnippetMeshContactBenchmark_cpp_debug_dep) $(SnippetMeshContactBenchmark_cc_debug_dep) $(SnippetMeshContactBenchmark_c_debug_dep)
+-include $(SnippetMeshContactBenchmark_debug_dep)
+SnippetMeshContactBenchmark_cpp_checked_dep    = $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/checked/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.P, $(SnippetMeshContactBenchmark_cppfiles)))))
+SnippetMeshContactBenchmark_cc_checked_dep    = $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.checked.P, $(SnippetMeshContactBenchmark_ccfiles)))))
+SnippetMeshContactBenchmark_c_checked_dep      = $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/checked/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.P, $(SnippetMeshContactBenchmark_cfiles)))))
+SnippetMeshContactBenchmark_checked_dep      = $(SnippetMeshContactBenchmark_cpp_checked_dep) $(SnippetMeshContactBenchmark_cc_checked_dep) $(SnippetMeshContactBenchmark_c_checked_dep)
+-include $(SnippetMeshContactBenchmark_checked_dep)
+SnippetMeshContactBenchmark_cpp_profile_dep    = $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/profile/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.P, $(SnippetMeshContactBenchmark_cppfiles)))))
+SnippetMeshContactBenchmark_cc_profile_dep    = $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.profile.P, $(SnippetMeshContactBenchmark_ccfiles)))))
+SnippetMeshContactBenchmark_c_profile_dep      = $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/profile/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.P, $(SnippetMeshContactBenchmark_cfiles)))))
+SnippetMeshContactBenchmark_profile_dep      = $(SnippetMeshContactBenchmark_cpp_profile_dep) $(SnippetMeshContactBenchmark_cc_profile_dep) $(SnippetMeshContactBenchmark_c_profile_dep)
+-include $(SnippetMeshContactBenchmark_profile_dep)
+SnippetMeshContactBenchmark_cpp_release_dep    = $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/release/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.P, $(SnippetMeshContactBenchmark_cppfiles)))))
+SnippetMeshContactBenchmark_cc_release_dep    = $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.release.P, $(SnippetMeshContactBenchmark_ccfiles)))))
+SnippetMeshContactBenchmark_c_release_dep      = $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/release/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.P, $(SnippetMeshContactBenchmark_cfiles)))))
+SnippetMeshContactBenchmark_release_dep      = $(SnippetMeshContactBenchmark_cpp_release_dep) $(SnippetMeshContactBenchmark_cc_release_dep) $(SnippetMeshContactBenchmark_c_release_dep)
+-include $(SnippetMeshContactBenchmark_release_dep)
+SnippetMeshContactBenchmark_debug_hpaths    := 
+SnippetMeshContactBenchmark_debug_hpaths    += ./../../../Include
+SnippetMeshContactBenchmark_debug_hpaths    += ./../../../../PxShared/include
+SnippetMeshContactBenchmark_debug_hpaths    += ./../../../../PxShared/src/foundation/include
+SnippetMeshContactBenchmark_debug_hpaths    += ./../../../../PxShared/src/fastxml/include
+SnippetMeshContactBenchmark_debug_lpaths    := 
+SnippetMeshContactBenchmark_debug_lpaths    += ./../../../Lib/linux32
+SnippetMeshContactBenchmark_debug_lpaths    += ./../../lib/linux32
+SnippetMeshContactBenchmark_debug_lpaths    += ./../../../Bin/linux32
+SnippetMeshContactBenchmark_debug_lpaths    += ./../../../../PxShared/lib/linux32
+SnippetMeshContactBenchmark_debug_lpaths    += ./../../../../PxShared/bin/linux32
+SnippetMeshContactBenchmark_debug_lpaths    += ./../../lib/linux32
+SnippetMeshContactBenchmark_debug_defines   := $(SnippetMeshContactBenchmark_custom_defines)
+SnippetMeshContactBenchmark_debug_defines   += PHYSX_PROFILE_SDK
+SnippetMeshContactBenchmark_debug_defines   += RENDER_SNIPPET
+SnippetMeshContactBenchmark_debug_defines   += _DEBUG
+SnippetMeshContactBenchmark_debug_defines   += PX_DEBUG=1
+SnippetMeshContactBenchmark_debug_defines   += PX_CHECKED=1
+SnippetMeshContactBenchmark_debug_defines   += PX_SUPPORT_PVD=1
+SnippetMeshContactBenchmark_debug_libraries := 
+SnippetMeshContactBenchmark_debug_libraries += SnippetRenderDEBUG
+SnippetMeshContactBenchmark_debug_libraries += SnippetUtilsDEBUG
+SnippetMeshContactBenchmark_debug_libraries += PhysX3DEBUG_x86
+SnippetMeshContactBenchmark_debug_libraries += PhysX3CookingDEBUG_x86
+SnippetMeshContactBenchmark_debug_libraries += PhysX3CharacterKinematicDEBUG_x86
+SnippetMeshContactBenchmark_debug_libraries += PhysX3ExtensionsDEBUG
+SnippetMeshContactBenchmark_debug_libraries += PhysX3VehicleDEBUG
+SnippetMeshContactBenchmark_debug_libraries += PxPvdSDKDEBUG_x86
+SnippetMeshContactBenchmark_debug_libraries += PhysX3CommonDEBUG_x86
+SnippetMeshContactBenchmark_debug_libraries += PxFoundationDEBUG_x86
+SnippetMeshContactBenchmark_debug_libraries += PxTaskDEBUG
+SnippetMeshContactBenchmark_debug_libraries += PsFastXmlDEBUG
+SnippetMeshContactBenchmark_debug_libraries += SnippetUtilsDEBUG
+SnippetMeshContactBenchmark_debug_libraries += SnippetRenderDEBUG
+SnippetMeshContactBenchmark_debug_libraries += GL
+SnippetMeshContactBenchmark_debug_libraries += GLU
+SnippetMeshContactBenchmark_debug_libraries += glut
+SnippetMeshContactBenchmark_debug_libraries += X11
+SnippetMeshContactBenchmark_debug_libraries += rt
+SnippetMeshContactBenchmark_debug_libraries += pthread
+SnippetMeshContactBenchmark_debug_common_cflags	:= $(SnippetMeshContactBenchmark_custom_cflags)
+SnippetMeshContactBenchmark_debug_common_cflags    += -MMD
+SnippetMeshContactBenchmark_debug_common_cflags    += $(addprefix -D, $(SnippetMeshContactBenchmark_debug_defines))
+SnippetMeshContactBenchmark_debug_common_cflags    += $(addprefix -I, $(SnippetMeshContactBenchmark_debug_hpaths))
+SnippetMeshContactBenchmark_debug_common_cflags  += -m32
+SnippetMeshContactBenchmark_debug_common_cflags  += -Werror -m32 -fPIC -msse2 -mfpmath=sse -malign-double -fno-exceptions -fno-rtti -fvisibility=hidden -fvisibility-inlines-hidden
+SnippetMeshContactBenchmark_debug_common_cflags  += -Wall -Wextra -Wstrict-aliasing=2 -fdiagnostics-show-option
+SnippetMeshContactBenchmark_debug_common_cflags  += -Wno-uninitialized
+SnippetMeshContactBenchmark_debug_common_cflags  += -g3 -gdwarf-2
+SnippetMeshContactBenchmark_debug_cflags	:= $(SnippetMeshContactBenchmark_debug_common_cflags)
+SnippetMeshContactBenchmark_debug_cppflags	:= $(SnippetMeshContactBenchmark_debug_common_cflags)
+SnippetMeshContactBenchmark_debug_lflags    := $(SnippetMeshContactBenchmark_custom_lflags)
+SnippetMeshContactBenchmark_debug_lflags    += $(addprefix -L, $(SnippetMeshContactBenchmark_debug_lpaths))
+SnippetMeshContactBenchmark_debug_lflags    += -Wl,--start-group $(addprefix -l, $(SnippetMeshContactBenchmark_debug_libraries)) -Wl,--end-group
+SnippetMeshContactBenchmark_debug_lflags  += -lrt
+SnippetMeshContactBenchmark_debug_lflags  += -Wl,-rpath ./
+SnippetMeshContactBenchmark_debug_lflags  += -m32
+SnippetMeshContactBenchmark_debug_objsdir  = $(OBJS_DIR)/SnippetMeshContactBenchmark_debug
+SnippetMeshContactBenchmark_debug_cpp_o    = $(addprefix $(SnippetMeshContactBenchmark_debug_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.o, $(SnippetMeshContactBenchmark_cppfiles)))))
+SnippetMeshContactBenchmark_debug_cc_o    = $(addprefix $(SnippetMeshContactBenchmark_debug_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.o, $(SnippetMeshContactBenchmark_ccfiles)))))
+SnippetMeshContactBenchmark_debug_c_o      = $(addprefix $(SnippetMeshContactBenchmark_debug_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.o, $(SnippetMeshContactBenchmark_cfiles)))))
+SnippetMeshContactBenchmark_debug_obj      = $(SnippetMeshContactBenchmark_debug_cpp_o) $(SnippetMeshContactBenchmark_debug_cc_o) $(SnippetMeshContactBenchmark_debug_c_o)
+SnippetMeshContactBenchmark_debug_bin      := ./../../../Bin/linux32/SnippetMeshContactBenchmarkDEBUG
+
+clean_SnippetMeshContactBenchmark_debug: 
+	@$(ECHO) clean SnippetMeshContactBenchmark debug
+	@$(RMDIR) $(SnippetMeshContactBenchmark_debug_objsdir)
+	@$(RMDIR) $(SnippetMeshContactBenchmark_debug_bin)
+	@$(RMDIR) $(DEPSDIR)/SnippetMeshContactBenchmark/debug
+
+build_SnippetMeshContactBenchmark_debug: postbuild_SnippetMeshContactBenchmark_debug
+postbuild_SnippetMeshContactBenchmark_debug: mainbuild_SnippetMeshContactBenchmark_debug
+	@cp -u "../../../../PxShared/bin/linux32/libPxFoundationDEBUG_x86.so" "../../../Bin/linux32/libPxFoundationDEBUG_x86.so"; cp -u "../../../../PxShared/bin/linux32/libPxPvdSDKDEBUG_x86.so" "../../../Bin/linux32/libPxPvdSDKDEBUG_x86.so"
+mainbuild_SnippetMeshContactBenchmark_debug: prebuild_SnippetMeshContactBenchmark_debug $(SnippetMeshContactBenchmark_debug_bin)
+prebuild_SnippetMeshContactBenchmark_debug:
+
+$(SnippetMeshContactBenchmark_debug_bin): $(SnippetMeshContactBenchmark_debug_obj) build_SnippetRender_debug build_SnippetUtils_debug 
+	mkdir -p `dirname ./../../../Bin/linux32/SnippetMeshContactBenchmarkDEBUG`
+	$(CCLD) $(SnippetMeshContactBenchmark_debug_obj) $(SnippetMeshContactBenchmark_debug_lflags) -o $(SnippetMeshContactBenchmark_debug_bin) 
+	$(ECHO) building $@ complete!
+
+SnippetMeshContactBenchmark_debug_DEPDIR = $(dir $(@))/$(*F)
+$(SnippetMeshContactBenchmark_debug_cpp_o): $(SnippetMeshContactBenchmark_debug_objsdir)/%.o:
+	$(ECHO) SnippetMeshContactBenchmark: compiling debug $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetMeshContactBenchmark_debug_objsdir),, $@))), $(SnippetMeshContactBenchmark_cppfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetMeshContactBenchmark_debug_cppflags) -c $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetMeshContactBenchmark_debug_objsdir),, $@))), $(SnippetMeshContactBenchmark_cppfiles)) -o $@
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetMeshContactBenchmark_debug_objsdir),, $@))), $(SnippetMeshContactBenchmark_cppfiles))))))
+	cp $(SnippetMeshContactBenchmark_debug_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetMeshContactBenchmark_debug_objsdir),, $@))), $(SnippetMeshContactBenchmark_cppfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetMeshContactBenchmark_debug_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetMeshContactBenchmark_debug_objsdir),, $@))), $(SnippetMeshContactBenchmark_cppfiles))))).P; \
+	  rm -f $(SnippetMeshContactBenchmark_debug_DEPDIR).d
+
+$(SnippetMeshContactBenchmark_debug_cc_o): $(SnippetMeshContactBenchmark_debug_objsdir)/%.o:
+	$(ECHO) SnippetMeshContactBenchmark: compiling debug $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetMeshContactBenchmark_debug_objsdir),, $@))), $(SnippetMeshContactBenchmark_ccfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetMeshContactBenchmark_debug_cppflags) -c $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetMeshContactBenchmark_debug_objsdir),, $@))), $(SnippetMeshContactBenchmark_ccfiles)) -o $@
+	mkdir -p $(dir $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetMeshContactBenchmark_debug_objsdir),, $@))), $(SnippetMeshContactBenchmark_ccfiles))))))
+	cp $(SnippetMeshContactBenchmark_debug_DEPDIR).d $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetMeshContactBenchmark_debug_objsdir),, $@))), $(SnippetMeshContactBenchmark_ccfiles))))).debug.P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetMeshContactBenchmark_debug_DEPDIR).d >> $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetMeshContactBenchmark_debug_objsdir),, $@))), $(SnippetMeshContactBenchmark_ccfiles))))).debug.P; \
+	  rm -f $(SnippetMeshContactBenchmark_debug_DEPDIR).d
+
+$(SnippetMeshContactBenchmark_debug_c_o): $(SnippetMeshContactBenchmark_debug_objsdir)/%.o:
+	$(ECHO) SnippetMeshContactBenchmark: compiling debug $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetMeshContactBenchmark_debug_objsdir),, $@))), $(SnippetMeshContactBenchmark_cfiles))...
+	mkdir -p $(dir $(@))
+	$(CC) $(SnippetMeshContactBenchmark_debug_cflags) -c $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetMeshContactBenchmark_debug_objsdir),, $@))), $(SnippetMeshContactBenchmark_cfiles)) -o $@ 
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetMeshContactBenchmark_debug_objsdir),, $@))), $(SnippetMeshContactBenchmark_cfiles))))))
+	cp $(SnippetMeshContactBenchmark_debug_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetMeshContactBenchmark_debug_objsdir),, $@))), $(SnippetMeshContactBenchmark_cfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetMeshContactBenchmark_debug_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetMeshContactBenchmark_debug_objsdir),, $@))), $(SnippetMeshContactBenchmark_cfiles))))).P; \
+	  rm -f $(SnippetMeshContactBenchmark_debug_DEPDIR).d
+
+SnippetMeshContactBenchmark_checked_hpaths    := 
+SnippetMeshContactBenchmark_checked_hpaths    += ./../../../Include
+SnippetMeshContactBenchmark_checked_hpaths    += ./../../../../PxShared/include
+SnippetMeshContactBenchmark_checked_hpaths    += ./../../../../PxShared/src/foundation/include
+SnippetMeshContactBenchmark_checked_hpaths    += ./../../../../PxShared/src/fastxml/include
+SnippetMeshContactBenchmark_checked_lpaths    := 
+SnippetMeshContactBenchmark_checked_lpaths    += ./../../../Lib/linux32
+SnippetMeshContactBenchmark_checked_lpaths    += ./../../lib/linux32
+SnippetMeshContactBenchmark_checked_lpaths    += ./../../../Bin/linux32
+SnippetMeshContactBenchmark_checked_lpaths    += ./../../../../PxShared/lib/linux32
+SnippetMeshContactBenchmark_checked_lpaths    += ./../../../../PxShared/bin/linux32
+SnippetMeshContactBenchmark_checked_lpaths    += ./../../lib/linux32
+SnippetMeshContactBenchmark_checked_defines   := $(SnippetMeshContactBenchmark_custom_defines)
+SnippetMeshContactBenchmark_checked_defines   += PHYSX_PROFILE_SDK
+SnippetMeshContactBenchmark_checked_defines   += RENDER_SNIPPET
+SnippetMeshContactBenchmark_checked_defines   += NDEBUG
+SnippetMeshContactBenchmark_checked_defines   += PX_CHECKED=1
+SnippetMeshContactBenchmark_checked_defines   += PX_SUPPORT_PVD=1
+SnippetMeshContactBenchmark_checked_libraries := 
+SnippetMeshContactBenchmark_checked_libraries += SnippetRenderCHECKED
+SnippetMeshContactBenchmark_checked_libraries += SnippetUtilsCHECKED
+SnippetMeshContactBenchmark_checked_libraries += PhysX3CHECKED_x86
+SnippetMeshContactBenchmark_checked_libraries += PhysX3CookingCHECKED_x86
+SnippetMeshContactBenchmark_checked_libraries += PhysX3CharacterKinematicCHECKED_x86
+SnippetMeshContactBenchmark_checked_libraries += PhysX3ExtensionsCHECKED
+SnippetMeshContactBenchmark_checked_libraries += PhysX3VehicleCHECKED
+SnippetMeshContactBenchmark_checked_libraries += PxPvdSDKCHECKED_x86
+SnippetMeshContactBenchmark_checked_libraries += PhysX3CommonCHECKED_x86
+SnippetMeshContactBenchmark_checked_libraries += PxFoundationCHECKED_x86
+SnippetMeshContactBenchmark_checked_libraries += PxTaskCHECKED
+SnippetMeshContactBenchmark_checked_libraries += PsFastXmlCHECKED
+SnippetMeshContactBenchmark_checked_libraries += SnippetUtilsCHECKED
+SnippetMeshContactBenchmark_checked_libraries += SnippetRenderCHECKED
+SnippetMeshContactBenchmark_checked_libraries += GL
+SnippetMeshContactBenchmark_checked_libraries += GLU
+SnippetMeshContactBenchmark_checked_libraries += glut
+SnippetMeshContactBenchmark_checked_libraries += X11
+SnippetMeshContactBenchmark_checked_libraries += rt
+SnippetMeshContactBenchmark_checked_libraries += pthread
+SnippetMeshContactBenchmark_checked_common_cflags	:= $(SnippetMeshContactBenchmark_custom_cflags)
+SnippetMeshContactBenchmark_checked_common_cflags    += -MMD
+SnippetMeshContactBenchmark_checked_common_cflags    += $(addprefix -D, $(SnippetMeshContactBenchmark_checked_defines))
+SnippetMeshContactBenchmark_checked_common_cflags    += $(addprefix -I, $(SnippetMeshContactBenchmark_checked_hpaths))
+SnippetMeshContactBenchmark_checked_common_cflags  += -m32
+SnippetMeshContactBenchmark_checked_common_cflags  += -Werror -m32 -fPIC -msse2 -mfpmath=sse -malign-double -fno-exceptions -fno-rtti -fvisibility=hidden -fvisibility-inlines-hidden
+SnippetMeshContactBenchmark_checked_common_cflags  += -Wall -Wextra -Wstrict-aliasing=2 -fdiagnostics-show-option
+SnippetMeshContactBenchmark_checked_common_cflags  += -Wno-uninitialized
+SnippetMeshContactBenchmark_checked_common_cflags  += -g3 -gdwarf-2 -O3 -fno-strict-aliasing
+SnippetMeshContactBenchmark_checked_cflags	:= $(SnippetMeshContactBenchmark_checked_common_cflags)
+SnippetMeshContactBenchmark_checked_cppflags	:= $(SnippetMeshContactBenchmark_checked_common_cflags)
+SnippetMeshContactBenchmark_checked_lflags    := $(SnippetMeshContactBenchmark_custom_lflags)
+SnippetMeshContactBenchmark_checked_lflags    += $(addprefix -L, $(SnippetMeshContactBenchmark_checked_lpaths))
+SnippetMeshContactBenchmark_checked_lflags    += -Wl,--start-group $(addprefix -l, $(SnippetMeshContactBenchmark_checked_libraries)) -Wl,--end-group
+SnippetMeshContactBenchmark_checked_lflags  += -lrt
+SnippetMeshContactBenchmark_checked_lflags  += -Wl,-rpath ./
+SnippetMeshContactBenchmark_checked_lflags  += -m32
+SnippetMeshContactBenchmark_checked_objsdir  = $(OBJS_DIR)/SnippetMeshContactBenchmark_checked
+SnippetMeshContactBenchmark_checked_cpp_o    = $(addprefix $(SnippetMeshContactBenchmark_checked_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.o, $(SnippetMeshContactBenchmark_cppfiles)))))
+SnippetMeshContactBenchmark_checked_cc_o    = $(addprefix $(SnippetMeshContactBenchmark_checked_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.o, $(SnippetMeshContactBenchmark_ccfiles)))))
+SnippetMeshContactBenchmark_checked_c_o      = $(addprefix $(SnippetMeshContactBenchmark_checked_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.o, $(SnippetMeshContactBenchmark_cfiles)))))
+SnippetMeshContactBenchmark_checked_obj      = $(SnippetMeshContactBenchmark_checked_cpp_o) $(SnippetMeshContactBenchmark_checked_cc_o) $(SnippetMeshContactBenchmark_checked_c_o)
+SnippetMeshContactBenchmark_checked_bin      := ./../../../Bin/linux32/SnippetMeshContactBenchmarkCHECKED
+
+clean_SnippetMeshContactBenchmark_checked: 
+	@$(ECHO) clean SnippetMeshContactBenchmark checked
+	@$(RMDIR) $(SnippetMeshContactBenchmark_checked_objsdir)
+	@$(RMDIR) $(SnippetMeshContactBenchmark_checked_bin)
+	@$(RMDIR) $(DEPSDIR)/SnippetMeshContactBenchmark/checked
+
+build_SnippetMeshContactBenchmark_checked: postbuild_SnippetMeshContactBenchmark_checked
+postbuild_SnippetMeshContactBenchmark_checked: mainbuild_SnippetMeshContactBenchmark_checked
+	@cp -u "../../../../PxShared/bin/linux32/libPxFoundationCHECKED_x86.so" "../../../Bin/linux32/libPxFoundationCHECKED_x86.so"; cp -u "../../../../PxShared/bin/linux32/libPxPvdSDKCHECKED_x86.so" "../../../Bin/linux32/libPxPvdSDKCHECKED_x86.so"
+mainbuild_SnippetMeshContactBenchmark_checked: prebuild_SnippetMeshContactBenchmark_checked $(SnippetMeshContactBenchmark_checked_bin)
+prebuild_SnippetMeshContactBenchmark_checked:
+
+$(SnippetMeshContactBenchmark_checked_bin): $(SnippetMeshContactBenchmark_checked_obj) build_SnippetRender_checked build_SnippetUtils_checked 
+	mkdir -p `dirname ./../../../Bin/linux32/SnippetMeshContactBenchmarkCHECKED`
+	$(CCLD) $(SnippetMeshContactBenchmark_checked_obj) $(SnippetMeshContactBenchmark_checked_lflags) -o $(SnippetMeshContactBenchmark_checked_bin) 
+	$(ECHO) building $@ complete!
+
+SnippetMeshContactBenchmark_checked_DEPDIR = $(dir $(@))/$(*F)
+$(SnippetMeshContactBenchmark_checked_cpp_o): $(SnippetMeshContactBenchmark_checked_objsdir)/%.o:
+	$(ECHO) SnippetMeshContactBenchmark: compiling checked $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetMeshContactBenchmark_checked_objsdir),, $@))), $(SnippetMeshContactBenchmark_cppfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetMeshContactBenchmark_checked_cppflags) -c $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetMeshContactBenchmark_checked_objsdir),, $@))), $(SnippetMeshContactBenchmark_cppfiles)) -o $@
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetMeshContactBenchmark_checked_objsdir),, $@))), $(SnippetMeshContactBenchmark_cppfiles))))))
+	cp $(SnippetMeshContactBenchmark_checked_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetMeshContactBenchmark_checked_objsdir),, $@))), $(SnippetMeshContactBenchmark_cppfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetMeshContactBenchmark_checked_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetMeshContactBenchmark_checked_objsdir),, $@))), $(SnippetMeshContactBenchmark_cppfiles))))).P; \
+	  rm -f $(SnippetMeshContactBenchmark_checked_DEPDIR).d
+
+$(SnippetMeshContactBenchmark_checked_cc_o): $(SnippetMeshContactBenchmark_checked_objsdir)/%.o:
+	$(ECHO) SnippetMeshContactBenchmark: compiling checked $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetMeshContactBenchmark_checked_objsdir),, $@))), $(SnippetMeshContactBenchmark_ccfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetMeshContactBenchmark_checked_cppflags) -c $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetMeshContactBenchmark_checked_objsdir),, $@))), $(SnippetMeshContactBenchmark_ccfiles)) -o $@
+	mkdir -p $(dir $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetMeshContactBenchmark_checked_objsdir),, $@))), $(SnippetMeshContactBenchmark_ccfiles))))))
+	cp $(SnippetMeshContactBenchmark_checked_DEPDIR).d $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetMeshContactBenchmark_checked_objsdir),, $@))), $(SnippetMeshContactBenchmark_ccfiles))))).checked.P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetMeshContactBenchmark_checked_DEPDIR).d >> $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetMeshContactBenchmark_checked_objsdir),, $@))), $(SnippetMeshContactBenchmark_ccfiles))))).checked.P; \
+	  rm -f $(SnippetMeshContactBenchmark_checked_DEPDIR).d
+
+$(SnippetMeshContactBenchmark_checked_c_o): $(SnippetMeshContactBenchmark_checked_objsdir)/%.o:
+	$(ECHO) SnippetMeshContactBenchmark: compiling checked $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetMeshContactBenchmark_checked_objsdir),, $@))), $(SnippetMeshContactBenchmark_cfiles))...
+	mkdir -p $(dir $(@))
+	$(CC) $(SnippetMeshContactBenchmark_checked_cflags) -c $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetMeshContactBenchmark_checked_objsdir),, $@))), $(SnippetMeshContactBenchmark_cfiles)) -o $@ 
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetMeshContactBenchmark_checked_objsdir),, $@))), $(SnippetMeshContactBenchmark_cfiles))))))
+	cp $(SnippetMeshContactBenchmark_checked_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetMeshContactBenchmark_checked_objsdir),, $@))), $(SnippetMeshContactBenchmark_cfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetMeshContactBenchmark_checked_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetMeshContactBenchmark_checked_objsdir),, $@))), $(SnippetMeshContactBenchmark_cfiles))))).P; \
+	  rm -f $(SnippetMeshContactBenchmark_checked_DEPDIR).d
+
+SnippetMeshContactBenchmark_profile_hpaths    := 
+SnippetMeshContactBenchmark_profile_hpaths    += ./../../../Include
+SnippetMeshContactBenchmark_profile_hpaths    += ./../../../../PxShared/include
+SnippetMeshContactBenchmark_profile_hpaths    += ./../../../../PxShared/src/foundation/include
+SnippetMeshContactBenchmark_profile_hpaths    += ./../../../../PxShared/src/fastxml/include
+SnippetMeshContactBenchmark_profile_lpaths    := 
+SnippetMeshContactBenchmark_profile_lpaths    += ./../../../Lib/linux32
+SnippetMeshContactBenchmark_profile_lpaths    += ./../../lib/linux32
+SnippetMeshContactBenchmark_profile_lpaths    += ./../../../Bin/linux32
+SnippetMeshContactBenchmark_profile_lpaths    += ./../../../../PxShared/lib/linux32
+SnippetMeshContactBenchmark_profile_lpaths    += ./../../../../PxShared/bin/linux32
+SnippetMeshContactBenchmark_profile_lpaths    += ./../../lib/linux32
+SnippetMeshContactBenchmark_profile_defines   := $(SnippetMeshContactBenchmark_custom_defines)
+SnippetMeshContactBenchmark_profile_defines   += PHYSX_PROFILE_SDK
+SnippetMeshContactBenchmark_profile_defines   += RENDER_SNIPPET
+SnippetMeshContactBenchmark_profile_defines   += NDEBUG
+SnippetMeshContactBenchmark_profile_defines   += PX_PROFILE=1
+SnippetMeshContactBenchmark_profile_defines   += PX_SUPPORT_PVD=1
+SnippetMeshContactBenchmark_profile_libraries := 
+SnippetMeshContactBenchmark_profile_libraries += SnippetRenderPROFILE
+SnippetMeshContactBenchmark_profile_libraries += SnippetUtilsPROFILE
+SnippetMeshContactBenchmark_profile_libraries += PhysX3PROFILE_x86
+SnippetMeshContactBenchmark_profile_libraries += PhysX3CookingPROFILE_x86
+SnippetMeshContactBenchmark_profile_libraries += PhysX3CharacterKinematicPROFILE_x86
+SnippetMeshContactBenchmark_profile_libraries += PhysX3ExtensionsPROFILE
+SnippetMeshContactBenchmark_profile_libraries += PhysX3VehiclePROFILE
+SnippetMeshContactBenchmark_profile_libraries += PxPvdSDKPROFILE_x86
+SnippetMeshContactBenchmark_profile_libraries += PhysX3CommonPROFILE_x86
+SnippetMeshContactBenchmark_profile_libraries += PxFoundationPROFILE_x86
+SnippetMeshContactBenchmark_profile_libraries += PxTaskPROFILE
+SnippetMeshContactBenchmark_profile_libraries += PsFastXmlPROFILE
+SnippetMeshContactBenchmark_profile_libraries += SnippetUtilsPROFILE
+SnippetMeshContactBenchmark_profile_libraries += SnippetRenderPROFILE
+SnippetMeshContactBenchmark_profile_libraries += GL
+SnippetMeshContactBenchmark_profile_libraries += GLU
+SnippetMeshContactBenchmark_profile_libraries += glut
+SnippetMeshContactBenchmark_profile_libraries += X11
+SnippetMeshContactBenchmark_profile_libraries += rt
+SnippetMeshContactBenchmark_profile_libraries += pthread
+SnippetMeshContactBenchmark_profile_common_cflags	:= $(SnippetMeshContactBenchmark_custom_cflags)
+SnippetMeshContactBenchmark_profile_common_cflags    += -MMD
+SnippetMeshContactBenchmark_profile_common_cflags    += $(addprefix -D, $(SnippetMeshContactBenchmark_profile_defines))
+SnippetMeshContactBenchmark_profile_common_cflags    += $(addprefix -I, $(SnippetMeshContactBenchmark_profile_hpaths))
+SnippetMeshContactBenchmark_profile_common_cflags  += -m32
+SnippetMeshContactBenchmark_profile_common_cflags  += -Werror -m32 -fPIC -msse2 -mfpmath=sse -malign-double -fno-exceptions -fno-rtti -fvisibility=hidden -fvisibility-inlines-hidden
+SnippetMeshContactBenchmark_profile_common_cflags  += -Wall -Wextra -Wstrict-aliasing=2 -fdiagnostics-show-option
+SnippetMeshContactBenchmark_profile_common_cflags  += -Wno-uninitialized
+SnippetMeshContactBenchmark_profile_common_cflags  += -O3 -fno-strict-aliasing
+SnippetMeshContactBenchmark_profile_cflags	:= $(SnippetMeshContactBenchmark_profile_common_cflags)
+SnippetMeshContactBenchmark_profile_cppflags	:= $(SnippetMeshContactBenchmark_profile_common_cflags)
+SnippetMeshContactBenchmark_profile_lflags    := $(SnippetMeshContactBenchmark_custom_lflags)
+SnippetMeshContactBenchmark_profile_lflags    += $(addprefix -L, $(SnippetMeshContactBenchmark_profile_lpaths))
+SnippetMeshContactBenchmark_profile_lflags    += -Wl,--start-group $(addprefix -l, $(SnippetMeshContactBenchmark_profile_libraries)) -Wl,--end-group
+SnippetMeshContactBenchmark_profile_lflags  += -lrt
+SnippetMeshContactBenchmark_profile_lflags  += -Wl,-rpath ./
+SnippetMeshContactBenchmark_profile_lflags  += -m32
+SnippetMeshContactBenchmark_profile_objsdir  = $(OBJS_DIR)/SnippetMeshContactBenchmark_profile
+SnippetMeshContactBenchmark_profile_cpp_o    = $(addprefix $(SnippetMeshContactBenchmark_profile_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.o, $(SnippetMeshContactBenchmark_cppfiles)))))
+SnippetMeshContactBenchmark_profile_cc_o    = $(addprefix $(SnippetMeshContactBenchmark_profile_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.o, $(SnippetMeshContactBenchmark_ccfiles)))))
+SnippetMeshContactBenchmark_profile_c_o      = $(addprefix $(SnippetMeshContactBenchmark_profile_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.o, $(SnippetMeshContactBenchmark_cfiles)))))
+SnippetMeshContactBenchmark_profile_obj      = $(SnippetMeshContactBenchmark_profile_cpp_o) $(SnippetMeshContactBenchmark_profile_cc_o) $(SnippetMeshContactBenchmark_profile_c_o)
+SnippetMeshContactBenchmark_profile_bin      := ./../../../Bin/linux32/SnippetMeshContactBenchmarkPROFILE
+
+clean_SnippetMeshContactBenchmark_profile: 
+	@$(ECHO) clean SnippetMeshContactBenchmark profile
+	@$(RMDIR) $(SnippetMeshContactBenchmark_profile_objsdir)
+	@$(RMDIR) $(SnippetMeshContactBenchmark_profile_bin)
+	@$(RMDIR) $(DEPSDIR)/SnippetMeshContactBenchmark/profile
+
+build_SnippetMeshContactBenchmark_profile: postbuild_SnippetMeshContactBenchmark_profile
+postbuild_SnippetMeshContactBenchmark_profile: mainbuild_SnippetMeshContactBenchmark_profile
+	@cp -u "../../../../PxShared/bin/linux32/libPxFoundationPROFILE_x86.so" "../../../Bin/linux32/libPxFoundationPROFILE_x86.so"; cp -u "../../../../PxShared/bin/linux32/libPxPvdSDKPROFILE_x86.so" "../../../Bin/linux32/libPxPvdSDKPROFILE_x86.so"
+mainbuild_SnippetMeshContactBenchmark_profile: prebuild_SnippetMeshContactBenchmark_profile $(SnippetMeshContactBenchmark_profile_bin)
+prebuild_SnippetMeshContactBenchmark_profile:
+
+$(SnippetMeshContactBenchmark_profile_bin): $(SnippetMeshContactBenchmark_profile_obj) build_SnippetRender_profile build_SnippetUtils_profile 
+	mkdir -p `dirname ./../../../Bin/linux32/SnippetMeshContactBenchmarkPROFILE`
+	$(CCLD) $(SnippetMeshContactBenchmark_profile_obj) $(SnippetMeshContactBenchmark_profile_lflags) -o $(SnippetMeshContactBenchmark_profile_bin) 
+	$(ECHO) building $@ complete!
+
+SnippetMeshContactBenchmark_profile_DEPDIR = $(dir $(@))/$(*F)
+$(SnippetMeshContactBenchmark_profile_cpp_o): $(SnippetMeshContactBenchmark_profile_objsdir)/%.o:
+	$(ECHO) SnippetMeshContactBenchmark: compiling profile $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetMeshContactBenchmark_profile_objsdir),, $@))), $(SnippetMeshContactBenchmark_cppfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetMeshContactBenchmark_profile_cppflags) -c $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetMeshContactBenchmark_profile_objsdir),, $@))), $(SnippetMeshContactBenchmark_cppfiles)) -o $@
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetMeshContactBenchmark_profile_objsdir),, $@))), $(SnippetMeshContactBenchmark_cppfiles))))))
+	cp $(SnippetMeshContactBenchmark_profile_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetMeshContactBenchmark_profile_objsdir),, $@))), $(SnippetMeshContactBenchmark_cppfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetMeshContactBenchmark_profile_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetMeshContactBenchmark_profile_objsdir),, $@))), $(SnippetMeshContactBenchmark_cppfiles))))).P; \
+	  rm -f $(SnippetMeshContactBenchmark_profile_DEPDIR).d
+
+$(SnippetMeshContactBenchmark_profile_cc_o): $(SnippetMeshContactBenchmark_profile_objsdir)/%.o:
+	$(ECHO) SnippetMeshContactBenchmark: compiling profile $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetMeshContactBenchmark_profile_objsdir),, $@))), $(SnippetMeshContactBenchmark_ccfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetMeshContactBenchmark_profile_cppflags) -c $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetMeshContactBenchmark_profile_objsdir),, $@))), $(SnippetMeshContactBenchmark_ccfiles)) -o $@
+	mkdir -p $(dir $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetMeshContactBenchmark_profile_objsdir),, $@))), $(SnippetMeshContactBenchmark_ccfiles))))))
+	cp $(SnippetMeshContactBenchmark_profile_DEPDIR).d $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetMeshContactBenchmark_profile_objsdir),, $@))), $(SnippetMeshContactBenchmark_ccfiles))))).profile.P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetMeshContactBenchmark_profile_DEPDIR).d >> $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetMeshContactBenchmark_profile_objsdir),, $@))), $(SnippetMeshContactBenchmark_ccfiles))))).profile.P; \
+	  rm -f $(SnippetMeshContactBenchmark_profile_DEPDIR).d
+
+$(SnippetMeshContactBenchmark_profile_c_o): $(SnippetMeshContactBenchmark_profile_objsdir)/%.o:
+	$(ECHO) SnippetMeshContactBenchmark: compiling profile $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetMeshContactBenchmark_profile_objsdir),, $@))), $(SnippetMeshContactBenchmark_cfiles))...
+	mkdir -p $(dir $(@))
+	$(CC) $(SnippetMeshContactBenchmark_profile_cflags) -c $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetMeshContactBenchmark_profile_objsdir),, $@))), $(SnippetMeshContactBenchmark_cfiles)) -o $@ 
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetMeshContactBenchmark_profile_objsdir),, $@))), $(SnippetMeshContactBenchmark_cfiles))))))
+	cp $(SnippetMeshContactBenchmark_profile_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetMeshContactBenchmark_profile_objsdir),, $@))), $(SnippetMeshContactBenchmark_cfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetMeshContactBenchmark_profile_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetMeshContactBenchmark_profile_objsdir),, $@))), $(SnippetMeshContactBenchmark_cfiles))))).P; \
+	  rm -f $(SnippetMeshContactBenchmark_profile_DEPDIR).d
+
+SnippetMeshContactBenchmark_release_hpaths    := 
+SnippetMeshContactBenchmark_release_hpaths    += ./../../../Include
+SnippetMeshContactBenchmark_release_hpaths    += ./../../../../PxShared/include
+SnippetMeshContactBenchmark_release_hpaths    += ./../../../../PxShared/src/foundation/include
+SnippetMeshContactBenchmark_release_hpaths    += ./../../../../PxShared/src/fastxml/include
+SnippetMeshContactBenchmark_release_lpaths    := 
+SnippetMeshContactBenchmark_release_lpaths    += ./../../../Lib/linux32
+SnippetMeshContactBenchmark_release_lpaths    += ./../../lib/linux32
+SnippetMeshContactBenchmark_release_lpaths    += ./../../../Bin/linux32
+SnippetMeshContactBenchmark_release_lpaths    += ./../../../../PxShared/lib/linux32
+SnippetMeshContactBenchmark_release_lpaths    += ./../../../../PxShared/bin/linux32
+SnippetMeshContactBenchmark_release_lpaths    += ./../../lib/linux32
+SnippetMeshContactBenchmark_release_defines   := $(SnippetMeshContactBenchmark_custom_defines)
+SnippetMeshContactBenchmark_release_defines   += PHYSX_PROFILE_SDK
+SnippetMeshContactBenchmark_release_defines   += RENDER_SNIPPET
+SnippetMeshContactBenchmark_release_defines   += NDEBUG
+SnippetMeshContactBenchmark_release_defines   += PX_SUPPORT_PVD=0
+SnippetMeshContactBenchmark_release_libraries := 
+SnippetMeshContactBenchmark_release_libraries += SnippetRender
+SnippetMeshContactBenchmark_release_libraries += SnippetUtils
+SnippetMeshContactBenchmark_release_libraries += PhysX3_x86
+SnippetMeshContactBenchmark_release_libraries += PhysX3Cooking_x86
+SnippetMeshContactBenchmark_release_libraries += PhysX3CharacterKinematic_x86
+SnippetMeshContactBenchmark_release_libraries += PhysX3Extensions
+SnippetMeshContactBenchmark_release_libraries += PhysX3Vehicle
+SnippetMeshContactBenchmark_release_libraries += PxPvdSDK_x86
+SnippetMeshContactBenchmark_release_libraries += PhysX3Common_x86
+SnippetMeshContactBenchmark_release_libraries += PxFoundation_x86
+SnippetMeshContactBenchmark_release_libraries += PxTask
+SnippetMeshContactBenchmark_release_libraries += PsFastXml
+SnippetMeshContactBenchmark_release_libraries += SnippetUtils
+SnippetMeshContactBenchmark_release_libraries += SnippetRender
+SnippetMeshContactBenchmark_release_libraries += GL
+SnippetMeshContactBenchmark_release_libraries += GLU
+SnippetMeshContactBenchmark_release_libraries += glut
+SnippetMeshContactBenchmark_release_libraries += X11
+SnippetMeshContactBenchmark_release_libraries += rt
+SnippetMeshContactBenchmark_release_libraries += pthread
+SnippetMeshContactBenchmark_release_common_cflags	:= $(SnippetMeshContactBenchmark_custom_cflags)
+SnippetMeshContactBenchmark_release_common_cflags    += -MMD
+SnippetMeshContactBenchmark_release_common_cflags    += $(addprefix -D, $(SnippetMeshContactBenchmark_release_defines))
+SnippetMeshContactBenchmark_release_common_cflags    += $(addprefix -I, $(SnippetMeshContactBenchmark_release_hpaths))
+SnippetMeshContactBenchmark_release_common_cflags  += -m32
+SnippetMeshContactBenchmark_release_common_cflags  += -Werror -m32 -fPIC -msse2 -mfpmath=sse -malign-double -fno-exceptions -fno-rtti -fvisibility=hidden -fvisibility-inlines-hidden
+SnippetMeshContactBenchmark_release_common_cflags  += -Wall -Wextra -Wstrict-aliasing=2 -fdiagnostics-show-option
+SnippetMeshContactBenchmark_release_common_cflags  += -Wno-uninitialized
+SnippetMeshContactBenchmark_release_common_cflags  += -O3 -fno-strict-aliasing
+SnippetMeshContactBenchmark_release_cflags	:= $(SnippetMeshContactBenchmark_release_common_cflags)
+SnippetMeshContactBenchmark_release_cppflags	:= $(SnippetMeshContactBenchmark_release_common_cflags)
+SnippetMeshContactBenchmark_release_lflags    := $(SnippetMeshContactBenchmark_custom_lflags)
+SnippetMeshContactBenchmark_release_lflags    += $(addprefix -L, $(SnippetMeshContactBenchmark_release_lpaths))
+SnippetMeshContactBenchmark_release_lflags    += -Wl,--start-group $(addprefix -l, $(SnippetMeshContactBenchmark_release_libraries)) -Wl,--end-group
+SnippetMeshContactBenchmark_release_lflags  += -lrt
+SnippetMeshContactBenchmark_release_lflags  += -Wl,-rpath ./
+SnippetMeshContactBenchmark_release_lflags  += -m32
+SnippetMeshContactBenchmark_release_objsdir  = $(OBJS_DIR)/SnippetMeshContactBenchmark_release
+SnippetMeshContactBenchmark_release_cpp_o    = $(addprefix $(SnippetMeshContactBenchmark_release_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.o, $(SnippetMeshContactBenchmark_cppfiles)))))
+SnippetMeshContactBenchmark_release_cc_o    = $(addprefix $(SnippetMeshContactBenchmark_release_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.o, $(SnippetMeshContactBenchmark_ccfiles)))))
+SnippetMeshContactBenchmark_release_c_o      = $(addprefix $(SnippetMeshContactBenchmark_release_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.o, $(SnippetMeshContactBenchmark_cfiles)))))
+SnippetMeshContactBenchmark_release_obj      = $(SnippetMeshContactBenchmark_release_cpp_o) $(SnippetMeshContactBenchmark_release_cc_o) $(SnippetMeshContactBenchmark_release_c_o)
+SnippetMeshContactBenchmark_release_bin      := ./../../../Bin/linux32/SnippetMeshContactBenchmark
+
+clean_SnippetMeshContactBenchmark_release: 
+	@$(ECHO) clean SnippetMeshContactBenchmark release
+	@$(RMDIR) $(SnippetMeshContactBenchmark_release_objsdir)
+	@$(RMDIR) $(SnippetMeshContactBenchmark_release_bin)
+	@$(RMDIR) $(DEPSDIR)/SnippetMeshContactBenchmark/release
+
+build_SnippetMeshContactBenchmark_release: postbuild_SnippetMeshContactBenchmark_release
+postbuild_SnippetMeshContactBenchmark_release: mainbuild_SnippetMeshContactBenchmark_release
+	@cp -u "../../../../PxShared/bin/linux32/libPxFoundation_x86.so" "../../../Bin/linux32/libPxFoundation_x86.so"; cp -u "../../../../PxShared/bin/linux32/libPxPvdSDK_x86.so" "../../../Bin/linux32/libPxPvdSDK_x86.so"
+mainbuild_SnippetMeshContactBenchmark_release: prebuild_SnippetMeshContactBenchmark_release $(SnippetMeshContactBenchmark_release_bin)
+prebuild_SnippetMeshContactBenchmark_release:
+
+$(SnippetMeshContactBenchmark_release_bin): $(SnippetMeshContactBenchmark_release_obj) build_SnippetRender_release build_SnippetUtils_release 
+	mkdir -p `dirname ./../../../Bin/linux32/SnippetMeshContactBenchmark`
+	$(CCLD) $(SnippetMeshContactBenchmark_release_obj) $(SnippetMeshContactBenchmark_release_lflags) -o $(SnippetMeshContactBenchmark_release_bin) 
+	$(ECHO) building $@ complete!
+
+SnippetMeshContactBenchmark_release_DEPDIR = $(dir $(@))/$(*F)
+$(SnippetMeshContactBenchmark_release_cpp_o): $(SnippetMeshContactBenchmark_release_objsdir)/%.o:
+	$(ECHO) SnippetMeshContactBenchmark: compiling release $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetMeshContactBenchmark_release_objsdir),, $@))), $(SnippetMeshContactBenchmark_cppfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetMeshContactBenchmark_release_cppflags) -c $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetMeshContactBenchmark_release_objsdir),, $@))), $(SnippetMeshContactBenchmark_cppfiles)) -o $@
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetMeshContactBenchmark_release_objsdir),, $@))), $(SnippetMeshContactBenchmark_cppfiles))))))
+	cp $(SnippetMeshContactBenchmark_release_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetMeshContactBenchmark_release_objsdir),, $@))), $(SnippetMeshContactBenchmark_cppfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetMeshContactBenchmark_release_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetMeshContactBenchmark_release_objsdir),, $@))), $(SnippetMeshContactBenchmark_cppfiles))))).P; \
+	  rm -f $(SnippetMeshContactBenchmark_release_DEPDIR).d
+
+$(SnippetMeshContactBenchmark_release_cc_o): $(SnippetMeshContactBenchmark_release_objsdir)/%.o:
+	$(ECHO) SnippetMeshContactBenchmark: compiling release $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetMeshContactBenchmark_release_objsdir),, $@))), $(SnippetMeshContactBenchmark_ccfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetMeshContactBenchmark_release_cppflags) -c $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetMeshContactBenchmark_release_objsdir),, $@))), $(SnippetMeshContactBenchmark_ccfiles)) -o $@
+	mkdir -p $(dir $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetMeshContactBenchmark_release_objsdir),, $@))), $(SnippetMeshContactBenchmark_ccfiles))))))
+	cp $(SnippetMeshContactBenchmark_release_DEPDIR).d $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetMeshContactBenchmark_release_objsdir),, $@))), $(SnippetMeshContactBenchmark_ccfiles))))).release.P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetMeshContactBenchmark_release_DEPDIR).d >> $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetMeshContactBenchmark_release_objsdir),, $@))), $(SnippetMeshContactBenchmark_ccfiles))))).release.P; \
+	  rm -f $(SnippetMeshContactBenchmark_release_DEPDIR).d
+
+$(SnippetMeshContactBenchmark_release_c_o): $(SnippetMeshContactBenchmark_release_objsdir)/%.o:
+	$(ECHO) SnippetMeshContactBenchmark: compiling release $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetMeshContactBenchmark_release_objsdir),, $@))), $(SnippetMeshContactBenchmark_cfiles))...
+	mkdir -p $(dir $(@))
+	$(CC) $(SnippetMeshContactBenchmark_release_cflags) -c $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetMeshContactBenchmark_release_objsdir),, $@))), $(SnippetMeshContactBenchmark_cfiles)) -o $@ 
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetMeshContactBenchmark_release_objsdir),, $@))), $(SnippetMeshContactBenchmark_cfiles))))))
+	cp $(SnippetMeshContactBenchmark_release_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetMeshContactBenchmark_release_objsdir),, $@))), $(SnippetMeshContactBenchmark_cfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetMeshContactBenchmark_release_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetMeshContactBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetMeshContactBenchmark_release_objsdir),, $@))), $(SnippetMeshContactBenchmark_cfiles))))).P; \
+	  rm -f $(SnippetMeshContactBenchmark_release_DEPDIR).d
+
+clean_SnippetMeshContactBenchmark:  clean_SnippetMeshContactBenchmark_debug clean_SnippetMeshContactBenchmark_checked clean_SnippetMeshContactBenchmark_profile clean_SnippetMeshContactBenchmark_release
+	rm -rf $(DEPSDIR)
+
+export VERBOSE
+ifndef VERBOSE
+.SILENT:
+endif
@@ -0,0 +1,477 @@
+# Makefile generated by XPJ for LINUX32
+-include Makefile.custom
+ProjectName = SnippetSolverBenchmark
+SnippetSolverBenchmark_cppfiles   += ./../../SnippetCommon/ClassicMain.cpp
+SnippetSolverBenchmark_cppfiles   += ./../../SnippetSolverBenchmark/SnippetSolverBenchmark.cpp
+
+SnippetSolverBenchmark_cpp_debug_dep    = $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/debug/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.P, $(SnippetSolverBenchmark_cppfiles)))))
+SnippetSolverBenchmark_cc_debug_dep    = $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.debug.P, $(SnippetSolverBenchmark_ccfiles)))))
+SnippetSolverBenchmark_c_debug_dep      = $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/debug/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.P, $(SnippetSolverBenchmark_cfiles)))))
+SnippetSolverBenchmark_debug_dep      = $(SnippetSolverBenchmark_cpp_debug_dep) $(SnippetSolverBenchmark_cc_debug_dep) $(SnippetSolverBenchmark_c_debug_dep)
+-include $(SnippetSolverBenchmark_debug_dep)
+SnippetSolverBenchmark_cpp_checked_dep    = $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/checked/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.P, $(SnippetSolverBenchmark_cppfiles)))))
+SnippetSolverBenchmark_cc_checked_dep    = $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.checked.P, $(SnippetSolverBenchmark_ccfiles)))))
+SnippetSolverBenchmark_c_checked_dep      = $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/checked/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.P, $(SnippetSolverBenchmark_cfiles)))))
+SnippetSolverBenchmark_checked_dep      = $(SnippetSolverBenchmark_cpp_checked_dep) $(SnippetSolverBenchmark_cc_checked_dep) $(SnippetSolverBenchmark_c_checked_dep)
+-include $(SnippetSolverBenchmark_checked_dep)
+SnippetSolverBenchmark_cpp_profile_dep    = $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/profile/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.P, $(SnippetSolverBenchmark_cppfiles)))))
+SnippetSolverBenchmark_cc_profile_dep    = $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.profile.P, $(SnippetSolverBenchmark_ccfiles)))))
+SnippetSolverBenchmark_c_profile_dep      = $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/profile/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.P, $(SnippetSolverBenchmark_cfiles)))))
+SnippetSolverBenchmark_profile_dep      = $(SnippetSolverBenchmark_cpp_profile_dep) $(SnippetSolverBenchmark_cc_profile_dep) $(SnippetSolverBenchmark_c_profile_dep)
+-include $(SnippetSolverBenchmark_profile_dep)
+SnippetSolverBenchmark_cpp_release_dep    = $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/release/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.P, $(SnippetSolverBenchmark_cppfiles)))))
+SnippetSolverBenchmark_cc_release_dep    = $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.release.P, $(SnippetSolverBenchmark_ccfiles)))))
+SnippetSolverBenchmark_c_release_dep      = $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/release/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.P, $(SnippetSolverBenchmark_cfiles)))))
+SnippetSolverBenchmark_release_dep      = $(SnippetSolverBenchmark_cpp_release_dep) $(SnippetSolverBenchmark_cc_release_dep) $(SnippetSolverBenchmark_c_release_dep)
+-include $(SnippetSolverBenchmark_release_dep)
+SnippetSolverBenchmark_debug_hpaths    := 
+SnippetSolverBenchmark_debug_hpaths    += ./../../../Include
+SnippetSolverBenchmark_debug_hpaths    += ./../../../../PxShared/include
+SnippetSolverBenchmark_debug_hpaths    += ./../../../../PxShared/src/foundation/include
+SnippetSolverBenchmark_debug_hpaths    += ./../../../../PxShared/src/fastxml/include
+SnippetSolverBenchmark_debug_lpaths    := 
+SnippetSolverBenchmark_debug_lpaths    += ./../../../Lib/linux32
+SnippetSolverBenchmark_debug_lpaths    += ./../../lib/linux32
+SnippetSolverBenchmark_debug_lpaths    += ./../../../Bin/linux32
+SnippetSolverBenchmark_debug_lpaths    += ./../../../../PxShared/lib/linux32
+SnippetSolverBenchmark_debug_lpaths    += ./../../../../PxShared/bin/linux32
+SnippetSolverBenchmark_debug_lpaths    += ./../../lib/linux32
+SnippetSolverBenchmark_debug_defines   := $(SnippetSolverBenchmark_custom_defines)
+SnippetSolverBenchmark_debug_defines   += PHYSX_PROFILE_SDK
+SnippetSolverBenchmark_debug_defines   += RENDER_SNIPPET
+SnippetSolverBenchmark_debug_defines   += _DEBUG
+SnippetSolverBenchmark_debug_defines   += PX_DEBUG=1
+SnippetSolverBenchmark_debug_defines   += PX_CHECKED=1
+SnippetSolverBenchmark_debug_defines   += PX_SUPPORT_PVD=1
+SnippetSolverBenchmark_debug_libraries := 
+SnippetSolverBenchmark_debug_libraries += SnippetRenderDEBUG
+SnippetSolverBenchmark_debug_libraries += SnippetUtilsDEBUG
+SnippetSolverBenchmark_debug_libraries += PhysX3DEBUG_x86
+SnippetSolverBenchmark_debug_libraries += PhysX3CookingDEBUG_x86
+SnippetSolverBenchmark_debug_libraries += PhysX3CharacterKinematicDEBUG_x86
+SnippetSolverBenchmark_debug_libraries += PhysX3ExtensionsDEBUG
+SnippetSolverBenchmark_debug_libraries += PhysX3VehicleDEBUG
+SnippetSolverBenchmark_debug_libraries += PxPvdSDKDEBUG_x86
+SnippetSolverBenchmark_debug_libraries += PhysX3CommonDEBUG_x86
+SnippetSolverBenchmark_debug_libraries += PxFoundationDEBUG_x86
+SnippetSolverBenchmark_debug_libraries += PxTaskDEBUG
+SnippetSolverBenchmark_debug_libraries += PsFastXmlDEBUG
+SnippetSolverBenchmark_debug_libraries += SnippetUtilsDEBUG
+SnippetSolverBenchmark_debug_libraries += SnippetRenderDEBUG
+SnippetSolverBenchmark_debug_libraries += GL
+SnippetSolverBenchmark_debug_libraries += GLU
+SnippetSolverBenchmark_debug_libraries += glut
+SnippetSolverBenchmark_debug_libraries += X11
+SnippetSolverBenchmark_debug_libraries += rt
+SnippetSolverBenchmark_debug_libraries += pthread
+SnippetSolverBenchmark_debug_common_cflags	:= $(SnippetSolverBenchmark_custom_cflags)
+SnippetSolverBenchmark_debug_common_cflags    += -MMD
+SnippetSolverBenchmark_debug_common_cflags    += $(addprefix -D, $(SnippetSolverBenchmark_debug_defines))
+SnippetSolverBenchmark_debug_common_cflags    += $(addprefix -I, $(SnippetSolverBenchmark_debug_hpaths))
+SnippetSolverBenchmark_debug_common_cflags  += -m32
+SnippetSolverBenchmark_debug_common_cflags  += -Werror -m32 -fPIC -msse2 -mfpmath=sse -malign-double -fno-exceptions -fno-rtti -fvisibility=hidden -fvisibility-inlines-hidden
+SnippetSolverBenchmark_debug_common_cflags  += -Wall -Wextra -Wstrict-aliasing=2 -fdiagnostics-show-option
+SnippetSolverBenchmark_debug_common_cflags  += -Wno-uninitialized
+SnippetSolverBenchmark_debug_common_cflags  += -g3 -gdwarf-2
+SnippetSolverBenchmark_debug_cflags	:= $(SnippetSolverBenchmark_debug_common_cflags)
+SnippetSolverBenchmark_debug_cppflags	:= $(SnippetSolverBenchmark_debug_common_cflags)
+SnippetSolverBenchmark_debug_lflags    := $(SnippetSolverBenchmark_custom_lflags)
+SnippetSolverBenchmark_debug_lflags    += $(addprefix -L, $(SnippetSolverBenchmark_debug_lpaths))
+SnippetSolverBenchmark_debug_lflags    += -Wl,--start-group $(addprefix -l, $(SnippetSolverBenchmark_debug_libraries)) -Wl,--end-group
+SnippetSolverBenchmark_debug_lflags  += -lrt
+SnippetSolverBenchmark_debug_lflags  += -Wl,-rpath ./
+SnippetSolverBenchmark_debug_lflags  += -m32
+SnippetSolverBenchmark_debug_objsdir  = $(OBJS_DIR)/SnippetSolverBenchmark_debug
+SnippetSolverBenchmark_debug_cpp_o    = $(addprefix $(SnippetSolverBenchmark_debug_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.o, $(SnippetSolverBenchmark_cppfiles)))))
+SnippetSolverBenchmark_debug_cc_o    = $(addprefix $(SnippetSolverBenchmark_debug_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.o, $(SnippetSolverBenchmark_ccfiles)))))
+SnippetSolverBenchmark_debug_c_o      = $(addprefix $(SnippetSolverBenchmark_debug_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.o, $(SnippetSolverBenchmark_cfiles)))))
+SnippetSolverBenchmark_debug_obj      = $(SnippetSolverBenchmark_debug_cpp_o) $(SnippetSolverBenchmark_debug_cc_o) $(SnippetSolverBenchmark_debug_c_o)
+SnippetSolverBenchmark_debug_bin      := ./../../../Bin/linux32/SnippetSolverBenchmarkDEBUG
+
+clean_SnippetSolverBenchmark_debug: 
+	@$(ECHO) clean SnippetSolverBenchmark debug
+	@$(RMDIR) $(SnippetSolverBenchmark_debug_objsdir)
+	@$(RMDIR) $(SnippetSolverBenchmark_debug_bin)
+	@$(RMDIR) $(DEPSDIR)/SnippetSolverBenchmark/debug
+
+build_SnippetSolverBenchmark_debug: postbuild_SnippetSolverBenchmark_debug
+postbuild_SnippetSolverBenchmark_debug: mainbuild_SnippetSolverBenchmark_debug
+	@cp -u "../../../../PxShared/bin/linux32/libPxFoundationDEBUG_x86.so" "../../../Bin/linux32/libPxFoundationDEBUG_x86.so"; cp -u "../../../../PxShared/bin/linux32/libPxPvdSDKDEBUG_x86.so" "../../../Bin/linux32/libPxPvdSDKDEBUG_x86.so"
+mainbuild_SnippetSolverBenchmark_debug: prebuild_SnippetSolverBenchmark_debug $(SnippetSolverBenchmark_debug_bin)
+prebuild_SnippetSolverBenchmark_debug:
+
+$(SnippetSolverBenchmark_debug_bin): $(SnippetSolverBenchmark_debug_obj) build_SnippetRender_debug build_SnippetUtils_debug 
+	mkdir -p `dirname ./../../../Bin/linux32/SnippetSolverBenchmarkDEBUG`
+	$(CCLD) $(SnippetSolverBenchmark_debug_obj) $(SnippetSolverBenchmark_debug_lflags) -o $(SnippetSolverBenchmark_debug_bin) 
+	$(ECHO) building $@ complete!
+
+SnippetSolverBenchmark_debug_DEPDIR = $(dir $(@))/$(*F)
+$(SnippetSolverBenchmark_debug_cpp_o): $(SnippetSolverBenchmark_debug_objsdir)/%.o:
+	$(ECHO) SnippetSolverBenchmark: compiling debug $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetSolverBenchmark_debug_objsdir),, $@))), $(SnippetSolverBenchmark_cppfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetSolverBenchmark_debug_cppflags) -c $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetSolverBenchmark_debug_objsdir),, $@))), $(SnippetSolverBenchmark_cppfiles)) -o $@
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetSolverBenchmark_debug_objsdir),, $@))), $(SnippetSolverBenchmark_cppfiles))))))
+	cp $(SnippetSolverBenchmark_debug_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetSolverBenchmark_debug_objsdir),, $@))), $(SnippetSolverBenchmark_cppfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetSolverBenchmark_debug_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetSolverBenchmark_debug_objsdir),, $@))), $(SnippetSolverBenchmark_cppfiles))))).P; \
+	  rm -f $(SnippetSolverBenchmark_debug_DEPDIR).d
+
+$(SnippetSolverBenchmark_debug_cc_o): $(SnippetSolverBenchmark_debug_objsdir)/%.o:
+	$(ECHO) SnippetSolverBenchmark: compiling debug $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetSolverBenchmark_debug_objsdir),, $@))), $(SnippetSolverBenchmark_ccfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetSolverBenchmark_debug_cppflags) -c $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetSolverBenchmark_debug_objsdir),, $@))), $(SnippetSolverBenchmark_ccfiles)) -o $@
+	mkdir -p $(dir $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetSolverBenchmark_debug_objsdir),, $@))), $(SnippetSolverBenchmark_ccfiles))))))
+	cp $(SnippetSolverBenchmark_debug_DEPDIR).d $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetSolverBenchmark_debug_objsdir),, $@))), $(SnippetSolverBenchmark_ccfiles))))).debug.P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetSolverBenchmark_debug_DEPDIR).d >> $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetSolverBenchmark_debug_objsdir),, $@))), $(SnippetSolverBenchmark_ccfiles))))).debug.P; \
+	  rm -f $(SnippetSolverBenchmark_debug_DEPDIR).d
+
+$(SnippetSolverBenchmark_debug_c_o): $(SnippetSolverBenchmark_debug_objsdir)/%.o:
+	$(ECHO) SnippetSolverBenchmark: compiling debug $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetSolverBenchmark_debug_objsdir),, $@))), $(SnippetSolverBenchmark_cfiles))...
+	mkdir -p $(dir $(@))
+	$(CC) $(SnippetSolverBenchmark_debug_cflags) -c $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetSolverBenchmark_debug_objsdir),, $@))), $(SnippetSolverBenchmark_cfiles)) -o $@ 
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetSolverBenchmark_debug_objsdir),, $@))), $(SnippetSolverBenchmark_cfiles))))))
+	cp $(SnippetSolverBenchmark_debug_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetSolverBenchmark_debug_objsdir),, $@))), $(SnippetSolverBenchmark_cfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetSolverBenchmark_debug_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetSolverBenchmark_debug_objsdir),, $@))), $(SnippetSolverBenchmark_cfiles))))).P; \
+	  rm -f $(SnippetSolverBenchmark_debug_DEPDIR).d
+
+SnippetSolverBenchmark_checked_hpaths    := 
+SnippetSolverBenchmark_checked_hpaths    += ./../../../Include
+SnippetSolverBenchmark_checked_hpaths    += ./../../../../PxShared/include
+SnippetSolverBenchmark_checked_hpaths    += ./../../../../PxShared/src/foundation/include
+SnippetSolverBenchmark_checked_hpaths    += ./../../../../PxShared/src/fastxml/include
+SnippetSolverBenchmark_checked_lpaths    := 
+SnippetSolverBenchmark_checked_lpaths    += ./../../../Lib/linux32
+SnippetSolverBenchmark_checked_lpaths    += ./../../lib/linux32
+SnippetSolverBenchmark_checked_lpaths    += ./../../../Bin/linux32
+SnippetSolverBenchmark_checked_lpaths    += ./../../../../PxShared/lib/linux32
+SnippetSolverBenchmark_checked_lpaths    += ./../../../../PxShared/bin/linux32
+SnippetSolverBenchmark_checked_lpaths    += ./../../lib/linux32
+SnippetSolverBenchmark_checked_defines   := $(SnippetSolverBenchmark_custom_defines)
+SnippetSolverBenchmark_checked_defines   += PHYSX_PROFILE_SDK
+SnippetSolverBenchmark_checked_defines   += RENDER_SNIPPET
+SnippetSolverBenchmark_checked_defines   += NDEBUG
+SnippetSolverBenchmark_checked_defines   += PX_CHECKED=1
+SnippetSolverBenchmark_checked_defines   += PX_SUPPORT_PVD=1
+SnippetSolverBenchmark_checked_libraries := 
+SnippetSolverBenchmark_checked_libraries += SnippetRenderCHECKED
+SnippetSolverBenchmark_checked_libraries += SnippetUtilsCHECKED
+SnippetSolverBenchmark_checked_libraries += PhysX3CHECKED_x86
+SnippetSolverBenchmark_checked_libraries += PhysX3CookingCHECKED_x86
+SnippetSolverBenchmark_checked_libraries += PhysX3CharacterKinematicCHECKED_x86
+SnippetSolverBenchmark_checked_libraries += PhysX3ExtensionsCHECKED
+SnippetSolverBenchmark_checked_libraries += PhysX3VehicleCHECKED
+SnippetSolverBenchmark_checked_libraries += PxPvdSDKCHECKED_x86
+SnippetSolverBenchmark_checked_libraries += PhysX3CommonCHECKED_x86
+SnippetSolverBenchmark_checked_libraries += PxFoundationCHECKED_x86
+SnippetSolverBenchmark_checked_libraries += PxTaskCHECKED
+SnippetSolverBenchmark_checked_libraries += PsFastXmlCHECKED
+SnippetSolverBenchmark_checked_libraries += SnippetUtilsCHECKED
+SnippetSolverBenchmark_checked_libraries += SnippetRenderCHECKED
+SnippetSolverBenchmark_checked_libraries += GL
+SnippetSolverBenchmark_checked_libraries += GLU
+SnippetSolverBenchmark_checked_libraries += glut
+SnippetSolverBenchmark_checked_libraries += X11
+SnippetSolverBenchmark_checked_libraries += rt
+SnippetSolverBenchmark_checked_libraries += pthread
+SnippetSolverBenchmark_checked_common_cflags	:= $(SnippetSolverBenchmark_custom_cflags)
+SnippetSolverBenchmark_checked_common_cflags    += -MMD
+SnippetSolverBenchmark_checked_common_cflags    += $(addprefix -D, $(SnippetSolverBenchmark_checked_defines))
+SnippetSolverBenchmark_checked_common_cflags    += $(addprefix -I, $(SnippetSolverBenchmark_checked_hpaths))
+SnippetSolverBenchmark_checked_common_cflags  += -m32
+SnippetSolverBenchmark_checked_common_cflags  += -Werror -m32 -fPIC -msse2 -mfpmath=sse -malign-double -fno-exceptions -fno-rtti -fvisibility=hidden -fvisibility-inlines-hidden
+SnippetSolverBenchmark_checked_common_cflags  += -Wall -Wextra -Wstrict-aliasing=2 -fdiagnostics-show-option
+SnippetSolverBenchmark_checked_common_cflags  += -Wno-uninitialized
+SnippetSolverBenchmark_checked_common_cflags  += -g3 -gdwarf-2 -O3 -fno-strict-aliasing
+SnippetSolverBenchmark_checked_cflags	:= $(SnippetSolverBenchmark_checked_common_cflags)
+SnippetSolverBenchmark_checked_cppflags	:= $(SnippetSolverBenchmark_checked_common_cflags)
+SnippetSolverBenchmark_checked_lflags    := $(SnippetSolverBenchmark_custom_lflags)
+SnippetSolverBenchmark_checked_lflags    += $(addprefix -L, $(SnippetSolverBenchmark_checked_lpaths))
+SnippetSolverBenchmark_checked_lflags    += -Wl,--start-group $(addprefix -l, $(SnippetSolverBenchmark_checked_libraries)) -Wl,--end-group
+SnippetSolverBenchmark_checked_lflags  += -lrt
+SnippetSolverBenchmark_checked_lflags  += -Wl,-rpath ./
+SnippetSolverBenchmark_checked_lflags  += -m32
+SnippetSolverBenchmark_checked_objsdir  = $(OBJS_DIR)/SnippetSolverBenchmark_checked
+SnippetSolverBenchmark_checked_cpp_o    = $(addprefix $(SnippetSolverBenchmark_checked_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.o, $(SnippetSolverBenchmark_cppfiles)))))
+SnippetSolverBenchmark_checked_cc_o    = $(addprefix $(SnippetSolverBenchmark_checked_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.o, $(SnippetSolverBenchmark_ccfiles)))))
+SnippetSolverBenchmark_checked_c_o      = $(addprefix $(SnippetSolverBenchmark_checked_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.o, $(SnippetSolverBenchmark_cfiles)))))
+SnippetSolverBenchmark_checked_obj      = $(SnippetSolverBenchmark_checked_cpp_o) $(SnippetSolverBenchmark_checked_cc_o) $(SnippetSolverBenchmark_checked_c_o)
+SnippetSolverBenchmark_checked_bin      := ./../../../Bin/linux32/SnippetSolverBenchmarkCHECKED
+
+clean_SnippetSolverBenchmark_checked: 
+	@$(ECHO) clean SnippetSolverBenchmark checked
+	@$(RMDIR) $(SnippetSolverBenchmark_checked_objsdir)
+	@$(RMDIR) $(SnippetSolverBenchmark_checked_bin)
+	@$(RMDIR) $(DEPSDIR)/SnippetSolverBenchmark/checked
+
+build_SnippetSolverBenchmark_checked: postbuild_SnippetSolverBenchmark_checked
+postbuild_SnippetSolverBenchmark_checked: mainbuild_SnippetSolverBenchmark_checked
+	@cp -u "../../../../PxShared/bin/linux32/libPxFoundationCHECKED_x86.so" "../../../Bin/linux32/libPxFoundationCHECKED_x86.so"; cp -u "../../../../PxShared/bin/linux32/libPxPvdSDKCHECKED_x86.so" "../../../Bin/linux32/libPxPvdSDKCHECKED_x86.so"
+mainbuild_SnippetSolverBenchmark_checked: prebuild_SnippetSolverBenchmark_checked $(SnippetSolverBenchmark_checked_bin)
+prebuild_SnippetSolverBenchmark_checked:
+
+$(SnippetSolverBenchmark_checked_bin): $(SnippetSolverBenchmark_checked_obj) build_SnippetRender_checked build_SnippetUtils_checked 
+	mkdir -p `dirname ./../../../Bin/linux32/SnippetSolverBenchmarkCHECKED`
+	$(CCLD) $(SnippetSolverBenchmark_checked_obj) $(SnippetSolverBenchmark_checked_lflags) -o $(SnippetSolverBenchmark_checked_bin) 
+	$(ECHO) building $@ complete!
+
+SnippetSolverBenchmark_checked_DEPDIR = $(dir $(@))/$(*F)
+$(SnippetSolverBenchmark_checked_cpp_o): $(SnippetSolverBenchmark_checked_objsdir)/%.o:
+	$(ECHO) SnippetSolverBenchmark: compiling checked $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetSolverBenchmark_checked_objsdir),, $@))), $(SnippetSolverBenchmark_cppfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetSolverBenchmark_checked_cppflags) -c $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetSolverBenchmark_checked_objsdir),, $@))), $(SnippetSolverBenchmark_cppfiles)) -o $@
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetSolverBenchmark_checked_objsdir),, $@))), $(SnippetSolverBenchmark_cppfiles))))))
+	cp $(SnippetSolverBenchmark_checked_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetSolverBenchmark_checked_objsdir),, $@))), $(SnippetSolverBenchmark_cppfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetSolverBenchmark_checked_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetSolverBenchmark_checked_objsdir),, $@))), $(SnippetSolverBenchmark_cppfiles))))).P; \
+	  rm -f $(SnippetSolverBenchmark_checked_DEPDIR).d
+
+$(SnippetSolverBenchmark_checked_cc_o): $(SnippetSolverBenchmark_checked_objsdir)/%.o:
+	$(ECHO) SnippetSolverBenchmark: compiling checked $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetSolverBenchmark_checked_objsdir),, $@))), $(SnippetSolverBenchmark_ccfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetSolverBenchmark_checked_cppflags) -c $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetSolverBenchmark_checked_objsdir),, $@))), $(SnippetSolverBenchmark_ccfiles)) -o $@
+	mkdir -p $(dir $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetSolverBenchmark_checked_objsdir),, $@))), $(SnippetSolverBenchmark_ccfiles))))))
+	cp $(SnippetSolverBenchmark_checked_DEPDIR).d $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetSolverBenchmark_checked_objsdir),, $@))), $(SnippetSolverBenchmark_ccfiles))))).checked.P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetSolverBenchmark_checked_DEPDIR).d >> $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetSolverBenchmark_checked_objsdir),, $@))), $(SnippetSolverBenchmark_ccfiles))))).checked.P; \
+	  rm -f $(SnippetSolverBenchmark_checked_DEPDIR).d
+
+$(SnippetSolverBenchmark_checked_c_o): $(SnippetSolverBenchmark_checked_objsdir)/%.o:
+	$(ECHO) SnippetSolverBenchmark: compiling checked $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetSolverBenchmark_checked_objsdir),, $@))), $(SnippetSolverBenchmark_cfiles))...
+	mkdir -p $(dir $(@))
+	$(CC) $(SnippetSolverBenchmark_checked_cflags) -c $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetSolverBenchmark_checked_objsdir),, $@))), $(SnippetSolverBenchmark_cfiles)) -o $@ 
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetSolverBenchmark_checked_objsdir),, $@))), $(SnippetSolverBenchmark_cfiles))))))
+	cp $(SnippetSolverBenchmark_checked_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetSolverBenchmark_checked_objsdir),, $@))), $(SnippetSolverBenchmark_cfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetSolverBenchmark_checked_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetSolverBenchmark_checked_objsdir),, $@))), $(SnippetSolverBenchmark_cfiles))))).P; \
+	  rm -f $(SnippetSolverBenchmark_checked_DEPDIR).d
+
+SnippetSolverBenchmark_profile_hpaths    := 
+SnippetSolverBenchmark_profile_hpaths    += ./../../../Include
+SnippetSolverBenchmark_profile_hpaths    += ./../../../../PxShared/include
+SnippetSolverBenchmark_profile_hpaths    += ./../../../../PxShared/src/foundation/include
+SnippetSolverBenchmark_profile_hpaths    += ./../../../../PxShared/src/fastxml/include
+SnippetSolverBenchmark_profile_lpaths    := 
+SnippetSolverBenchmark_profile_lpaths    += ./../../../Lib/linux32
+SnippetSolverBenchmark_profile_lpaths    += ./../../lib/linux32
+SnippetSolverBenchmark_profile_lpaths    += ./../../../Bin/linux32
+SnippetSolverBenchmark_profile_lpaths    += ./../../../../PxShared/lib/linux32
+SnippetSolverBenchmark_profile_lpaths    += ./../../../../PxShared/bin/linux32
+SnippetSolverBenchmark_profile_lpaths    += ./../../lib/linux32
+SnippetSolverBenchmark_profile_defines   := $(SnippetSolverBenchmark_custom_defines)
+SnippetSolverBenchmark_profile_defines   += PHYSX_PROFILE_SDK
+SnippetSolverBenchmark_profile_defines   += RENDER_SNIPPET
+SnippetSolverBenchmark_profile_defines   += NDEBUG
+SnippetSolverBenchmark_profile_defines   += PX_PROFILE=1
+SnippetSolverBenchmark_profile_defines   += PX_SUPPORT_PVD=1
+SnippetSolverBenchmark_profile_libraries := 
+SnippetSolverBenchmark_profile_libraries += SnippetRenderPROFILE
+SnippetSolverBenchmark_profile_libraries += SnippetUtilsPROFILE
+SnippetSolverBenchmark_profile_libraries += PhysX3PROFILE_x86
+SnippetSolverBenchmark_profile_libraries += PhysX3CookingPROFILE_x86
+SnippetSolverBenchmark_profile_libraries += PhysX3CharacterKinematicPROFILE_x86
+SnippetSolverBenchmark_profile_libraries += PhysX3ExtensionsPROFILE
+SnippetSolverBenchmark_profile_libraries += PhysX3VehiclePROFILE
+SnippetSolverBenchmark_profile_libraries += PxPvdSDKPROFILE_x86
+SnippetSolverBenchmark_profile_libraries += PhysX3CommonPROFILE_x86
+SnippetSolverBenchmark_profile_libraries += PxFoundationPROFILE_x86
+SnippetSolverBenchmark_profile_libraries += PxTaskPROFILE
+SnippetSolverBenchmark_profile_libraries += PsFastXmlPROFILE
+SnippetSolverBenchmark_profile_libraries += SnippetUtilsPROFILE
+SnippetSolverBenchmark_profile_libraries += SnippetRenderPROFILE
+SnippetSolverBenchmark_profile_libraries += GL
+SnippetSolverBenchmark_profile_libraries += GLU
+SnippetSolverBenchmark_profile_libraries += glut
+SnippetSolverBenchmark_profile_libraries += X11
+SnippetSolverBenchmark_profile_libraries += rt
+SnippetSolverBenchmark_profile_libraries += pthread
+SnippetSolverBenchmark_profile_common_cflags	:= $(SnippetSolverBenchmark_custom_cflags)
+SnippetSolverBenchmark_profile_common_cflags    += -MMD
+SnippetSolverBenchmark_profile_common_cflags    += $(addprefix -D, $(SnippetSolverBenchmark_profile_defines))
+SnippetSolverBenchmark_profile_common_cflags    += $(addprefix -I, $(SnippetSolverBenchmark_profile_hpaths))
+SnippetSolverBenchmark_profile_common_cflags  += -m32
+SnippetSolverBenchmark_profile_common_cflags  += -Werror -m32 -fPIC -msse2 -mfpmath=sse -malign-double -fno-exceptions -fno-rtti -fvisibility=hidden -fvisibility-inlines-hidden
+SnippetSolverBenchmark_profile_common_cflags  += -Wall -Wextra -Wstrict-aliasing=2 -fdiagnostics-show-option
+SnippetSolverBenchmark_profile_common_cflags  += -Wno-uninitialized
+SnippetSolverBenchmark_profile_common_cflags  += -O3 -fno-strict-aliasing
+SnippetSolverBenchmark_profile_cflags	:= $(SnippetSolverBenchmark_profile_common_cflags)
+SnippetSolverBenchmark_profile_cppflags	:= $(SnippetSolverBenchmark_profile_common_cflags)
+SnippetSolverBenchmark_profile_lflags    := $(SnippetSolverBenchmark_custom_lflags)
+SnippetSolverBenchmark_profile_lflags    += $(addprefix -L, $(SnippetSolverBenchmark_profile_lpaths))
+SnippetSolverBenchmark_profile_lflags    += -Wl,--start-group $(addprefix -l, $(SnippetSolverBenchmark_profile_libraries)) -Wl,--end-group
+SnippetSolverBenchmark_profile_lflags  += -lrt
+SnippetSolverBenchmark_profile_lflags  += -Wl,-rpath ./
+SnippetSolverBenchmark_profile_lflags  += -m32
+SnippetSolverBenchmark_profile_objsdir  = $(OBJS_DIR)/SnippetSolverBenchmark_profile
+SnippetSolverBenchmark_profile_cpp_o    = $(addprefix $(SnippetSolverBenchmark_profile_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.o, $(SnippetSolverBenchmark_cppfiles)))))
+SnippetSolverBenchmark_profile_cc_o    = $(addprefix $(SnippetSolverBenchmark_profile_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.o, $(SnippetSolverBenchmark_ccfiles)))))
+SnippetSolverBenchmark_profile_c_o      = $(addprefix $(SnippetSolverBenchmark_profile_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.o, $(SnippetSolverBenchmark_cfiles)))))
+SnippetSolverBenchmark_profile_obj      = $(SnippetSolverBenchmark_profile_cpp_o) $(SnippetSolverBenchmark_profile_cc_o) $(SnippetSolverBenchmark_profile_c_o)
+SnippetSolverBenchmark_profile_bin      := ./../../../Bin/linux32/SnippetSolverBenchmarkPROFILE
+
+clean_SnippetSolverBenchmark_profile: 
+	@$(ECHO) clean SnippetSolverBenchmark profile
+	@$(RMDIR) $(SnippetSolverBenchmark_profile_objsdir)
+	@$(RMDIR) $(SnippetSolverBenchmark_profile_bin)
+	@$(RMDIR) $(DEPSDIR)/SnippetSolverBenchmark/profile
+
+build_SnippetSolverBenchmark_profile: postbuild_SnippetSolverBenchmark_profile
+postbuild_SnippetSolverBenchmark_profile: mainbuild_SnippetSolverBenchmark_profile
+	@cp -u "../../../../PxShared/bin/linux32/libPxFoundationPROFILE_x86.so" "../../../Bin/linux32/libPxFoundationPROFILE_x86.so"; cp -u "../../../../PxShared/bin/linux32/libPxPvdSDKPROFILE_x86.so" "../../../Bin/linux32/libPxPvdSDKPROFILE_x86.so"
+mainbuild_SnippetSolverBenchmark_profile: prebuild_SnippetSolverBenchmark_profile $(SnippetSolverBenchmark_profile_bin)
+prebuild_SnippetSolverBenchmark_profile:
+
+$(SnippetSolverBenchmark_profile_bin): $(SnippetSolverBenchmark_profile_obj) build_SnippetRender_profile build_SnippetUtils_profile 
+	mkdir -p `dirname ./../../../Bin/linux32/SnippetSolverBenchmarkPROFILE`
+	$(CCLD) $(SnippetSolverBenchmark_profile_obj) $(SnippetSolverBenchmark_profile_lflags) -o $(SnippetSolverBenchmark_profile_bin) 
+	$(ECHO) building $@ complete!
+
+SnippetSolverBenchmark_profile_DEPDIR = $(dir $(@))/$(*F)
+$(SnippetSolverBenchmark_profile_cpp_o): $(SnippetSolverBenchmark_profile_objsdir)/%.o:
+	$(ECHO) SnippetSolverBenchmark: compiling profile $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetSolverBenchmark_profile_objsdir),, $@))), $(SnippetSolverBenchmark_cppfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetSolverBenchmark_profile_cppflags) -c $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetSolverBenchmark_profile_objsdir),, $@))), $(SnippetSolverBenchmark_cppfiles)) -o $@
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetSolverBenchmark_profile_objsdir),, $@))), $(SnippetSolverBenchmark_cppfiles))))))
+	cp $(SnippetSolverBenchmark_profile_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetSolverBenchmark_profile_objsdir),, $@))), $(SnippetSolverBenchmark_cppfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetSolverBenchmark_profile_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetSolverBenchmark_profile_objsdir),, $@))), $(SnippetSolverBenchmark_cppfiles))))).P; \
+	  rm -f $(SnippetSolverBenchmark_profile_DEPDIR).d
+
+$(SnippetSolverBenchmark_profile_cc_o): $(SnippetSolverBenchmark_profile_objsdir)/%.o:
+	$(ECHO) SnippetSolverBenchmark: compiling profile $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetSolverBenchmark_profile_objsdir),, $@))), $(SnippetSolverBenchmark_ccfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetSolverBenchmark_profile_cppflags) -c $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetSolverBenchmark_profile_objsdir),, $@))), $(SnippetSolverBenchmark_ccfiles)) -o $@
+	mkdir -p $(dir $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetSolverBenchmark_profile_objsdir),, $@))), $(SnippetSolverBenchmark_ccfiles))))))
+	cp $(SnippetSolverBenchmark_profile_DEPDIR).d $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetSolverBenchmark_profile_objsdir),, $@))), $(SnippetSolverBenchmark_ccfiles))))).profile.P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetSolverBenchmark_profile_DEPDIR).d >> $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetSolverBenchmark_profile_objsdir),, $@))), $(SnippetSolverBenchmark_ccfiles))))).profile.P; \
+	  rm -f $(SnippetSolverBenchmark_profile_DEPDIR).d
+
+$(SnippetSolverBenchmark_profile_c_o): $(SnippetSolverBenchmark_profile_objsdir)/%.o:
+	$(ECHO) SnippetSolverBenchmark: compiling profile $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetSolverBenchmark_profile_objsdir),, $@))), $(SnippetSolverBenchmark_cfiles))...
+	mkdir -p $(dir $(@))
+	$(CC) $(SnippetSolverBenchmark_profile_cflags) -c $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetSolverBenchmark_profile_objsdir),, $@))), $(SnippetSolverBenchmark_cfiles)) -o $@ 
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetSolverBenchmark_profile_objsdir),, $@))), $(SnippetSolverBenchmark_cfiles))))))
+	cp $(SnippetSolverBenchmark_profile_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetSolverBenchmark_profile_objsdir),, $@))), $(SnippetSolverBenchmark_cfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetSolverBenchmark_profile_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetSolverBenchmark_profile_objsdir),, $@))), $(SnippetSolverBenchmark_cfiles))))).P; \
+	  rm -f $(SnippetSolverBenchmark_profile_DEPDIR).d
+
+SnippetSolverBenchmark_release_hpaths    := 
+SnippetSolverBenchmark_release_hpaths    += ./../../../Include
+SnippetSolverBenchmark_release_hpaths    += ./../../../../PxShared/include
+SnippetSolverBenchmark_release_hpaths    += ./../../../../PxShared/src/foundation/include
+SnippetSolverBenchmark_release_hpaths    += ./../../../../PxShared/src/fastxml/include
+SnippetSolverBenchmark_release_lpaths    := 
+SnippetSolverBenchmark_release_lpaths    += ./../../../Lib/linux32
+SnippetSolverBenchmark_release_lpaths    += ./../../lib/linux32
+SnippetSolverBenchmark_release_lpaths    += ./../../../Bin/linux32
+SnippetSolverBenchmark_release_lpaths    += ./../../../../PxShared/lib/linux32
+SnippetSolverBenchmark_release_lpaths    += ./../../../../PxShared/bin/linux32
+SnippetSolverBenchmark_release_lpaths    += ./../../lib/linux32
+SnippetSolverBenchmark_release_defines   := $(SnippetSolverBenchmark_custom_defines)
+SnippetSolverBenchmark_release_defines   += PHYSX_PROFILE_SDK
+SnippetSolverBenchmark_release_defines   += RENDER_SNIPPET
+SnippetSolverBenchmark_release_defines   += NDEBUG
+SnippetSolverBenchmark_release_defines   += PX_SUPPORT_PVD=0
+SnippetSolverBenchmark_release_libraries := 
+SnippetSolverBenchmark_release_libraries += SnippetRender
+SnippetSolverBenchmark_release_libraries += SnippetUtils
+SnippetSolverBenchmark_release_libraries += PhysX3_x86
+SnippetSolverBenchmark_release_libraries += PhysX3Cooking_x86
+SnippetSolverBenchmark_release_libraries += PhysX3CharacterKinematic_x86
+SnippetSolverBenchmark_release_libraries += PhysX3Extensions
+SnippetSolverBenchmark_release_libraries += PhysX3Vehicle
+SnippetSolverBenchmark_release_libraries += PxPvdSDK_x86
+SnippetSolverBenchmark_release_libraries += PhysX3Common_x86
+SnippetSolverBenchmark_release_libraries += PxFoundation_x86
+SnippetSolverBenchmark_release_libraries += PxTask
+SnippetSolverBenchmark_release_libraries += PsFastXml
+SnippetSolverBenchmark_release_libraries += SnippetUtils
+SnippetSolverBenchmark_release_libraries += SnippetRender
+SnippetSolverBenchmark_release_libraries += GL
+SnippetSolverBenchmark_release_libraries += GLU
+SnippetSolverBenchmark_release_libraries += glut
+SnippetSolverBenchmark_release_libraries += X11
+SnippetSolverBenchmark_release_libraries += rt
+SnippetSolverBenchmark_release_libraries += pthread
+SnippetSolverBenchmark_release_common_cflags	:= $(SnippetSolverBenchmark_custom_cflags)
+SnippetSolverBenchmark_release_common_cflags    += -MMD
+SnippetSolverBenchmark_release_common_cflags    += $(addprefix -D, $(SnippetSolverBenchmark_release_defines))
+SnippetSolverBenchmark_release_common_cflags    += $(addprefix -I, $(SnippetSolverBenchmark_release_hpaths))
+SnippetSolverBenchmark_release_common_cflags  += -m32
+SnippetSolverBenchmark_release_common_cflags  += -Werror -m32 -fPIC -msse2 -mfpmath=sse -malign-double -fno-exceptions -fno-rtti -fvisibility=hidden -fvisibility-inlines-hidden
+SnippetSolverBenchmark_release_common_cflags  += -Wall -Wextra -Wstrict-aliasing=2 -fdiagnostics-show-option
+SnippetSolverBenchmark_release_common_cflags  += -Wno-uninitialized
+SnippetSolverBenchmark_release_common_cflags  += -O3 -fno-strict-aliasing
+SnippetSolverBenchmark_release_cflags	:= $(SnippetSolverBenchmark_release_common_cflags)
+SnippetSolverBenchmark_release_cppflags	:= $(SnippetSolverBenchmark_release_common_cflags)
+SnippetSolverBenchmark_release_lflags    := $(SnippetSolverBenchmark_custom_lflags)
+SnippetSolverBenchmark_release_lflags    += $(addprefix -L, $(SnippetSolverBenchmark_release_lpaths))
+SnippetSolverBenchmark_release_lflags    += -Wl,--start-group $(addprefix -l, $(SnippetSolverBenchmark_release_libraries)) -Wl,--end-group
+SnippetSolverBenchmark_release_lflags  += -lrt
+SnippetSolverBenchmark_release_lflags  += -Wl,-rpath ./
+SnippetSolverBenchmark_release_lflags  += -m32
+SnippetSolverBenchmark_release_objsdir  = $(OBJS_DIR)/SnippetSolverBenchmark_release
+SnippetSolverBenchmark_release_cpp_o    = $(addprefix $(SnippetSolverBenchmark_release_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.o, $(SnippetSolverBenchmark_cppfiles)))))
+SnippetSolverBenchmark_release_cc_o    = $(addprefix $(SnippetSolverBenchmark_release_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.o, $(SnippetSolverBenchmark_ccfiles)))))
+SnippetSolverBenchmark_release_c_o      = $(addprefix $(SnippetSolverBenchmark_release_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.o, $(SnippetSolverBenchmark_cfiles)))))
+SnippetSolverBenchmark_release_obj      = $(SnippetSolverBenchmark_release_cpp_o) $(SnippetSolverBenchmark_release_cc_o) $(SnippetSolverBenchmark_release_c_o)
+SnippetSolverBenchmark_release_bin      := ./../../../Bin/linux32/SnippetSolverBenchmark
+
+clean_SnippetSolverBenchmark_release: 
+	@$(ECHO) clean SnippetSolverBenchmark release
+	@$(RMDIR) $(SnippetSolverBenchmark_release_objsdir)
+	@$(RMDIR) $(SnippetSolverBenchmark_release_bin)
+	@$(RMDIR) $(DEPSDIR)/SnippetSolverBenchmark/release
+
+build_SnippetSolverBenchmark_release: postbuild_SnippetSolverBenchmark_release
+postbuild_SnippetSolverBenchmark_release: mainbuild_SnippetSolverBenchmark_release
+	@cp -u "../../../../PxShared/bin/linux32/libPxFoundation_x86.so" "../../../Bin/linux32/libPxFoundation_x86.so"; cp -u "../../../../PxShared/bin/linux32/libPxPvdSDK_x86.so" "../../../Bin/linux32/libPxPvdSDK_x86.so"
+mainbuild_SnippetSolverBenchmark_release: prebuild_SnippetSolverBenchmark_release $(SnippetSolverBenchmark_release_bin)
+prebuild_SnippetSolverBenchmark_release:
+
+$(SnippetSolverBenchmark_release_bin): $(SnippetSolverBenchmark_release_obj) build_SnippetRender_release build_SnippetUtils_release 
+	mkdir -p `dirname ./../../../Bin/linux32/SnippetSolverBenchmark`
+	$(CCLD) $(SnippetSolverBenchmark_release_obj) $(SnippetSolverBenchmark_release_lflags) -o $(SnippetSolverBenchmark_release_bin) 
+	$(ECHO) building $@ complete!
+
+SnippetSolverBenchmark_release_DEPDIR = $(dir $(@))/$(*F)
+$(SnippetSolverBenchmark_release_cpp_o): $(SnippetSolverBenchmark_release_objsdir)/%.o:
+	$(ECHO) SnippetSolverBenchmark: compiling release $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetSolverBenchmark_release_objsdir),, $@))), $(SnippetSolverBenchmark_cppfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetSolverBenchmark_release_cppflags) -c $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetSolverBenchmark_release_objsdir),, $@))), $(SnippetSolverBenchmark_cppfiles)) -o $@
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetSolverBenchmark_release_objsdir),, $@))), $(SnippetSolverBenchmark_cppfiles))))))
+	cp $(SnippetSolverBenchmark_release_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetSolverBenchmark_release_objsdir),, $@))), $(SnippetSolverBenchmark_cppfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetSolverBenchmark_release_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetSolverBenchmark_release_objsdir),, $@))), $(SnippetSolverBenchmark_cppfiles))))).P; \
+	  rm -f $(SnippetSolverBenchmark_release_DEPDIR).d
+
+$(SnippetSolverBenchmark_release_cc_o): $(SnippetSolverBenchmark_release_objsdir)/%.o:
+	$(ECHO) SnippetSolverBenchmark: compiling release $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetSolverBenchmark_release_objsdir),, $@))), $(SnippetSolverBenchmark_ccfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetSolverBenchmark_release_cppflags) -c $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetSolverBenchmark_release_objsdir),, $@))), $(SnippetSolverBenchmark_ccfiles)) -o $@
+	mkdir -p $(dir $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetSolverBenchmark_release_objsdir),, $@))), $(SnippetSolverBenchmark_ccfiles))))))
+	cp $(SnippetSolverBenchmark_release_DEPDIR).d $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetSolverBenchmark_release_objsdir),, $@))), $(SnippetSolverBenchmark_ccfiles))))).release.P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetSolverBenchmark_release_DEPDIR).d >> $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetSolverBenchmark_release_objsdir),, $@))), $(SnippetSolverBenchmark_ccfiles))))).release.P; \
+	  rm -f $(SnippetSolverBenchmark_release_DEPDIR).d
+
+$(SnippetSolverBenchmark_release_c_o): $(SnippetSolverBenchmark_release_objsdir)/%.o:
+	$(ECHO) SnippetSolverBenchmark: compiling release $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetSolverBenchmark_release_objsdir),, $@))), $(SnippetSolverBenchmark_cfiles))...
+	mkdir -p $(dir $(@))
+	$(CC) $(SnippetSolverBenchmark_release_cflags) -c $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetSolverBenchmark_release_objsdir),, $@))), $(SnippetSolverBenchmark_cfiles)) -o $@ 
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetSolverBenchmark_release_objsdir),, $@))), $(SnippetSolverBenchmark_cfiles))))))
+	cp $(SnippetSolverBenchmark_release_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetSolverBenchmark_release_objsdir),, $@))), $(SnippetSolverBenchmark_cfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetSolverBenchmark_release_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetSolverBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetSolverBenchmark_release_objsdir),, $@))), $(SnippetSolverBenchmark_cfiles))))).P; \
+	  rm -f $(SnippetSolverBenchmark_release_DEPDIR).d
+
+clean_SnippetSolverBenchmark:  clean_SnippetSolverBenchmark_debug clean_SnippetSolverBenchmark_checked clean_SnippetSolverBenchmark_profile clean_SnippetSolverBenchmark_release
+	rm -rf $(DEPSDIR)
+
+export VERBOSE
+ifndef VERBOSE
+.SILENT:
+endif
@@ -0,0 +1,477 @@
+# Makefile generated by XPJ for LINUX64
+-include Makefile.custom
+ProjectName = SnippetBodyOrderBenchmark
+SnippetBodyOrderBenchmark_cppfiles   += ./../../SnippetCommon/ClassicMain.cpp
+SnippetBodyOrderBenchmark_cppfiles   += ./../../SnippetBodyOrderBenchmark/SnippetBodyOrderBenchmark.cpp
+
+SnippetBodyOrderBenchmark_cpp_debug_dep    = $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/debug/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.P, $(SnippetBodyOrderBenchmark_cppfiles)))))
+SnippetBodyOrderBenchmark_cc_debug_dep    = $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.debug.P, $(SnippetBodyOrderBenchmark_ccfiles)))))
+SnippetBodyOrderBenchmark_c_debug_dep      = $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/debug/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.P, $(SnippetBodyOrderBenchmark_cfiles)))))
+SnippetBodyOrderBenchmark_debug_dep      = $(SnippetBodyOrderBenchmark_cpp_debug_dep) $(SnippetBodyOrderBenchmark_cc_debug_dep) $(SnippetBodyOrderBenchmark_c_debug_dep)
+-include $(SnippetBodyOrderBenchmark_debug_dep)
+SnippetBodyOrderBenchmark_cpp_checked_dep    = $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/checked/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.P, $(SnippetBodyOrderBenchmark_cppfiles)))))
+SnippetBodyOrderBenchmark_cc_checked_dep    = $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.checked.P, $(SnippetBodyOrderBenchmark_ccfiles)))))
+SnippetBodyOrderBenchmark_c_checked_dep      = $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/checked/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.P, $(SnippetBodyOrderBenchmark_cfiles)))))
+SnippetBodyOrderBenchmark_checked_dep      = $(SnippetBodyOrderBenchmark_cpp_checked_dep) $(SnippetBodyOrderBenchmark_cc_checked_dep) $(SnippetBodyOrderBenchmark_c_checked_dep)
+-include $(SnippetBodyOrderBenchmark_checked_dep)
+SnippetBodyOrderBenchmark_cpp_profile_dep    = $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/profile/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.P, $(SnippetBodyOrderBenchmark_cppfiles)))))
+SnippetBodyOrderBenchmark_cc_profile_dep    = $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.profile.P, $(SnippetBodyOrderBenchmark_ccfiles)))))
+SnippetBodyOrderBenchmark_c_profile_dep      = $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/profile/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.P, $(SnippetBodyOrderBenchmark_cfiles)))))
+SnippetBodyOrderBenchmark_profile_dep      = $(SnippetBodyOrderBenchmark_cpp_profile_dep) $(SnippetBodyOrderBenchmark_cc_profile_dep) $(SnippetBodyOrderBenchmark_c_profile_dep)
+-include $(SnippetBodyOrderBenchmark_profile_dep)
+SnippetBodyOrderBenchmark_cpp_release_dep    = $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/release/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.P, $(SnippetBodyOrderBenchmark_cppfiles)))))
+SnippetBodyOrderBenchmark_cc_release_dep    = $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.release.P, $(SnippetBodyOrderBenchmark_ccfiles)))))
+SnippetBodyOrderBenchmark_c_release_dep      = $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/release/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.P, $(SnippetBodyOrderBenchmark_cfiles)))))
+SnippetBodyOrderBenchmark_release_dep      = $(SnippetBodyOrderBenchmark_cpp_release_dep) $(SnippetBodyOrderBenchmark_cc_release_dep) $(SnippetBodyOrderBenchmark_c_release_dep)
+-include $(SnippetBodyOrderBenchmark_release_dep)
+SnippetBodyOrderBenchmark_debug_hpaths    := 
+SnippetBodyOrderBenchmark_debug_hpaths    += ./../../../Include
+SnippetBodyOrderBenchmark_debug_hpaths    += ./../../../../PxShared/include
+SnippetBodyOrderBenchmark_debug_hpaths    += ./../../../../PxShared/src/foundation/include
+SnippetBodyOrderBenchmark_debug_hpaths    += ./../../../../PxShared/src/fastxml/include
+SnippetBodyOrderBenchmark_debug_lpaths    := 
+SnippetBodyOrderBenchmark_debug_lpaths    += ./../../../Lib/linux64
+SnippetBodyOrderBenchmark_debug_lpaths    += ./../../lib/linux64
+SnippetBodyOrderBenchmark_debug_lpaths    += ./../../../Bin/linux64
+SnippetBodyOrderBenchmark_debug_lpaths    += ./../../../../PxShared/lib/linux64
+SnippetBodyOrderBenchmark_debug_lpaths    += ./../../../../PxShared/bin/linux64
+SnippetBodyOrderBenchmark_debug_lpaths    += ./../../lib/linux64
+SnippetBodyOrderBenchmark_debug_defines   := $(SnippetBodyOrderBenchmark_custom_defines)
+SnippetBodyOrderBenchmark_debug_defines   += PHYSX_PROFILE_SDK
+SnippetBodyOrderBenchmark_debug_defines   += RENDER_SNIPPET
+SnippetBodyOrderBenchmark_debug_defines   += _DEBUG
+SnippetBodyOrderBenchmark_debug_defines   += PX_DEBUG=1
+SnippetBodyOrderBenchmark_debug_defines   += PX_CHECKED=1
+SnippetBodyOrderBenchmark_debug_defines   += PX_SUPPORT_PVD=1
+SnippetBodyOrderBenchmark_debug_libraries := 
+SnippetBodyOrderBenchmark_debug_libraries += SnippetRenderDEBUG
+SnippetBodyOrderBenchmark_debug_libraries += SnippetUtilsDEBUG
+SnippetBodyOrderBenchmark_debug_libraries += PhysX3DEBUG_x64
+SnippetBodyOrderBenchmark_debug_libraries += PhysX3CookingDEBUG_x64
+SnippetBodyOrderBenchmark_debug_libraries += PhysX3CharacterKinematicDEBUG_x64
+SnippetBodyOrderBenchmark_debug_libraries += PhysX3ExtensionsDEBUG
+SnippetBodyOrderBenchmark_debug_libraries += PhysX3VehicleDEBUG
+SnippetBodyOrderBenchmark_debug_libraries += PxPvdSDKDEBUG_x64
+SnippetBodyOrderBenchmark_debug_libraries += PhysX3CommonDEBUG_x64
+SnippetBodyOrderBenchmark_debug_libraries += PxFoundationDEBUG_x64
+SnippetBodyOrderBenchmark_debug_libraries += PxTaskDEBUG
+SnippetBodyOrderBenchmark_debug_libraries += PsFastXmlDEBUG
+SnippetBodyOrderBenchmark_debug_libraries += SnippetUtilsDEBUG
+SnippetBodyOrderBenchmark_debug_libraries += SnippetRenderDEBUG
+SnippetBodyOrderBenchmark_debug_libraries += GL
+SnippetBodyOrderBenchmark_debug_libraries += GLU
+SnippetBodyOrderBenchmark_debug_libraries += glut
+SnippetBodyOrderBenchmark_debug_libraries += X11
+SnippetBodyOrderBenchmark_debug_libraries += rt
+SnippetBodyOrderBenchmark_debug_libraries += pthread
+SnippetBodyOrderBenchmark_debug_common_cflags	:= $(SnippetBodyOrderBenchmark_custom_cflags)
+SnippetBodyOrderBenchmark_debug_common_cflags    += -MMD
+SnippetBodyOrderBenchmark_debug_common_cflags    += $(addprefix -D, $(SnippetBodyOrderBenchmark_debug_defines))
+SnippetBodyOrderBenchmark_debug_common_cflags    += $(addprefix -I, $(SnippetBodyOrderBenchmark_debug_hpaths))
+SnippetBodyOrderBenchmark_debug_common_cflags  += -m64
+SnippetBodyOrderBenchmark_debug_common_cflags  += -Werror -m64 -fPIC -msse2 -mfpmath=sse -fno-exceptions -fno-rtti -fvisibility=hidden -fvisibility-inlines-hidden
+SnippetBodyOrderBenchmark_debug_common_cflags  += -Wall -Wextra -Wstrict-aliasing=2 -fdiagnostics-show-option
+SnippetBodyOrderBenchmark_debug_common_cflags  += -Wno-uninitialized
+SnippetBodyOrderBenchmark_debug_common_cflags  += -g3 -gdwarf-2
+SnippetBodyOrderBenchmark_debug_cflags	:= $(SnippetBodyOrderBenchmark_debug_common_cflags)
+SnippetBodyOrderBenchmark_debug_cppflags	:= $(SnippetBodyOrderBenchmark_debug_common_cflags)
+SnippetBodyOrderBenchmark_debug_lflags    := $(SnippetBodyOrderBenchmark_custom_lflags)
+SnippetBodyOrderBenchmark_debug_lflags    += $(addprefix -L, $(SnippetBodyOrderBenchmark_debug_lpaths))
+SnippetBodyOrderBenchmark_debug_lflags    += -Wl,--start-group $(addprefix -l, $(SnippetBodyOrderBenchmark_debug_libraries)) -Wl,--end-group
+SnippetBodyOrderBenchmark_debug_lflags  += -lrt
+SnippetBodyOrderBenchmark_debug_lflags  += -Wl,-rpath ./
+SnippetBodyOrderBenchmark_debug_lflags  += -m64
+SnippetBodyOrderBenchmark_debug_objsdir  = $(OBJS_DIR)/SnippetBodyOrderBenchmark_debug
+SnippetBodyOrderBenchmark_debug_cpp_o    = $(addprefix $(SnippetBodyOrderBenchmark_debug_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.o, $(SnippetBodyOrderBenchmark_cppfiles)))))
+SnippetBodyOrderBenchmark_debug_cc_o    = $(addprefix $(SnippetBodyOrderBenchmark_debug_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.o, $(SnippetBodyOrderBenchmark_ccfiles)))))
+SnippetBodyOrderBenchmark_debug_c_o      = $(addprefix $(SnippetBodyOrderBenchmark_debug_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.o, $(SnippetBodyOrderBenchmark_cfiles)))))
+SnippetBodyOrderBenchmark_debug_obj      = $(SnippetBodyOrderBenchmark_debug_cpp_o) $(SnippetBodyOrderBenchmark_debug_cc_o) $(SnippetBodyOrderBenchmark_debug_c_o)
+SnippetBodyOrderBenchmark_debug_bin      := ./../../../Bin/linux64/SnippetBodyOrderBenchmarkDEBUG
+
+clean_SnippetBodyOrderBenchmark_debug: 
+	@$(ECHO) clean SnippetBodyOrderBenchmark debug
+	@$(RMDIR) $(SnippetBodyOrderBenchmark_debug_objsdir)
+	@$(RMDIR) $(SnippetBodyOrderBenchmark_debug_bin)
+	@$(RMDIR) $(DEPSDIR)/SnippetBodyOrderBenchmark/debug
+
+build_SnippetBodyOrderBenchmark_debug: postbuild_SnippetBodyOrderBenchmark_debug
+postbuild_SnippetBodyOrderBenchmark_debug: mainbuild_SnippetBodyOrderBenchmark_debug
+	@cp -u "../../../../PxShared/bin/linux64/libPxFoundationDEBUG_x64.so" "../../../Bin/linux64/libPxFoundationDEBUG_x64.so"; cp -u "../../../../PxShared/bin/linux64/libPxPvdSDKDEBUG_x64.so" "../../../Bin/linux64/libPxPvdSDKDEBUG_x64.so"
+mainbuild_SnippetBodyOrderBenchmark_debug: prebuild_SnippetBodyOrderBenchmark_debug $(SnippetBodyOrderBenchmark_debug_bin)
+prebuild_SnippetBodyOrderBenchmark_debug:
+
+$(SnippetBodyOrderBenchmark_debug_bin): $(SnippetBodyOrderBenchmark_debug_obj) build_SnippetRender_debug build_SnippetUtils_debug 
+	mkdir -p `dirname ./../../../Bin/linux64/SnippetBodyOrderBenchmarkDEBUG`
+	$(CCLD) $(SnippetBodyOrderBenchmark_debug_obj) $(SnippetBodyOrderBenchmark_debug_lflags) -o $(SnippetBodyOrderBenchmark_debug_bin) 
+	$(ECHO) building $@ complete!
+
+SnippetBodyOrderBenchmark_debug_DEPDIR = $(dir $(@))/$(*F)
+$(SnippetBodyOrderBenchmark_debug_cpp_o): $(SnippetBodyOrderBenchmark_debug_objsdir)/%.o:
+	$(ECHO) SnippetBodyOrderBenchmark: compiling debug $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetBodyOrderBenchmark_debug_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cppfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetBodyOrderBenchmark_debug_cppflags) -c $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetBodyOrderBenchmark_debug_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cppfiles)) -o $@
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetBodyOrderBenchmark_debug_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cppfiles))))))
+	cp $(SnippetBodyOrderBenchmark_debug_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetBodyOrderBenchmark_debug_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cppfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetBodyOrderBenchmark_debug_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetBodyOrderBenchmark_debug_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cppfiles))))).P; \
+	  rm -f $(SnippetBodyOrderBenchmark_debug_DEPDIR).d
+
+$(SnippetBodyOrderBenchmark_debug_cc_o): $(SnippetBodyOrderBenchmark_debug_objsdir)/%.o:
+	$(ECHO) SnippetBodyOrderBenchmark: compiling debug $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetBodyOrderBenchmark_debug_objsdir),, $@))), $(SnippetBodyOrderBenchmark_ccfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetBodyOrderBenchmark_debug_cppflags) -c $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetBodyOrderBenchmark_debug_objsdir),, $@))), $(SnippetBodyOrderBenchmark_ccfiles)) -o $@
+	mkdir -p $(dir $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetBodyOrderBenchmark_debug_objsdir),, $@))), $(SnippetBodyOrderBenchmark_ccfiles))))))
+	cp $(SnippetBodyOrderBenchmark_debug_DEPDIR).d $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetBodyOrderBenchmark_debug_objsdir),, $@))), $(SnippetBodyOrderBenchmark_ccfiles))))).debug.P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetBodyOrderBenchmark_debug_DEPDIR).d >> $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetBodyOrderBenchmark_debug_objsdir),, $@))), $(SnippetBodyOrderBenchmark_ccfiles))))).debug.P; \
+	  rm -f $(SnippetBodyOrderBenchmark_debug_DEPDIR).d
+
+$(SnippetBodyOrderBenchmark_debug_c_o): $(SnippetBodyOrderBenchmark_debug_objsdir)/%.o:
+	$(ECHO) SnippetBodyOrderBenchmark: compiling debug $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetBodyOrderBenchmark_debug_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cfiles))...
+	mkdir -p $(dir $(@))
+	$(CC) $(SnippetBodyOrderBenchmark_debug_cflags) -c $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetBodyOrderBenchmark_debug_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cfiles)) -o $@ 
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetBodyOrderBenchmark_debug_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cfiles))))))
+	cp $(SnippetBodyOrderBenchmark_debug_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetBodyOrderBenchmark_debug_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetBodyOrderBenchmark_debug_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetBodyOrderBenchmark_debug_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cfiles))))).P; \
+	  rm -f $(SnippetBodyOrderBenchmark_debug_DEPDIR).d
+
+SnippetBodyOrderBenchmark_checked_hpaths    := 
+SnippetBodyOrderBenchmark_checked_hpaths    += ./../../../Include
+SnippetBodyOrderBenchmark_checked_hpaths    += ./../../../../PxShared/include
+SnippetBodyOrderBenchmark_checked_hpaths    += ./../../../../PxShared/src/foundation/include
+SnippetBodyOrderBenchmark_checked_hpaths    += ./../../../../PxShared/src/fastxml/include
+SnippetBodyOrderBenchmark_checked_lpaths    := 
+SnippetBodyOrderBenchmark_checked_lpaths    += ./../../../Lib/linux64
+SnippetBodyOrderBenchmark_checked_lpaths    += ./../../lib/linux64
+SnippetBodyOrderBenchmark_checked_lpaths    += ./../../../Bin/linux64
+SnippetBodyOrderBenchmark_checked_lpaths    += ./../../../../PxShared/lib/linux64
+SnippetBodyOrderBenchmark_checked_lpaths    += ./../../../../PxShared/bin/linux64
+SnippetBodyOrderBenchmark_checked_lpaths    += ./../../lib/linux64
+SnippetBodyOrderBenchmark_checked_defines   := $(SnippetBodyOrderBenchmark_custom_defines)
+SnippetBodyOrderBenchmark_checked_defines   += PHYSX_PROFILE_SDK
+SnippetBodyOrderBenchmark_checked_defines   += RENDER_SNIPPET
+SnippetBodyOrderBenchmark_checked_defines   += NDEBUG
+SnippetBodyOrderBenchmark_checked_defines   += PX_CHECKED=1
+SnippetBodyOrderBenchmark_checked_defines   += PX_SUPPORT_PVD=1
+SnippetBodyOrderBenchmark_checked_libraries := 
+SnippetBodyOrderBenchmark_checked_libraries += SnippetRenderCHECKED
+SnippetBodyOrderBenchmark_checked_libraries += SnippetUtilsCHECKED
+SnippetBodyOrderBenchmark_checked_libraries += PhysX3CHECKED_x64
+SnippetBodyOrderBenchmark_checked_libraries += PhysX3CookingCHECKED_x64
+SnippetBodyOrderBenchmark_checked_libraries += PhysX3CharacterKinematicCHECKED_x64
+SnippetBodyOrderBenchmark_checked_libraries += PhysX3ExtensionsCHECKED
+SnippetBodyOrderBenchmark_checked_libraries += PhysX3VehicleCHECKED
+SnippetBodyOrderBenchmark_checked_libraries += PxPvdSDKCHECKED_x64
+SnippetBodyOrderBenchmark_checked_libraries += PhysX3CommonCHECKED_x64
+SnippetBodyOrderBenchmark_checked_libraries += PxFoundationCHECKED_x64
+SnippetBodyOrderBenchmark_checked_libraries += PxTaskCHECKED
+SnippetBodyOrderBenchmark_checked_libraries += PsFastXmlCHECKED
+SnippetBodyOrderBenchmark_checked_libraries += SnippetUtilsCHECKED
+SnippetBodyOrderBenchmark_checked_libraries += SnippetRenderCHECKED
+SnippetBodyOrderBenchmark_checked_libraries += GL
+SnippetBodyOrderBenchmark_checked_libraries += GLU
+SnippetBodyOrderBenchmark_checked_libraries += glut
+SnippetBodyOrderBenchmark_checked_libraries += X11
+SnippetBodyOrderBenchmark_checked_libraries += rt
+SnippetBodyOrderBenchmark_checked_libraries += pthread
+SnippetBodyOrderBenchmark_checked_common_cflags	:= $(SnippetBodyOrderBenchmark_custom_cflags)
+SnippetBodyOrderBenchmark_checked_common_cflags    += -MMD
+SnippetBodyOrderBenchmark_checked_common_cflags    += $(addprefix -D, $(SnippetBodyOrderBenchmark_checked_defines))
+SnippetBodyOrderBenchmark_checked_common_cflags    += $(addprefix -I, $(SnippetBodyOrderBenchmark_checked_hpaths))
+SnippetBodyOrderBenchmark_checked_common_cflags  += -m64
+SnippetBodyOrderBenchmark_checked_common_cflags  += -Werror -m64 -fPIC -msse2 -mfpmath=sse -fno-exceptions -fno-rtti -fvisibility=hidden -fvisibility-inlines-hidden
+SnippetBodyOrderBenchmark_checked_common_cflags  += -Wall -Wextra -Wstrict-aliasing=2 -fdiagnostics-show-option
+SnippetBodyOrderBenchmark_checked_common_cflags  += -Wno-uninitialized
+SnippetBodyOrderBenchmark_checked_common_cflags  += -g3 -gdwarf-2 -O3 -fno-strict-aliasing
+SnippetBodyOrderBenchmark_checked_cflags	:= $(SnippetBodyOrderBenchmark_checked_common_cflags)
+SnippetBodyOrderBenchmark_checked_cppflags	:= $(SnippetBodyOrderBenchmark_checked_common_cflags)
+SnippetBodyOrderBenchmark_checked_lflags    := $(SnippetBodyOrderBenchmark_custom_lflags)
+SnippetBodyOrderBenchmark_checked_lflags    += $(addprefix -L, $(SnippetBodyOrderBenchmark_checked_lpaths))
+SnippetBodyOrderBenchmark_checked_lflags    += -Wl,--start-group $(addprefix -l, $(SnippetBodyOrderBenchmark_checked_libraries)) -Wl,--end-group
+SnippetBodyOrderBenchmark_checked_lflags  += -lrt
+SnippetBodyOrderBenchmark_checked_lflags  += -Wl,-rpath ./
+SnippetBodyOrderBenchmark_checked_lflags  += -m64
+SnippetBodyOrderBenchmark_checked_objsdir  = $(OBJS_DIR)/SnippetBodyOrderBenchmark_checked
+SnippetBodyOrderBenchmark_checked_cpp_o    = $(addprefix $(SnippetBodyOrderBenchmark_checked_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.o, $(SnippetBodyOrderBenchmark_cppfiles)))))
+SnippetBodyOrderBenchmark_checked_cc_o    = $(addprefix $(SnippetBodyOrderBenchmark_checked_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.o, $(SnippetBodyOrderBenchmark_ccfiles)))))
+SnippetBodyOrderBenchmark_checked_c_o      = $(addprefix $(SnippetBodyOrderBenchmark_checked_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.o, $(SnippetBodyOrderBenchmark_cfiles)))))
+SnippetBodyOrderBenchmark_checked_obj      = $(SnippetBodyOrderBenchmark_checked_cpp_o) $(SnippetBodyOrderBenchmark_checked_cc_o) $(SnippetBodyOrderBenchmark_checked_c_o)
+SnippetBodyOrderBenchmark_checked_bin      := ./../../../Bin/linux64/SnippetBodyOrderBenchmarkCHECKED
+
+clean_SnippetBodyOrderBenchmark_checked: 
+	@$(ECHO) clean SnippetBodyOrderBenchmark checked
+	@$(RMDIR) $(SnippetBodyOrderBenchmark_checked_objsdir)
+	@$(RMDIR) $(SnippetBodyOrderBenchmark_checked_bin)
+	@$(RMDIR) $(DEPSDIR)/SnippetBodyOrderBenchmark/checked
+
+build_SnippetBodyOrderBenchmark_checked: postbuild_SnippetBodyOrderBenchmark_checked
+postbuild_SnippetBodyOrderBenchmark_checked: mainbuild_SnippetBodyOrderBenchmark_checked
+	@cp -u "../../../../PxShared/bin/linux64/libPxFoundationCHECKED_x64.so" "../../../Bin/linux64/libPxFoundationCHECKED_x64.so"; cp -u "../../../../PxShared/bin/linux64/libPxPvdSDKCHECKED_x64.so" "../../../Bin/linux64/libPxPvdSDKCHECKED_x64.so"
+mainbuild_SnippetBodyOrderBenchmark_checked: prebuild_SnippetBodyOrderBenchmark_checked $(SnippetBodyOrderBenchmark_checked_bin)
+prebuild_SnippetBodyOrderBenchmark_checked:
+
+$(SnippetBodyOrderBenchmark_checked_bin): $(SnippetBodyOrderBenchmark_checked_obj) build_SnippetRender_checked build_SnippetUtils_checked 
+	mkdir -p `dirname ./../../../Bin/linux64/SnippetBodyOrderBenchmarkCHECKED`
+	$(CCLD) $(SnippetBodyOrderBenchmark_checked_obj) $(SnippetBodyOrderBenchmark_checked_lflags) -o $(SnippetBodyOrderBenchmark_checked_bin) 
+	$(ECHO) building $@ complete!
+
+SnippetBodyOrderBenchmark_checked_DEPDIR = $(dir $(@))/$(*F)
+$(SnippetBodyOrderBenchmark_checked_cpp_o): $(SnippetBodyOrderBenchmark_checked_objsdir)/%.o:
+	$(ECHO) SnippetBodyOrderBenchmark: compiling checked $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetBodyOrderBenchmark_checked_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cppfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetBodyOrderBenchmark_checked_cppflags) -c $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetBodyOrderBenchmark_checked_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cppfiles)) -o $@
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetBodyOrderBenchmark_checked_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cppfiles))))))
+	cp $(SnippetBodyOrderBenchmark_checked_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetBodyOrderBenchmark_checked_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cppfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetBodyOrderBenchmark_checked_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetBodyOrderBenchmark_checked_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cppfiles))))).P; \
+	  rm -f $(SnippetBodyOrderBenchmark_checked_DEPDIR).d
+
+$(SnippetBodyOrderBenchmark_checked_cc_o): $(SnippetBodyOrderBenchmark_checked_objsdir)/%.o:
+	$(ECHO) SnippetBodyOrderBenchmark: compiling checked $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetBodyOrderBenchmark_checked_objsdir),, $@))), $(SnippetBodyOrderBenchmark_ccfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetBodyOrderBenchmark_checked_cppflags) -c $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetBodyOrderBenchmark_checked_objsdir),, $@))), $(SnippetBodyOrderBenchmark_ccfiles)) -o $@
+	mkdir -p $(dir $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetBodyOrderBenchmark_checked_objsdir),, $@))), $(SnippetBodyOrderBenchmark_ccfiles))))))
+	cp $(SnippetBodyOrderBenchmark_checked_DEPDIR).d $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetBodyOrderBenchmark_checked_objsdir),, $@))), $(SnippetBodyOrderBenchmark_ccfiles))))).checked.P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetBodyOrderBenchmark_checked_DEPDIR).d >> $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetBodyOrderBenchmark_checked_objsdir),, $@))), $(SnippetBodyOrderBenchmark_ccfiles))))).checked.P; \
+	  rm -f $(SnippetBodyOrderBenchmark_checked_DEPDIR).d
+
+$(SnippetBodyOrderBenchmark_checked_c_o): $(SnippetBodyOrderBenchmark_checked_objsdir)/%.o:
+	$(ECHO) SnippetBodyOrderBenchmark: compiling checked $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetBodyOrderBenchmark_checked_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cfiles))...
+	mkdir -p $(dir $(@))
+	$(CC) $(SnippetBodyOrderBenchmark_checked_cflags) -c $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetBodyOrderBenchmark_checked_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cfiles)) -o $@ 
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetBodyOrderBenchmark_checked_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cfiles))))))
+	cp $(SnippetBodyOrderBenchmark_checked_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetBodyOrderBenchmark_checked_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetBodyOrderBenchmark_checked_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetBodyOrderBenchmark_checked_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cfiles))))).P; \
+	  rm -f $(SnippetBodyOrderBenchmark_checked_DEPDIR).d
+
+SnippetBodyOrderBenchmark_profile_hpaths    := 
+SnippetBodyOrderBenchmark_profile_hpaths    += ./../../../Include
+SnippetBodyOrderBenchmark_profile_hpaths    += ./../../../../PxShared/include
+SnippetBodyOrderBenchmark_profile_hpaths    += ./../../../../PxShared/src/foundation/include
+SnippetBodyOrderBenchmark_profile_hpaths    += ./../../../../PxShared/src/fastxml/include
+SnippetBodyOrderBenchmark_profile_lpaths    := 
+SnippetBodyOrderBenchmark_profile_lpaths    += ./../../../Lib/linux64
+SnippetBodyOrderBenchmark_profile_lpaths    += ./../../lib/linux64
+SnippetBodyOrderBenchmark_profile_lpaths    += ./../../../Bin/linux64
+SnippetBodyOrderBenchmark_profile_lpaths    += ./../../../../PxShared/lib/linux64
+SnippetBodyOrderBenchmark_profile_lpaths    += ./../../../../PxShared/bin/linux64
+SnippetBodyOrderBenchmark_profile_lpaths    += ./../../lib/linux64
+SnippetBodyOrderBenchmark_profile_defines   := $(SnippetBodyOrderBenchmark_custom_defines)
+SnippetBodyOrderBenchmark_profile_defines   += PHYSX_PROFILE_SDK
+SnippetBodyOrderBenchmark_profile_defines   += RENDER_SNIPPET
+SnippetBodyOrderBenchmark_profile_defines   += NDEBUG
+SnippetBodyOrderBenchmark_profile_defines   += PX_PROFILE=1
+SnippetBodyOrderBenchmark_profile_defines   += PX_SUPPORT_PVD=1
+SnippetBodyOrderBenchmark_profile_libraries := 
+SnippetBodyOrderBenchmark_profile_libraries += SnippetRenderPROFILE
+SnippetBodyOrderBenchmark_profile_libraries += SnippetUtilsPROFILE
+SnippetBodyOrderBenchmark_profile_libraries += PhysX3PROFILE_x64
+SnippetBodyOrderBenchmark_profile_libraries += PhysX3CookingPROFILE_x64
+SnippetBodyOrderBenchmark_profile_libraries += PhysX3CharacterKinematicPROFILE_x64
+SnippetBodyOrderBenchmark_profile_libraries += PhysX3ExtensionsPROFILE
+SnippetBodyOrderBenchmark_profile_libraries += PhysX3VehiclePROFILE
+SnippetBodyOrderBenchmark_profile_libraries += PxPvdSDKPROFILE_x64
+SnippetBodyOrderBenchmark_profile_libraries += PhysX3CommonPROFILE_x64
+SnippetBodyOrderBenchmark_profile_libraries += PxFoundationPROFILE_x64
+SnippetBodyOrderBenchmark_profile_libraries += PxTaskPROFILE
+SnippetBodyOrderBenchmark_profile_libraries += PsFastXmlPROFILE
+SnippetBodyOrderBenchmark_profile_libraries += SnippetUtilsPROFILE
+SnippetBodyOrderBenchmark_profile_libraries += SnippetRenderPROFILE
+SnippetBodyOrderBenchmark_profile_libraries += GL
+SnippetBodyOrderBenchmark_profile_libraries += GLU
+SnippetBodyOrderBenchmark_profile_libraries += glut
+SnippetBodyOrderBenchmark_profile_libraries += X11
+SnippetBodyOrderBenchmark_profile_libraries += rt
+SnippetBodyOrderBenchmark_profile_libraries += pthread
+SnippetBodyOrderBenchmark_profile_common_cflags	:= $(SnippetBodyOrderBenchmark_custom_cflags)
+SnippetBodyOrderBenchmark_profile_common_cflags    += -MMD
+SnippetBodyOrderBenchmark_profile_common_cflags    += $(addprefix -D, $(SnippetBodyOrderBenchmark_profile_defines))
+SnippetBodyOrderBenchmark_profile_common_cflags    += $(addprefix -I, $(SnippetBodyOrderBenchmark_profile_hpaths))
+SnippetBodyOrderBenchmark_profile_common_cflags  += -m64
+SnippetBodyOrderBenchmark_profile_common_cflags  += -Werror -m64 -fPIC -msse2 -mfpmath=sse -fno-exceptions -fno-rtti -fvisibility=hidden -fvisibility-inlines-hidden
+SnippetBodyOrderBenchmark_profile_common_cflags  += -Wall -Wextra -Wstrict-aliasing=2 -fdiagnostics-show-option
+SnippetBodyOrderBenchmark_profile_common_cflags  += -Wno-uninitialized
+SnippetBodyOrderBenchmark_profile_common_cflags  += -O3 -fno-strict-aliasing
+SnippetBodyOrderBenchmark_profile_cflags	:= $(SnippetBodyOrderBenchmark_profile_common_cflags)
+SnippetBodyOrderBenchmark_profile_cppflags	:= $(SnippetBodyOrderBenchmark_profile_common_cflags)
+SnippetBodyOrderBenchmark_profile_lflags    := $(SnippetBodyOrderBenchmark_custom_lflags)
+SnippetBodyOrderBenchmark_profile_lflags    += $(addprefix -L, $(SnippetBodyOrderBenchmark_profile_lpaths))
+SnippetBodyOrderBenchmark_profile_lflags    += -Wl,--start-group $(addprefix -l, $(SnippetBodyOrderBenchmark_profile_libraries)) -Wl,--end-group
+SnippetBodyOrderBenchmark_profile_lflags  += -lrt
+SnippetBodyOrderBenchmark_profile_lflags  += -Wl,-rpath ./
+SnippetBodyOrderBenchmark_profile_lflags  += -m64
+SnippetBodyOrderBenchmark_profile_objsdir  = $(OBJS_DIR)/SnippetBodyOrderBenchmark_profile
+SnippetBodyOrderBenchmark_profile_cpp_o    = $(addprefix $(SnippetBodyOrderBenchmark_profile_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.o, $(SnippetBodyOrderBenchmark_cppfiles)))))
+SnippetBodyOrderBenchmark_profile_cc_o    = $(addprefix $(SnippetBodyOrderBenchmark_profile_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.o, $(SnippetBodyOrderBenchmark_ccfiles)))))
+SnippetBodyOrderBenchmark_profile_c_o      = $(addprefix $(SnippetBodyOrderBenchmark_profile_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.o, $(SnippetBodyOrderBenchmark_cfiles)))))
+SnippetBodyOrderBenchmark_profile_obj      = $(SnippetBodyOrderBenchmark_profile_cpp_o) $(SnippetBodyOrderBenchmark_profile_cc_o) $(SnippetBodyOrderBenchmark_profile_c_o)
+SnippetBodyOrderBenchmark_profile_bin      := ./../../../Bin/linux64/SnippetBodyOrderBenchmarkPROFILE
+
+clean_SnippetBodyOrderBenchmark_profile: 
+	@$(ECHO) clean SnippetBodyOrderBenchmark profile
+	@$(RMDIR) $(SnippetBodyOrderBenchmark_profile_objsdir)
+	@$(RMDIR) $(SnippetBodyOrderBenchmark_profile_bin)
+	@$(RMDIR) $(DEPSDIR)/SnippetBodyOrderBenchmark/profile
+
+build_SnippetBodyOrderBenchmark_profile: postbuild_SnippetBodyOrderBenchmark_profile
+postbuild_SnippetBodyOrderBenchmark_profile: mainbuild_SnippetBodyOrderBenchmark_profile
+	@cp -u "../../../../PxShared/bin/linux64/libPxFoundationPROFILE_x64.so" "../../../Bin/linux64/libPxFoundationPROFILE_x64.so"; cp -u "../../../../PxShared/bin/linux64/libPxPvdSDKPROFILE_x64.so" "../../../Bin/linux64/libPxPvdSDKPROFILE_x64.so"
+mainbuild_SnippetBodyOrderBenchmark_profile: prebuild_SnippetBodyOrderBenchmark_profile $(SnippetBodyOrderBenchmark_profile_bin)
+prebuild_SnippetBodyOrderBenchmark_profile:
+
+$(SnippetBodyOrderBenchmark_profile_bin): $(SnippetBodyOrderBenchmark_profile_obj) build_SnippetRender_profile build_SnippetUtils_profile 
+	mkdir -p `dirname ./../../../Bin/linux64/SnippetBodyOrderBenchmarkPROFILE`
+	$(CCLD) $(SnippetBodyOrderBenchmark_profile_obj) $(SnippetBodyOrderBenchmark_profile_lflags) -o $(SnippetBodyOrderBenchmark_profile_bin) 
+	$(ECHO) building $@ complete!
+
+SnippetBodyOrderBenchmark_profile_DEPDIR = $(dir $(@))/$(*F)
+$(SnippetBodyOrderBenchmark_profile_cpp_o): $(SnippetBodyOrderBenchmark_profile_objsdir)/%.o:
+	$(ECHO) SnippetBodyOrderBenchmark: compiling profile $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetBodyOrderBenchmark_profile_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cppfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetBodyOrderBenchmark_profile_cppflags) -c $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetBodyOrderBenchmark_profile_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cppfiles)) -o $@
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetBodyOrderBenchmark_profile_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cppfiles))))))
+	cp $(SnippetBodyOrderBenchmark_profile_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetBodyOrderBenchmark_profile_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cppfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetBodyOrderBenchmark_profile_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetBodyOrderBenchmark_profile_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cppfiles))))).P; \
+	  rm -f $(SnippetBodyOrderBenchmark_profile_DEPDIR).d
+
+$(SnippetBodyOrderBenchmark_profile_cc_o): $(SnippetBodyOrderBenchmark_profile_objsdir)/%.o:
+	$(ECHO) SnippetBodyOrderBenchmark: compiling profile $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetBodyOrderBenchmark_profile_objsdir),, $@))), $(SnippetBodyOrderBenchmark_ccfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetBodyOrderBenchmark_profile_cppflags) -c $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetBodyOrderBenchmark_profile_objsdir),, $@))), $(SnippetBodyOrderBenchmark_ccfiles)) -o $@
+	mkdir -p $(dir $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetBodyOrderBenchmark_profile_objsdir),, $@))), $(SnippetBodyOrderBenchmark_ccfiles))))))
+	cp $(SnippetBodyOrderBenchmark_profile_DEPDIR).d $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetBodyOrderBenchmark_profile_objsdir),, $@))), $(SnippetBodyOrderBenchmark_ccfiles))))).profile.P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetBodyOrderBenchmark_profile_DEPDIR).d >> $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetBodyOrderBenchmark_profile_objsdir),, $@))), $(SnippetBodyOrderBenchmark_ccfiles))))).profile.P; \
+	  rm -f $(SnippetBodyOrderBenchmark_profile_DEPDIR).d
+
+$(SnippetBodyOrderBenchmark_profile_c_o): $(SnippetBodyOrderBenchmark_profile_objsdir)/%.o:
+	$(ECHO) SnippetBodyOrderBenchmark: compiling profile $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetBodyOrderBenchmark_profile_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cfiles))...
+	mkdir -p $(dir $(@))
+	$(CC) $(SnippetBodyOrderBenchmark_profile_cflags) -c $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetBodyOrderBenchmark_profile_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cfiles)) -o $@ 
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetBodyOrderBenchmark_profile_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cfiles))))))
+	cp $(SnippetBodyOrderBenchmark_profile_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetBodyOrderBenchmark_profile_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetBodyOrderBenchmark_profile_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetBodyOrderBenchmark_profile_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cfiles))))).P; \
+	  rm -f $(SnippetBodyOrderBenchmark_profile_DEPDIR).d
+
+SnippetBodyOrderBenchmark_release_hpaths    := 
+SnippetBodyOrderBenchmark_release_hpaths    += ./../../../Include
+SnippetBodyOrderBenchmark_release_hpaths    += ./../../../../PxShared/include
+SnippetBodyOrderBenchmark_release_hpaths    += ./../../../../PxShared/src/foundation/include
+SnippetBodyOrderBenchmark_release_hpaths    += ./../../../../PxShared/src/fastxml/include
+SnippetBodyOrderBenchmark_release_lpaths    := 
+SnippetBodyOrderBenchmark_release_lpaths    += ./../../../Lib/linux64
+SnippetBodyOrderBenchmark_release_lpaths    += ./../../lib/linux64
+SnippetBodyOrderBenchmark_release_lpaths    += ./../../../Bin/linux64
+SnippetBodyOrderBenchmark_release_lpaths    += ./../../../../PxShared/lib/linux64
+SnippetBodyOrderBenchmark_release_lpaths    += ./../../../../PxShared/bin/linux64
+SnippetBodyOrderBenchmark_release_lpaths    += ./../../lib/linux64
+SnippetBodyOrderBenchmark_release_defines   := $(SnippetBodyOrderBenchmark_custom_defines)
+SnippetBodyOrderBenchmark_release_defines   += PHYSX_PROFILE_SDK
+SnippetBodyOrderBenchmark_release_defines   += RENDER_SNIPPET
+SnippetBodyOrderBenchmark_release_defines   += NDEBUG
+SnippetBodyOrderBenchmark_release_defines   += PX_SUPPORT_PVD=0
+SnippetBodyOrderBenchmark_release_libraries := 
+SnippetBodyOrderBenchmark_release_libraries += SnippetRender
+SnippetBodyOrderBenchmark_release_libraries += SnippetUtils
+SnippetBodyOrderBenchmark_release_libraries += PhysX3_x64
+SnippetBodyOrderBenchmark_release_libraries += PhysX3Cooking_x64
+SnippetBodyOrderBenchmark_release_libraries += PhysX3CharacterKinematic_x64
+SnippetBodyOrderBenchmark_release_libraries += PhysX3Extensions
+SnippetBodyOrderBenchmark_release_libraries += PhysX3Vehicle
+SnippetBodyOrderBenchmark_release_libraries += PxPvdSDK_x64
+SnippetBodyOrderBenchmark_release_libraries += PhysX3Common_x64
+SnippetBodyOrderBenchmark_release_libraries += PxFoundation_x64
+SnippetBodyOrderBenchmark_release_libraries += PxTask
+SnippetBodyOrderBenchmark_release_libraries += PsFastXml
+SnippetBodyOrderBenchmark_release_libraries += SnippetUtils
+SnippetBodyOrderBenchmark_release_libraries += SnippetRender
+SnippetBodyOrderBenchmark_release_libraries += GL
+SnippetBodyOrderBenchmark_release_libraries += GLU
+SnippetBodyOrderBenchmark_release_libraries += glut
+SnippetBodyOrderBenchmark_release_libraries += X11
+SnippetBodyOrderBenchmark_release_libraries += rt
+SnippetBodyOrderBenchmark_release_libraries += pthread
+SnippetBodyOrderBenchmark_release_common_cflags	:= $(SnippetBodyOrderBenchmark_custom_cflags)
+SnippetBodyOrderBenchmark_release_common_cflags    += -MMD
+SnippetBodyOrderBenchmark_release_common_cflags    += $(addprefix -D, $(SnippetBodyOrderBenchmark_release_defines))
+SnippetBodyOrderBenchmark_release_common_cflags    += $(addprefix -I, $(SnippetBodyOrderBenchmark_release_hpaths))
+SnippetBodyOrderBenchmark_release_common_cflags  += -m64
+SnippetBodyOrderBenchmark_release_common_cflags  += -Werror -m64 -fPIC -msse2 -mfpmath=sse -fno-exceptions -fno-rtti -fvisibility=hidden -fvisibility-inlines-hidden
+SnippetBodyOrderBenchmark_release_common_cflags  += -Wall -Wextra -Wstrict-aliasing=2 -fdiagnostics-show-option
+SnippetBodyOrderBenchmark_release_common_cflags  += -Wno-uninitialized
+SnippetBodyOrderBenchmark_release_common_cflags  += -O3 -fno-strict-aliasing
+SnippetBodyOrderBenchmark_release_cflags	:= $(SnippetBodyOrderBenchmark_release_common_cflags)
+SnippetBodyOrderBenchmark_release_cppflags	:= $(SnippetBodyOrderBenchmark_release_common_cflags)
+SnippetBodyOrderBenchmark_release_lflags    := $(SnippetBodyOrderBenchmark_custom_lflags)
+SnippetBodyOrderBenchmark_release_lflags    += $(addprefix -L, $(SnippetBodyOrderBenchmark_release_lpaths))
+SnippetBodyOrderBenchmark_release_lflags    += -Wl,--start-group $(addprefix -l, $(SnippetBodyOrderBenchmark_release_libraries)) -Wl,--end-group
+SnippetBodyOrderBenchmark_release_lflags  += -lrt
+SnippetBodyOrderBenchmark_release_lflags  += -Wl,-rpath ./
+SnippetBodyOrderBenchmark_release_lflags  += -m64
+SnippetBodyOrderBenchmark_release_objsdir  = $(OBJS_DIR)/SnippetBodyOrderBenchmark_release
+SnippetBodyOrderBenchmark_release_cpp_o    = $(addprefix $(SnippetBodyOrderBenchmark_release_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.o, $(SnippetBodyOrderBenchmark_cppfiles)))))
+SnippetBodyOrderBenchmark_release_cc_o    = $(addprefix $(SnippetBodyOrderBenchmark_release_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.o, $(SnippetBodyOrderBenchmark_ccfiles)))))
+SnippetBodyOrderBenchmark_release_c_o      = $(addprefix $(SnippetBodyOrderBenchmark_release_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.o, $(SnippetBodyOrderBenchmark_cfiles)))))
+SnippetBodyOrderBenchmark_release_obj      = $(SnippetBodyOrderBenchmark_release_cpp_o) $(SnippetBodyOrderBenchmark_release_cc_o) $(SnippetBodyOrderBenchmark_release_c_o)
+SnippetBodyOrderBenchmark_release_bin      := ./../../../Bin/linux64/SnippetBodyOrderBenchmark
+
+clean_SnippetBodyOrderBenchmark_release: 
+	@$(ECHO) clean SnippetBodyOrderBenchmark release
+	@$(RMDIR) $(SnippetBodyOrderBenchmark_release_objsdir)
+	@$(RMDIR) $(SnippetBodyOrderBenchmark_release_bin)
+	@$(RMDIR) $(DEPSDIR)/SnippetBodyOrderBenchmark/release
+
+build_SnippetBodyOrderBenchmark_release: postbuild_SnippetBodyOrderBenchmark_release
+postbuild_SnippetBodyOrderBenchmark_release: mainbuild_SnippetBodyOrderBenchmark_release
+	@cp -u "../../../../PxShared/bin/linux64/libPxFoundation_x64.so" "../../../Bin/linux64/libPxFoundation_x64.so"; cp -u "../../../../PxShared/bin/linux64/libPxPvdSDK_x64.so" "../../../Bin/linux64/libPxPvdSDK_x64.so"
+mainbuild_SnippetBodyOrderBenchmark_release: prebuild_SnippetBodyOrderBenchmark_release $(SnippetBodyOrderBenchmark_release_bin)
+prebuild_SnippetBodyOrderBenchmark_release:
+
+$(SnippetBodyOrderBenchmark_release_bin): $(SnippetBodyOrderBenchmark_release_obj) build_SnippetRender_release build_SnippetUtils_release 
+	mkdir -p `dirname ./../../../Bin/linux64/SnippetBodyOrderBenchmark`
+	$(CCLD) $(SnippetBodyOrderBenchmark_release_obj) $(SnippetBodyOrderBenchmark_release_lflags) -o $(SnippetBodyOrderBenchmark_release_bin) 
+	$(ECHO) building $@ complete!
+
+SnippetBodyOrderBenchmark_release_DEPDIR = $(dir $(@))/$(*F)
+$(SnippetBodyOrderBenchmark_release_cpp_o): $(SnippetBodyOrderBenchmark_release_objsdir)/%.o:
+	$(ECHO) SnippetBodyOrderBenchmark: compiling release $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetBodyOrderBenchmark_release_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cppfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetBodyOrderBenchmark_release_cppflags) -c $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetBodyOrderBenchmark_release_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cppfiles)) -o $@
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetBodyOrderBenchmark_release_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cppfiles))))))
+	cp $(SnippetBodyOrderBenchmark_release_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetBodyOrderBenchmark_release_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cppfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetBodyOrderBenchmark_release_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetBodyOrderBenchmark_release_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cppfiles))))).P; \
+	  rm -f $(SnippetBodyOrderBenchmark_release_DEPDIR).d
+
+$(SnippetBodyOrderBenchmark_release_cc_o): $(SnippetBodyOrderBenchmark_release_objsdir)/%.o:
+	$(ECHO) SnippetBodyOrderBenchmark: compiling release $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetBodyOrderBenchmark_release_objsdir),, $@))), $(SnippetBodyOrderBenchmark_ccfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetBodyOrderBenchmark_release_cppflags) -c $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetBodyOrderBenchmark_release_objsdir),, $@))), $(SnippetBodyOrderBenchmark_ccfiles)) -o $@
+	mkdir -p $(dir $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetBodyOrderBenchmark_release_objsdir),, $@))), $(SnippetBodyOrderBenchmark_ccfiles))))))
+	cp $(SnippetBodyOrderBenchmark_release_DEPDIR).d $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetBodyOrderBenchmark_release_objsdir),, $@))), $(SnippetBodyOrderBenchmark_ccfiles))))).release.P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetBodyOrderBenchmark_release_DEPDIR).d >> $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetBodyOrderBenchmark_release_objsdir),, $@))), $(SnippetBodyOrderBenchmark_ccfiles))))).release.P; \
+	  rm -f $(SnippetBodyOrderBenchmark_release_DEPDIR).d
+
+$(SnippetBodyOrderBenchmark_release_c_o): $(SnippetBodyOrderBenchmark_release_objsdir)/%.o:
+	$(ECHO) SnippetBodyOrderBenchmark: compiling release $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetBodyOrderBenchmark_release_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cfiles))...
+	mkdir -p $(dir $(@))
+	$(CC) $(SnippetBodyOrderBenchmark_release_cflags) -c $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetBodyOrderBenchmark_release_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cfiles)) -o $@ 
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetBodyOrderBenchmark_release_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cfiles))))))
+	cp $(SnippetBodyOrderBenchmark_release_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetBodyOrderBenchmark_release_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetBodyOrderBenchmark_release_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetBodyOrderBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetBodyOrderBenchmark_release_objsdir),, $@))), $(SnippetBodyOrderBenchmark_cfiles))))).P; \
+	  rm -f $(SnippetBodyOrderBenchmark_release_DEPDIR).d
+
+clean_SnippetBodyOrderBenchmark:  clean_SnippetBodyOrderBenchmark_debug clean_SnippetBodyOrderBenchmark_checked clean_SnippetBodyOrderBenchmark_profile clean_SnippetBodyOrderBenchmark_release
+	rm -rf $(DEPSDIR)
+
+export VERBOSE
+ifndef VERBOSE
+.SILENT:
+endif
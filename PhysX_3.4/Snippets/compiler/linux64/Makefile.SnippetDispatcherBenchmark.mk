@@ -0,0 +1,477 @@
+# Makefile generated by XPJ for LINUX64
+-include Makefile.custom
+ProjectName = SnippetDispatcherBenchmark
+SnippetDispatcherBenchmark_cppfiles   += ./../../SnippetCommon/ClassicMain.cpp
+SnippetDispatcherBenchmark_cppfiles   += ./../../SnippetDispatcherBenchmark/SnippetDispatcherBenchmark.cpp
+
+SnippetDispatcherBenchmark_cpp_debug_dep    = $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/debug/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.P, $(SnippetDispatcherBenchmark_cppfiles)))))
+SnippetDispatcherBenchmark_cc_debug_dep    = $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.debug.P, $(SnippetDispatcherBenchmark_ccfiles)))))
+SnippetDispatcherBenchmark_c_debug_dep      = $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/debug/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.P, $(SnippetDispatcherBenchmark_cfiles)))))
+SnippetDispatcherBenchmark_debug_dep      = $(SnippetDispatcherBenchmark_cpp_debug_dep) $(SnippetDispatcherBenchmark_cc_debug_dep) $(SnippetDispatcherBenchmark_c_debug_dep)
+-include $(SnippetDispatcherBenchmark_debug_dep)
+SnippetDispatcherBenchmark_cpp_checked_dep    = $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/checked/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.P, $(SnippetDispatcherBenchmark_cppfiles)))))
+SnippetDispatcherBenchmark_cc_checked_dep    = $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.checked.P, $(SnippetDispatcherBenchmark_ccfiles)))))
+SnippetDispatcherBenchmark_c_checked_dep      = $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/checked/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.P, $(SnippetDispatcherBenchmark_cfiles)))))
+SnippetDispatcherBenchmark_checked_dep      = $(SnippetDispatcherBenchmark_cpp_checked_dep) $(SnippetDispatcherBenchmark_cc_checked_dep) $(SnippetDispatcherBenchmark_c_checked_dep)
+-include $(SnippetDispatcherBenchmark_checked_dep)
+SnippetDispatcherBenchmark_cpp_profile_dep    = $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/profile/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.P, $(SnippetDispatcherBenchmark_cppfiles)))))
+SnippetDispatcherBenchmark_cc_profile_dep    = $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.profile.P, $(SnippetDispatcherBenchmark_ccfiles)))))
+SnippetDispatcherBenchmark_c_profile_dep      = $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/profile/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.P, $(SnippetDispatcherBenchmark_cfiles)))))
+SnippetDispatcherBenchmark_profile_dep      = $(SnippetDispatcherBenchmark_cpp_profile_dep) $(SnippetDispatcherBenchmark_cc_profile_dep) $(SnippetDispatcherBenchmark_c_profile_dep)
+-include $(SnippetDispatcherBenchmark_profile_dep)
+SnippetDispatcherBenchmark_cpp_release_dep    = $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/release/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.P, $(SnippetDispatcherBenchmark_cppfiles)))))
+SnippetDispatcherBenchmark_cc_release_dep    = $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.release.P, $(SnippetDispatcherBenchmark_ccfiles)))))
+SnippetDispatcherBenchmark_c_release_dep      = $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/release/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.P, $(SnippetDispatcherBenchmark_cfiles)))))
+SnippetDispatcherBenchmark_release_dep      = $(SnippetDispatcherBenchmark_cpp_release_dep) $(SnippetDispatcherBenchmark_cc_release_dep) $(SnippetDispatcherBenchmark_c_release_dep)
+-include $(SnippetDispatcherBenchmark_release_dep)
+SnippetDispatcherBenchmark_debug_hpaths    := 
+SnippetDispatcherBenchmark_debug_hpaths    += ./../../../Include
+SnippetDispatcherBenchmark_debug_hpaths    += ./../../../../PxShared/include
+SnippetDispatcherBenchmark_debug_hpaths    += ./../../../../PxShared/src/foundation/include
+SnippetDispatcherBenchmark_debug_hpaths    += ./../../../../PxShared/src/fastxml/include
+SnippetDispatcherBenchmark_debug_lpaths    := 
+SnippetDispatcherBenchmark_debug_lpaths    += ./../../../Lib/linux64
+SnippetDispatcherBenchmark_debug_lpaths    += ./../../lib/linux64
+SnippetDispatcherBenchmark_debug_lpaths    += ./../../../Bin/linux64
+SnippetDispatcherBenchmark_debug_lpaths    += ./../../../../PxShared/lib/linux64
+SnippetDispatcherBenchmark_debug_lpaths    += ./../../../../PxShared/bin/linux64
+SnippetDispatcherBenchmark_debug_lpaths    += ./../../lib/linux64
+SnippetDispatcherBenchmark_debug_defines   := $(SnippetDispatcherBenchmark_custom_defines)
+SnippetDispatcherBenchmark_debug_defines   += PHYSX_PROFILE_SDK
+SnippetDispatcherBenchmark_debug_defines   += RENDER_SNIPPET
+SnippetDispatcherBenchmark_debug_defines   += _DEBUG
+SnippetDispatcherBenchmark_debug_defines   += PX_DEBUG=1
+SnippetDispatcherBenchmark_debug_defines   += PX_CHECKED=1
+SnippetDispatcherBenchmark_debug_defines   += PX_SUPPORT_PVD=1
+SnippetDispatcherBenchmark_debug_libraries := 
+SnippetDispatcherBenchmark_debug_libraries += SnippetRenderDEBUG
+SnippetDispatcherBenchmark_debug_libraries += SnippetUtilsDEBUG
+SnippetDispatcherBenchmark_debug_libraries += PhysX3DEBUG_x64
+SnippetDispatcherBenchmark_debug_libraries += PhysX3CookingDEBUG_x64
+SnippetDispatcherBenchmark_debug_libraries += PhysX3CharacterKinematicDEBUG_x64
+SnippetDispatcherBenchmark_debug_libraries += PhysX3ExtensionsDEBUG
+SnippetDispatcherBenchmark_debug_libraries += PhysX3VehicleDEBUG
+SnippetDispatcherBenchmark_debug_libraries += PxPvdSDKDEBUG_x64
+SnippetDispatcherBenchmark_debug_libraries += PhysX3CommonDEBUG_x64
+SnippetDispatcherBenchmark_debug_libraries += PxFoundationDEBUG_x64
+SnippetDispatcherBenchmark_debug_libraries += PxTaskDEBUG
+SnippetDispatcherBenchmark_debug_libraries += PsFastXmlDEBUG
+SnippetDispatcherBenchmark_debug_libraries += SnippetUtilsDEBUG
+SnippetDispatcherBenchmark_debug_libraries += SnippetRenderDEBUG
+SnippetDispatcherBenchmark_debug_libraries += GL
+SnippetDispatcherBenchmark_debug_libraries += GLU
+SnippetDispatcherBenchmark_debug_libraries += glut
+SnippetDispatcherBenchmark_debug_libraries += X11
+SnippetDispatcherBenchmark_debug_libraries += rt
+SnippetDispatcherBenchmark_debug_libraries += pthread
+SnippetDispatcherBenchmark_debug_common_cflags	:= $(SnippetDispatcherBenchmark_custom_cflags)
+SnippetDispatcherBenchmark_debug_common_cflags    += -MMD
+SnippetDispatcherBenchmark_debug_common_cflags    += $(addprefix -D, $(SnippetDispatcherBenchmark_debug_defines))
+SnippetDispatcherBenchmark_debug_common_cflags    += $(addprefix -I, $(SnippetDispatcherBenchmark_debug_hpaths))
+SnippetDispatcherBenchmark_debug_common_cflags  += -m64
+SnippetDispatcherBenchmark_debug_common_cflags  += -Werror -m64 -fPIC -msse2 -mfpmath=sse -fno-exceptions -fno-rtti -fvisibility=hidden -fvisibility-inlines-hidden
+SnippetDispatcherBenchmark_debug_common_cflags  += -Wall -Wextra -Wstrict-aliasing=2 -fdiagnostics-show-option
+SnippetDispatcherBenchmark_debug_common_cflags  += -Wno-uninitialized
+SnippetDispatcherBenchmark_debug_common_cflags  += -g3 -gdwarf-2
+SnippetDispatcherBenchmark_debug_cflags	:= $(SnippetDispatcherBenchmark_debug_common_cflags)
+SnippetDispatcherBenchmark_debug_cppflags	:= $(SnippetDispatcherBenchmark_debug_common_cflags)
+SnippetDispatcherBenchmark_debug_lflags    := $(SnippetDispatcherBenchmark_custom_lflags)
+SnippetDispatcherBenchmark_debug_lflags    += $(addprefix -L, $(SnippetDispatcherBenchmark_debug_lpaths))
+SnippetDispatcherBenchmark_debug_lflags    += -Wl,--start-group $(addprefix -l, $(SnippetDispatcherBenchmark_debug_libraries)) -Wl,--end-group
+SnippetDispatcherBenchmark_debug_lflags  += -lrt
+SnippetDispatcherBenchmark_debug_lflags  += -Wl,-rpath ./
+SnippetDispatcherBenchmark_debug_lflags  += -m64
+SnippetDispatcherBenchmark_debug_objsdir  = $(OBJS_DIR)/SnippetDispatcherBenchmark_debug
+SnippetDispatcherBenchmark_debug_cpp_o    = $(addprefix $(SnippetDispatcherBenchmark_debug_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.o, $(SnippetDispatcherBenchmark_cppfiles)))))
+SnippetDispatcherBenchmark_debug_cc_o    = $(addprefix $(SnippetDispatcherBenchmark_debug_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.o, $(SnippetDispatcherBenchmark_ccfiles)))))
+SnippetDispatcherBenchmark_debug_c_o      = $(addprefix $(SnippetDispatcherBenchmark_debug_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.o, $(SnippetDispatcherBenchmark_cfiles)))))
+SnippetDispatcherBenchmark_debug_obj      = $(SnippetDispatcherBenchmark_debug_cpp_o) $(SnippetDispatcherBenchmark_debug_cc_o) $(SnippetDispatcherBenchmark_debug_c_o)
+SnippetDispatcherBenchmark_debug_bin      := ./../../../Bin/linux64/SnippetDispatcherBenchmarkDEBUG
+
+clean_SnippetDispatcherBenchmark_debug: 
+	@$(ECHO) clean SnippetDispatcherBenchmark debug
+	@$(RMDIR) $(SnippetDispatcherBenchmark_debug_objsdir)
+	@$(RMDIR) $(SnippetDispatcherBenchmark_debug_bin)
+	@$(RMDIR) $(DEPSDIR)/SnippetDispatcherBenchmark/debug
+
+build_SnippetDispatcherBenchmark_debug: postbuild_SnippetDispatcherBenchmark_debug
+postbuild_SnippetDispatcherBenchmark_debug: mainbuild_SnippetDispatcherBenchmark_debug
+	@cp -u "../../../../PxShared/bin/linux64/libPxFoundationDEBUG_x64.so" "../../../Bin/linux64/libPxFoundationDEBUG_x64.so"; cp -u "../../../../PxShared/bin/linux64/libPxPvdSDKDEBUG_x64.so" "../../../Bin/linux64/libPxPvdSDKDEBUG_x64.so"
+mainbuild_SnippetDispatcherBenchmark_debug: prebuild_SnippetDispatcherBenchmark_debug $(SnippetDispatcherBenchmark_debug_bin)
+prebuild_SnippetDispatcherBenchmark_debug:
+
+$(SnippetDispatcherBenchmark_debug_bin): $(SnippetDispatcherBenchmark_debug_obj) build_SnippetRender_debug build_SnippetUtils_debug 
+	mkdir -p `dirname ./../../../Bin/linux64/SnippetDispatcherBenchmarkDEBUG`
+	$(CCLD) $(SnippetDispatcherBenchmark_debug_obj) $(SnippetDispatcherBenchmark_debug_lflags) -o $(SnippetDispatcherBenchmark_debug_bin) 
+	$(ECHO) building $@ complete!
+
+SnippetDispatcherBenchmark_debug_DEPDIR = $(dir $(@))/$(*F)
+$(SnippetDispatcherBenchmark_debug_cpp_o): $(SnippetDispatcherBenchmark_debug_objsdir)/%.o:
+	$(ECHO) SnippetDispatcherBenchmark: compiling debug $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetDispatcherBenchmark_debug_objsdir),, $@))), $(SnippetDispatcherBenchmark_cppfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetDispatcherBenchmark_debug_cppflags) -c $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetDispatcherBenchmark_debug_objsdir),, $@))), $(SnippetDispatcherBenchmark_cppfiles)) -o $@
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetDispatcherBenchmark_debug_objsdir),, $@))), $(SnippetDispatcherBenchmark_cppfiles))))))
+	cp $(SnippetDispatcherBenchmark_debug_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetDispatcherBenchmark_debug_objsdir),, $@))), $(SnippetDispatcherBenchmark_cppfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetDispatcherBenchmark_debug_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetDispatcherBenchmark_debug_objsdir),, $@))), $(SnippetDispatcherBenchmark_cppfiles))))).P; \
+	  rm -f $(SnippetDispatcherBenchmark_debug_DEPDIR).d
+
+$(SnippetDispatcherBenchmark_debug_cc_o): $(SnippetDispatcherBenchmark_debug_objsdir)/%.o:
+	$(ECHO) SnippetDispatcherBenchmark: compiling debug $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetDispatcherBenchmark_debug_objsdir),, $@))), $(SnippetDispatcherBenchmark_ccfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetDispatcherBenchmark_debug_cppflags) -c $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetDispatcherBenchmark_debug_objsdir),, $@))), $(SnippetDispatcherBenchmark_ccfiles)) -o $@
+	mkdir -p $(dir $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetDispatcherBenchmark_debug_objsdir),, $@))), $(SnippetDispatcherBenchmark_ccfiles))))))
+	cp $(SnippetDispatcherBenchmark_debug_DEPDIR).d $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetDispatcherBenchmark_debug_objsdir),, $@))), $(SnippetDispatcherBenchmark_ccfiles))))).debug.P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetDispatcherBenchmark_debug_DEPDIR).d >> $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetDispatcherBenchmark_debug_objsdir),, $@))), $(SnippetDispatcherBenchmark_ccfiles))))).debug.P; \
+	  rm -f $(SnippetDispatcherBenchmark_debug_DEPDIR).d
+
+$(SnippetDispatcherBenchmark_debug_c_o): $(SnippetDispatcherBenchmark_debug_objsdir)/%.o:
+	$(ECHO) SnippetDispatcherBenchmark: compiling debug $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetDispatcherBenchmark_debug_objsdir),, $@))), $(SnippetDispatcherBenchmark_cfiles))...
+	mkdir -p $(dir $(@))
+	$(CC) $(SnippetDispatcherBenchmark_debug_cflags) -c $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetDispatcherBenchmark_debug_objsdir),, $@))), $(SnippetDispatcherBenchmark_cfiles)) -o $@ 
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetDispatcherBenchmark_debug_objsdir),, $@))), $(SnippetDispatcherBenchmark_cfiles))))))
+	cp $(SnippetDispatcherBenchmark_debug_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetDispatcherBenchmark_debug_objsdir),, $@))), $(SnippetDispatcherBenchmark_cfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetDispatcherBenchmark_debug_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetDispatcherBenchmark_debug_objsdir),, $@))), $(SnippetDispatcherBenchmark_cfiles))))).P; \
+	  rm -f $(SnippetDispatcherBenchmark_debug_DEPDIR).d
+
+SnippetDispatcherBenchmark_checked_hpaths    := 
+SnippetDispatcherBenchmark_checked_hpaths    += ./../../../Include
+SnippetDispatcherBenchmark_checked_hpaths    += ./../../../../PxShared/include
+SnippetDispatcherBenchmark_checked_hpaths    += ./../../../../PxShared/src/foundation/include
+SnippetDispatcherBenchmark_checked_hpaths    += ./../../../../PxShared/src/fastxml/include
+SnippetDispatcherBenchmark_checked_lpaths    := 
+SnippetDispatcherBenchmark_checked_lpaths    += ./../../../Lib/linux64
+SnippetDispatcherBenchmark_checked_lpaths    += ./../../lib/linux64
+SnippetDispatcherBenchmark_checked_lpaths    += ./../../../Bin/linux64
+SnippetDispatcherBenchmark_checked_lpaths    += ./../../../../PxShared/lib/linux64
+SnippetDispatcherBenchmark_checked_lpaths    += ./../../../../PxShared/bin/linux64
+SnippetDispatcherBenchmark_checked_lpaths    += ./../../lib/linux64
+SnippetDispatcherBenchmark_checked_defines   := $(SnippetDispatcherBenchmark_custom_defines)
+SnippetDispatcherBenchmark_checked_defines   += PHYSX_PROFILE_SDK
+SnippetDispatcherBenchmark_checked_defines   += RENDER_SNIPPET
+SnippetDispatcherBenchmark_checked_defines   += NDEBUG
+SnippetDispatcherBenchmark_checked_defines   += PX_CHECKED=1
+SnippetDispatcherBenchmark_checked_defines   += PX_SUPPORT_PVD=1
+SnippetDispatcherBenchmark_checked_libraries := 
+SnippetDispatcherBenchmark_checked_libraries += SnippetRenderCHECKED
+SnippetDispatcherBenchmark_checked_libraries += SnippetUtilsCHECKED
+SnippetDispatcherBenchmark_checked_libraries += PhysX3CHECKED_x64
+SnippetDispatcherBenchmark_checked_libraries += PhysX3CookingCHECKED_x64
+SnippetDispatcherBenchmark_checked_libraries += PhysX3CharacterKinematicCHECKED_x64
+SnippetDispatcherBenchmark_checked_libraries += PhysX3ExtensionsCHECKED
+SnippetDispatcherBenchmark_checked_libraries += PhysX3VehicleCHECKED
+SnippetDispatcherBenchmark_checked_libraries += PxPvdSDKCHECKED_x64
+SnippetDispatcherBenchmark_checked_libraries += PhysX3CommonCHECKED_x64
+SnippetDispatcherBenchmark_checked_libraries += PxFoundationCHECKED_x64
+SnippetDispatcherBenchmark_checked_libraries += PxTaskCHECKED
+SnippetDispatcherBenchmark_checked_libraries += PsFastXmlCHECKED
+SnippetDispatcherBenchmark_checked_libraries += SnippetUtilsCHECKED
+SnippetDispatcherBenchmark_checked_libraries += SnippetRenderCHECKED
+SnippetDispatcherBenchmark_checked_libraries += GL
+SnippetDispatcherBenchmark_checked_libraries += GLU
+SnippetDispatcherBenchmark_checked_libraries += glut
+SnippetDispatcherBenchmark_checked_libraries += X11
+SnippetDispatcherBenchmark_checked_libraries += rt
+SnippetDispatcherBenchmark_checked_libraries += pthread
+SnippetDispatcherBenchmark_checked_common_cflags	:= $(SnippetDispatcherBenchmark_custom_cflags)
+SnippetDispatcherBenchmark_checked_common_cflags    += -MMD
+SnippetDispatcherBenchmark_checked_common_cflags    += $(addprefix -D, $(SnippetDispatcherBenchmark_checked_defines))
+SnippetDispatcherBenchmark_checked_common_cflags    += $(addprefix -I, $(SnippetDispatcherBenchmark_checked_hpaths))
+SnippetDispatcherBenchmark_checked_common_cflags  += -m64
+SnippetDispatcherBenchmark_checked_common_cflags  += -Werror -m64 -fPIC -msse2 -mfpmath=sse -fno-exceptions -fno-rtti -fvisibility=hidden -fvisibility-inlines-hidden
+SnippetDispatcherBenchmark_checked_common_cflags  += -Wall -Wextra -Wstrict-aliasing=2 -fdiagnostics-show-option
+SnippetDispatcherBenchmark_checked_common_cflags  += -Wno-uninitialized
+SnippetDispatcherBenchmark_checked_common_cflags  += -g3 -gdwarf-2 -O3 -fno-strict-aliasing
+SnippetDispatcherBenchmark_checked_cflags	:= $(SnippetDispatcherBenchmark_checked_common_cflags)
+SnippetDispatcherBenchmark_checked_cppflags	:= $(SnippetDispatcherBenchmark_checked_common_cflags)
+SnippetDispatcherBenchmark_checked_lflags    := $(SnippetDispatcherBenchmark_custom_lflags)
+SnippetDispatcherBenchmark_checked_lflags    += $(addprefix -L, $(SnippetDispatcherBenchmark_checked_lpaths))
+SnippetDispatcherBenchmark_checked_lflags    += -Wl,--start-group $(addprefix -l, $(SnippetDispatcherBenchmark_checked_libraries)) -Wl,--end-group
+SnippetDispatcherBenchmark_checked_lflags  += -lrt
+SnippetDispatcherBenchmark_checked_lflags  += -Wl,-rpath ./
+SnippetDispatcherBenchmark_checked_lflags  += -m64
+SnippetDispatcherBenchmark_checked_objsdir  = $(OBJS_DIR)/SnippetDispatcherBenchmark_checked
+SnippetDispatcherBenchmark_checked_cpp_o    = $(addprefix $(SnippetDispatcherBenchmark_checked_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.o, $(SnippetDispatcherBenchmark_cppfiles)))))
+SnippetDispatcherBenchmark_checked_cc_o    = $(addprefix $(SnippetDispatcherBenchmark_checked_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.o, $(SnippetDispatcherBenchmark_ccfiles)))))
+SnippetDispatcherBenchmark_checked_c_o      = $(addprefix $(SnippetDispatcherBenchmark_checked_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.o, $(SnippetDispatcherBenchmark_cfiles)))))
+SnippetDispatcherBenchmark_checked_obj      = $(SnippetDispatcherBenchmark_checked_cpp_o) $(SnippetDispatcherBenchmark_checked_cc_o) $(SnippetDispatcherBenchmark_checked_c_o)
+SnippetDispatcherBenchmark_checked_bin      := ./../../../Bin/linux64/SnippetDispatcherBenchmarkCHECKED
+
+clean_SnippetDispatcherBenchmark_checked: 
+	@$(ECHO) clean SnippetDispatcherBenchmark checked
+	@$(RMDIR) $(SnippetDispatcherBenchmark_checked_objsdir)
+	@$(RMDIR) $(SnippetDispatcherBenchmark_checked_bin)
+	@$(RMDIR) $(DEPSDIR)/SnippetDispatcherBenchmark/checked
+
+build_SnippetDispatcherBenchmark_checked: postbuild_SnippetDispatcherBenchmark_checked
+postbuild_SnippetDispatcherBenchmark_checked: mainbuild_SnippetDispatcherBenchmark_checked
+	@cp -u "../../../../PxShared/bin/linux64/libPxFoundationCHECKED_x64.so" "../../../Bin/linux64/libPxFoundationCHECKED_x64.so"; cp -u "../../../../PxShared/bin/linux64/libPxPvdSDKCHECKED_x64.so" "../../../Bin/linux64/libPxPvdSDKCHECKED_x64.so"
+mainbuild_SnippetDispatcherBenchmark_checked: prebuild_SnippetDispatcherBenchmark_checked $(SnippetDispatcherBenchmark_checked_bin)
+prebuild_SnippetDispatcherBenchmark_checked:
+
+$(SnippetDispatcherBenchmark_checked_bin): $(SnippetDispatcherBenchmark_checked_obj) build_SnippetRender_checked build_SnippetUtils_checked 
+	mkdir -p `dirname ./../../../Bin/linux64/SnippetDispatcherBenchmarkCHECKED`
+	$(CCLD) $(SnippetDispatcherBenchmark_checked_obj) $(SnippetDispatcherBenchmark_checked_lflags) -o $(SnippetDispatcherBenchmark_checked_bin) 
+	$(ECHO) building $@ complete!
+
+SnippetDispatcherBenchmark_checked_DEPDIR = $(dir $(@))/$(*F)
+$(SnippetDispatcherBenchmark_checked_cpp_o): $(SnippetDispatcherBenchmark_checked_objsdir)/%.o:
+	$(ECHO) SnippetDispatcherBenchmark: compiling checked $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetDispatcherBenchmark_checked_objsdir),, $@))), $(SnippetDispatcherBenchmark_cppfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetDispatcherBenchmark_checked_cppflags) -c $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetDispatcherBenchmark_checked_objsdir),, $@))), $(SnippetDispatcherBenchmark_cppfiles)) -o $@
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetDispatcherBenchmark_checked_objsdir),, $@))), $(SnippetDispatcherBenchmark_cppfiles))))))
+	cp $(SnippetDispatcherBenchmark_checked_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetDispatcherBenchmark_checked_objsdir),, $@))), $(SnippetDispatcherBenchmark_cppfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetDispatcherBenchmark_checked_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetDispatcherBenchmark_checked_objsdir),, $@))), $(SnippetDispatcherBenchmark_cppfiles))))).P; \
+	  rm -f $(SnippetDispatcherBenchmark_checked_DEPDIR).d
+
+$(SnippetDispatcherBenchmark_checked_cc_o): $(SnippetDispatcherBenchmark_checked_objsdir)/%.o:
+	$(ECHO) SnippetDispatcherBenchmark: compiling checked $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetDispatcherBenchmark_checked_objsdir),, $@))), $(SnippetDispatcherBenchmark_ccfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetDispatcherBenchmark_checked_cppflags) -c $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetDispatcherBenchmark_checked_objsdir),, $@))), $(SnippetDispatcherBenchmark_ccfiles)) -o $@
+	mkdir -p $(dir $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetDispatcherBenchmark_checked_objsdir),, $@))), $(SnippetDispatcherBenchmark_ccfiles))))))
+	cp $(SnippetDispatcherBenchmark_checked_DEPDIR).d $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetDispatcherBenchmark_checked_objsdir),, $@))), $(SnippetDispatcherBenchmark_ccfiles))))).checked.P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetDispatcherBenchmark_checked_DEPDIR).d >> $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetDispatcherBenchmark_checked_objsdir),, $@))), $(SnippetDispatcherBenchmark_ccfiles))))).checked.P; \
+	  rm -f $(SnippetDispatcherBenchmark_checked_DEPDIR).d
+
+$(SnippetDispatcherBenchmark_checked_c_o): $(SnippetDispatcherBenchmark_checked_objsdir)/%.o:
+	$(ECHO) SnippetDispatcherBenchmark: compiling checked $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetDispatcherBenchmark_checked_objsdir),, $@))), $(SnippetDispatcherBenchmark_cfiles))...
+	mkdir -p $(dir $(@))
+	$(CC) $(SnippetDispatcherBenchmark_checked_cflags) -c $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetDispatcherBenchmark_checked_objsdir),, $@))), $(SnippetDispatcherBenchmark_cfiles)) -o $@ 
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetDispatcherBenchmark_checked_objsdir),, $@))), $(SnippetDispatcherBenchmark_cfiles))))))
+	cp $(SnippetDispatcherBenchmark_checked_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetDispatcherBenchmark_checked_objsdir),, $@))), $(SnippetDispatcherBenchmark_cfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetDispatcherBenchmark_checked_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetDispatcherBenchmark_checked_objsdir),, $@))), $(SnippetDispatcherBenchmark_cfiles))))).P; \
+	  rm -f $(SnippetDispatcherBenchmark_checked_DEPDIR).d
+
+SnippetDispatcherBenchmark_profile_hpaths    := 
+SnippetDispatcherBenchmark_profile_hpaths    += ./../../../Include
+SnippetDispatcherBenchmark_profile_hpaths    += ./../../../../PxShared/include
+SnippetDispatcherBenchmark_profile_hpaths    += ./../../../../PxShared/src/foundation/include
+SnippetDispatcherBenchmark_profile_hpaths    += ./../../../../PxShared/src/fastxml/include
+SnippetDispatcherBenchmark_profile_lpaths    := 
+SnippetDispatcherBenchmark_profile_lpaths    += ./../../../Lib/linux64
+SnippetDispatcherBenchmark_profile_lpaths    += ./../../lib/linux64
+SnippetDispatcherBenchmark_profile_lpaths    += ./../../../Bin/linux64
+SnippetDispatcherBenchmark_profile_lpaths    += ./../../../../PxShared/lib/linux64
+SnippetDispatcherBenchmark_profile_lpaths    += ./../../../../PxShared/bin/linux64
+SnippetDispatcherBenchmark_profile_lpaths    += ./../../lib/linux64
+SnippetDispatcherBenchmark_profile_defines   := $(SnippetDispatcherBenchmark_custom_defines)
+SnippetDispatcherBenchmark_profile_defines   += PHYSX_PROFILE_SDK
+SnippetDispatcherBenchmark_profile_defines   += RENDER_SNIPPET
+SnippetDispatcherBenchmark_profile_defines   += NDEBUG
+SnippetDispatcherBenchmark_profile_defines   += PX_PROFILE=1
+SnippetDispatcherBenchmark_profile_defines   += PX_SUPPORT_PVD=1
+SnippetDispatcherBenchmark_profile_libraries := 
+SnippetDispatcherBenchmark_profile_libraries += SnippetRenderPROFILE
+SnippetDispatcherBenchmark_profile_libraries += SnippetUtilsPROFILE
+SnippetDispatcherBenchmark_profile_libraries += PhysX3PROFILE_x64
+SnippetDispatcherBenchmark_profile_libraries += PhysX3CookingPROFILE_x64
+SnippetDispatcherBenchmark_profile_libraries += PhysX3CharacterKinematicPROFILE_x64
+SnippetDispatcherBenchmark_profile_libraries += PhysX3ExtensionsPROFILE
+SnippetDispatcherBenchmark_profile_libraries += PhysX3VehiclePROFILE
+SnippetDispatcherBenchmark_profile_libraries += PxPvdSDKPROFILE_x64
+SnippetDispatcherBenchmark_profile_libraries += PhysX3CommonPROFILE_x64
+SnippetDispatcherBenchmark_profile_libraries += PxFoundationPROFILE_x64
+SnippetDispatcherBenchmark_profile_libraries += PxTaskPROFILE
+SnippetDispatcherBenchmark_profile_libraries += PsFastXmlPROFILE
+SnippetDispatcherBenchmark_profile_libraries += SnippetUtilsPROFILE
+SnippetDispatcherBenchmark_profile_libraries += SnippetRenderPROFILE
+SnippetDispatcherBenchmark_profile_libraries += GL
+SnippetDispatcherBenchmark_profile_libraries += GLU
+SnippetDispatcherBenchmark_profile_libraries += glut
+SnippetDispatcherBenchmark_profile_libraries += X11
+SnippetDispatcherBenchmark_profile_libraries += rt
+SnippetDispatcherBenchmark_profile_libraries += pthread
+SnippetDispatcherBenchmark_profile_common_cflags	:= $(SnippetDispatcherBenchmark_custom_cflags)
+SnippetDispatcherBenchmark_profile_common_cflags    += -MMD
+SnippetDispatcherBenchmark_profile_common_cflags    += $(addprefix -D, $(SnippetDispatcherBenchmark_profile_defines))
+SnippetDispatcherBenchmark_profile_common_cflags    += $(addprefix -I, $(SnippetDispatcherBenchmark_profile_hpaths))
+SnippetDispatcherBenchmark_profile_common_cflags  += -m64
+SnippetDispatcherBenchmark_profile_common_cflags  += -Werror -m64 -fPIC -msse2 -mfpmath=sse -fno-exceptions -fno-rtti -fvisibility=hidden -fvisibility-inlines-hidden
+SnippetDispatcherBenchmark_profile_common_cflags  += -Wall -Wextra -Wstrict-aliasing=2 -fdiagnostics-show-option
+SnippetDispatcherBenchmark_profile_common_cflags  += -Wno-uninitialized
+SnippetDispatcherBenchmark_profile_common_cflags  += -O3 -fno-strict-aliasing
+SnippetDispatcherBenchmark_profile_cflags	:= $(SnippetDispatcherBenchmark_profile_common_cflags)
+SnippetDispatcherBenchmark_profile_cppflags	:= $(SnippetDispatcherBenchmark_profile_common_cflags)
+SnippetDispatcherBenchmark_profile_lflags    := $(SnippetDispatcherBenchmark_custom_lflags)
+SnippetDispatcherBenchmark_profile_lflags    += $(addprefix -L, $(SnippetDispatcherBenchmark_profile_lpaths))
+SnippetDispatcherBenchmark_profile_lflags    += -Wl,--start-group $(addprefix -l, $(SnippetDispatcherBenchmark_profile_libraries)) -Wl,--end-group
+SnippetDispatcherBenchmark_profile_lflags  += -lrt
+SnippetDispatcherBenchmark_profile_lflags  += -Wl,-rpath ./
+SnippetDispatcherBenchmark_profile_lflags  += -m64
+SnippetDispatcherBenchmark_profile_objsdir  = $(OBJS_DIR)/SnippetDispatcherBenchmark_profile
+SnippetDispatcherBenchmark_profile_cpp_o    = $(addprefix $(SnippetDispatcherBenchmark_profile_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.o, $(SnippetDispatcherBenchmark_cppfiles)))))
+SnippetDispatcherBenchmark_profile_cc_o    = $(addprefix $(SnippetDispatcherBenchmark_profile_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.o, $(SnippetDispatcherBenchmark_ccfiles)))))
+SnippetDispatcherBenchmark_profile_c_o      = $(addprefix $(SnippetDispatcherBenchmark_profile_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.o, $(SnippetDispatcherBenchmark_cfiles)))))
+SnippetDispatcherBenchmark_profile_obj      = $(SnippetDispatcherBenchmark_profile_cpp_o) $(SnippetDispatcherBenchmark_profile_cc_o) $(SnippetDispatcherBenchmark_profile_c_o)
+SnippetDispatcherBenchmark_profile_bin      := ./../../../Bin/linux64/SnippetDispatcherBenchmarkPROFILE
+
+clean_SnippetDispatcherBenchmark_profile: 
+	@$(ECHO) clean SnippetDispatcherBenchmark profile
+	@$(RMDIR) $(SnippetDispatcherBenchmark_profile_objsdir)
+	@$(RMDIR) $(SnippetDispatcherBenchmark_profile_bin)
+	@$(RMDIR) $(DEPSDIR)/SnippetDispatcherBenchmark/profile
+
+build_SnippetDispatcherBenchmark_profile: postbuild_SnippetDispatcherBenchmark_profile
+postbuild_SnippetDispatcherBenchmark_profile: mainbuild_SnippetDispatcherBenchmark_profile
+	@cp -u "../../../../PxShared/bin/linux64/libPxFoundationPROFILE_x64.so" "../../../Bin/linux64/libPxFoundationPROFILE_x64.so"; cp -u "../../../../PxShared/bin/linux64/libPxPvdSDKPROFILE_x64.so" "../../../Bin/linux64/libPxPvdSDKPROFILE_x64.so"
+mainbuild_SnippetDispatcherBenchmark_profile: prebuild_SnippetDispatcherBenchmark_profile $(SnippetDispatcherBenchmark_profile_bin)
+prebuild_SnippetDispatcherBenchmark_profile:
+
+$(SnippetDispatcherBenchmark_profile_bin): $(SnippetDispatcherBenchmark_profile_obj) build_SnippetRender_profile build_SnippetUtils_profile 
+	mkdir -p `dirname ./../../../Bin/linux64/SnippetDispatcherBenchmarkPROFILE`
+	$(CCLD) $(SnippetDispatcherBenchmark_profile_obj) $(SnippetDispatcherBenchmark_profile_lflags) -o $(SnippetDispatcherBenchmark_profile_bin) 
+	$(ECHO) building $@ complete!
+
+SnippetDispatcherBenchmark_profile_DEPDIR = $(dir $(@))/$(*F)
+$(SnippetDispatcherBenchmark_profile_cpp_o): $(SnippetDispatcherBenchmark_profile_objsdir)/%.o:
+	$(ECHO) SnippetDispatcherBenchmark: compiling profile $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetDispatcherBenchmark_profile_objsdir),, $@))), $(SnippetDispatcherBenchmark_cppfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetDispatcherBenchmark_profile_cppflags) -c $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetDispatcherBenchmark_profile_objsdir),, $@))), $(SnippetDispatcherBenchmark_cppfiles)) -o $@
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetDispatcherBenchmark_profile_objsdir),, $@))), $(SnippetDispatcherBenchmark_cppfiles))))))
+	cp $(SnippetDispatcherBenchmark_profile_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetDispatcherBenchmark_profile_objsdir),, $@))), $(SnippetDispatcherBenchmark_cppfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetDispatcherBenchmark_profile_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetDispatcherBenchmark_profile_objsdir),, $@))), $(SnippetDispatcherBenchmark_cppfiles))))).P; \
+	  rm -f $(SnippetDispatcherBenchmark_profile_DEPDIR).d
+
+$(SnippetDispatcherBenchmark_profile_cc_o): $(SnippetDispatcherBenchmark_profile_objsdir)/%.o:
+	$(ECHO) SnippetDispatcherBenchmark: compiling profile $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetDispatcherBenchmark_profile_objsdir),, $@))), $(SnippetDispatcherBenchmark_ccfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetDispatcherBenchmark_profile_cppflags) -c $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetDispatcherBenchmark_profile_objsdir),, $@))), $(SnippetDispatcherBenchmark_ccfiles)) -o $@
+	mkdir -p $(dir $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetDispatcherBenchmark_profile_objsdir),, $@))), $(SnippetDispatcherBenchmark_ccfiles))))))
+	cp $(SnippetDispatcherBenchmark_profile_DEPDIR).d $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetDispatcherBenchmark_profile_objsdir),, $@))), $(SnippetDispatcherBenchmark_ccfiles))))).profile.P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetDispatcherBenchmark_profile_DEPDIR).d >> $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetDispatcherBenchmark_profile_objsdir),, $@))), $(SnippetDispatcherBenchmark_ccfiles))))).profile.P; \
+	  rm -f $(SnippetDispatcherBenchmark_profile_DEPDIR).d
+
+$(SnippetDispatcherBenchmark_profile_c_o): $(SnippetDispatcherBenchmark_profile_objsdir)/%.o:
+	$(ECHO) SnippetDispatcherBenchmark: compiling profile $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetDispatcherBenchmark_profile_objsdir),, $@))), $(SnippetDispatcherBenchmark_cfiles))...
+	mkdir -p $(dir $(@))
+	$(CC) $(SnippetDispatcherBenchmark_profile_cflags) -c $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetDispatcherBenchmark_profile_objsdir),, $@))), $(SnippetDispatcherBenchmark_cfiles)) -o $@ 
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetDispatcherBenchmark_profile_objsdir),, $@))), $(SnippetDispatcherBenchmark_cfiles))))))
+	cp $(SnippetDispatcherBenchmark_profile_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetDispatcherBenchmark_profile_objsdir),, $@))), $(SnippetDispatcherBenchmark_cfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetDispatcherBenchmark_profile_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetDispatcherBenchmark_profile_objsdir),, $@))), $(SnippetDispatcherBenchmark_cfiles))))).P; \
+	  rm -f $(SnippetDispatcherBenchmark_profile_DEPDIR).d
+
+SnippetDispatcherBenchmark_release_hpaths    := 
+SnippetDispatcherBenchmark_release_hpaths    += ./../../../Include
+SnippetDispatcherBenchmark_release_hpaths    += ./../../../../PxShared/include
+SnippetDispatcherBenchmark_release_hpaths    += ./../../../../PxShared/src/foundation/include
+SnippetDispatcherBenchmark_release_hpaths    += ./../../../../PxShared/src/fastxml/include
+SnippetDispatcherBenchmark_release_lpaths    := 
+SnippetDispatcherBenchmark_release_lpaths    += ./../../../Lib/linux64
+SnippetDispatcherBenchmark_release_lpaths    += ./../../lib/linux64
+SnippetDispatcherBenchmark_release_lpaths    += ./../../../Bin/linux64
+SnippetDispatcherBenchmark_release_lpaths    += ./../../../../PxShared/lib/linux64
+SnippetDispatcherBenchmark_release_lpaths    += ./../../../../PxShared/bin/linux64
+SnippetDispatcherBenchmark_release_lpaths    += ./../../lib/linux64
+SnippetDispatcherBenchmark_release_defines   := $(SnippetDispatcherBenchmark_custom_defines)
+SnippetDispatcherBenchmark_release_defines   += PHYSX_PROFILE_SDK
+SnippetDispatcherBenchmark_release_defines   += RENDER_SNIPPET
+SnippetDispatcherBenchmark_release_defines   += NDEBUG
+SnippetDispatcherBenchmark_release_defines   += PX_SUPPORT_PVD=0
+SnippetDispatcherBenchmark_release_libraries := 
+SnippetDispatcherBenchmark_release_libraries += SnippetRender
+SnippetDispatcherBenchmark_release_libraries += SnippetUtils
+SnippetDispatcherBenchmark_release_libraries += PhysX3_x64
+SnippetDispatcherBenchmark_release_libraries += PhysX3Cooking_x64
+SnippetDispatcherBenchmark_release_libraries += PhysX3CharacterKinematic_x64
+SnippetDispatcherBenchmark_release_libraries += PhysX3Extensions
+SnippetDispatcherBenchmark_release_libraries += PhysX3Vehicle
+SnippetDispatcherBenchmark_release_libraries += PxPvdSDK_x64
+SnippetDispatcherBenchmark_release_libraries += PhysX3Common_x64
+SnippetDispatcherBenchmark_release_libraries += PxFoundation_x64
+SnippetDispatcherBenchmark_release_libraries += PxTask
+SnippetDispatcherBenchmark_release_libraries += PsFastXml
+SnippetDispatcherBenchmark_release_libraries += SnippetUtils
+SnippetDispatcherBenchmark_release_libraries += SnippetRender
+SnippetDispatcherBenchmark_release_libraries += GL
+SnippetDispatcherBenchmark_release_libraries += GLU
+SnippetDispatcherBenchmark_release_libraries += glut
+SnippetDispatcherBenchmark_release_libraries += X11
+SnippetDispatcherBenchmark_release_libraries += rt
+SnippetDispatcherBenchmark_release_libraries += pthread
+SnippetDispatcherBenchmark_release_common_cflags	:= $(SnippetDispatcherBenchmark_custom_cflags)
+SnippetDispatcherBenchmark_release_common_cflags    += -MMD
+SnippetDispatcherBenchmark_release_common_cflags    += $(addprefix -D, $(SnippetDispatcherBenchmark_release_defines))
+SnippetDispatcherBenchmark_release_common_cflags    += $(addprefix -I, $(SnippetDispatcherBenchmark_release_hpaths))
+SnippetDispatcherBenchmark_release_common_cflags  += -m64
+SnippetDispatcherBenchmark_release_common_cflags  += -Werror -m64 -fPIC -msse2 -mfpmath=sse -fno-exceptions -fno-rtti -fvisibility=hidden -fvisibility-inlines-hidden
+SnippetDispatcherBenchmark_release_common_cflags  += -Wall -Wextra -Wstrict-aliasing=2 -fdiagnostics-show-option
+SnippetDispatcherBenchmark_release_common_cflags  += -Wno-uninitialized
+SnippetDispatcherBenchmark_release_common_cflags  += -O3 -fno-strict-aliasing
+SnippetDispatcherBenchmark_release_cflags	:= $(SnippetDispatcherBenchmark_release_common_cflags)
+SnippetDispatcherBenchmark_release_cppflags	:= $(SnippetDispatcherBenchmark_release_common_cflags)
+SnippetDispatcherBenchmark_release_lflags    := $(SnippetDispatcherBenchmark_custom_lflags)
+SnippetDispatcherBenchmark_release_lflags    += $(addprefix -L, $(SnippetDispatcherBenchmark_release_lpaths))
+SnippetDispatcherBenchmark_release_lflags    += -Wl,--start-group $(addprefix -l, $(SnippetDispatcherBenchmark_release_libraries)) -Wl,--end-group
+SnippetDispatcherBenchmark_release_lflags  += -lrt
+SnippetDispatcherBenchmark_release_lflags  += -Wl,-rpath ./
+SnippetDispatcherBenchmark_release_lflags  += -m64
+SnippetDispatcherBenchmark_release_objsdir  = $(OBJS_DIR)/SnippetDispatcherBenchmark_release
+SnippetDispatcherBenchmark_release_cpp_o    = $(addprefix $(SnippetDispatcherBenchmark_release_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.o, $(SnippetDispatcherBenchmark_cppfiles)))))
+SnippetDispatcherBenchmark_release_cc_o    = $(addprefix $(SnippetDispatcherBenchmark_release_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.o, $(SnippetDispatcherBenchmark_ccfiles)))))
+SnippetDispatcherBenchmark_release_c_o      = $(addprefix $(SnippetDispatcherBenchmark_release_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.o, $(SnippetDispatcherBenchmark_cfiles)))))
+SnippetDispatcherBenchmark_release_obj      = $(SnippetDispatcherBenchmark_release_cpp_o) $(SnippetDispatcherBenchmark_release_cc_o) $(SnippetDispatcherBenchmark_release_c_o)
+SnippetDispatcherBenchmark_release_bin      := ./../../../Bin/linux64/SnippetDispatcherBenchmark
+
+clean_SnippetDispatcherBenchmark_release: 
+	@$(ECHO) clean SnippetDispatcherBenchmark release
+	@$(RMDIR) $(SnippetDispatcherBenchmark_release_objsdir)
+	@$(RMDIR) $(SnippetDispatcherBenchmark_release_bin)
+	@$(RMDIR) $(DEPSDIR)/SnippetDispatcherBenchmark/release
+
+build_SnippetDispatcherBenchmark_release: postbuild_SnippetDispatcherBenchmark_release
+postbuild_SnippetDispatcherBenchmark_release: mainbuild_SnippetDispatcherBenchmark_release
+	@cp -u "../../../../PxShared/bin/linux64/libPxFoundation_x64.so" "../../../Bin/linux64/libPxFoundation_x64.so"; cp -u "../../../../PxShared/bin/linux64/libPxPvdSDK_x64.so" "../../../Bin/linux64/libPxPvdSDK_x64.so"
+mainbuild_SnippetDispatcherBenchmark_release: prebuild_SnippetDispatcherBenchmark_release $(SnippetDispatcherBenchmark_release_bin)
+prebuild_SnippetDispatcherBenchmark_release:
+
+$(SnippetDispatcherBenchmark_release_bin): $(SnippetDispatcherBenchmark_release_obj) build_SnippetRender_release build_SnippetUtils_release 
+	mkdir -p `dirname ./../../../Bin/linux64/SnippetDispatcherBenchmark`
+	$(CCLD) $(SnippetDispatcherBenchmark_release_obj) $(SnippetDispatcherBenchmark_release_lflags) -o $(SnippetDispatcherBenchmark_release_bin) 
+	$(ECHO) building $@ complete!
+
+SnippetDispatcherBenchmark_release_DEPDIR = $(dir $(@))/$(*F)
+$(SnippetDispatcherBenchmark_release_cpp_o): $(SnippetDispatcherBenchmark_release_objsdir)/%.o:
+	$(ECHO) SnippetDispatcherBenchmark: compiling release $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetDispatcherBenchmark_release_objsdir),, $@))), $(SnippetDispatcherBenchmark_cppfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetDispatcherBenchmark_release_cppflags) -c $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetDispatcherBenchmark_release_objsdir),, $@))), $(SnippetDispatcherBenchmark_cppfiles)) -o $@
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetDispatcherBenchmark_release_objsdir),, $@))), $(SnippetDispatcherBenchmark_cppfiles))))))
+	cp $(SnippetDispatcherBenchmark_release_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetDispatcherBenchmark_release_objsdir),, $@))), $(SnippetDispatcherBenchmark_cppfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetDispatcherBenchmark_release_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetDispatcherBenchmark_release_objsdir),, $@))), $(SnippetDispatcherBenchmark_cppfiles))))).P; \
+	  rm -f $(SnippetDispatcherBenchmark_release_DEPDIR).d
+
+$(SnippetDispatcherBenchmark_release_cc_o): $(SnippetDispatcherBenchmark_release_objsdir)/%.o:
+	$(ECHO) SnippetDispatcherBenchmark: compiling release $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetDispatcherBenchmark_release_objsdir),, $@))), $(SnippetDispatcherBenchmark_ccfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetDispatcherBenchmark_release_cppflags) -c $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetDispatcherBenchmark_release_objsdir),, $@))), $(SnippetDispatcherBenchmark_ccfiles)) -o $@
+	mkdir -p $(dir $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetDispatcherBenchmark_release_objsdir),, $@))), $(SnippetDispatcherBenchmark_ccfiles))))))
+	cp $(SnippetDispatcherBenchmark_release_DEPDIR).d $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetDispatcherBenchmark_release_objsdir),, $@))), $(SnippetDispatcherBenchmark_ccfiles))))).release.P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetDispatcherBenchmark_release_DEPDIR).d >> $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetDispatcherBenchmark_release_objsdir),, $@))), $(SnippetDispatcherBenchmark_ccfiles))))).release.P; \
+	  rm -f $(SnippetDispatcherBenchmark_release_DEPDIR).d
+
+$(SnippetDispatcherBenchmark_release_c_o): $(SnippetDispatcherBenchmark_release_objsdir)/%.o:
+	$(ECHO) SnippetDispatcherBenchmark: compiling release $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetDispatcherBenchmark_release_objsdir),, $@))), $(SnippetDispatcherBenchmark_cfiles))...
+	mkdir -p $(dir $(@))
+	$(CC) $(SnippetDispatcherBenchmark_release_cflags) -c $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetDispatcherBenchmark_release_objsdir),, $@))), $(SnippetDispatcherBenchmark_cfiles)) -o $@ 
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetDispatcherBenchmark_release_objsdir),, $@))), $(SnippetDispatcherBenchmark_cfiles))))))
+	cp $(SnippetDispatcherBenchmark_release_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetDispatcherBenchmark_release_objsdir),, $@))), $(SnippetDispatcherBenchmark_cfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetDispatcherBenchmark_release_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetDispatcherBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetDispatcherBenchmark_release_objsdir),, $@))), $(SnippetDispatcherBenchmark_cfiles))))).P; \
+	  rm -f $(SnippetDispatcherBenchmark_release_DEPDIR).d
+
+clean_SnippetDispatcherBenchmark:  clean_SnippetDispatcherBenchmark_debug clean_SnippetDispatcherBenchmark_checked clean_SnippetDispatcherBenchmark_profile clean_SnippetDispatcherBenchmark_release
+	rm -rf $(DEPSDIR)
+
+export VERBOSE
+ifndef VERBOSE
+.SILENT:
+endif
@@ -0,0 +1,477 @@
+# Makefile generated by XPJ for LINUX64
+-include Makefile.custom
+ProjectName = SnippetIslandSplitBenchmark
+SnippetIslandSplitBenchmark_cppfiles   += ./../../SnippetCommon/ClassicMain.cpp
+SnippetIslandSplitBenchmark_cppfiles   += ./../../SnippetIslandSplitBenchmark/SnippetIslandSplitBenchmark.cpp
+
+SnippetIslandSplitBenchmark_cpp_debug_dep    = $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/debug/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.P, $(SnippetIslandSplitBenchmark_cppfiles)))))
+SnippetIslandSplitBenchmark_cc_debug_dep    = $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.debug.P, $(SnippetIslandSplitBenchmark_ccfiles)))))
+SnippetIslandSplitBenchmark_c_debug_dep      = $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/debug/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.P, $(SnippetIslandSplitBenchmark_cfiles)))))
+SnippetIslandSplitBenchmark_debug_dep      = $(SnippetIslandSplitBenchmark_cpp_debug_dep) $(SnippetIslandSplitBenchmark_cc_debug_dep) $(SnippetIslandSplitBenchmark_c_debug_dep)
+-include $(SnippetIslandSplitBenchmark_debug_dep)
+SnippetIslandSplitBenchmark_cpp_checked_dep    = $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/checked/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.P, $(SnippetIslandSplitBenchmark_cppfiles)))))
+SnippetIslandSplitBenchmark_cc_checked_dep    = $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.checked.P, $(SnippetIslandSplitBenchmark_ccfiles)))))
+SnippetIslandSplitBenchmark_c_checked_dep      = $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/checked/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.P, $(SnippetIslandSplitBenchmark_cfiles)))))
+SnippetIslandSplitBenchmark_checked_dep      = $(SnippetIslandSplitBenchmark_cpp_checked_dep) $(SnippetIslandSplitBenchmark_cc_checked_dep) $(SnippetIslandSplitBenchmark_c_checked_dep)
+-include $(SnippetIslandSplitBenchmark_checked_dep)
+SnippetIslandSplitBenchmark_cpp_profile_dep    = $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/profile/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.P, $(SnippetIslandSplitBenchmark_cppfiles)))))
+SnippetIslandSplitBenchmark_cc_profile_dep    = $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.profile.P, $(SnippetIslandSplitBenchmark_ccfiles)))))
+SnippetIslandSplitBenchmark_c_profile_dep      = $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/profile/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.P, $(SnippetIslandSplitBenchmark_cfiles)))))
+SnippetIslandSplitBenchmark_profile_dep      = $(SnippetIslandSplitBenchmark_cpp_profile_dep) $(SnippetIslandSplitBenchmark_cc_profile_dep) $(SnippetIslandSplitBenchmark_c_profile_dep)
+-include $(SnippetIslandSplitBenchmark_profile_dep)
+SnippetIslandSplitBenchmark_cpp_release_dep    = $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/release/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.P, $(SnippetIslandSplitBenchmark_cppfiles)))))
+SnippetIslandSplitBenchmark_cc_release_dep    = $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.release.P, $(SnippetIslandSplitBenchmark_ccfiles)))))
+SnippetIslandSplitBenchmark_c_release_dep      = $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/release/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.P, $(SnippetIslandSplitBenchmark_cfiles)))))
+SnippetIslandSplitBenchmark_release_dep      = $(SnippetIslandSplitBenchmark_cpp_release_dep) $(SnippetIslandSplitBenchmark_cc_release_dep) $(SnippetIslandSplitBenchmark_c_release_dep)
+-include $(SnippetIslandSplitBenchmark_release_dep)
+SnippetIslandSplitBenchmark_debug_hpaths    := 
+SnippetIslandSplitBenchmark_debug_hpaths    += ./../../../Include
+SnippetIslandSplitBenchmark_debug_hpaths    += ./../../../../PxShared/include
+SnippetIslandSplitBenchmark_debug_hpaths    += ./../../../../PxShared/src/foundation/include
+SnippetIslandSplitBenchmark_debug_hpaths    += ./../../../../PxShared/src/fastxml/include
+SnippetIslandSplitBenchmark_debug_lpaths    := 
+SnippetIslandSplitBenchmark_debug_lpaths    += ./../../../Lib/linux64
+SnippetIslandSplitBenchmark_debug_lpaths    += ./../../lib/linux64
+SnippetIslandSplitBenchmark_debug_lpaths    += ./../../../Bin/linux64
+SnippetIslandSplitBenchmark_debug_lpaths    += ./../../../../PxShared/lib/linux64
+SnippetIslandSplitBenchmark_debug_lpaths    += ./../../../../PxShared/bin/linux64
+SnippetIslandSplitBenchmark_debug_lpaths    += ./../../lib/linux64
+SnippetIslandSplitBenchmark_debug_defines   := $(SnippetIslandSplitBenchmark_custom_defines)
+SnippetIslandSplitBenchmark_debug_defines   += PHYSX_PROFILE_SDK
+SnippetIslandSplitBenchmark_debug_defines   += RENDER_SNIPPET
+SnippetIslandSplitBenchmark_debug_defines   += _DEBUG
+SnippetIslandSplitBenchmark_debug_defines   += PX_DEBUG=1
+SnippetIslandSplitBenchmark_debug_defines   += PX_CHECKED=1
+SnippetIslandSplitBenchmark_debug_defines   += PX_SUPPORT_PVD=1
+SnippetIslandSplitBenchmark_debug_libraries := 
+SnippetIslandSplitBenchmark_debug_libraries += SnippetRenderDEBUG
+SnippetIslandSplitBenchmark_debug_libraries += SnippetUtilsDEBUG
+SnippetIslandSplitBenchmark_debug_libraries += PhysX3DEBUG_x64
+SnippetIslandSplitBenchmark_debug_libraries += PhysX3CookingDEBUG_x64
+SnippetIslandSplitBenchmark_debug_libraries += PhysX3CharacterKinematicDEBUG_x64
+SnippetIslandSplitBenchmark_debug_libraries += PhysX3ExtensionsDEBUG
+SnippetIslandSplitBenchmark_debug_libraries += PhysX3VehicleDEBUG
+SnippetIslandSplitBenchmark_debug_libraries += PxPvdSDKDEBUG_x64
+SnippetIslandSplitBenchmark_debug_libraries += PhysX3CommonDEBUG_x64
+SnippetIslandSplitBenchmark_debug_libraries += PxFoundationDEBUG_x64
+SnippetIslandSplitBenchmark_debug_libraries += PxTaskDEBUG
+SnippetIslandSplitBenchmark_debug_libraries += PsFastXmlDEBUG
+SnippetIslandSplitBenchmark_debug_libraries += SnippetUtilsDEBUG
+SnippetIslandSplitBenchmark_debug_libraries += SnippetRenderDEBUG
+SnippetIslandSplitBenchmark_debug_libraries += GL
+SnippetIslandSplitBenchmark_debug_libraries += GLU
+SnippetIslandSplitBenchmark_debug_libraries += glut
+SnippetIslandSplitBenchmark_debug_libraries += X11
+SnippetIslandSplitBenchmark_debug_libraries += rt
+SnippetIslandSplitBenchmark_debug_libraries += pthread
+SnippetIslandSplitBenchmark_debug_common_cflags	:= $(SnippetIslandSplitBenchmark_custom_cflags)
+SnippetIslandSplitBenchmark_debug_common_cflags    += -MMD
+SnippetIslandSplitBenchmark_debug_common_cflags    += $(addprefix -D, $(SnippetIslandSplitBenchmark_debug_defines))
+SnippetIslandSplitBenchmark_debug_common_cflags    += $(addprefix -I, $(SnippetIslandSplitBenchmark_debug_hpaths))
+SnippetIslandSplitBenchmark_debug_common_cflags  += -m64
+SnippetIslandSplitBenchmark_debug_common_cflags  += -Werror -m64 -fPIC -msse2 -mfpmath=sse -fno-exceptions -fno-rtti -fvisibility=hidden -fvisibility-inlines-hidden
+SnippetIslandSplitBenchmark_debug_common_cflags  += -Wall -Wextra -Wstrict-aliasing=2 -fdiagnostics-show-option
+SnippetIslandSplitBenchmark_debug_common_cflags  += -Wno-uninitialized
+SnippetIslandSplitBenchmark_debug_common_cflags  += -g3 -gdwarf-2
+SnippetIslandSplitBenchmark_debug_cflags	:= $(SnippetIslandSplitBenchmark_debug_common_cflags)
+SnippetIslandSplitBenchmark_debug_cppflags	:= $(SnippetIslandSplitBenchmark_debug_common_cflags)
+SnippetIslandSplitBenchmark_debug_lflags    := $(SnippetIslandSplitBenchmark_custom_lflags)
+SnippetIslandSplitBenchmark_debug_lflags    += $(addprefix -L, $(SnippetIslandSplitBenchmark_debug_lpaths))
+SnippetIslandSplitBenchmark_debug_lflags    += -Wl,--start-group $(addprefix -l, $(SnippetIslandSplitBenchmark_debug_libraries)) -Wl,--end-group
+SnippetIslandSplitBenchmark_debug_lflags  += -lrt
+SnippetIslandSplitBenchmark_debug_lflags  += -Wl,-rpath ./
+SnippetIslandSplitBenchmark_debug_lflags  += -m64
+SnippetIslandSplitBenchmark_debug_objsdir  = $(OBJS_DIR)/SnippetIslandSplitBenchmark_debug
+SnippetIslandSplitBenchmark_debug_cpp_o    = $(addprefix $(SnippetIslandSplitBenchmark_debug_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.o, $(SnippetIslandSplitBenchmark_cppfiles)))))
+SnippetIslandSplitBenchmark_debug_cc_o    = $(addprefix $(SnippetIslandSplitBenchmark_debug_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.o, $(SnippetIslandSplitBenchmark_ccfiles)))))
+SnippetIslandSplitBenchmark_debug_c_o      = $(addprefix $(SnippetIslandSplitBenchmark_debug_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.o, $(SnippetIslandSplitBenchmark_cfiles)))))
+SnippetIslandSplitBenchmark_debug_obj      = $(SnippetIslandSplitBenchmark_debug_cpp_o) $(SnippetIslandSplitBenchmark_debug_cc_o) $(SnippetIslandSplitBenchmark_debug_c_o)
+SnippetIslandSplitBenchmark_debug_bin      := ./../../../Bin/linux64/SnippetIslandSplitBenchmarkDEBUG
+
+clean_SnippetIslandSplitBenchmark_debug: 
+	@$(ECHO) clean SnippetIslandSplitBenchmark debug
+	@$(RMDIR) $(SnippetIslandSplitBenchmark_debug_objsdir)
+	@$(RMDIR) $(SnippetIslandSplitBenchmark_debug_bin)
+	@$(RMDIR) $(DEPSDIR)/SnippetIslandSplitBenchmark/debug
+
+build_SnippetIslandSplitBenchmark_debug: postbuild_SnippetIslandSplitBenchmark_debug
+postbuild_SnippetIslandSplitBenchmark_debug: mainbuild_SnippetIslandSplitBenchmark_debug
+	@cp -u "../../../../PxShared/bin/linux64/libPxFoundationDEBUG_x64.so" "../../../Bin/linux64/libPxFoundationDEBUG_x64.so"; cp -u "../../../../PxShared/bin/linux64/libPxPvdSDKDEBUG_x64.so" "../../../Bin/linux64/libPxPvdSDKDEBUG_x64.so"
+mainbuild_SnippetIslandSplitBenchmark_debug: prebuild_SnippetIslandSplitBenchmark_debug $(SnippetIslandSplitBenchmark_debug_bin)
+prebuild_SnippetIslandSplitBenchmark_debug:
+
+$(SnippetIslandSplitBenchmark_debug_bin): $(SnippetIslandSplitBenchmark_debug_obj) build_SnippetRender_debug build_SnippetUtils_debug 
+	mkdir -p `dirname ./../../../Bin/linux64/SnippetIslandSplitBenchmarkDEBUG`
+	$(CCLD) $(SnippetIslandSplitBenchmark_debug_obj) $(SnippetIslandSplitBenchmark_debug_lflags) -o $(SnippetIslandSplitBenchmark_debug_bin) 
+	$(ECHO) building $@ complete!
+
+SnippetIslandSplitBenchmark_debug_DEPDIR = $(dir $(@))/$(*F)
+$(SnippetIslandSplitBenchmark_debug_cpp_o): $(SnippetIslandSplitBenchmark_debug_objsdir)/%.o:
+	$(ECHO) SnippetIslandSplitBenchmark: compiling debug $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetIslandSplitBenchmark_debug_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cppfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetIslandSplitBenchmark_debug_cppflags) -c $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetIslandSplitBenchmark_debug_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cppfiles)) -o $@
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetIslandSplitBenchmark_debug_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cppfiles))))))
+	cp $(SnippetIslandSplitBenchmark_debug_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetIslandSplitBenchmark_debug_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cppfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetIslandSplitBenchmark_debug_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetIslandSplitBenchmark_debug_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cppfiles))))).P; \
+	  rm -f $(SnippetIslandSplitBenchmark_debug_DEPDIR).d
+
+$(SnippetIslandSplitBenchmark_debug_cc_o): $(SnippetIslandSplitBenchmark_debug_objsdir)/%.o:
+	$(ECHO) SnippetIslandSplitBenchmark: compiling debug $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetIslandSplitBenchmark_debug_objsdir),, $@))), $(SnippetIslandSplitBenchmark_ccfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetIslandSplitBenchmark_debug_cppflags) -c $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetIslandSplitBenchmark_debug_objsdir),, $@))), $(SnippetIslandSplitBenchmark_ccfiles)) -o $@
+	mkdir -p $(dir $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetIslandSplitBenchmark_debug_objsdir),, $@))), $(SnippetIslandSplitBenchmark_ccfiles))))))
+	cp $(SnippetIslandSplitBenchmark_debug_DEPDIR).d $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetIslandSplitBenchmark_debug_objsdir),, $@))), $(SnippetIslandSplitBenchmark_ccfiles))))).debug.P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetIslandSplitBenchmark_debug_DEPDIR).d >> $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetIslandSplitBenchmark_debug_objsdir),, $@))), $(SnippetIslandSplitBenchmark_ccfiles))))).debug.P; \
+	  rm -f $(SnippetIslandSplitBenchmark_debug_DEPDIR).d
+
+$(SnippetIslandSplitBenchmark_debug_c_o): $(SnippetIslandSplitBenchmark_debug_objsdir)/%.o:
+	$(ECHO) SnippetIslandSplitBenchmark: compiling debug $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetIslandSplitBenchmark_debug_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cfiles))...
+	mkdir -p $(dir $(@))
+	$(CC) $(SnippetIslandSplitBenchmark_debug_cflags) -c $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetIslandSplitBenchmark_debug_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cfiles)) -o $@ 
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetIslandSplitBenchmark_debug_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cfiles))))))
+	cp $(SnippetIslandSplitBenchmark_debug_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetIslandSplitBenchmark_debug_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetIslandSplitBenchmark_debug_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/debug/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetIslandSplitBenchmark_debug_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cfiles))))).P; \
+	  rm -f $(SnippetIslandSplitBenchmark_debug_DEPDIR).d
+
+SnippetIslandSplitBenchmark_checked_hpaths    := 
+SnippetIslandSplitBenchmark_checked_hpaths    += ./../../../Include
+SnippetIslandSplitBenchmark_checked_hpaths    += ./../../../../PxShared/include
+SnippetIslandSplitBenchmark_checked_hpaths    += ./../../../../PxShared/src/foundation/include
+SnippetIslandSplitBenchmark_checked_hpaths    += ./../../../../PxShared/src/fastxml/include
+SnippetIslandSplitBenchmark_checked_lpaths    := 
+SnippetIslandSplitBenchmark_checked_lpaths    += ./../../../Lib/linux64
+SnippetIslandSplitBenchmark_checked_lpaths    += ./../../lib/linux64
+SnippetIslandSplitBenchmark_checked_lpaths    += ./../../../Bin/linux64
+SnippetIslandSplitBenchmark_checked_lpaths    += ./../../../../PxShared/lib/linux64
+SnippetIslandSplitBenchmark_checked_lpaths    += ./../../../../PxShared/bin/linux64
+SnippetIslandSplitBenchmark_checked_lpaths    += ./../../lib/linux64
+SnippetIslandSplitBenchmark_checked_defines   := $(SnippetIslandSplitBenchmark_custom_defines)
+SnippetIslandSplitBenchmark_checked_defines   += PHYSX_PROFILE_SDK
+SnippetIslandSplitBenchmark_checked_defines   += RENDER_SNIPPET
+SnippetIslandSplitBenchmark_checked_defines   += NDEBUG
+SnippetIslandSplitBenchmark_checked_defines   += PX_CHECKED=1
+SnippetIslandSplitBenchmark_checked_defines   += PX_SUPPORT_PVD=1
+SnippetIslandSplitBenchmark_checked_libraries := 
+SnippetIslandSplitBenchmark_checked_libraries += SnippetRenderCHECKED
+SnippetIslandSplitBenchmark_checked_libraries += SnippetUtilsCHECKED
+SnippetIslandSplitBenchmark_checked_libraries += PhysX3CHECKED_x64
+SnippetIslandSplitBenchmark_checked_libraries += PhysX3CookingCHECKED_x64
+SnippetIslandSplitBenchmark_checked_libraries += PhysX3CharacterKinematicCHECKED_x64
+SnippetIslandSplitBenchmark_checked_libraries += PhysX3ExtensionsCHECKED
+SnippetIslandSplitBenchmark_checked_libraries += PhysX3VehicleCHECKED
+SnippetIslandSplitBenchmark_checked_libraries += PxPvdSDKCHECKED_x64
+SnippetIslandSplitBenchmark_checked_libraries += PhysX3CommonCHECKED_x64
+SnippetIslandSplitBenchmark_checked_libraries += PxFoundationCHECKED_x64
+SnippetIslandSplitBenchmark_checked_libraries += PxTaskCHECKED
+SnippetIslandSplitBenchmark_checked_libraries += PsFastXmlCHECKED
+SnippetIslandSplitBenchmark_checked_libraries += SnippetUtilsCHECKED
+SnippetIslandSplitBenchmark_checked_libraries += SnippetRenderCHECKED
+SnippetIslandSplitBenchmark_checked_libraries += GL
+SnippetIslandSplitBenchmark_checked_libraries += GLU
+SnippetIslandSplitBenchmark_checked_libraries += glut
+SnippetIslandSplitBenchmark_checked_libraries += X11
+SnippetIslandSplitBenchmark_checked_libraries += rt
+SnippetIslandSplitBenchmark_checked_libraries += pthread
+SnippetIslandSplitBenchmark_checked_common_cflags	:= $(SnippetIslandSplitBenchmark_custom_cflags)
+SnippetIslandSplitBenchmark_checked_common_cflags    += -MMD
+SnippetIslandSplitBenchmark_checked_common_cflags    += $(addprefix -D, $(SnippetIslandSplitBenchmark_checked_defines))
+SnippetIslandSplitBenchmark_checked_common_cflags    += $(addprefix -I, $(SnippetIslandSplitBenchmark_checked_hpaths))
+SnippetIslandSplitBenchmark_checked_common_cflags  += -m64
+SnippetIslandSplitBenchmark_checked_common_cflags  += -Werror -m64 -fPIC -msse2 -mfpmath=sse -fno-exceptions -fno-rtti -fvisibility=hidden -fvisibility-inlines-hidden
+SnippetIslandSplitBenchmark_checked_common_cflags  += -Wall -Wextra -Wstrict-aliasing=2 -fdiagnostics-show-option
+SnippetIslandSplitBenchmark_checked_common_cflags  += -Wno-uninitialized
+SnippetIslandSplitBenchmark_checked_common_cflags  += -g3 -gdwarf-2 -O3 -fno-strict-aliasing
+SnippetIslandSplitBenchmark_checked_cflags	:= $(SnippetIslandSplitBenchmark_checked_common_cflags)
+SnippetIslandSplitBenchmark_checked_cppflags	:= $(SnippetIslandSplitBenchmark_checked_common_cflags)
+SnippetIslandSplitBenchmark_checked_lflags    := $(SnippetIslandSplitBenchmark_custom_lflags)
+SnippetIslandSplitBenchmark_checked_lflags    += $(addprefix -L, $(SnippetIslandSplitBenchmark_checked_lpaths))
+SnippetIslandSplitBenchmark_checked_lflags    += -Wl,--start-group $(addprefix -l, $(SnippetIslandSplitBenchmark_checked_libraries)) -Wl,--end-group
+SnippetIslandSplitBenchmark_checked_lflags  += -lrt
+SnippetIslandSplitBenchmark_checked_lflags  += -Wl,-rpath ./
+SnippetIslandSplitBenchmark_checked_lflags  += -m64
+SnippetIslandSplitBenchmark_checked_objsdir  = $(OBJS_DIR)/SnippetIslandSplitBenchmark_checked
+SnippetIslandSplitBenchmark_checked_cpp_o    = $(addprefix $(SnippetIslandSplitBenchmark_checked_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.o, $(SnippetIslandSplitBenchmark_cppfiles)))))
+SnippetIslandSplitBenchmark_checked_cc_o    = $(addprefix $(SnippetIslandSplitBenchmark_checked_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.o, $(SnippetIslandSplitBenchmark_ccfiles)))))
+SnippetIslandSplitBenchmark_checked_c_o      = $(addprefix $(SnippetIslandSplitBenchmark_checked_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.o, $(SnippetIslandSplitBenchmark_cfiles)))))
+SnippetIslandSplitBenchmark_checked_obj      = $(SnippetIslandSplitBenchmark_checked_cpp_o) $(SnippetIslandSplitBenchmark_checked_cc_o) $(SnippetIslandSplitBenchmark_checked_c_o)
+SnippetIslandSplitBenchmark_checked_bin      := ./../../../Bin/linux64/SnippetIslandSplitBenchmarkCHECKED
+
+clean_SnippetIslandSplitBenchmark_checked: 
+	@$(ECHO) clean SnippetIslandSplitBenchmark checked
+	@$(RMDIR) $(SnippetIslandSplitBenchmark_checked_objsdir)
+	@$(RMDIR) $(SnippetIslandSplitBenchmark_checked_bin)
+	@$(RMDIR) $(DEPSDIR)/SnippetIslandSplitBenchmark/checked
+
+build_SnippetIslandSplitBenchmark_checked: postbuild_SnippetIslandSplitBenchmark_checked
+postbuild_SnippetIslandSplitBenchmark_checked: mainbuild_SnippetIslandSplitBenchmark_checked
+	@cp -u "../../../../PxShared/bin/linux64/libPxFoundationCHECKED_x64.so" "../../../Bin/linux64/libPxFoundationCHECKED_x64.so"; cp -u "../../../../PxShared/bin/linux64/libPxPvdSDKCHECKED_x64.so" "../../../Bin/linux64/libPxPvdSDKCHECKED_x64.so"
+mainbuild_SnippetIslandSplitBenchmark_checked: prebuild_SnippetIslandSplitBenchmark_checked $(SnippetIslandSplitBenchmark_checked_bin)
+prebuild_SnippetIslandSplitBenchmark_checked:
+
+$(SnippetIslandSplitBenchmark_checked_bin): $(SnippetIslandSplitBenchmark_checked_obj) build_SnippetRender_checked build_SnippetUtils_checked 
+	mkdir -p `dirname ./../../../Bin/linux64/SnippetIslandSplitBenchmarkCHECKED`
+	$(CCLD) $(SnippetIslandSplitBenchmark_checked_obj) $(SnippetIslandSplitBenchmark_checked_lflags) -o $(SnippetIslandSplitBenchmark_checked_bin) 
+	$(ECHO) building $@ complete!
+
+SnippetIslandSplitBenchmark_checked_DEPDIR = $(dir $(@))/$(*F)
+$(SnippetIslandSplitBenchmark_checked_cpp_o): $(SnippetIslandSplitBenchmark_checked_objsdir)/%.o:
+	$(ECHO) SnippetIslandSplitBenchmark: compiling checked $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetIslandSplitBenchmark_checked_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cppfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetIslandSplitBenchmark_checked_cppflags) -c $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetIslandSplitBenchmark_checked_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cppfiles)) -o $@
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetIslandSplitBenchmark_checked_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cppfiles))))))
+	cp $(SnippetIslandSplitBenchmark_checked_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetIslandSplitBenchmark_checked_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cppfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetIslandSplitBenchmark_checked_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetIslandSplitBenchmark_checked_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cppfiles))))).P; \
+	  rm -f $(SnippetIslandSplitBenchmark_checked_DEPDIR).d
+
+$(SnippetIslandSplitBenchmark_checked_cc_o): $(SnippetIslandSplitBenchmark_checked_objsdir)/%.o:
+	$(ECHO) SnippetIslandSplitBenchmark: compiling checked $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetIslandSplitBenchmark_checked_objsdir),, $@))), $(SnippetIslandSplitBenchmark_ccfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetIslandSplitBenchmark_checked_cppflags) -c $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetIslandSplitBenchmark_checked_objsdir),, $@))), $(SnippetIslandSplitBenchmark_ccfiles)) -o $@
+	mkdir -p $(dir $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetIslandSplitBenchmark_checked_objsdir),, $@))), $(SnippetIslandSplitBenchmark_ccfiles))))))
+	cp $(SnippetIslandSplitBenchmark_checked_DEPDIR).d $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetIslandSplitBenchmark_checked_objsdir),, $@))), $(SnippetIslandSplitBenchmark_ccfiles))))).checked.P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetIslandSplitBenchmark_checked_DEPDIR).d >> $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetIslandSplitBenchmark_checked_objsdir),, $@))), $(SnippetIslandSplitBenchmark_ccfiles))))).checked.P; \
+	  rm -f $(SnippetIslandSplitBenchmark_checked_DEPDIR).d
+
+$(SnippetIslandSplitBenchmark_checked_c_o): $(SnippetIslandSplitBenchmark_checked_objsdir)/%.o:
+	$(ECHO) SnippetIslandSplitBenchmark: compiling checked $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetIslandSplitBenchmark_checked_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cfiles))...
+	mkdir -p $(dir $(@))
+	$(CC) $(SnippetIslandSplitBenchmark_checked_cflags) -c $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetIslandSplitBenchmark_checked_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cfiles)) -o $@ 
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetIslandSplitBenchmark_checked_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cfiles))))))
+	cp $(SnippetIslandSplitBenchmark_checked_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetIslandSplitBenchmark_checked_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetIslandSplitBenchmark_checked_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/checked/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetIslandSplitBenchmark_checked_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cfiles))))).P; \
+	  rm -f $(SnippetIslandSplitBenchmark_checked_DEPDIR).d
+
+SnippetIslandSplitBenchmark_profile_hpaths    := 
+SnippetIslandSplitBenchmark_profile_hpaths    += ./../../../Include
+SnippetIslandSplitBenchmark_profile_hpaths    += ./../../../../PxShared/include
+SnippetIslandSplitBenchmark_profile_hpaths    += ./../../../../PxShared/src/foundation/include
+SnippetIslandSplitBenchmark_profile_hpaths    += ./../../../../PxShared/src/fastxml/include
+SnippetIslandSplitBenchmark_profile_lpaths    := 
+SnippetIslandSplitBenchmark_profile_lpaths    += ./../../../Lib/linux64
+SnippetIslandSplitBenchmark_profile_lpaths    += ./../../lib/linux64
+SnippetIslandSplitBenchmark_profile_lpaths    += ./../../../Bin/linux64
+SnippetIslandSplitBenchmark_profile_lpaths    += ./../../../../PxShared/lib/linux64
+SnippetIslandSplitBenchmark_profile_lpaths    += ./../../../../PxShared/bin/linux64
+SnippetIslandSplitBenchmark_profile_lpaths    += ./../../lib/linux64
+SnippetIslandSplitBenchmark_profile_defines   := $(SnippetIslandSplitBenchmark_custom_defines)
+SnippetIslandSplitBenchmark_profile_defines   += PHYSX_PROFILE_SDK
+SnippetIslandSplitBenchmark_profile_defines   += RENDER_SNIPPET
+SnippetIslandSplitBenchmark_profile_defines   += NDEBUG
+SnippetIslandSplitBenchmark_profile_defines   += PX_PROFILE=1
+SnippetIslandSplitBenchmark_profile_defines   += PX_SUPPORT_PVD=1
+SnippetIslandSplitBenchmark_profile_libraries := 
+SnippetIslandSplitBenchmark_profile_libraries += SnippetRenderPROFILE
+SnippetIslandSplitBenchmark_profile_libraries += SnippetUtilsPROFILE
+SnippetIslandSplitBenchmark_profile_libraries += PhysX3PROFILE_x64
+SnippetIslandSplitBenchmark_profile_libraries += PhysX3CookingPROFILE_x64
+SnippetIslandSplitBenchmark_profile_libraries += PhysX3CharacterKinematicPROFILE_x64
+SnippetIslandSplitBenchmark_profile_libraries += PhysX3ExtensionsPROFILE
+SnippetIslandSplitBenchmark_profile_libraries += PhysX3VehiclePROFILE
+SnippetIslandSplitBenchmark_profile_libraries += PxPvdSDKPROFILE_x64
+SnippetIslandSplitBenchmark_profile_libraries += PhysX3CommonPROFILE_x64
+SnippetIslandSplitBenchmark_profile_libraries += PxFoundationPROFILE_x64
+SnippetIslandSplitBenchmark_profile_libraries += PxTaskPROFILE
+SnippetIslandSplitBenchmark_profile_libraries += PsFastXmlPROFILE
+SnippetIslandSplitBenchmark_profile_libraries += SnippetUtilsPROFILE
+SnippetIslandSplitBenchmark_profile_libraries += SnippetRenderPROFILE
+SnippetIslandSplitBenchmark_profile_libraries += GL
+SnippetIslandSplitBenchmark_profile_libraries += GLU
+SnippetIslandSplitBenchmark_profile_libraries += glut
+SnippetIslandSplitBenchmark_profile_libraries += X11
+SnippetIslandSplitBenchmark_profile_libraries += rt
+SnippetIslandSplitBenchmark_profile_libraries += pthread
+SnippetIslandSplitBenchmark_profile_common_cflags	:= $(SnippetIslandSplitBenchmark_custom_cflags)
+SnippetIslandSplitBenchmark_profile_common_cflags    += -MMD
+SnippetIslandSplitBenchmark_profile_common_cflags    += $(addprefix -D, $(SnippetIslandSplitBenchmark_profile_defines))
+SnippetIslandSplitBenchmark_profile_common_cflags    += $(addprefix -I, $(SnippetIslandSplitBenchmark_profile_hpaths))
+SnippetIslandSplitBenchmark_profile_common_cflags  += -m64
+SnippetIslandSplitBenchmark_profile_common_cflags  += -Werror -m64 -fPIC -msse2 -mfpmath=sse -fno-exceptions -fno-rtti -fvisibility=hidden -fvisibility-inlines-hidden
+SnippetIslandSplitBenchmark_profile_common_cflags  += -Wall -Wextra -Wstrict-aliasing=2 -fdiagnostics-show-option
+SnippetIslandSplitBenchmark_profile_common_cflags  += -Wno-uninitialized
+SnippetIslandSplitBenchmark_profile_common_cflags  += -O3 -fno-strict-aliasing
+SnippetIslandSplitBenchmark_profile_cflags	:= $(SnippetIslandSplitBenchmark_profile_common_cflags)
+SnippetIslandSplitBenchmark_profile_cppflags	:= $(SnippetIslandSplitBenchmark_profile_common_cflags)
+SnippetIslandSplitBenchmark_profile_lflags    := $(SnippetIslandSplitBenchmark_custom_lflags)
+SnippetIslandSplitBenchmark_profile_lflags    += $(addprefix -L, $(SnippetIslandSplitBenchmark_profile_lpaths))
+SnippetIslandSplitBenchmark_profile_lflags    += -Wl,--start-group $(addprefix -l, $(SnippetIslandSplitBenchmark_profile_libraries)) -Wl,--end-group
+SnippetIslandSplitBenchmark_profile_lflags  += -lrt
+SnippetIslandSplitBenchmark_profile_lflags  += -Wl,-rpath ./
+SnippetIslandSplitBenchmark_profile_lflags  += -m64
+SnippetIslandSplitBenchmark_profile_objsdir  = $(OBJS_DIR)/SnippetIslandSplitBenchmark_profile
+SnippetIslandSplitBenchmark_profile_cpp_o    = $(addprefix $(SnippetIslandSplitBenchmark_profile_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.o, $(SnippetIslandSplitBenchmark_cppfiles)))))
+SnippetIslandSplitBenchmark_profile_cc_o    = $(addprefix $(SnippetIslandSplitBenchmark_profile_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.o, $(SnippetIslandSplitBenchmark_ccfiles)))))
+SnippetIslandSplitBenchmark_profile_c_o      = $(addprefix $(SnippetIslandSplitBenchmark_profile_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.o, $(SnippetIslandSplitBenchmark_cfiles)))))
+SnippetIslandSplitBenchmark_profile_obj      = $(SnippetIslandSplitBenchmark_profile_cpp_o) $(SnippetIslandSplitBenchmark_profile_cc_o) $(SnippetIslandSplitBenchmark_profile_c_o)
+SnippetIslandSplitBenchmark_profile_bin      := ./../../../Bin/linux64/SnippetIslandSplitBenchmarkPROFILE
+
+clean_SnippetIslandSplitBenchmark_profile: 
+	@$(ECHO) clean SnippetIslandSplitBenchmark profile
+	@$(RMDIR) $(SnippetIslandSplitBenchmark_profile_objsdir)
+	@$(RMDIR) $(SnippetIslandSplitBenchmark_profile_bin)
+	@$(RMDIR) $(DEPSDIR)/SnippetIslandSplitBenchmark/profile
+
+build_SnippetIslandSplitBenchmark_profile: postbuild_SnippetIslandSplitBenchmark_profile
+postbuild_SnippetIslandSplitBenchmark_profile: mainbuild_SnippetIslandSplitBenchmark_profile
+	@cp -u "../../../../PxShared/bin/linux64/libPxFoundationPROFILE_x64.so" "../../../Bin/linux64/libPxFoundationPROFILE_x64.so"; cp -u "../../../../PxShared/bin/linux64/libPxPvdSDKPROFILE_x64.so" "../../../Bin/linux64/libPxPvdSDKPROFILE_x64.so"
+mainbuild_SnippetIslandSplitBenchmark_profile: prebuild_SnippetIslandSplitBenchmark_profile $(SnippetIslandSplitBenchmark_profile_bin)
+prebuild_SnippetIslandSplitBenchmark_profile:
+
+$(SnippetIslandSplitBenchmark_profile_bin): $(SnippetIslandSplitBenchmark_profile_obj) build_SnippetRender_profile build_SnippetUtils_profile 
+	mkdir -p `dirname ./../../../Bin/linux64/SnippetIslandSplitBenchmarkPROFILE`
+	$(CCLD) $(SnippetIslandSplitBenchmark_profile_obj) $(SnippetIslandSplitBenchmark_profile_lflags) -o $(SnippetIslandSplitBenchmark_profile_bin) 
+	$(ECHO) building $@ complete!
+
+SnippetIslandSplitBenchmark_profile_DEPDIR = $(dir $(@))/$(*F)
+$(SnippetIslandSplitBenchmark_profile_cpp_o): $(SnippetIslandSplitBenchmark_profile_objsdir)/%.o:
+	$(ECHO) SnippetIslandSplitBenchmark: compiling profile $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetIslandSplitBenchmark_profile_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cppfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetIslandSplitBenchmark_profile_cppflags) -c $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetIslandSplitBenchmark_profile_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cppfiles)) -o $@
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetIslandSplitBenchmark_profile_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cppfiles))))))
+	cp $(SnippetIslandSplitBenchmark_profile_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetIslandSplitBenchmark_profile_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cppfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetIslandSplitBenchmark_profile_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetIslandSplitBenchmark_profile_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cppfiles))))).P; \
+	  rm -f $(SnippetIslandSplitBenchmark_profile_DEPDIR).d
+
+$(SnippetIslandSplitBenchmark_profile_cc_o): $(SnippetIslandSplitBenchmark_profile_objsdir)/%.o:
+	$(ECHO) SnippetIslandSplitBenchmark: compiling profile $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetIslandSplitBenchmark_profile_objsdir),, $@))), $(SnippetIslandSplitBenchmark_ccfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetIslandSplitBenchmark_profile_cppflags) -c $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetIslandSplitBenchmark_profile_objsdir),, $@))), $(SnippetIslandSplitBenchmark_ccfiles)) -o $@
+	mkdir -p $(dir $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetIslandSplitBenchmark_profile_objsdir),, $@))), $(SnippetIslandSplitBenchmark_ccfiles))))))
+	cp $(SnippetIslandSplitBenchmark_profile_DEPDIR).d $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetIslandSplitBenchmark_profile_objsdir),, $@))), $(SnippetIslandSplitBenchmark_ccfiles))))).profile.P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetIslandSplitBenchmark_profile_DEPDIR).d >> $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetIslandSplitBenchmark_profile_objsdir),, $@))), $(SnippetIslandSplitBenchmark_ccfiles))))).profile.P; \
+	  rm -f $(SnippetIslandSplitBenchmark_profile_DEPDIR).d
+
+$(SnippetIslandSplitBenchmark_profile_c_o): $(SnippetIslandSplitBenchmark_profile_objsdir)/%.o:
+	$(ECHO) SnippetIslandSplitBenchmark: compiling profile $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetIslandSplitBenchmark_profile_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cfiles))...
+	mkdir -p $(dir $(@))
+	$(CC) $(SnippetIslandSplitBenchmark_profile_cflags) -c $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetIslandSplitBenchmark_profile_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cfiles)) -o $@ 
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetIslandSplitBenchmark_profile_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cfiles))))))
+	cp $(SnippetIslandSplitBenchmark_profile_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetIslandSplitBenchmark_profile_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetIslandSplitBenchmark_profile_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/profile/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetIslandSplitBenchmark_profile_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cfiles))))).P; \
+	  rm -f $(SnippetIslandSplitBenchmark_profile_DEPDIR).d
+
+SnippetIslandSplitBenchmark_release_hpaths    := 
+SnippetIslandSplitBenchmark_release_hpaths    += ./../../../Include
+SnippetIslandSplitBenchmark_release_hpaths    += ./../../../../PxShared/include
+SnippetIslandSplitBenchmark_release_hpaths    += ./../../../../PxShared/src/foundation/include
+SnippetIslandSplitBenchmark_release_hpaths    += ./../../../../PxShared/src/fastxml/include
+SnippetIslandSplitBenchmark_release_lpaths    := 
+SnippetIslandSplitBenchmark_release_lpaths    += ./../../../Lib/linux64
+SnippetIslandSplitBenchmark_release_lpaths    += ./../../lib/linux64
+SnippetIslandSplitBenchmark_release_lpaths    += ./../../../Bin/linux64
+SnippetIslandSplitBenchmark_release_lpaths    += ./../../../../PxShared/lib/linux64
+SnippetIslandSplitBenchmark_release_lpaths    += ./../../../../PxShared/bin/linux64
+SnippetIslandSplitBenchmark_release_lpaths    += ./../../lib/linux64
+SnippetIslandSplitBenchmark_release_defines   := $(SnippetIslandSplitBenchmark_custom_defines)
+SnippetIslandSplitBenchmark_release_defines   += PHYSX_PROFILE_SDK
+SnippetIslandSplitBenchmark_release_defines   += RENDER_SNIPPET
+SnippetIslandSplitBenchmark_release_defines   += NDEBUG
+SnippetIslandSplitBenchmark_release_defines   += PX_SUPPORT_PVD=0
+SnippetIslandSplitBenchmark_release_libraries := 
+SnippetIslandSplitBenchmark_release_libraries += SnippetRender
+SnippetIslandSplitBenchmark_release_libraries += SnippetUtils
+SnippetIslandSplitBenchmark_release_libraries += PhysX3_x64
+SnippetIslandSplitBenchmark_release_libraries += PhysX3Cooking_x64
+SnippetIslandSplitBenchmark_release_libraries += PhysX3CharacterKinematic_x64
+SnippetIslandSplitBenchmark_release_libraries += PhysX3Extensions
+SnippetIslandSplitBenchmark_release_libraries += PhysX3Vehicle
+SnippetIslandSplitBenchmark_release_libraries += PxPvdSDK_x64
+SnippetIslandSplitBenchmark_release_libraries += PhysX3Common_x64
+SnippetIslandSplitBenchmark_release_libraries += PxFoundation_x64
+SnippetIslandSplitBenchmark_release_libraries += PxTask
+SnippetIslandSplitBenchmark_release_libraries += PsFastXml
+SnippetIslandSplitBenchmark_release_libraries += SnippetUtils
+SnippetIslandSplitBenchmark_release_libraries += SnippetRender
+SnippetIslandSplitBenchmark_release_libraries += GL
+SnippetIslandSplitBenchmark_release_libraries += GLU
+SnippetIslandSplitBenchmark_release_libraries += glut
+SnippetIslandSplitBenchmark_release_libraries += X11
+SnippetIslandSplitBenchmark_release_libraries += rt
+SnippetIslandSplitBenchmark_release_libraries += pthread
+SnippetIslandSplitBenchmark_release_common_cflags	:= $(SnippetIslandSplitBenchmark_custom_cflags)
+SnippetIslandSplitBenchmark_release_common_cflags    += -MMD
+SnippetIslandSplitBenchmark_release_common_cflags    += $(addprefix -D, $(SnippetIslandSplitBenchmark_release_defines))
+SnippetIslandSplitBenchmark_release_common_cflags    += $(addprefix -I, $(SnippetIslandSplitBenchmark_release_hpaths))
+SnippetIslandSplitBenchmark_release_common_cflags  += -m64
+SnippetIslandSplitBenchmark_release_common_cflags  += -Werror -m64 -fPIC -msse2 -mfpmath=sse -fno-exceptions -fno-rtti -fvisibility=hidden -fvisibility-inlines-hidden
+SnippetIslandSplitBenchmark_release_common_cflags  += -Wall -Wextra -Wstrict-aliasing=2 -fdiagnostics-show-option
+SnippetIslandSplitBenchmark_release_common_cflags  += -Wno-uninitialized
+SnippetIslandSplitBenchmark_release_common_cflags  += -O3 -fno-strict-aliasing
+SnippetIslandSplitBenchmark_release_cflags	:= $(SnippetIslandSplitBenchmark_release_common_cflags)
+SnippetIslandSplitBenchmark_release_cppflags	:= $(SnippetIslandSplitBenchmark_release_common_cflags)
+SnippetIslandSplitBenchmark_release_lflags    := $(SnippetIslandSplitBenchmark_custom_lflags)
+SnippetIslandSplitBenchmark_release_lflags    += $(addprefix -L, $(SnippetIslandSplitBenchmark_release_lpaths))
+SnippetIslandSplitBenchmark_release_lflags    += -Wl,--start-group $(addprefix -l, $(SnippetIslandSplitBenchmark_release_libraries)) -Wl,--end-group
+SnippetIslandSplitBenchmark_release_lflags  += -lrt
+SnippetIslandSplitBenchmark_release_lflags  += -Wl,-rpath ./
+SnippetIslandSplitBenchmark_release_lflags  += -m64
+SnippetIslandSplitBenchmark_release_objsdir  = $(OBJS_DIR)/SnippetIslandSplitBenchmark_release
+SnippetIslandSplitBenchmark_release_cpp_o    = $(addprefix $(SnippetIslandSplitBenchmark_release_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cpp, %.cpp.o, $(SnippetIslandSplitBenchmark_cppfiles)))))
+SnippetIslandSplitBenchmark_release_cc_o    = $(addprefix $(SnippetIslandSplitBenchmark_release_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.cc, %.cc.o, $(SnippetIslandSplitBenchmark_ccfiles)))))
+SnippetIslandSplitBenchmark_release_c_o      = $(addprefix $(SnippetIslandSplitBenchmark_release_objsdir)/, $(subst ./, , $(subst ../, , $(patsubst %.c, %.c.o, $(SnippetIslandSplitBenchmark_cfiles)))))
+SnippetIslandSplitBenchmark_release_obj      = $(SnippetIslandSplitBenchmark_release_cpp_o) $(SnippetIslandSplitBenchmark_release_cc_o) $(SnippetIslandSplitBenchmark_release_c_o)
+SnippetIslandSplitBenchmark_release_bin      := ./../../../Bin/linux64/SnippetIslandSplitBenchmark
+
+clean_SnippetIslandSplitBenchmark_release: 
+	@$(ECHO) clean SnippetIslandSplitBenchmark release
+	@$(RMDIR) $(SnippetIslandSplitBenchmark_release_objsdir)
+	@$(RMDIR) $(SnippetIslandSplitBenchmark_release_bin)
+	@$(RMDIR) $(DEPSDIR)/SnippetIslandSplitBenchmark/release
+
+build_SnippetIslandSplitBenchmark_release: postbuild_SnippetIslandSplitBenchmark_release
+postbuild_SnippetIslandSplitBenchmark_release: mainbuild_SnippetIslandSplitBenchmark_release
+	@cp -u "../../../../PxShared/bin/linux64/libPxFoundation_x64.so" "../../../Bin/linux64/libPxFoundation_x64.so"; cp -u "../../../../PxShared/bin/linux64/libPxPvdSDK_x64.so" "../../../Bin/linux64/libPxPvdSDK_x64.so"
+mainbuild_SnippetIslandSplitBenchmark_release: prebuild_SnippetIslandSplitBenchmark_release $(SnippetIslandSplitBenchmark_release_bin)
+prebuild_SnippetIslandSplitBenchmark_release:
+
+$(SnippetIslandSplitBenchmark_release_bin): $(SnippetIslandSplitBenchmark_release_obj) build_SnippetRender_release build_SnippetUtils_release 
+	mkdir -p `dirname ./../../../Bin/linux64/SnippetIslandSplitBenchmark`
+	$(CCLD) $(SnippetIslandSplitBenchmark_release_obj) $(SnippetIslandSplitBenchmark_release_lflags) -o $(SnippetIslandSplitBenchmark_release_bin) 
+	$(ECHO) building $@ complete!
+
+SnippetIslandSplitBenchmark_release_DEPDIR = $(dir $(@))/$(*F)
+$(SnippetIslandSplitBenchmark_release_cpp_o): $(SnippetIslandSplitBenchmark_release_objsdir)/%.o:
+	$(ECHO) SnippetIslandSplitBenchmark: compiling release $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetIslandSplitBenchmark_release_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cppfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetIslandSplitBenchmark_release_cppflags) -c $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetIslandSplitBenchmark_release_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cppfiles)) -o $@
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetIslandSplitBenchmark_release_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cppfiles))))))
+	cp $(SnippetIslandSplitBenchmark_release_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetIslandSplitBenchmark_release_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cppfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetIslandSplitBenchmark_release_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cpp.o,.cpp, $(subst $(SnippetIslandSplitBenchmark_release_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cppfiles))))).P; \
+	  rm -f $(SnippetIslandSplitBenchmark_release_DEPDIR).d
+
+$(SnippetIslandSplitBenchmark_release_cc_o): $(SnippetIslandSplitBenchmark_release_objsdir)/%.o:
+	$(ECHO) SnippetIslandSplitBenchmark: compiling release $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetIslandSplitBenchmark_release_objsdir),, $@))), $(SnippetIslandSplitBenchmark_ccfiles))...
+	mkdir -p $(dir $(@))
+	$(CXX) $(SnippetIslandSplitBenchmark_release_cppflags) -c $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetIslandSplitBenchmark_release_objsdir),, $@))), $(SnippetIslandSplitBenchmark_ccfiles)) -o $@
+	mkdir -p $(dir $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetIslandSplitBenchmark_release_objsdir),, $@))), $(SnippetIslandSplitBenchmark_ccfiles))))))
+	cp $(SnippetIslandSplitBenchmark_release_DEPDIR).d $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetIslandSplitBenchmark_release_objsdir),, $@))), $(SnippetIslandSplitBenchmark_ccfiles))))).release.P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetIslandSplitBenchmark_release_DEPDIR).d >> $(addprefix $(DEPSDIR)/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .cc.o,.cc, $(subst $(SnippetIslandSplitBenchmark_release_objsdir),, $@))), $(SnippetIslandSplitBenchmark_ccfiles))))).release.P; \
+	  rm -f $(SnippetIslandSplitBenchmark_release_DEPDIR).d
+
+$(SnippetIslandSplitBenchmark_release_c_o): $(SnippetIslandSplitBenchmark_release_objsdir)/%.o:
+	$(ECHO) SnippetIslandSplitBenchmark: compiling release $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetIslandSplitBenchmark_release_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cfiles))...
+	mkdir -p $(dir $(@))
+	$(CC) $(SnippetIslandSplitBenchmark_release_cflags) -c $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetIslandSplitBenchmark_release_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cfiles)) -o $@ 
+	@mkdir -p $(dir $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetIslandSplitBenchmark_release_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cfiles))))))
+	cp $(SnippetIslandSplitBenchmark_release_DEPDIR).d $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetIslandSplitBenchmark_release_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cfiles))))).P; \
+	  sed -e 's/#.*//' -e 's/^[^:]*: *//' -e 's/ *\\$$//' \
+		-e '/^$$/ d' -e 's/$$/ :/' < $(SnippetIslandSplitBenchmark_release_DEPDIR).d >> $(addprefix $(DEPSDIR)/SnippetIslandSplitBenchmark/release/, $(subst ./, , $(subst ../, , $(filter %$(strip $(subst .c.o,.c, $(subst $(SnippetIslandSplitBenchmark_release_objsdir),, $@))), $(SnippetIslandSplitBenchmark_cfiles))))).P; \
+	  rm -f $(SnippetIslandSplitBenchmark_release_DEPDIR).d
+
+clean_SnippetIslandSplitBenchmark:  clean_SnippetIslandSplitBenchmark_debug clean_SnippetIslandSplitBenchmark_checked clean_SnippetIslandSplitBenchmark_profile clean_SnippetIslandSplitBenchmark_release
+	rm -rf $(DEPSDIR)
+
+export VERBOSE
+ifndef VERBOSE
+.SILENT:
+endif
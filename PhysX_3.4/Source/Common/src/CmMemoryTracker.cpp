@@ -0,0 +1,493 @@
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Copyright (c) 2008-2018 NVIDIA Corporation. All rights reserved.
+// Copyright (c) 2004-2008 AGEIA Technologies, Inc. All rights reserved.
+// Copyright (c) 2001-2004 NovodeX AG. All rights reserved.  
+
+
+#include "CmMemoryTracker.h"
+#include "PsAtomic.h"
+#include "PsFoundation.h"
+#include "PsBroadcast.h"
+#include "PsHashMap.h"
+#include "PsMutex.h"
+#include "PsThread.h"
+#include "foundation/PxMath.h"
+#include "foundation/PxMemory.h"
+
+using namespace physx;
+using namespace Cm;
+
+#define CM_MEMORY_TRACKER_SHARDS			64
+#define CM_MEMORY_TRACKER_INITIAL_CAPACITY	64
+#define CM_MEMORY_TRACKER_REMOVED			PxU64(0xffffffffffffffff)
+
+namespace
+{
+	// The bookkeeping of the listener must not be reported to the listener itself, so it goes straight to the user allocator.
+	class UntrackedAllocator
+	{
+	public:
+		UntrackedAllocator(const char* = 0)	{}
+
+		void* allocate(size_t size, const char* file, int line)
+		{
+			return Ps::getFoundation().getAllocatorCallback().allocate(size, "Cm::MemoryTracker", file, line);
+		}
+
+		void deallocate(void* ptr)
+		{
+			if(ptr)
+				Ps::getFoundation().getAllocatorCallback().deallocate(ptr);
+		}
+	};
+
+	typedef Ps::MutexT<UntrackedAllocator> TrackerMutex;
+
+	struct LiveAllocation
+	{
+		MemoryTracker*	tracker;
+		size_t			size;
+		PxU32			category;
+	};
+
+	typedef Ps::HashMap<const void*, LiveAllocation, Ps::Hash<const void*>, UntrackedAllocator> LiveAllocationMap;
+
+	// Blocks are spread over the shards by address, each shard has its own lock
+	struct LiveAllocationShard
+	{
+		LiveAllocationShard() : mNbLiveAllocations(0)	{}
+
+		TrackerMutex		mMutex;
+		LiveAllocationMap	mLiveAllocations;
+		volatile PxI32		mNbLiveAllocations;
+	};
+
+	// Open addressing table from context IDs to trackers. Lookups do not lock. Tables are replaced, never resized in
+	// place, and replaced tables stay allocated until the listener goes away so that concurrent lookups remain valid.
+	struct TrackerTable
+	{
+		PxU32						mCapacity;
+		PxU32						mNbUsedSlots;
+		volatile PxU64*				mContextIDs;
+		MemoryTracker* volatile*	mTrackers;
+		TrackerTable*				mPrevious;
+	};
+
+	TrackerTable* createTrackerTable(PxU32 capacity, TrackerTable* previous)
+	{
+		const size_t size = sizeof(TrackerTable) + capacity * (sizeof(PxU64) + sizeof(MemoryTracker*));
+		TrackerTable* table = reinterpret_cast<TrackerTable*>(UntrackedAllocator().allocate(size, __FILE__, __LINE__));
+		table->mCapacity = capacity;
+		table->mNbUsedSlots = 0;
+		table->mContextIDs = reinterpret_cast<PxU64*>(table + 1);
+		table->mTrackers = reinterpret_cast<MemoryTracker**>(const_cast<PxU64*>(table->mContextIDs) + capacity);
+		table->mPrevious = previous;
+		PxMemZero(const_cast<PxU64*>(table->mContextIDs), capacity * sizeof(PxU64));
+		PxMemZero(const_cast<MemoryTracker**>(table->mTrackers), capacity * sizeof(MemoryTracker*));
+		return table;
+	}
+
+	PX_FORCE_INLINE PxU32 getSlot(const TrackerTable& table, PxU64 contextID)
+	{
+		return Ps::hash(contextID) & (table.mCapacity - 1);
+	}
+
+	// the caller makes the table visible to lookups
+	void insertTracker(TrackerTable& table, PxU64 contextID, MemoryTracker* tracker)
+	{
+		PxU32 slot = getSlot(table, contextID);
+		while(table.mContextIDs[slot])
+			slot = (slot + 1) & (table.mCapacity - 1);
+
+		table.mTrackers[slot] = tracker;
+		Ps::memoryBarrier();
+		table.mContextIDs[slot] = contextID;
+		table.mNbUsedSlots++;
+	}
+
+	class TrackingListener : public Ps::AllocationListener
+	{
+		PX_NOCOPY(TrackingListener)
+	public:
+		TrackingListener() : mTrackerTls(Ps::TlsAlloc()), mCategoryTls(Ps::TlsAlloc()), mNbTrackers(0)
+		{
+			mTrackerTable = createTrackerTable(CM_MEMORY_TRACKER_INITIAL_CAPACITY, NULL);
+		}
+
+		virtual ~TrackingListener()
+		{
+			TrackerTable* table = mTrackerTable;
+			while(table)
+			{
+				TrackerTable* previous = table->mPrevious;
+				UntrackedAllocator().deallocate(table);
+				table = previous;
+			}
+
+			Ps::TlsFree(mCategoryTls);
+			Ps::TlsFree(mTrackerTls);
+		}
+
+		MemoryTracker* setCurrentTracker(MemoryTracker* tracker, PxU32 category, PxU32& previousCategory)
+		{
+			MemoryTracker* previous = reinterpret_cast<MemoryTracker*>(Ps::TlsGet(mTrackerTls));
+			previousCategory = PxU32(Ps::TlsGetValue(mCategoryTls));
+			Ps::TlsSet(mTrackerTls, tracker);
+			Ps::TlsSetValue(mCategoryTls, category);
+			return previous;
+		}
+
+		MemoryTracker* getCurrentTracker() const
+		{
+			return reinterpret_cast<MemoryTracker*>(Ps::TlsGet(mTrackerTls));
+		}
+
+		PxU32 getCurrentCategory() const
+		{
+			return Ps::TlsGet(mTrackerTls) ? PxU32(Ps::TlsGetValue(mCategoryTls)) : PxU32(PxSceneMemoryCategory::eOTHER);
+		}
+
+		virtual void onAllocationRequest(size_t size, const char* /*typeName*/, const char* /*filename*/, int /*line*/)
+		{
+			MemoryTracker* tracker = reinterpret_cast<MemoryTracker*>(Ps::TlsGet(mTrackerTls));
+			if(tracker)
+				tracker->allocationRequested(PxU32(Ps::TlsGetValue(mCategoryTls)), size);
+		}
+
+		virtual void onAllocation(size_t size, const char* /*typeName*/, const char* /*filename*/, int /*line*/, void* allocatedMemory)
+		{
+			MemoryTracker* tracker = reinterpret_cast<MemoryTracker*>(Ps::TlsGet(mTrackerTls));
+			if(!tracker || !allocatedMemory)
+				return;
+
+			const PxU32 category = PxU32(Ps::TlsGetValue(mCategoryTls));
+			const LiveAllocation allocation = { tracker, size, category };
+
+			LiveAllocationShard& shard = getShard(allocatedMemory);
+			TrackerMutex::ScopedLock lock(shard.mMutex);
+			shard.mLiveAllocations.insert(allocatedMemory, allocation);
+			shard.mNbLiveAllocations = PxI32(shard.mLiveAllocations.size());
+			tracker->allocated(category, size);
+		}
+
+		virtual void onDeallocation(void* allocatedMemory)
+		{
+			if(!allocatedMemory)
+				return;
+
+			// the deallocation of a tracked block cannot race with its own allocation, so an empty shard can be skipped without locking
+			LiveAllocationShard& shard = getShard(allocatedMemory);
+			if(!shard.mNbLiveAllocations)
+				return;
+
+			// the tracker is credited under the lock, releaseTracker() cannot delete it meanwhile
+			TrackerMutex::ScopedLock lock(shard.mMutex);
+			LiveAllocationMap::Entry entry;
+			if(shard.mLiveAllocations.erase(allocatedMemory, entry))
+			{
+				entry.second.tracker->deallocated(entry.second.category, entry.second.size);
+				shard.mNbLiveAllocations = PxI32(shard.mLiveAllocations.size());
+			}
+		}
+
+		// forgets the blocks of a tracker which goes away. They are simply not reported when they are freed.
+		void releaseTracker(const MemoryTracker* tracker)
+		{
+			for(PxU32 i=0; i<CM_MEMORY_TRACKER_SHARDS; i++)
+			{
+				LiveAllocationShard& shard = mShards[i];
+				TrackerMutex::ScopedLock lock(shard.mMutex);
+				LiveAllocationMap::EraseIterator it = shard.mLiveAllocations.getEraseIterator();
+				LiveAllocationMap::Entry* entry = it.eraseCurrentGetNext(false);
+				while(entry)
+					entry = it.eraseCurrentGetNext(entry->second.tracker == tracker);
+				shard.mNbLiveAllocations = PxI32(shard.mLiveAllocations.size());
+			}
+		}
+
+		void registerTracker(MemoryTracker* tracker, PxU64 contextID)
+		{
+			TrackerMutex::ScopedLock lock(mRegistryMutex);
+
+			TrackerTable* table = mTrackerTable;
+			if((table->mNbUsedSlots + 1) * 2 > table->mCapacity)
+			{
+				// rebuild without the removed entries, growing if needed
+				PxU32 capacity = CM_MEMORY_TRACKER_INITIAL_CAPACITY;
+				while(capacity < PxU32(mNbTrackers + 1) * 4)
+					capacity *= 2;
+
+				TrackerTable* newTable = createTrackerTable(capacity, table);
+				for(PxU32 i=0; i<table->mCapacity; i++)
+				{
+					if(table->mTrackers[i])
+						insertTracker(*newTable, table->mContextIDs[i], table->mTrackers[i]);
+				}
+				Ps::memoryBarrier();
+				mTrackerTable = table = newTable;
+			}
+
+			insertTracker(*table, contextID, tracker);
+			Ps::atomicIncrement(&mNbTrackers);
+		}
+
+		void unregisterTracker(PxU64 contextID)
+		{
+			TrackerMutex::ScopedLock lock(mRegistryMutex);
+
+			TrackerTable* table = mTrackerTable;
+			PxU32 slot = getSlot(*table, contextID);
+			while(table->mContextIDs[slot])
+			{
+				if(table->mContextIDs[slot] == contextID)
+				{
+					// the slot keeps breaking the probe sequences of the other entries until the table is rebuilt
+					table->mContextIDs[slot] = CM_MEMORY_TRACKER_REMOVED;
+					Ps::memoryBarrier();
+					table->mTrackers[slot] = NULL;
+					Ps::atomicDecrement(&mNbTrackers);
+					return;
+				}
+				slot = (slot + 1) & (table->mCapacity - 1);
+			}
+		}
+
+		// Lookups only return the tracker of the caller's own context, which cannot be unregistered while that context
+		// runs tasks. Other contexts may register and unregister concurrently.
+		MemoryTracker* findTracker(PxU64 contextID) const
+		{
+			if(!mNbTrackers)
+				return NULL;
+
+			const TrackerTable* table = mTrackerTable;
+			PxU32 slot = getSlot(*table, contextID);
+			for(;;)
+			{
+				const PxU64 id = table->mContextIDs[slot];
+				if(id == contextID)
+					return table->mTrackers[slot];
+				if(!id)
+					return NULL;
+				slot = (slot + 1) & (table->mCapacity - 1);
+			}
+		}
+
+	private:
+		PX_FORCE_INLINE LiveAllocationShard& getShard(const void* allocatedMemory)
+		{
+			// allocations are 16-byte aligned, the low bits carry no information
+			return mShards[Ps::hash(size_t(allocatedMemory) >> 4) & (CM_MEMORY_TRACKER_SHARDS - 1)];
+		}
+
+		const PxU32				mTrackerTls;
+		const PxU32				mCategoryTls;
+		LiveAllocationShard		mShards[CM_MEMORY_TRACKER_SHARDS];
+		TrackerMutex			mRegistryMutex;
+		TrackerTable* volatile	mTrackerTable;
+		volatile PxI32			mNbTrackers;
+	};
+
+	// Created with the first tracker and kept until the SDK is released, see releaseMemoryTracking(). The tasks of every
+	// context look the listener up without any synchronization, so it must outlive the trackers of all scenes.
+	TrackingListener* volatile	gListener = NULL;
+
+	void destroyListener(TrackingListener* listener)
+	{
+		listener->~TrackingListener();
+		UntrackedAllocator().deallocate(listener);
+	}
+
+	TrackingListener& getListener()
+	{
+		TrackingListener* listener = gListener;
+		if(listener)
+			return *listener;
+
+		void* memory = UntrackedAllocator().allocate(sizeof(TrackingListener), __FILE__, __LINE__);
+		TrackingListener* newListener = PX_PLACEMENT_NEW(memory, TrackingListener)();
+		listener = reinterpret_cast<TrackingListener*>(Ps::atomicCompareExchangePointer((volatile void**)(&gListener), newListener, NULL));
+		if(listener)
+		{
+			// another thread created the first tracker concurrently
+			destroyListener(newListener);
+			return *listener;
+		}
+
+		Ps::getFoundation().registerAllocationListener(*newListener);
+		return *newListener;
+	}
+
+	PX_FORCE_INLINE PxU64 read(const volatile PxI64& value)
+	{
+		return PxU64(Ps::atomicAdd64(const_cast<volatile PxI64*>(&value), 0));
+	}
+}
+
+MemoryTracker* Cm::getMemoryTracker(PxU64 contextID)
+{
+	const TrackingListener* listener = gListener;
+	return listener ? listener->findTracker(contextID) : NULL;
+}
+
+MemoryTracker* Cm::setCurrentMemoryTracker(MemoryTracker* tracker, PxU32 category, PxU32& previousCategory)
+{
+	PX_ASSERT(gListener);
+	return gListener->setCurrentTracker(tracker, category, previousCategory);
+}
+
+MemoryTracker* Cm::getCurrentMemoryTracker()
+{
+	const TrackingListener* listener = gListener;
+	return listener ? listener->getCurrentTracker() : NULL;
+}
+
+PxU32 Cm::getCurrentMemoryCategory()
+{
+	const TrackingListener* listener = gListener;
+	return listener ? listener->getCurrentCategory() : PxU32(PxSceneMemoryCategory::eOTHER);
+}
+
+void Cm::releaseMemoryTracking()
+{
+	TrackingListener* listener = gListener;
+	if(!listener)
+		return;
+
+	Ps::getFoundation().deregisterAllocationListener(*listener);
+	destroyListener(listener);
+	gListener = NULL;
+}
+
+MemoryTracker::MemoryTracker() :
+	mScene						(NULL),
+	mContextID					(0),
+	mTotalLiveBytes				(0),
+	mTotalPeakBytes				(0),
+	mNbFrameAllocations			(0),
+	mFrameAllocatedBytes		(0),
+	mNbLastFrameAllocations		(0),
+	mLastFrameAllocatedBytes	(0),
+	mBudget						(0),
+	mBudgetCallback				(NULL),
+	mNbBudgetExceeded			(0),
+	mOverBudget					(0)
+{
+	for(PxU32 i=0; i<PxSceneMemoryCategory::eCOUNT; i++)
+	{
+		mLiveBytes[i] = 0;
+		mPeakBytes[i] = 0;
+	}
+
+	getListener();
+}
+
+MemoryTracker::~MemoryTracker()
+{
+	TrackingListener& listener = getListener();
+	if(mContextID)
+		listener.unregisterTracker(mContextID);
+	listener.releaseTracker(this);
+}
+
+void MemoryTracker::registerContext(PxU64 contextID, PxScene& scene)
+{
+	PX_ASSERT(!mContextID && contextID);
+	mScene = &scene;
+	mContextID = contextID;
+	getListener().registerTracker(this, contextID);
+}
+
+void MemoryTracker::setBudget(PxU64 budget, PxSceneMemoryBudgetCallback* callback)
+{
+	mBudget = budget;
+	mBudgetCallback = callback;
+	mOverBudget = budget && read(mTotalLiveBytes) > budget;
+}
+
+void MemoryTracker::startFrame()
+{
+	mNbLastFrameAllocations = PxU32(Ps::atomicExchange(&mNbFrameAllocations, 0));
+	const PxI64 frameAllocatedBytes = PxI64(read(mFrameAllocatedBytes));
+	Ps::atomicAdd64(&mFrameAllocatedBytes, -frameAllocatedBytes);
+	mLastFrameAllocatedBytes = PxU64(frameAllocatedBytes);
+}
+
+void MemoryTracker::getStats(PxSceneMemoryStats& stats) const
+{
+	for(PxU32 i=0; i<PxSceneMemoryCategory::eCOUNT; i++)
+	{
+		stats.liveBytes[i] = read(mLiveBytes[i]);
+		stats.peakBytes[i] = read(mPeakBytes[i]);
+	}
+	stats.totalLiveBytes = read(mTotalLiveBytes);
+	stats.totalPeakBytes = read(mTotalPeakBytes);
+	stats.nbFrameAllocations = mNbLastFrameAllocations;
+	stats.frameAllocatedBytes = mLastFrameAllocatedBytes;
+	stats.budget = mBudget;
+	stats.nbBudgetExceeded = PxU32(mNbBudgetExceeded);
+}
+
+void MemoryTracker::allocationRequested(PxU32 category, size_t size)
+{
+	const PxU64 budget = mBudget;
+	if(!budget || mOverBudget)
+		return;
+
+	const PxU64 liveBytes = read(mTotalLiveBytes) + size;
+	if(liveBytes <= budget)
+		return;
+
+	// only the first thread crossing the budget reports it
+	if(Ps::atomicCompareExchange(&mOverBudget, 1, 0))
+		return;
+
+	Ps::atomicIncrement(&mNbBudgetExceeded);
+
+	// the callback may log or allocate
+	PxSceneMemoryBudgetCallback* callback = mBudgetCallback;
+	if(callback && mScene)
+		callback->onBudgetExceeded(*mScene, PxSceneMemoryCategory::Enum(category), size, liveBytes, budget);
+}
+
+void MemoryTracker::allocated(PxU32 category, size_t size)
+{
+	const PxI64 bytes = PxI64(size);
+	Ps::atomicMax64(&mPeakBytes[category], Ps::atomicAdd64(&mLiveBytes[category], bytes));
+	Ps::atomicMax64(&mTotalPeakBytes, Ps::atomicAdd64(&mTotalLiveBytes, bytes));
+	Ps::atomicIncrement(&mNbFrameAllocations);
+	Ps::atomicAdd64(&mFrameAllocatedBytes, bytes);
+}
+
+void MemoryTracker::deallocated(PxU32 category, size_t size)
+{
+	const PxI64 bytes = PxI64(size);
+	PX_ASSERT(read(mLiveBytes[category]) >= size);
+	Ps::atomicAdd64(&mLiveBytes[category], -bytes);
+	const PxU64 liveBytes = PxU64(Ps::atomicAdd64(&mTotalLiveBytes, -bytes));
+	if(mOverBudget && liveBytes <= mBudget)
+		Ps::atomicExchange(&mOverBudget, 0);
+}
@@ -0,0 +1,194 @@
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Copyright (c) 2008-2018 NVIDIA Corporation. All rights reserved.
+// Copyright (c) 2004-2008 AGEIA Technologies, Inc. All rights reserved.
+// Copyright (c) 2001-2004 NovodeX AG. All rights reserved.  
+
+
+#ifndef PX_PHYSICS_COMMON_MEMORY_TRACKER
+#define PX_PHYSICS_COMMON_MEMORY_TRACKER
+
+#include "PxSceneMemory.h"
+#include "CmPhysXCommon.h"
+#include "PsUserAllocated.h"
+
+namespace physx
+{
+namespace Cm
+{
+	/**
+	\brief Records the allocations made on behalf of one simulation context.
+
+	Trackers register a listener with the foundation allocator. An allocation is charged to the tracker and the
+	PxSceneMemoryCategory which are current on the allocating thread, see MemoryTrackingScope, and is credited back on
+	deallocation, from whichever thread that happens. Blocks allocated while no tracker was current are never charged
+	or credited.
+
+	The counters are updated atomically and the record of live blocks is split into independently locked shards, so
+	that threads allocating and freeing concurrently rarely wait on each other.
+
+	The listener is created with the first tracker and stays registered until releaseMemoryTracking(), so that
+	trackers can be created and released while other contexts simulate.
+	*/
+	class PX_PHYSX_COMMON_API MemoryTracker : public Ps::UserAllocated
+	{
+		PX_NOCOPY(MemoryTracker)
+	public:
+								MemoryTracker();
+								~MemoryTracker();
+
+				// Makes the tracker current for the tasks and API calls of a context. Until then allocations can only be
+				// charged to it with an explicit MemoryTrackingScope, e.g. while the scene is being created.
+				void			registerContext(PxU64 contextID, PxScene& scene);
+
+				void			setBudget(PxU64 budget, PxSceneMemoryBudgetCallback* callback);
+				void			startFrame();
+				void			getStats(PxSceneMemoryStats& stats) const;
+
+				// called by the allocation listener, from any thread
+				void			allocationRequested(PxU32 category, size_t size);
+				void			allocated(PxU32 category, size_t size);
+				void			deallocated(PxU32 category, size_t size);
+
+	private:
+				PxScene*						mScene;
+				PxU64							mContextID;
+				volatile PxI64					mLiveBytes[PxSceneMemoryCategory::eCOUNT];
+				volatile PxI64					mPeakBytes[PxSceneMemoryCategory::eCOUNT];
+				volatile PxI64					mTotalLiveBytes;
+				volatile PxI64					mTotalPeakBytes;
+				volatile PxI32					mNbFrameAllocations;
+				volatile PxI64					mFrameAllocatedBytes;
+				PxU32							mNbLastFrameAllocations;
+				PxU64							mLastFrameAllocatedBytes;
+				PxU64							mBudget;
+				PxSceneMemoryBudgetCallback*	mBudgetCallback;
+				volatile PxI32					mNbBudgetExceeded;
+				volatile PxI32					mOverBudget;
+	};
+
+	/**
+	\brief Deregisters and destroys the allocation listener of the trackers.
+
+	Called when the SDK is released, after all scenes and their trackers are gone.
+	*/
+	PX_PHYSX_COMMON_API void releaseMemoryTracking();
+
+	/**
+	\brief Returns the tracker registered for a context, or NULL.
+	*/
+	PX_PHYSX_COMMON_API MemoryTracker* getMemoryTracker(PxU64 contextID);
+
+	/**
+	\brief Makes a tracker and a category current on the calling thread. Returns the previously current tracker and category.
+	*/
+	PX_PHYSX_COMMON_API MemoryTracker* setCurrentMemoryTracker(MemoryTracker* tracker, PxU32 category, PxU32& previousCategory);
+
+	/**
+	\brief Returns the tracker current on the calling thread, or NULL.
+	*/
+	PX_PHYSX_COMMON_API MemoryTracker* getCurrentMemoryTracker();
+
+	/**
+	\brief Returns the category current on the calling thread, or PxSceneMemoryCategory::eOTHER when no tracker is current.
+
+	Tasks created without an explicit category pick the category of the thread creating them with this.
+	*/
+	PX_PHYSX_COMMON_API PxU32 getCurrentMemoryCategory();
+
+	/**
+	\brief Charges the allocations of the calling thread to a tracker and a category for the lifetime of the scope.
+
+	Costs a lookup in the tracker registry when a tracker is registered for any context.
+	*/
+	class MemoryTrackingScope
+	{
+		PX_NOCOPY(MemoryTrackingScope)
+	public:
+		PX_FORCE_INLINE	MemoryTrackingScope(PxU64 contextID, PxU32 category) : mPrevious(NULL), mPreviousCategory(0)
+		{
+			mTracker = getMemoryTracker(contextID);
+			if(mTracker)
+				mPrevious = setCurrentMemoryTracker(mTracker, category, mPreviousCategory);
+		}
+
+		PX_FORCE_INLINE	MemoryTrackingScope(MemoryTracker* tracker, PxU32 category) : mTracker(tracker), mPrevious(NULL), mPreviousCategory(0)
+		{
+			if(mTracker)
+				mPrevious = setCurrentMemoryTracker(mTracker, category, mPreviousCategory);
+		}
+
+		PX_FORCE_INLINE	~MemoryTrackingScope()
+		{
+			if(mTracker)
+			{
+				PxU32 category;
+				setCurrentMemoryTracker(mPrevious, mPreviousCategory, category);
+			}
+		}
+
+	private:
+		MemoryTracker*	mTracker;
+		MemoryTracker*	mPrevious;
+		PxU32			mPreviousCategory;
+	};
+
+	/**
+	\brief Charges the allocations of the calling thread to another category for the lifetime of the scope.
+
+	For work of one subsystem done synchronously by another one, e.g. scene query structures updated while results are
+	fetched. Does nothing when no tracker is current.
+	*/
+	class MemoryCategoryScope
+	{
+		PX_NOCOPY(MemoryCategoryScope)
+	public:
+		PX_FORCE_INLINE	MemoryCategoryScope(PxU32 category) : mPreviousCategory(0)
+		{
+			mTracker = getCurrentMemoryTracker();
+			if(mTracker)
+				setCurrentMemoryTracker(mTracker, category, mPreviousCategory);
+		}
+
+		PX_FORCE_INLINE	~MemoryCategoryScope()
+		{
+			if(mTracker)
+			{
+				PxU32 category;
+				setCurrentMemoryTracker(mTracker, mPreviousCategory, category);
+			}
+		}
+
+	private:
+		MemoryTracker*	mTracker;
+		PxU32			mPreviousCategory;
+	};
+
+} // namespace Cm
+
+}
+
+#endif
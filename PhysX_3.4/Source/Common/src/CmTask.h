@@ -38,6 +38,9 @@
 #include "PsMutex.h"
 #include "PsInlineArray.h"
 #include "PsFPU.h"
+#include "foundation/PxMath.h"
+#include "CmTaskGraphRecorder.h"
+#include "CmMemoryTracker.h"
 
 namespace physx
 {
@@ -48,10 +51,18 @@ namespace Cm
 	// this and override the runInternal() method
 	// to ensure that the correct floating point 
 	// state is set / reset during execution
+	// allocations made while the task runs are charged to the memory category
+	// given at construction, or else to the category current on the thread
+	// creating the task, see Cm::MemoryTracker
 	class Task : public physx::PxLightCpuTask
 	{
 	public:
-		Task(PxU64 contextId)
+		Task(PxU64 contextId) : mMemoryCategory(getCurrentMemoryCategory())
+		{
+			mContextID = contextId;
+		}
+
+		Task(PxU64 contextId, PxSceneMemoryCategory::Enum memoryCategory) : mMemoryCategory(memoryCategory)
 		{
 			mContextID = contextId;
 		}
@@ -63,10 +74,24 @@ namespace Cm
 #else
 			PX_SIMD_GUARD;
 #endif
-			runInternal();
+			MemoryTrackingScope memoryScope(mContextID, mMemoryCategory);
+			TaskGraphRecorder* recorder = getTaskGraphRecorder(mContextID);
+			if(recorder)
+			{
+				// the continuation may be reset while running, grab it first
+				physx::PxBaseTask* cont = mCont;
+				const PxU32 eventIndex = recorder->taskStarted(*this);
+				runInternal();
+				recorder->taskEnded(eventIndex, &cont, cont ? 1u : 0u);
+			}
+			else
+				runInternal();
 		}
 
 		virtual void runInternal()=0;
+
+	protected:
+		PxU32	mMemoryCategory;
 	};
 
 	// same as Cm::Task but inheriting from physx::PxBaseTask
@@ -74,6 +99,13 @@ namespace Cm
 	class BaseTask : public physx::PxBaseTask
 	{
 	public:
+		BaseTask() : mMemoryCategory(getCurrentMemoryCategory())
+		{
+		}
+
+		BaseTask(PxSceneMemoryCategory::Enum memoryCategory) : mMemoryCategory(memoryCategory)
+		{
+		}
 
 		virtual void run()
 		{
@@ -82,10 +114,29 @@ namespace Cm
 #else
 			PX_SIMD_GUARD;
 #endif
-			runInternal();
+			MemoryTrackingScope memoryScope(mContextID, mMemoryCategory);
+			TaskGraphRecorder* recorder = getTaskGraphRecorder(mContextID);
+			if(recorder)
+			{
+				physx::PxBaseTask* successors[CM_TASK_GRAPH_MAX_SUCCESSORS];
+				const PxU32 nbSuccessors = getSuccessors(successors, CM_TASK_GRAPH_MAX_SUCCESSORS);
+				const PxU32 eventIndex = recorder->taskStarted(*this);
+				runInternal();
+				recorder->taskEnded(eventIndex, successors, nbSuccessors);
+			}
+			else
+				runInternal();
 		}
 
 		virtual void runInternal()=0;
+
+		/**
+		\brief Retrieves the tasks whose reference count is decremented when this task completes, for task graph recording.
+		*/
+		virtual PxU32 getSuccessors(physx::PxBaseTask** /*successors*/, PxU32 /*maxNbSuccessors*/) const { return 0; }
+
+	protected:
+		PxU32	mMemoryCategory;
 	};
 
 	template <class T, void (T::*Fn)(physx::PxBaseTask*) >
@@ -95,6 +146,8 @@ namespace Cm
 
 		DelegateTask(PxU64 contextID, T* obj, const char* name) : Cm::Task(contextID), mObj(obj), mName(name) { }
 
+		DelegateTask(PxU64 contextID, T* obj, const char* name, PxSceneMemoryCategory::Enum memoryCategory) : Cm::Task(contextID, memoryCategory), mObj(obj), mName(name) { }
+
 		virtual void runInternal()
 		{
 			(mObj->*Fn)(mCont);
@@ -127,6 +180,8 @@ namespace Cm
 	public:
 		FanoutTask(PxU64 contextID, const char* name) : Cm::BaseTask(), mRefCount(0), mName(name), mNotifySubmission(false) { mContextID = contextID; }
 
+		FanoutTask(PxU64 contextID, const char* name, PxSceneMemoryCategory::Enum memoryCategory) : Cm::BaseTask(memoryCategory), mRefCount(0), mName(name), mNotifySubmission(false) { mContextID = contextID; }
+
 		virtual void runInternal() {}
 
 		virtual const char* getName() const { return mName; }
@@ -176,6 +231,14 @@ namespace Cm
 			mTm = &tm;
 		}
 
+		virtual PxU32 getSuccessors(physx::PxBaseTask** successors, PxU32 maxNbSuccessors) const
+		{
+			const PxU32 nb = PxMin(mReferencesToRemove.size(), maxNbSuccessors);
+			for(PxU32 i=0; i < nb; ++i)
+				successors[i] = mReferencesToRemove[i];
+			return nb;
+		}
+
 		/**
 		Adds a dependent task. It also sets the task manager querying it from the dependent task.  
 		The refcount is incremented every time a dependent task is added.
@@ -249,6 +312,9 @@ namespace Cm
 		DelegateFanoutTask(PxU64 contextID, T* obj, const char* name) : 
 		  FanoutTask(contextID, name), mObj(obj) { }
 
+		DelegateFanoutTask(PxU64 contextID, T* obj, const char* name, PxSceneMemoryCategory::Enum memoryCategory) : 
+		  FanoutTask(contextID, name, memoryCategory), mObj(obj) { }
+
 		  virtual void runInternal()
 		  {
 			  physx::PxBaseTask* continuation = mReferencesToRemove.empty() ? NULL : mReferencesToRemove[0];
@@ -0,0 +1,345 @@
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Copyright (c) 2008-2018 NVIDIA Corporation. All rights reserved.
+// Copyright (c) 2004-2008 AGEIA Technologies, Inc. All rights reserved.
+// Copyright (c) 2001-2004 NovodeX AG. All rights reserved.  
+
+
+#include "CmTaskGraphRecorder.h"
+#include "task/PxTask.h"
+#include "PsAtomic.h"
+#include "PsFoundation.h"
+#include "PsThread.h"
+#include "PsTime.h"
+#include "PsSort.h"
+#include "foundation/PxMath.h"
+
+using namespace physx;
+using namespace Cm;
+
+#define CM_MAX_TASK_GRAPH_RECORDERS	64
+#define CM_TASK_GRAPH_SPAWN_SEARCH	256	// how far back to look for the task which spawned one without a recorded predecessor
+
+namespace
+{
+	// Lookups only compare context IDs and only return the recorder of the caller's own context, which cannot
+	// be unregistered while that context runs tasks. Other contexts may register and unregister concurrently.
+	TaskGraphRecorder* volatile	gRecorders[CM_MAX_TASK_GRAPH_RECORDERS];
+	volatile PxU64				gRecorderContextIDs[CM_MAX_TASK_GRAPH_RECORDERS];
+	volatile PxI32				gNbRecorders = 0;
+
+	void registerRecorder(TaskGraphRecorder* recorder, PxU64 contextID)
+	{
+		for(PxU32 i=0; i<CM_MAX_TASK_GRAPH_RECORDERS; i++)
+		{
+			if(!gRecorders[i] && Ps::atomicCompareExchangePointer((volatile void**)(&gRecorders[i]), recorder, NULL) == NULL)
+			{
+				gRecorderContextIDs[i] = contextID;
+				Ps::atomicIncrement(&gNbRecorders);
+				return;
+			}
+		}
+		Ps::getFoundation().error(PxErrorCode::eDEBUG_WARNING, __FILE__, __LINE__, "Too many task graph recorders, task graph recording will be disabled for this scene.");
+	}
+
+	void unregisterRecorder(TaskGraphRecorder* recorder)
+	{
+		for(PxU32 i=0; i<CM_MAX_TASK_GRAPH_RECORDERS; i++)
+		{
+			if(gRecorders[i] == recorder)
+			{
+				gRecorderContextIDs[i] = 0;
+				Ps::memoryBarrier();
+				gRecorders[i] = NULL;
+				Ps::atomicDecrement(&gNbRecorders);
+				return;
+			}
+		}
+	}
+
+	class EventStartTimeCompare
+	{
+	public:
+		EventStartTimeCompare(const PxU64* startTimes) : mStartTimes(startTimes)	{}
+
+		bool operator()(PxU32 a, PxU32 b) const
+		{
+			return mStartTimes[a] < mStartTimes[b] || (mStartTimes[a] == mStartTimes[b] && a < b);
+		}
+
+		const PxU64* mStartTimes;
+	};
+
+	struct TaskRun
+	{
+		const PxBaseTask*	task;
+		PxU64				startTime;
+		PxU32				index;	// in start time order
+	};
+
+	class TaskRunCompare
+	{
+	public:
+		bool operator()(const TaskRun& a, const TaskRun& b) const
+		{
+			return a.task < b.task || (a.task == b.task && a.index < b.index);
+		}
+	};
+}
+
+TaskGraphRecorder* Cm::getTaskGraphRecorder(PxU64 contextID)
+{
+	if(!gNbRecorders)
+		return NULL;
+
+	for(PxU32 i=0; i<CM_MAX_TASK_GRAPH_RECORDERS; i++)
+	{
+		if(gRecorderContextIDs[i] == contextID)
+			return gRecorders[i];
+	}
+	return NULL;
+}
+
+TaskGraphRecorder::TaskGraphRecorder(PxU64 contextID, PxU32 maxNbEvents) :
+	mContextID			(contextID),
+	mMaxNbEvents		(maxNbEvents),
+	mNbRawEvents		(0),
+	mNbDroppedEvents	(0),
+	mFrameValid			(false)
+{
+	mRawEvents = maxNbEvents ? reinterpret_cast<RawEvent*>(PX_ALLOC(sizeof(RawEvent)*maxNbEvents, "TaskGraphRawEvents")) : NULL;
+	mEvents.reserve(maxNbEvents);
+	registerRecorder(this, contextID);
+}
+
+TaskGraphRecorder::~TaskGraphRecorder()
+{
+	unregisterRecorder(this);
+	if(mRawEvents)
+		PX_FREE(mRawEvents);
+}
+
+void TaskGraphRecorder::startFrame()
+{
+	mNbRawEvents = 0;
+	mNbDroppedEvents = 0;
+	mFrameValid = false;
+}
+
+PxU32 TaskGraphRecorder::taskStarted(const PxBaseTask& task)
+{
+	const PxU32 index = PxU32(Ps::atomicIncrement(&mNbRawEvents) - 1);
+	if(index >= mMaxNbEvents)
+	{
+		Ps::atomicIncrement(&mNbDroppedEvents);
+		return CM_TASK_GRAPH_INVALID_EVENT;
+	}
+
+	RawEvent& e = mRawEvents[index];
+	e.task = &task;
+	e.name = task.getName();
+	e.threadId = PxU64(Ps::Thread::getId());
+	e.endTime = 0;
+	e.nbSuccessors = 0;
+	e.startTime = Ps::Time::getCurrentCounterValue();
+	return index;
+}
+
+void TaskGraphRecorder::taskEnded(PxU32 eventIndex, PxBaseTask* const* successors, PxU32 nbSuccessors)
+{
+	if(eventIndex == CM_TASK_GRAPH_INVALID_EVENT)
+		return;
+
+	RawEvent& e = mRawEvents[eventIndex];
+	nbSuccessors = PxMin(nbSuccessors, PxU32(CM_TASK_GRAPH_MAX_SUCCESSORS));
+	for(PxU32 i=0; i<nbSuccessors; i++)
+		e.successors[i] = successors[i];
+	e.nbSuccessors = nbSuccessors;
+	e.endTime = PxMax(Ps::Time::getCurrentCounterValue(), e.startTime + 1);
+}
+
+void TaskGraphRecorder::endFrame()
+{
+	const PxU32 nbEvents = PxMin(PxU32(mNbRawEvents), mMaxNbEvents);
+
+	mEvents.clear();
+	mFrame.events = NULL;
+	mFrame.nbEvents = 0;
+	mFrame.nbDroppedEvents = PxU32(mNbDroppedEvents);
+	mFrame.nbThreads = 0;
+	mFrame.wallTime = 0.0f;
+	mFrame.totalWork = 0.0f;
+	mFrame.criticalPathLength = 0.0f;
+	mFrameValid = true;
+
+	if(!nbEvents)
+		return;
+
+	// tasks which have not signalled their end yet (typically the one which woke up the simulating thread) get a zero duration
+	Ps::Array<PxU64> startTimes(nbEvents), endTimes(nbEvents);
+	for(PxU32 i=0; i<nbEvents; i++)
+	{
+		startTimes[i] = mRawEvents[i].startTime;
+		endTimes[i] = mRawEvents[i].endTime ? mRawEvents[i].endTime : mRawEvents[i].startTime;
+	}
+
+	Ps::Array<PxU32> order(nbEvents);
+	for(PxU32 i=0; i<nbEvents; i++)
+		order[i] = i;
+	Ps::sort(order.begin(), nbEvents, EventStartTimeCompare(startTimes.begin()));
+
+	// runs of the same task object sorted by start time, to resolve continuation pointers to task executions
+	Ps::Array<TaskRun> runs(nbEvents);
+	for(PxU32 i=0; i<nbEvents; i++)
+	{
+		runs[i].task = mRawEvents[order[i]].task;
+		runs[i].startTime = startTimes[order[i]];
+		runs[i].index = i;
+	}
+	Ps::sort(runs.begin(), nbEvents, TaskRunCompare());
+
+	// path[i] is the length of the longest dependency chain ending with event i, including i
+	Ps::Array<PxU64> path(nbEvents, 0);
+	Ps::Array<PxU64> contPath(nbEvents, 0);
+	Ps::Array<PxU32> critPred(nbEvents, CM_TASK_GRAPH_INVALID_EVENT);
+	Ps::Array<PxU64> threadIds;
+
+	const Ps::CounterFrequencyToTensOfNanos freq = Ps::Time::getCounterFrequency();
+	const PxU64 frameStart = startTimes[order[0]];
+	PxU64 frameEnd = frameStart;
+	PxU64 totalWork = 0;
+	PxU32 critEnd = 0;
+
+	mEvents.resize(nbEvents);
+
+	for(PxU32 i=0; i<nbEvents; i++)
+	{
+		const RawEvent& raw = mRawEvents[order[i]];
+		const PxU64 start = startTimes[order[i]];
+		const PxU64 end = endTimes[order[i]];
+		const PxU64 duration = end - start;
+
+		PxU64 base = contPath[i];
+		if(critPred[i] == CM_TASK_GRAPH_INVALID_EVENT && i)
+		{
+			// No continuation edge into this task, so it was submitted directly by another task. Assume the spawning task
+			// is the most recent one running when this one started, or the last one to finish before it.
+			PxU32 parent = CM_TASK_GRAPH_INVALID_EVENT;
+			PxU64 latestEnd = 0;
+			const PxU32 first = i > CM_TASK_GRAPH_SPAWN_SEARCH ? i - CM_TASK_GRAPH_SPAWN_SEARCH : 0;
+			for(PxU32 j=i; j-- > first;)
+			{
+				const PxU64 pEnd = endTimes[order[j]];
+				if(pEnd >= start)
+				{
+					parent = j;
+					break;
+				}
+				if(pEnd > latestEnd)
+				{
+					latestEnd = pEnd;
+					parent = j;
+				}
+			}
+
+			if(parent != CM_TASK_GRAPH_INVALID_EVENT)
+			{
+				// the spawned task can only start once the parent has run up to the spawn point
+				const PxU64 pStart = startTimes[order[parent]];
+				const PxU64 pDuration = endTimes[order[parent]] - pStart;
+				base = PxMin(path[parent], path[parent] - pDuration + (start - pStart));
+				critPred[i] = parent;
+			}
+		}
+
+		path[i] = base + duration;
+		if(path[i] > path[critEnd])
+			critEnd = i;
+
+		// propagate to the next run of each continuation
+		for(PxU32 s=0; s<raw.nbSuccessors; s++)
+		{
+			TaskRun key;
+			key.task = raw.successors[s];
+			key.startTime = 0;
+			key.index = i+1;
+			const TaskRun* r = runs.begin();
+			PxU32 lo = 0, hi = nbEvents;
+			while(lo < hi)
+			{
+				const PxU32 mid = (lo + hi)/2;
+				if(TaskRunCompare()(r[mid], key))
+					lo = mid + 1;
+				else
+					hi = mid;
+			}
+			// first run of the continuation starting after this task ended
+			while(lo < nbEvents && r[lo].task == key.task && r[lo].startTime < end)
+				lo++;
+			if(lo < nbEvents && r[lo].task == key.task && path[i] >= contPath[r[lo].index])
+			{
+				contPath[r[lo].index] = path[i];
+				critPred[r[lo].index] = i;
+			}
+		}
+
+		PxU32 threadIndex = 0;
+		while(threadIndex < threadIds.size() && threadIds[threadIndex] != raw.threadId)
+			threadIndex++;
+		if(threadIndex == threadIds.size())
+			threadIds.pushBack(raw.threadId);
+
+		PxTaskGraphEvent& e = mEvents[i];
+		e.name = raw.name;
+		e.startTime = PxReal(freq.toTensOfNanos(start - frameStart)) * 0.01f;
+		e.endTime = PxReal(freq.toTensOfNanos(end - frameStart)) * 0.01f;
+		e.threadIndex = threadIndex;
+		e.criticalPredecessor = critPred[i];
+		e.onCriticalPath = false;
+
+		frameEnd = PxMax(frameEnd, end);
+		totalWork += duration;
+	}
+
+	for(PxU32 i=critEnd; i!=CM_TASK_GRAPH_INVALID_EVENT; i=critPred[i])
+		mEvents[i].onCriticalPath = true;
+
+	mFrame.events = mEvents.begin();
+	mFrame.nbEvents = nbEvents;
+	mFrame.nbThreads = threadIds.size();
+	mFrame.wallTime = PxReal(freq.toTensOfNanos(frameEnd - frameStart)) * 0.01f;
+	mFrame.totalWork = PxReal(freq.toTensOfNanos(totalWork)) * 0.01f;
+	mFrame.criticalPathLength = PxReal(freq.toTensOfNanos(path[critEnd])) * 0.01f;
+}
+
+bool TaskGraphRecorder::getFrame(PxTaskGraphFrame& frame) const
+{
+	if(!mFrameValid)
+		return false;
+
+	frame = mFrame;
+	return true;
+}
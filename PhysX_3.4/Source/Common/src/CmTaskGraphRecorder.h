@@ -0,0 +1,105 @@
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Copyright (c) 2008-2018 NVIDIA Corporation. All rights reserved.
+// Copyright (c) 2004-2008 AGEIA Technologies, Inc. All rights reserved.
+// Copyright (c) 2001-2004 NovodeX AG. All rights reserved.  
+
+
+#ifndef PX_PHYSICS_COMMON_TASK_GRAPH_RECORDER
+#define PX_PHYSICS_COMMON_TASK_GRAPH_RECORDER
+
+#include "PxTaskGraph.h"
+#include "CmPhysXCommon.h"
+#include "PsUserAllocated.h"
+#include "PsArray.h"
+
+namespace physx
+{
+class PxBaseTask;
+
+namespace Cm
+{
+	#define CM_TASK_GRAPH_MAX_SUCCESSORS	4
+	#define CM_TASK_GRAPH_INVALID_EVENT		0xffffffff
+
+	/**
+	\brief Records the execution of the internal tasks of one simulation context.
+
+	Cm::Task and Cm::BaseTask look up the recorder registered for their context ID when they run,
+	so recording costs nothing beyond that lookup when no recorder is registered. Events are
+	appended lock-free during the step. endFrame() then resolves the continuation edges, infers
+	the spawning task of tasks without a recorded predecessor, and computes the critical path.
+
+	startFrame(), endFrame() and getFrame() must not be called while tasks of the context run.
+	*/
+	class PX_PHYSX_COMMON_API TaskGraphRecorder : public Ps::UserAllocated
+	{
+		PX_NOCOPY(TaskGraphRecorder)
+	public:
+								TaskGraphRecorder(PxU64 contextID, PxU32 maxNbEvents);
+								~TaskGraphRecorder();
+
+				void			startFrame();
+				void			endFrame();
+
+				PxU32			taskStarted(const PxBaseTask& task);
+				void			taskEnded(PxU32 eventIndex, PxBaseTask* const* successors, PxU32 nbSuccessors);
+
+				bool			getFrame(PxTaskGraphFrame& frame) const;
+
+	private:
+		struct RawEvent
+		{
+			const PxBaseTask*	task;
+			const char*			name;
+			PxU64				threadId;
+			PxU64				startTime;
+			PxU64				endTime;	// 0 while running
+			const PxBaseTask*	successors[CM_TASK_GRAPH_MAX_SUCCESSORS];
+			PxU32				nbSuccessors;
+		};
+
+				PxU64			mContextID;
+				RawEvent*		mRawEvents;
+				PxU32			mMaxNbEvents;
+		volatile PxI32			mNbRawEvents;
+		volatile PxI32			mNbDroppedEvents;
+
+				Ps::Array<PxTaskGraphEvent>	mEvents;
+				PxTaskGraphFrame			mFrame;
+				bool						mFrameValid;
+	};
+
+	/**
+	\brief Returns the recorder registered for a context, or NULL.
+	*/
+	PX_PHYSX_COMMON_API TaskGraphRecorder* getTaskGraphRecorder(PxU64 contextID);
+
+} // namespace Cm
+
+}
+
+#endif
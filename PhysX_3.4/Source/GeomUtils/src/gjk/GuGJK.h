@@ -76,6 +76,8 @@ namespace Gu
 		normal				:normal pointing from ConvexA to ConvexB in the local space of ConvexB if acceptance threshold is sufficent large. Otherwise, it will be garbage
 		distance			:the distance of the closest points between ConvexA and ConvexB if acceptance threshold is sufficent large. Otherwise, it will be garbage
 		contactDist			:the distance which we will generate contact information if ConvexA and ConvexB are both separated within contactDist
+
+		gjk runs a single pair per call; there is no multi-pair (SoA) variant.
 	*/
 
 	//*Each convex has
@@ -140,6 +140,11 @@ namespace Gu
 			minMargin = PxMin(toleranceLength * BOX_MIN_MARGIN_RATIO, minMargin);
 		}
 
+		//! Copy constructor
+		PX_FORCE_INLINE BoxV(const BoxV& other) : ConvexV(other), extents(other.extents), marginDif(other.marginDif), minExtent(other.minExtent)
+		{
+		}
+
 		//! Assignment operator
 		PX_FORCE_INLINE const BoxV& operator=(const BoxV& other)
 		{
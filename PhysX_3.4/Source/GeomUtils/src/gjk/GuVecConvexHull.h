@@ -50,6 +50,8 @@ namespace Gu
 #define	CONVEX_SWEEP_MARGIN_RATIO	0.025f
 #define TOLERANCE_MARGIN_RATIO		0.08f
 #define TOLERANCE_MIN_MARGIN_RATIO	0.05f
+//hulls up to this many vertices use the brute force search even if they have hill climbing data. Above that, hill climbing is faster
+#define CONVEX_BRUTE_FORCE_LIMIT	32
 
 
 	//This margin is used in Persistent contact manifold
@@ -337,35 +339,59 @@ namespace Gu
 			return index;
 		}
 
+		//load 4 vertices starting at start and transpose them to SoA. Indices past the last vertex are clamped to the last vertex
+		PX_FORCE_INLINE void loadVertexBlock(const PxU32 start, Ps::aos::Vec4V& x, Ps::aos::Vec4V& y, Ps::aos::Vec4V& z)const
+		{
+			using namespace Ps::aos;
+			const PxU32 last = PxU32(numVerts - 1);
+			// PT: safe because of the way vertex memory is allocated in ConvexHullData (and 'verts' is initialized with ConvexHullData::getHullVertices())
+			Vec4V v0 = V4LoadU(&verts[start].x);
+			Vec4V v1 = V4LoadU(&verts[PxMin(start + 1, last)].x);
+			Vec4V v2 = V4LoadU(&verts[PxMin(start + 2, last)].x);
+			Vec4V v3 = V4LoadU(&verts[PxMin(start + 3, last)].x);
+			PX_TRANSPOSE_44_34(v0, v1, v2, v3, x, y, z);
+		}
+
 		PX_SUPPORT_INLINE PxU32 bruteForceSearch(const Ps::aos::Vec3VArg _dir)const 
 		{
 			using namespace Ps::aos;
 			//brute force
-			//get the support point from the orignal margin
-			FloatV max = V3Dot(V3LoadU_SafeReadW(verts[0]), _dir);	// PT: safe because of the way vertex memory is allocated in ConvexHullData (and 'verts' is initialized with ConvexHullData::getHullVertices())
-			PxU32 maxIndex=0;
-
-			// PT: TODO: not sure SIMD is useful here...
-
-			for(PxU32 i = 1; i < numVerts; ++i)
+			//get the support point from the orignal margin. We test 4 vertices at a time, each lane keeps its own maximum and the index of
+			//the first vertex reaching it, so we end up with the same vertex as testing them one by one
+			const Vec4V dirX = V4Splat(V3GetX(_dir));
+			const Vec4V dirY = V4Splat(V3GetY(_dir));
+			const Vec4V dirZ = V4Splat(V3GetZ(_dir));
+			const Vec4V four = V4Load(4.f);
+			const Vec4V lastIndex = V4Load(PxReal(numVerts - 1));
+
+			Vec4V x, y, z;
+			loadVertexBlock(0, x, y, z);
+			Vec4V max = V4MulAdd(z, dirZ, V4MulAdd(y, dirY, V4Mul(x, dirX)));
+			Vec4V index = V4LoadXYZW(0.f, 1.f, 2.f, 3.f);
+			Vec4V maxIndex = V4Min(index, lastIndex);
+
+			for(PxU32 i = 4; i < numVerts; i += 4)
 			{
-//				Ps::prefetchLine(&verts[i], 128);			// PT: TODO: 128 doesn't help when your cache line is 64. HW prefetchers do a better job here.
-				const Vec3V vertex = V3LoadU_SafeReadW(verts[i]);	// PT: safe because of the way vertex memory is allocated in ConvexHullData (and 'verts' is initialized with ConvexHullData::getHullVertices())
-				const FloatV dist = V3Dot(vertex, _dir);
-				if(FAllGrtr(dist, max))
-				{
-					max = dist;
-					maxIndex = i;
-				}
+				index = V4Add(index, four);
+				loadVertexBlock(i, x, y, z);
+				const Vec4V dist = V4MulAdd(z, dirZ, V4MulAdd(y, dirY, V4Mul(x, dirX)));
+				const BoolV con = V4IsGrtr(dist, max);
+				max = V4Sel(con, dist, max);
+				maxIndex = V4Sel(con, V4Min(index, lastIndex), maxIndex);
 			}
-			return maxIndex;
+
+			//several lanes might have reached the maximum, take the lowest index
+			const Vec4V candidates = V4Sel(V4IsEq(max, V4Splat(V4ExtractMax(max))), maxIndex, V4Splat(FMax()));
+			PxF32 result;
+			FStore(V4ExtractMin(candidates), &result);
+			return PxU32(result);
 		}
 
 		//points are in vertex space, _dir in vertex space
 		PX_NOINLINE PxU32 supportVertexIndex(const Ps::aos::Vec3VArg _dir)const
 		{
 			using namespace Ps::aos;
-			if(data)
+			if(data && numVerts > CONVEX_BRUTE_FORCE_LIMIT)
 				return hillClimbing(_dir);
 			else
 				return bruteForceSearch(_dir);
@@ -377,20 +403,25 @@ namespace Gu
 			using namespace Ps::aos;
 			//brute force
 			//get the support point from the orignal margin
-			FloatV _max = V3Dot(V3LoadU_SafeReadW(verts[0]), dir);	// PT: safe because of the way vertex memory is allocated in ConvexHullData (and 'verts' is initialized with ConvexHullData::getHullVertices())
-			FloatV _min = _max;
+			const Vec4V dirX = V4Splat(V3GetX(dir));
+			const Vec4V dirY = V4Splat(V3GetY(dir));
+			const Vec4V dirZ = V4Splat(V3GetZ(dir));
+
+			Vec4V x, y, z;
+			loadVertexBlock(0, x, y, z);
+			Vec4V _max = V4MulAdd(z, dirZ, V4MulAdd(y, dirY, V4Mul(x, dirX)));
+			Vec4V _min = _max;
 
-			for(PxU32 i = 1; i < numVerts; ++i)
+			for(PxU32 i = 4; i < numVerts; i += 4)
 			{ 
-//				Ps::prefetchLine(&verts[i], 128);			// PT: TODO: 128 doesn't help when your cache line is 64. HW prefetchers do a better job here.
-				const FloatV dist = V3Dot(V3LoadU_SafeReadW(verts[i]), dir);
-				_max = FMax(dist, _max);
-				_min = FMin(dist, _min);
+				loadVertexBlock(i, x, y, z);
+				const Vec4V dist = V4MulAdd(z, dirZ, V4MulAdd(y, dirY, V4Mul(x, dirX)));
+				_max = V4Max(dist, _max);
+				_min = V4Min(dist, _min);
 			}
 
-
-			min = _min;
-			max = _max;
+			min = V4ExtractMin(_min);
+			max = V4ExtractMax(_max);
 		}
 
 		//This function is used in the full contact manifold generation code, points are in vertex space.
@@ -402,7 +433,7 @@ namespace Gu
 			//dir is in the vertex space
 			const Vec3V dir = M33TrnspsMulV3(vertex2Shape, _dir);
 
-			if(data)
+			if(data && numVerts > CONVEX_BRUTE_FORCE_LIMIT)
 			{
 				const PxU32 maxIndex= hillClimbing(dir);
 				const PxU32 minIndex= hillClimbing(V3Neg(dir));
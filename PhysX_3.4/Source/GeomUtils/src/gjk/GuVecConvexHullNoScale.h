@@ -123,34 +123,12 @@ namespace Gu
 		}
 
 		
-		PX_SUPPORT_INLINE void bruteForceSearchMinMax(const Ps::aos::Vec3VArg _dir, Ps::aos::FloatV& min, Ps::aos::FloatV& max)const 
-		{
-			using namespace Ps::aos;
-			//brute force
-			//get the support point from the orignal margin
-			FloatV _max = V3Dot(V3LoadU_SafeReadW(verts[0]), _dir);	// PT: safe because of the way vertex memory is allocated in ConvexHullData (and 'verts' is initialized with ConvexHullData::getHullVertices())
-			FloatV _min = _max;
-
-			for(PxU32 i = 1; i < numVerts; ++i)
-			{ 
-				Ps::prefetchLine(&verts[i], 128);
-				const Vec3V vertex = V3LoadU_SafeReadW(verts[i]);	// PT: safe because of the way vertex memory is allocated in ConvexHullData (and 'verts' is initialized with ConvexHullData::getHullVertices())
-				const FloatV dist = V3Dot(vertex, _dir);
-
-				_max = FMax(dist, _max);
-				_min = FMin(dist, _min);
-			}
-
-			min = _min;
-			max = _max;
-		}
-
 		//This function support no scaling, dir is in the shape space(the same as vertex space)
 		PX_SUPPORT_INLINE void supportVertexMinMax(const Ps::aos::Vec3VArg dir, Ps::aos::FloatV& min, Ps::aos::FloatV& max)const
 		{
 			using namespace Ps::aos;
 
-			if(data)
+			if(data && numVerts > CONVEX_BRUTE_FORCE_LIMIT)
 			{
 				const PxU32 maxIndex= hillClimbing(dir);
 				const PxU32 minIndex= hillClimbing(V3Neg(dir));
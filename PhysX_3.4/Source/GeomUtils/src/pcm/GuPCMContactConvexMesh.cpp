@@ -43,6 +43,7 @@
 #include "GuPCMContactMeshCallback.h"
 #include "GuIntersectionTriangleBox.h"
 #include "GuBox.h"
+#include "PsAlloca.h"
 
 using namespace physx;
 using namespace Gu;
@@ -51,12 +52,19 @@ using namespace physx::shdfnd::aos;
 namespace physx
 {
 
+// Pairs whose midphase returns more triangles than this get the remaining triangles split into jobs of
+// PCM_MESH_TRIANGLES_PER_JOB triangles, when the caller provides a job dispatcher.
+#define	PCM_MESH_PARALLEL_TRIANGLE_THRESHOLD	256
+#define	PCM_MESH_TRIANGLES_PER_JOB				128
+
 struct PCMConvexVsMeshContactGenerationCallback : PCMMeshContactGenerationCallback<PCMConvexVsMeshContactGenerationCallback>
 {
 	PCMConvexVsMeshContactGenerationCallback& operator=(const PCMConvexVsMeshContactGenerationCallback&);
 public:
 	PCMConvexVsMeshContactGeneration	mGeneration;
 	const BoxPadded&					mBox;
+	Ps::Array<TriangleCache<CacheSize> >*	mDeferredCaches;
+	PxU32								mNbProcessedTriangles;
 
 	PCMConvexVsMeshContactGenerationCallback(
 		const Ps::aos::FloatVArg					contactDistance,
@@ -75,13 +83,16 @@ public:
 		bool										idtMeshScale,
 		bool										silhouetteEdgesAreActive,
 		const BoxPadded&							box,
+		Ps::Array<TriangleCache<CacheSize> >*		deferredCaches,
 		Cm::RenderOutput*							renderOutput = NULL
 		
 	) :
 		PCMMeshContactGenerationCallback<PCMConvexVsMeshContactGenerationCallback>(meshScaling, extraTriData, idtMeshScale),
 		mGeneration(contactDistance, replaceBreakingThreshold, convexTransform, meshTransform, multiManifold, contactBuffer, polyData, polyMap, 
 			delayedContacts, convexScaling, idtConvexScale, silhouetteEdgesAreActive, renderOutput),
-		mBox(box)
+		mBox(box),
+		mDeferredCaches(deferredCaches),
+		mNbProcessedTriangles(0)
 	{
 	}
 
@@ -94,18 +105,120 @@ public:
 	template<PxU32 CacheSize>
 	void processTriangleCache(TriangleCache<CacheSize>& cache)
 	{
+		// Once the threshold is reached, the triangles are kept for the jobs instead of being processed here
+		if(mDeferredCaches && mNbProcessedTriangles >= PCM_MESH_PARALLEL_TRIANGLE_THRESHOLD)
+		{
+			mDeferredCaches->pushBack(cache);
+			return;
+		}
+
+		mNbProcessedTriangles += cache.mNumTriangles;
 		mGeneration.processTriangleCache<CacheSize, PCMConvexVsMeshContactGeneration>(cache);
 	}
 	
 };
 
+// Generates contacts for a range of deferred triangle caches into a manifold of its own. The support functions of the
+// convex are const, so all jobs share it.
+template<class ConvexType>
+struct PCMConvexVsMeshRangeJob : public NarrowPhaseJob
+{
+	PCMConvexVsMeshRangeJob& operator=(const PCMConvexVsMeshRangeJob&);
+public:
+	static const PxU32 CacheSize = PCMConvexVsMeshContactGenerationCallback::CacheSize;
+	static const PxU32 NbCachesPerJob = PCM_MESH_TRIANGLES_PER_JOB/CacheSize;
+
+	const Ps::aos::FloatV						mContactDist;
+	const Ps::aos::FloatV						mReplaceBreakingThreshold;
+	const PsTransformV&							mConvexTransform;
+	const PsTransformV&							mMeshTransform;
+	const PolygonalData&						mPolyData;
+	const SupportLocalImpl<ConvexType>&			mPolyMap;
+	const Cm::FastVertex2ShapeScaling&			mConvexScaling;
+	bool										mIdtConvexScale;
+	TriangleCache<CacheSize>*					mCaches;
+	PxU32										mNbCaches;
+	MultiplePersistentContactManifold*			mManifolds;
+
+	PCMConvexVsMeshRangeJob(const Ps::aos::FloatVArg contactDist, const Ps::aos::FloatVArg replaceBreakingThreshold, const PsTransformV& convexTransform,
+		const PsTransformV& meshTransform, const PolygonalData& polyData, const SupportLocalImpl<ConvexType>& polyMap, const Cm::FastVertex2ShapeScaling& convexScaling,
+		bool idtConvexScale, TriangleCache<CacheSize>* caches, PxU32 nbCaches, MultiplePersistentContactManifold* manifolds) :
+		mContactDist(contactDist), mReplaceBreakingThreshold(replaceBreakingThreshold), mConvexTransform(convexTransform), mMeshTransform(meshTransform),
+		mPolyData(polyData), mPolyMap(polyMap), mConvexScaling(convexScaling), mIdtConvexScale(idtConvexScale), mCaches(caches), mNbCaches(nbCaches),
+		mManifolds(manifolds)
+	{
+	}
+
+	static PX_FORCE_INLINE PxU32 getNbJobs(PxU32 nbCaches)
+	{
+		return (nbCaches + NbCachesPerJob - 1)/NbCachesPerJob;
+	}
+
+	virtual void runJob(PxU32 jobIndex)
+	{
+		using namespace Ps::aos;
+
+		SupportLocalImpl<ConvexType> polyMap(mPolyMap.conv, mPolyMap.transform, mPolyMap.vertex2Shape, mPolyMap.shape2Vertex, mPolyMap.isIdentityScale);
+
+		MultiplePersistentContactManifold* manifold = PX_PLACEMENT_NEW(&mManifolds[jobIndex], MultiplePersistentContactManifold)();
+		manifold->initialize();
+
+		ContactBuffer contactBuffer;
+		Ps::InlineArray<PxU32, LOCAL_CONTACTS_SIZE> delayedContacts;
+		PCMConvexVsMeshContactGeneration generation(mContactDist, mReplaceBreakingThreshold, mConvexTransform, mMeshTransform, *manifold, contactBuffer,
+			mPolyData, &polyMap, &delayedContacts, mConvexScaling, mIdtConvexScale, true, NULL);
+
+		const PxU32 start = jobIndex*NbCachesPerJob;
+		const PxU32 end = PxMin(start + NbCachesPerJob, mNbCaches);
+		for(PxU32 i=start; i<end; ++i)
+			generation.processTriangleCache<CacheSize, PCMConvexVsMeshContactGeneration>(mCaches[i]);
+
+		generation.generateLastContacts();
+		generation.processContacts(GU_SINGLE_MANIFOLD_CACHE_SIZE, false);
+	}
+};
+
+// Feeds the contacts of a job's manifold back into the pair's contact generation, one patch per single manifold. The
+// contacts are already in mesh space so they go through the same patch merging and reduction as freshly generated ones.
+static void addPartialManifold(PCMConvexVsMeshContactGeneration& generation, MultiplePersistentContactManifold& partialManifold)
+{
+	using namespace Ps::aos;
+
+	for(PxU32 i=0; i<partialManifold.mNumManifolds; ++i)
+	{
+		SinglePersistentContactManifold& manifold = *partialManifold.getManifold(i);
+		const PxU32 numContacts = manifold.getNumContacts();
+		if(!numContacts)
+			continue;
+
+		const PxU32 previousNumContacts = generation.mNumContacts;
+		FloatV maxPen = FMax();
+		for(PxU32 j=0; j<numContacts; ++j)
+		{
+			const MeshPersistentContact& contact = manifold.getContactPoint(j);
+			maxPen = FMin(maxPen, V4GetW(contact.mLocalNormalPen));
+			generation.mManifoldContacts[generation.mNumContacts++] = contact;
+		}
+
+		const Vec3V patchNormal = Vec3V_From_Vec4V(manifold.getContactPoint(0).mLocalNormalPen);
+		generation.addManifoldPointToPatch(patchNormal, maxPen, previousNumContacts);
+
+		PX_ASSERT(generation.mNumContactPatch < PCM_MAX_CONTACTPATCH_SIZE);
+		if(generation.mNumContacts >= GU_MESH_CONTACT_REDUCTION_THRESHOLD)
+		{
+			PX_ASSERT(generation.mNumContacts <= ContactBuffer::MAX_CONTACTS);
+			generation.processContacts(GU_SINGLE_MANIFOLD_CACHE_SIZE);
+		}
+	}
+}
 
-bool Gu::PCMContactConvexMesh(const PolygonalData& polyData, SupportLocal* polyMap, const Ps::aos::FloatVArg minMargin, const PxBounds3& hullAABB, const PxTriangleMeshGeometryLL& shapeMesh,
+template<class ConvexType>
+static bool PCMContactConvexMesh(const PolygonalData& polyData, SupportLocalImpl<ConvexType>* polyMap, const Ps::aos::FloatVArg minMargin, const PxBounds3& hullAABB, const PxTriangleMeshGeometryLL& shapeMesh,
 						const PxTransform& transform0, const PxTransform& transform1,
 						PxReal contactDistance, ContactBuffer& contactBuffer,
 						const Cm::FastVertex2ShapeScaling& convexScaling, const Cm::FastVertex2ShapeScaling& meshScaling,
 						bool idtConvexScale, bool idtMeshScale, Gu::MultiplePersistentContactManifold& multiManifold,
-						Cm::RenderOutput* renderOutput)
+						NarrowPhaseJobDispatcher* jobDispatcher, Cm::RenderOutput* renderOutput)
 
 {
 	using namespace Ps::aos;
@@ -141,18 +254,36 @@ bool Gu::PCMContactConvexMesh(const PolygonalData& polyData, SupportLocal* polyM
 		// Setup the collider
 
 		Ps::InlineArray<PxU32,LOCAL_CONTACTS_SIZE> delayedContacts;
+		Ps::Array<TriangleCache<PCMConvexVsMeshContactGenerationCallback::CacheSize> > deferredCaches;
 		
 		const PxU8* PX_RESTRICT extraData = meshData->getExtraTrigData();
 		PCMConvexVsMeshContactGenerationCallback blockCallback(
 			contactDist, replaceBreakingThreshold, convexTransform, meshTransform, multiManifold, contactBuffer,
 			polyData, polyMap, &delayedContacts, convexScaling, idtConvexScale, meshScaling, extraData, idtMeshScale, true, 
-			hullOBB, renderOutput);
+			hullOBB, jobDispatcher ? &deferredCaches : NULL, renderOutput);
 
 		Midphase::intersectOBB(meshData, hullOBB, blockCallback, true);
 
 		PX_ASSERT(multiManifold.mNumManifolds <= GU_MAX_MANIFOLD_SIZE);
 
 		blockCallback.flushCache();
+
+		const PxU32 nbDeferredCaches = deferredCaches.size();
+		if(nbDeferredCaches)
+		{
+			typedef PCMConvexVsMeshRangeJob<ConvexType> RangeJob;
+			const PxU32 nbJobs = RangeJob::getNbJobs(nbDeferredCaches);
+
+			PX_ALLOCA(partialManifolds, MultiplePersistentContactManifold, nbJobs);
+			RangeJob job(contactDist, replaceBreakingThreshold, convexTransform, meshTransform, polyData, *polyMap, convexScaling, idtConvexScale,
+				deferredCaches.begin(), nbDeferredCaches, partialManifolds);
+			jobDispatcher->run(job, nbJobs);
+
+			// Reduce in job order so that the result doesn't depend on which thread ran which range
+			for(PxU32 i=0; i<nbJobs; ++i)
+				addPartialManifold(blockCallback.mGeneration, partialManifolds[i]);
+		}
+
 		//This is very important
 		blockCallback.mGeneration.generateLastContacts();
 		blockCallback.mGeneration.processContacts(GU_SINGLE_MANIFOLD_CACHE_SIZE, false);
@@ -206,14 +337,14 @@ bool Gu::pcmContactConvexMesh(GU_CONTACT_METHOD_ARGS)
 	if(idtScaleConvex)
 	{
 		SupportLocalImpl<Gu::ConvexHullNoScaleV> convexMap(static_cast<ConvexHullNoScaleV&>(convexHull), convexTransform, convexHull.vertex2Shape, convexHull.shape2Vertex, true);
-		return Gu::PCMContactConvexMesh(polyData, &convexMap, minMargin, hullAABB, shapeMesh,transform0,transform1, params.mContactDistance, contactBuffer, convexScaling,  
-			meshScaling, idtScaleConvex, idtScaleMesh, multiManifold, renderOutput);
+		return PCMContactConvexMesh(polyData, &convexMap, minMargin, hullAABB, shapeMesh,transform0,transform1, params.mContactDistance, contactBuffer, convexScaling,  
+			meshScaling, idtScaleConvex, idtScaleMesh, multiManifold, params.mJobDispatcher, renderOutput);
 	}
 	else
 	{
 		SupportLocalImpl<Gu::ConvexHullV> convexMap(convexHull, convexTransform, convexHull.vertex2Shape, convexHull.shape2Vertex, false);
-		return Gu::PCMContactConvexMesh(polyData, &convexMap, minMargin, hullAABB, shapeMesh,transform0,transform1, params.mContactDistance, contactBuffer, convexScaling,  
-			meshScaling, idtScaleConvex, idtScaleMesh, multiManifold, renderOutput);
+		return PCMContactConvexMesh(polyData, &convexMap, minMargin, hullAABB, shapeMesh,transform0,transform1, params.mContactDistance, contactBuffer, convexScaling,  
+			meshScaling, idtScaleConvex, idtScaleMesh, multiManifold, params.mJobDispatcher, renderOutput);
 	}
 }
 
@@ -252,8 +383,8 @@ bool Gu::pcmContactBoxMesh(GU_CONTACT_METHOD_ARGS)
 	Mat33V identity =  M33Identity();
 	SupportLocalImpl<BoxV> boxMap(boxV, boxTransform, identity, identity, true);
 
-	return Gu::PCMContactConvexMesh(polyData, &boxMap, minMargin, hullAABB, shapeMesh,transform0,transform1, params.mContactDistance, contactBuffer, idtScaling,  meshScaling, 
-		true, idtMeshScale, multiManifold, renderOutput);
+	return PCMContactConvexMesh(polyData, &boxMap, minMargin, hullAABB, shapeMesh,transform0,transform1, params.mContactDistance, contactBuffer, idtScaling,  meshScaling, 
+		true, idtMeshScale, multiManifold, params.mJobDispatcher, renderOutput);
 }
 
 }
@@ -41,17 +41,6 @@ namespace physx
 namespace Gu
 {
 
-	bool PCMContactConvexMesh(const Gu::PolygonalData& polyData0, 
-						Gu::SupportLocal* polyMap, 
-						const Ps::aos::FloatVArg minMargin, 
-						const PxBounds3& hullAABB, 
-						const PxTriangleMeshGeometryLL& shapeMesh,
-						const PxTransform& transform0, const PxTransform& transform1,
-						PxReal contactDistance, Gu::ContactBuffer& contactBuffer,
-						const Cm::FastVertex2ShapeScaling& convexScaling, const Cm::FastVertex2ShapeScaling& meshScaling,
-						bool idtConvexScale, bool idtMeshScale, Gu::MultiplePersistentContactManifold& multiManifold,
-						Cm::RenderOutput* renderOutput);
-
 	bool PCMContactConvexHeightfield(const Gu::PolygonalData& polyData0, 
 						Gu::SupportLocal* polyMap, 
 						const Ps::aos::FloatVArg minMargin, 
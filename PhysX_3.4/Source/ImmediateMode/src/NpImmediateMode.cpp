@@ -555,6 +555,7 @@ namespace physx
 		Dy::SolverContext cache;
 		cache.mThresholdStreamIndex = 0;
 		cache.mThresholdStreamLength = 0xFFFFFFF;
+		cache.residual = 0.0f;
 		
 		PX_ASSERT(nbPositionIterations > 0);
 		PX_ASSERT(nbVelocityIterations > 0);
@@ -35,6 +35,7 @@
 #include "foundation/PxMemory.h"
 #include "CmPhysXCommon.h"
 #include "PxGeometry.h"
+#include "PxSimulationStatistics.h"
 
 namespace physx
 {
@@ -91,6 +92,7 @@ struct PxvSimStats
 	PxU32	mNbDiscreteContactPairsTotal;		// PT: sum of mNbDiscreteContactPairs, i.e. number of pairs reaching narrow phase
 	PxU32	mNbDiscreteContactPairsWithCacheHits;
 	PxU32	mNbDiscreteContactPairsWithContacts;
+	PxU32	mNbDiscreteContactPairsReplayed;
 	PxU32	mNbActiveConstraints;
 	PxU32	mNbActiveDynamicBodies;
 	PxU32	mNbActiveKinematicBodies;
@@ -99,6 +101,9 @@ struct PxvSimStats
 	PxU32	mTotalCompressedContactSize;
 	PxU32	mTotalConstraintSize;
 	PxU32	mPeakConstraintBlockAllocations;
+	PxU32	mPeakContactDataBlocks;			// high-water mark of 16K blocks used by the PxcNpMemBlockPool this frame
+	PxU32	mNbNpArenaBlocks;				// 16K blocks held by the narrow phase thread arenas
+	PxU32	mNbNpArenaOverflowBlocks;		// 16K blocks the narrow phase thread arenas had to fetch from the pool this frame
 
 	PxU32	mNbNewPairs;
 	PxU32	mNbLostPairs;
@@ -107,6 +112,30 @@ struct PxvSimStats
 	PxU32	mNbLostTouches;
 
 	PxU32	mNbPartitions;
+
+	PxU32	mSolverPartitionWaitTime[PxSimulationStatistics::eMAX_SOLVER_BARRIER_PARTITIONS];	// microseconds the parallel solver threads waited before each partition
+	PxU32	mSolverFrictionPartitionWaitTime[PxSimulationStatistics::eMAX_SOLVER_BARRIER_PARTITIONS];	// same for the friction partitions of the patch friction models
+	PxU32	mSolverVelocitySaveWaitTime;
+	PxU32	mNbSolverBarrierWaits;
+	PxU32	mNbSolverBarrierYields;
+
+	PxU32	mNbSolverIslands;
+	PxU32	mNbSolverIslandsTerminatedEarly;
+	PxU32	mSolverPositionIterations;		// iterations actually run, summed over all islands
+	PxU32	mSolverVelocityIterations;
+	PxU32	mMaxSolverPositionIterations;
+	PxU32	mMaxSolverVelocityIterations;
+
+	PxU32	mNbSolverPartitions;			// summed over all islands
+	PxU32	mMaxSolverPartitions;
+	PxU32	mNbSolverMergedPartitions;
+	PxU32	mNbSolverConstraintBatches;
+	PxU32	mNbSolverBatchedConstraints;
+
+	PxU32	mNbCCDPasses;
+	PxU32	mCCDPassTime[PxSimulationStatistics::eMAX_CCD_PASSES];	// microseconds
+	PxU32	mNbCCDSweeps;					// summed over all passes
+	PxU32	mNbCCDSkippedSweeps;
 };
 
 }
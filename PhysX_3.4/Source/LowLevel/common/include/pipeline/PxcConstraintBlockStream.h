@@ -116,7 +116,7 @@ class PxcContactBlockStream
 	PX_NOCOPY(PxcContactBlockStream)
 public:
 	PxcContactBlockStream(PxcNpMemBlockPool & blockPool):
-		mBlockPool(blockPool),
+		mBlockArena(blockPool, PxcNpMemBlockArena::eCONTACTS),
 		mBlock(NULL),
 		mUsed(0)
 	{
@@ -127,13 +127,13 @@ public:
 											size = (size+15)&~15;
 
 											if(size>PxcNpMemBlock::SIZE)
-												return mBlockPool.acquireExceptionalConstraintMemory(size);
+												return mBlockArena.getMemBlockPool().acquireExceptionalConstraintMemory(size);
 
 											PX_ASSERT(size <= PxcNpMemBlock::SIZE);
 
 											if(mBlock == NULL || size+mUsed>PxcNpMemBlock::SIZE)
 											{
-												mBlock = mBlockPool.acquireContactBlock();
+												mBlock = mBlockArena.acquireBlock();
 												PX_ASSERT(0==mBlock || mBlock->data == reinterpret_cast<PxU8*>(mBlock));
 												mUsed = size;
 												return reinterpret_cast<PxU8*>(mBlock);
@@ -152,11 +152,14 @@ public:
 
 	PX_FORCE_INLINE PxcNpMemBlockPool&	getMemBlockPool()
 	{
-		return mBlockPool;
+		return mBlockArena.getMemBlockPool();
 	}
 
+	PX_FORCE_INLINE	const PxcNpMemBlockArena&	getMemBlockArena()	const	{ return mBlockArena;	}
+	PX_FORCE_INLINE	PxcNpMemBlockArena&			getMemBlockArena()			{ return mBlockArena;	}
+
 private:
-			PxcNpMemBlockPool&			mBlockPool;
+			PxcNpMemBlockArena			mBlockArena;	// thread-local blocks, overflows to the shared pool
 			PxcNpMemBlock*				mBlock;	// current constraint block
 			PxU32						mUsed;	// number of bytes used in constraint block
 };
@@ -41,6 +41,8 @@ struct PxcNpWorkUnit;
 class PxsContactManager;
 struct PxsContactManagerOutput;
 
+struct PxcNpContactPoses;
+
 namespace Gu
 {
 	struct Cache;
@@ -58,8 +60,8 @@ namespace Gu
 	class PxgGpuNarrowphaseCoreInterface;
 }
 
-void PxcDiscreteNarrowPhase(PxcNpThreadContext& context, const PxcNpWorkUnit& cmInput, Gu::Cache& cache, PxsContactManagerOutput& output);
-void PxcDiscreteNarrowPhasePCM(PxcNpThreadContext& context, const PxcNpWorkUnit& cmInput, Gu::Cache& cache, PxsContactManagerOutput& output);
+void PxcDiscreteNarrowPhase(PxcNpThreadContext& context, const PxcNpWorkUnit& cmInput, Gu::Cache& cache, PxcNpContactPoses& contactPoses, PxsContactManagerOutput& output);
+void PxcDiscreteNarrowPhasePCM(PxcNpThreadContext& context, const PxcNpWorkUnit& cmInput, Gu::Cache& cache, PxcNpContactPoses& contactPoses, PxsContactManagerOutput& output);
 }
 
 #endif
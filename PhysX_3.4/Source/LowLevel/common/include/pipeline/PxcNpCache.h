@@ -31,6 +31,7 @@
 #define PXC_NPCACHE_H
 
 #include "foundation/PxMemory.h"
+#include "foundation/PxTransform.h"
 
 #include "PsIntrinsics.h"
 #include "PxcNpCacheStreamPair.h"
@@ -149,6 +150,20 @@ const PxU8* PxcNpCacheRead2(Gu::Cache& cache, T& payload, PxU32& bytes)
 	return reinterpret_cast<const PxU8*>(ls+payloadSize+sizeof(PxU32));
 }
 
+/*
+World poses of the two shapes and the contact distance in use the last time contacts were generated for a pair.
+Stored per pair next to its Gu::Cache so that pairs which barely moved since then can replay their previous contacts.
+The contacts are stored in world space, so both shapes have to stay in place, not just their relative pose.
+*/
+struct PxcNpContactPoses
+{
+	PxTransform	mTransform0;
+	PxTransform	mTransform1;
+	PxReal		mContactDistance;
+
+	PX_FORCE_INLINE	void	invalidate()	{ mTransform0 = mTransform1 = PxTransform(PxIdentity); mContactDistance = -1.0f;	}
+};
+
 }
 
 #endif // #ifndef PXC_NPCACHE_H
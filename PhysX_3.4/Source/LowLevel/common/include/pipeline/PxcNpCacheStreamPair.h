@@ -50,8 +50,11 @@ public:
 	// reserve can fail and return null.
 	PxU8*					reserve(PxU32 byteCount);
 	void					reset();
+
+	PX_FORCE_INLINE	const PxcNpMemBlockArena&	getMemBlockArena()	const	{ return mBlockArena;	}
+	PX_FORCE_INLINE	PxcNpMemBlockArena&			getMemBlockArena()			{ return mBlockArena;	}
 private:
-	PxcNpMemBlockPool&	mBlockPool;
+	PxcNpMemBlockArena	mBlockArena;
 	PxcNpMemBlock*		mBlock;
 	PxU32				mUsed;
 private:
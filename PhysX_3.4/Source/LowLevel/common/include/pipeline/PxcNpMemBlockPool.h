@@ -62,6 +62,8 @@ public:
 	PxU32			getUsedBlockCount() const;
 	PxU32			getMaxUsedBlockCount() const;
 	PxU32			getPeakConstraintBlockCount() const;
+	PxU32			getFramePeakUsedBlockCount() const;
+	void			resetFramePeakUsedBlockCount();
 	void			releaseUnusedBlocks();
 
 	PxcNpMemBlock*	acquireConstraintBlock();
@@ -72,6 +74,14 @@ public:
 
 	PxU8*			acquireExceptionalConstraintMemory(PxU32 size);
 
+	// blocks owned by a PxcNpMemBlockArena. They stay in use until the arena hands them back.
+	PxcNpMemBlock*	acquireArenaBlock(PxcNpMemBlockArray& arenaBlocks);
+	void			releaseArenaBlocks(PxcNpMemBlockArray& arenaBlocks, PxU32 nbToKeep);
+
+	// incremented each time the corresponding stream pair is swapped
+	PX_FORCE_INLINE	PxU32	getContactStreamStamp()		const	{ return mContactStamp;		}
+	PX_FORCE_INLINE	PxU32	getNpCacheStreamStamp()		const	{ return mNpCacheStamp;		}
+
 	void			acquireConstraintMemory();
 	void			releaseConstraintMemory();
 	void			releaseConstraintBlocks(PxcNpMemBlockArray& memBlocks);
@@ -103,6 +113,9 @@ private:
 	PxU32					mInitialBlocks;
 	PxU32					mUsedBlocks;
 	PxU32					mMaxUsedBlocks;
+	PxU32					mFramePeakUsedBlocks;
+	PxU32					mContactStamp;
+	PxU32					mNpCacheStamp;
 	PxcNpMemBlock*			mScratchBlockAddr;
 	PxU32					mNbScratchBlocks;
 	PxcScratchAllocator&	mScratchAllocator;
@@ -114,6 +127,48 @@ private:
 	void			release(PxcNpMemBlockArray& deadArray, PxU32* allocationCount = NULL);
 };
 
+/*!
+Per-thread bump allocator for the double-buffered contact and NP cache streams.
+
+The arena keeps the blocks it took from the pool across frames. Once the pool has swapped a stream twice, the data
+written into the arena's blocks for that buffer is dead, and the arena recycles them wholesale without touching the
+pool lock. The pool is only called when the arena runs out of blocks, and at the end of the narrow phase when
+releaseIdleBlocks() gives back the blocks the arena did not use.
+*/
+class PxcNpMemBlockArena
+{
+	PX_NOCOPY(PxcNpMemBlockArena)
+public:
+	enum StreamType
+	{
+		eCONTACTS,
+		eNP_CACHE
+	};
+
+	PxcNpMemBlockArena(PxcNpMemBlockPool& pool, StreamType type);
+	~PxcNpMemBlockArena();
+
+	PxcNpMemBlock*	acquireBlock();
+
+	// returns the blocks not used during the last cycle of each buffer, and all blocks of buffers holding dead data
+	void			releaseIdleBlocks();
+
+	PX_FORCE_INLINE	PxcNpMemBlockPool&	getMemBlockPool()			{ return mPool;									}
+	PX_FORCE_INLINE	PxU32	getNbBlocks()				const	{ return mBlocks[0].size() + mBlocks[1].size();	}
+	PX_FORCE_INLINE	PxU32	getNbOverflowBlocks()		const	{ return mNbOverflowBlocks;						}
+	PX_FORCE_INLINE	void	clearStats()						{ mNbOverflowBlocks = 0;						}
+
+private:
+	PX_FORCE_INLINE	PxU32	getStreamStamp()	const;
+
+	PxcNpMemBlockPool&		mPool;
+	const StreamType		mType;
+	PxcNpMemBlockArray		mBlocks[2];		// blocks owned by the arena, per stream buffer
+	PxU32					mNbUsed[2];		// number of blocks handed out from mBlocks[i] since mStamp[i]
+	PxU32					mStamp[2];		// stream stamp mBlocks[i] was last written in
+	PxU32					mNbOverflowBlocks;	// blocks taken from the pool since the last clearStats()
+};
+
 }
 
 #endif
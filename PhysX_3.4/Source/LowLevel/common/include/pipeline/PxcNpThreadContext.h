@@ -177,10 +177,12 @@ public:
 					bool						mContactCache;
 					bool						mCreateContactStream;	// flag to enforce that contacts are stored persistently per workunit. Used for PVD.
 					bool						mCreateAveragePoint;	// flag to enforce whether we create average points
+					PxReal						mContactReplayThreshold;	// pairs whose shapes both moved less than this replay their previous contacts (0 = disabled)
 #if PX_ENABLE_SIM_STATS
 					PxU32						mCompressedCacheSize;
 					PxU32						mNbDiscreteContactPairsWithCacheHits;
 					PxU32						mNbDiscreteContactPairsWithContacts;
+					PxU32						mNbDiscreteContactPairsReplayed;
 #endif
 					PxReal						mDt; // AP: still needed for ccd
 					PxU32						mCCDPass;
@@ -33,6 +33,7 @@
 #include "PxsContactManager.h"
 #include "GuGeometryUnion.h"
 #include "PxcContactCache.h"
+#include "PxcNpCache.h"
 #include "PxcMaterialMethodImpl.h"
 #include "PxcNpContactPrepShared.h"
 #include "PxvDynamics.h"			// for PxsBodyCore
@@ -93,9 +94,14 @@ static bool copyBuffers(PxsContactManagerOutput& cmOutput, Gu::Cache& cache, Pxc
 		PxU8* oldContacts = cmOutput.contactPoints;
 		PxReal* oldForces = cmOutput.contactForces;
 
-		PxU32 forceSize = cmOutput.nbContacts * sizeof(PxReal);
-		if(isMeshType)
-			forceSize += cmOutput.nbContacts * sizeof(PxU32);
+		//Only carry a force buffer over if the pair had one: without contact reports, finishContacts does not create one either.
+		PxU32 forceSize = 0;
+		if(oldForces)
+		{
+			forceSize = cmOutput.nbContacts * sizeof(PxReal);
+			if(isMeshType)
+				forceSize += cmOutput.nbContacts * sizeof(PxU32);
+		}
 
 		PxU8* PX_RESTRICT contactPatches = NULL;
 		PxU8* PX_RESTRICT contactPoints = NULL;
@@ -151,7 +157,7 @@ static bool copyBuffers(PxsContactManagerOutput& cmOutput, Gu::Cache& cache, Pxc
 			{
 				PxMemCopy(contactPatches, oldPatches, patchSize);
 				PxMemCopy(contactPoints, oldContacts, contactSize);
-				if (isMeshType)
+				if (isMeshType && oldForces)
 				{
 					PxMemCopy(forceBuffer + cmOutput.nbContacts, oldForces + cmOutput.nbContacts, sizeof(PxU32) * cmOutput.nbContacts);
 				}
@@ -169,14 +175,15 @@ static bool copyBuffers(PxsContactManagerOutput& cmOutput, Gu::Cache& cache, Pxc
 			contactPoints = data + cmOutput.nbPatches * sizeof(PxContactPatch);
 
 			PxMemCopy(data, oldPatches, oldSize);
-			if (isMeshType)
+			if (isMeshType && oldForces)
 			{
 				PxMemCopy(forceBuffer + cmOutput.nbContacts, oldForces + cmOutput.nbContacts, sizeof(PxU32) * cmOutput.nbContacts);
 			}
 		}
 
+		//Clear the forces only, the face indices copied behind them for mesh pairs must be kept.
 		if(forceSize)
-			PxMemZero(forceBuffer, forceSize);
+			PxMemZero(forceBuffer, cmOutput.nbContacts * sizeof(PxReal));
 		
 		cmOutput.contactPatches= contactPatches;
 		cmOutput.contactPoints = contactPoints;
@@ -270,8 +277,30 @@ static bool finishContacts(const PxcNpWorkUnit& input, PxsContactManagerOutput&
 	return res;
 }
 
+// Distance a shape moved from previousPose to currentPose. The rotational part is converted to a distance using leverArm.
+static PX_FORCE_INLINE PxReal getShapeMotion(const PxTransform& previousPose, const PxTransform& currentPose, const PxReal leverArm)
+{
+	const PxReal linearMotion = (currentPose.p - previousPose.p).magnitude();
+	const PxQuat deltaQ = previousPose.q.getConjugate() * currentPose.q;
+	return linearMotion + 2.0f * deltaQ.getImaginaryPart().magnitude() * leverArm;
+}
+
+// Returns true if both shapes of the pair moved less than the replay threshold since contactPoses was recorded, i.e. the
+// world space contacts generated back then are still good enough. The rotational part is converted to a distance using the
+// offset between the two shapes as lever arm, which is conservative for compact shapes and makes large or far-reaching
+// shapes (planes, meshes, heightfields) rarely qualify.
+static PX_FORCE_INLINE bool canReplayContacts(const PxcNpContactPoses& contactPoses, const PxTransform& currentPose0, const PxTransform& currentPose1, const PxReal contactDistance,
+											  const PxReal threshold)
+{
+	if(contactPoses.mContactDistance != contactDistance)
+		return false;
+
+	const PxReal leverArm = (currentPose1.p - currentPose0.p).magnitude();
+	return getShapeMotion(contactPoses.mTransform0, currentPose0, leverArm) < threshold && getShapeMotion(contactPoses.mTransform1, currentPose1, leverArm) < threshold;
+}
+
 template<bool useContactCacheT>
-static PX_FORCE_INLINE bool checkContactsMustBeGenerated(PxcNpThreadContext& context, const PxcNpWorkUnit& input, Gu::Cache& cache, PxsContactManagerOutput& output,
+static PX_FORCE_INLINE bool checkContactsMustBeGenerated(PxcNpThreadContext& context, const PxcNpWorkUnit& input, Gu::Cache& cache, PxcNpContactPoses& contactPoses, PxsContactManagerOutput& output,
 										 const PxsCachedTransform* cachedTransform0, const PxsCachedTransform* cachedTransform1,
 										 const bool flip, PxGeometryType::Enum type0, PxGeometryType::Enum type1)
 {
@@ -281,6 +310,10 @@ static PX_FORCE_INLINE bool checkContactsMustBeGenerated(PxcNpThreadContext& con
 	if(!(input.flags & PxcNpWorkUnitFlag::eDETECT_DISCRETE_CONTACT))
 		return false;
 
+	const PxReal contactDist0 = context.mContactDistance[input.mTransformCache0];
+	const PxReal contactDist1 = context.mContactDistance[input.mTransformCache1];
+	const PxReal contactDistance = contactDist0 + contactDist1;
+
 	if(!(output.statusFlag & PxcNpWorkUnitStatusFlag::eDIRTY_MANAGER) && !(input.flags & PxcNpWorkUnitFlag::eMODIFIABLE_CONTACT))
 	{
 		const PxU32 body0Dynamic = PxU32(input.flags & PxcNpWorkUnitFlag::eDYNAMIC_BODY0);
@@ -289,7 +322,14 @@ static PX_FORCE_INLINE bool checkContactsMustBeGenerated(PxcNpThreadContext& con
 		const PxU32 active0 = PxU32(body0Dynamic && !cachedTransform0->isFrozen());
 		const PxU32 active1 = PxU32(body1Dynamic && !cachedTransform1->isFrozen());
 
-		if(!(active0 || active1))
+		bool reuseContacts = !(active0 || active1);
+
+		//Pairs whose shapes both moved less than the replay threshold since their contacts were last generated keep the
+		//previous frame's contacts, same as frozen pairs.
+		const bool replay = !reuseContacts && context.mContactReplayThreshold > 0.0f &&
+			canReplayContacts(contactPoses, cachedTransform0->transform, cachedTransform1->transform, contactDistance, context.mContactReplayThreshold);
+
+		if(reuseContacts || replay)
 		{
 			if(flip)
 				Ps::swap(type0, type1);
@@ -299,6 +339,11 @@ static PX_FORCE_INLINE bool checkContactsMustBeGenerated(PxcNpThreadContext& con
 #if PX_ENABLE_SIM_STATS
 			if(output.nbContacts)
 				context.mNbDiscreteContactPairsWithContacts++;
+			if(replay)
+			{
+				updateDiscreteContactStats(context, type0, type1);
+				context.mNbDiscreteContactPairsReplayed++;
+			}
 #endif
 			const bool isMeshType = type1 > PxGeometryType::eCONVEXMESH;
 			copyBuffers(output, cache, context, useContactCache, isMeshType);
@@ -308,16 +353,21 @@ static PX_FORCE_INLINE bool checkContactsMustBeGenerated(PxcNpThreadContext& con
 
 	output.statusFlag &= (~PxcNpWorkUnitStatusFlag::eDIRTY_MANAGER);
 
-	const PxReal contactDist0 = context.mContactDistance[input.mTransformCache0];
-	const PxReal contactDist1 = context.mContactDistance[input.mTransformCache1];
 	//context.mNarrowPhaseParams.mContactDistance = shape0->contactOffset + shape1->contactOffset;
-	context.mNarrowPhaseParams.mContactDistance = contactDist0 + contactDist1;
+	context.mNarrowPhaseParams.mContactDistance = contactDistance;
+
+	if(context.mContactReplayThreshold > 0.0f)
+	{
+		contactPoses.mTransform0 = cachedTransform0->transform;
+		contactPoses.mTransform1 = cachedTransform1->transform;
+		contactPoses.mContactDistance = contactDistance;
+	}
 
 	return true;
 }
 
 template<bool useLegacyCodepath>
-static PX_FORCE_INLINE void discreteNarrowPhase(PxcNpThreadContext& context, const PxcNpWorkUnit& input, Gu::Cache& cache, PxsContactManagerOutput& output)
+static PX_FORCE_INLINE void discreteNarrowPhase(PxcNpThreadContext& context, const PxcNpWorkUnit& input, Gu::Cache& cache, PxcNpContactPoses& contactPoses, PxsContactManagerOutput& output)
 {
 	PxGeometryType::Enum type0 = static_cast<PxGeometryType::Enum>(input.geomType0);
 	PxGeometryType::Enum type1 = static_cast<PxGeometryType::Enum>(input.geomType1);
@@ -327,7 +377,7 @@ static PX_FORCE_INLINE void discreteNarrowPhase(PxcNpThreadContext& context, con
 	const PxsCachedTransform* cachedTransform0 = &context.mTransformCache->getTransformCache(input.mTransformCache0);
 	const PxsCachedTransform* cachedTransform1 = &context.mTransformCache->getTransformCache(input.mTransformCache1);
 
-	if(!checkContactsMustBeGenerated<useLegacyCodepath>(context, input, cache, output, cachedTransform0, cachedTransform1, flip, type0, type1))
+	if(!checkContactsMustBeGenerated<useLegacyCodepath>(context, input, cache, contactPoses, output, cachedTransform0, cachedTransform1, flip, type0, type1))
 		return;
 
 	PxsShapeCore* shape0 = const_cast<PxsShapeCore*>(input.shapeCore0);
@@ -434,12 +484,12 @@ static PX_FORCE_INLINE void discreteNarrowPhase(PxcNpThreadContext& context, con
 	finishContacts(input, output, context, materialInfo, isMeshType);
 }
 
-void physx::PxcDiscreteNarrowPhase(PxcNpThreadContext& context, const PxcNpWorkUnit& input, Gu::Cache& cache, PxsContactManagerOutput& output)
+void physx::PxcDiscreteNarrowPhase(PxcNpThreadContext& context, const PxcNpWorkUnit& input, Gu::Cache& cache, PxcNpContactPoses& contactPoses, PxsContactManagerOutput& output)
 {
-	discreteNarrowPhase<true>(context, input, cache, output);
+	discreteNarrowPhase<true>(context, input, cache, contactPoses, output);
 }
 
-void physx::PxcDiscreteNarrowPhasePCM(PxcNpThreadContext& context, const PxcNpWorkUnit& input, Gu::Cache& cache, PxsContactManagerOutput& output)
+void physx::PxcDiscreteNarrowPhasePCM(PxcNpThreadContext& context, const PxcNpWorkUnit& input, Gu::Cache& cache, PxcNpContactPoses& contactPoses, PxsContactManagerOutput& output)
 {
-	discreteNarrowPhase<false>(context, input, cache, output);
+	discreteNarrowPhase<false>(context, input, cache, contactPoses, output);
 }
@@ -41,7 +41,7 @@ void PxcNpCacheStreamPair::reset()
 }
 
 PxcNpCacheStreamPair::PxcNpCacheStreamPair(PxcNpMemBlockPool& blockPool):
-  mBlockPool(blockPool), mBlock(NULL), mUsed(0)
+  mBlockArena(blockPool, PxcNpMemBlockArena::eNP_CACHE), mBlock(NULL), mUsed(0)
 {
 }
 
@@ -57,7 +57,7 @@ PxU8* PxcNpCacheStreamPair::reserve(PxU32 size)
 
 	if(mBlock == NULL || mUsed + size > PxcNpMemBlock::SIZE)
 	{
-		mBlock = mBlockPool.acquireNpCacheBlock();
+		mBlock = mBlockArena.acquireBlock();
 		mUsed = 0;
 	}
 
@@ -47,6 +47,9 @@ PxcNpMemBlockPool::PxcNpMemBlockPool(PxcScratchAllocator& allocator):
   mMaxBlocks(0),
   mUsedBlocks(0),
   mMaxUsedBlocks(0),
+  mFramePeakUsedBlocks(0),
+  mContactStamp(0),
+  mNpCacheStamp(0),
   mScratchBlockAddr(0),
   mNbScratchBlocks(0),
   mScratchAllocator(allocator),
@@ -89,6 +92,16 @@ PxU32 PxcNpMemBlockPool::getPeakConstraintBlockCount() const
 	return mPeakConstraintAllocations;
 }
 
+PxU32 PxcNpMemBlockPool::getFramePeakUsedBlockCount() const
+{
+	return mFramePeakUsedBlocks;
+}
+
+void PxcNpMemBlockPool::resetFramePeakUsedBlockCount()
+{
+	mFramePeakUsedBlocks = mUsedBlocks;
+}
+
 
 void PxcNpMemBlockPool::setBlockCount(PxU32 blockCount)
 {
@@ -206,6 +219,7 @@ PxcNpMemBlock* PxcNpMemBlockPool::acquire(PxcNpMemBlockArray& trackingArray, PxU
 		PxcNpMemBlock* block = mUnused.popBack();
 		trackingArray.pushBack(block);
 		mMaxUsedBlocks = PxMax<PxU32>(mUsedBlocks+1, mMaxUsedBlocks);
+		mFramePeakUsedBlocks = PxMax<PxU32>(mUsedBlocks+1, mFramePeakUsedBlocks);
 		mUsedBlocks++;
 		return block;
 	}	
@@ -237,6 +251,7 @@ PxcNpMemBlock* PxcNpMemBlockPool::acquire(PxcNpMemBlockArray& trackingArray, PxU
 	{
 		trackingArray.pushBack(block);
 		mMaxUsedBlocks = PxMax<PxU32>(mUsedBlocks+1, mMaxUsedBlocks);
+		mFramePeakUsedBlocks = PxMax<PxU32>(mUsedBlocks+1, mFramePeakUsedBlocks);
 		mUsedBlocks++;
 	}
 	else
@@ -325,6 +340,7 @@ void PxcNpMemBlockPool::releaseContacts()
 	//releaseConstraintBlocks(mContacts);
 	release(mContacts[1-mContactIndex]);
 	mContactIndex = 1-mContactIndex;
+	mContactStamp++;
 }
 
 PxcNpMemBlock* PxcNpMemBlockPool::acquireFrictionBlock()
@@ -347,5 +363,85 @@ void PxcNpMemBlockPool::swapNpCacheStreams()
 {
 	release(mNpCache[1-mNpCacheActiveStream]);
 	mNpCacheActiveStream = 1-mNpCacheActiveStream;
+	mNpCacheStamp++;
+}
+
+PxcNpMemBlock* PxcNpMemBlockPool::acquireArenaBlock(PxcNpMemBlockArray& arenaBlocks)
+{
+	return acquire(arenaBlocks);
+}
+
+void PxcNpMemBlockPool::releaseArenaBlocks(PxcNpMemBlockArray& arenaBlocks, PxU32 nbToKeep)
+{
+	Ps::Mutex::ScopedLock lock(mLock);
+	while(arenaBlocks.size()>nbToKeep)
+	{
+		mUnused.pushBack(arenaBlocks.popBack());
+		PX_ASSERT(mUsedBlocks>0);
+		mUsedBlocks--;
+	}
+}
+
+PxcNpMemBlockArena::PxcNpMemBlockArena(PxcNpMemBlockPool& pool, StreamType type) :
+	mPool				(pool),
+	mType				(type),
+	mNbOverflowBlocks	(0)
+{
+	mNbUsed[0] = mNbUsed[1] = 0;
+	mStamp[0] = mStamp[1] = 0;
+}
+
+PxcNpMemBlockArena::~PxcNpMemBlockArena()
+{
+	mPool.releaseArenaBlocks(mBlocks[0], 0);
+	mPool.releaseArenaBlocks(mBlocks[1], 0);
+}
+
+PX_FORCE_INLINE PxU32 PxcNpMemBlockArena::getStreamStamp() const
+{
+	return mType == eCONTACTS ? mPool.getContactStreamStamp() : mPool.getNpCacheStreamStamp();
+}
+
+PxcNpMemBlock* PxcNpMemBlockArena::acquireBlock()
+{
+	// The pool releases a stream buffer two swaps after it was written, so consecutive stamps must map to different
+	// buffers and a buffer whose stamp is out of date only holds data the pool would already have reclaimed.
+	const PxU32 stamp = getStreamStamp();
+	const PxU32 index = stamp & 1;
+	PxcNpMemBlockArray& blocks = mBlocks[index];
+
+	if(mStamp[index] != stamp)
+	{
+		// wholesale reset, the surplus of the previous cycle was already given back by releaseIdleBlocks()
+		mStamp[index] = stamp;
+		mNbUsed[index] = 0;
+	}
+
+	if(mNbUsed[index] < blocks.size())
+		return blocks[mNbUsed[index]++];
+
+	// arena exhausted, overflow to the shared pool
+	PxcNpMemBlock* block = mPool.acquireArenaBlock(blocks);
+	if(block)
+	{
+		mNbUsed[index]++;
+		mNbOverflowBlocks++;
+	}
+	return block;
+}
+
+void PxcNpMemBlockArena::releaseIdleBlocks()
+{
+	const PxU32 stamp = getStreamStamp();
+	for(PxU32 i=0; i<2; i++)
+	{
+		// Blocks past mNbUsed[i] were not handed out during the last cycle of the buffer. Once the pool has swapped
+		// the stream twice since that cycle, the data in the other blocks is dead as well.
+		if(stamp - mStamp[i] >= 2)
+			mNbUsed[i] = 0;
+
+		if(mBlocks[i].size() > mNbUsed[i])
+			mPool.releaseArenaBlocks(mBlocks[i], mNbUsed[i]);
+	}
 }
 
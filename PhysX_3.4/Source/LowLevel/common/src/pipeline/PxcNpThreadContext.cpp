@@ -41,10 +41,12 @@ PxcNpThreadContext::PxcNpThreadContext(PxcNpContext* params) :
 	mContactCache						(false),
 	mCreateContactStream				(params->mCreateContactStream),
 	mCreateAveragePoint					(false),
+	mContactReplayThreshold				(0.0f),
 #if PX_ENABLE_SIM_STATS
 	mCompressedCacheSize				(0),
 	mNbDiscreteContactPairsWithCacheHits(0),
 	mNbDiscreteContactPairsWithContacts	(0),
+	mNbDiscreteContactPairsReplayed		(0),
 #endif
 	mMaxPatches							(0),
 	mTotalCompressedCacheSize			(0),
@@ -74,6 +76,9 @@ void PxcNpThreadContext::clearStats()
 	mCompressedCacheSize					= 0;
 	mNbDiscreteContactPairsWithCacheHits	= 0;
 	mNbDiscreteContactPairsWithContacts		= 0;
+	mNbDiscreteContactPairsReplayed			= 0;
+	mContactBlockStream.getMemBlockArena().clearStats();
+	mNpCacheStreamPair.getMemBlockArena().clearStats();
 }
 #endif
 
@@ -130,6 +130,9 @@ struct PxsCCDBody
 	PxsCCDOverlap*				mOverlappingObjects;		//A list of overlapping bodies for island update
 	PxU32						mUpdateCount;				//How many times this body has eben updated in the CCD. This is correlated with CCD shapes' update counts.
 	PxU32						mNbInteractionsThisPass;	//How many interactions this pass
+	PxU32						mPassStartUpdateCount;		//mUpdateCount at the start of the current pass
+	bool						mHadHitThisPass;			//Whether one of this body's pairs had an impact in the current pass
+	bool						mNeedsSweep;				//Whether this body was created, moved or had an impact in the previous pass. Pairs between bodies that did not can be skipped.
 
 	
 
@@ -576,6 +579,9 @@ private:
 		bool					mDisableCCDResweep;
 		PxU32					miCCDPass;
 		PxI32					mSweepTotalHits;
+		PxI32					mNbSweeps;				// pairs swept this pass
+		PxI32					mNbSkippedSweeps;		// pairs not swept this pass because neither body changed in the previous pass
+		PxU64					mPassStartTime;
 
 		// a fraction of objects will be CCD active so PxsCCDBody is dynamic, not a member of PxsRigidBody
 		PxsCCDBodyArray mCCDBodies;
@@ -596,6 +602,8 @@ private:
 		PxcNpThreadContext* mCCDThreadContext;
 		// number of pairs to process per thread
 		PxU32 mCCDPairsPerBatch;
+		// number of pairs to advance per task
+		PxU32 mCCDAdvancePairsPerBatch;
 		PxU32 mCCDMaxPasses;
 
 		PxsContext* mContext;
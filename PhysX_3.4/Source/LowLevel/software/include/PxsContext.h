@@ -164,6 +164,7 @@ public:
 	PX_FORCE_INLINE	bool						getPCM()					const	{ return mPCM;														}
 	PX_FORCE_INLINE	bool						getContactCacheFlag()		const	{ return mContactCache;												}
 	PX_FORCE_INLINE	bool						getCreateAveragePoint()		const	{ return mCreateAveragePoint;										}
+	PX_FORCE_INLINE	PxReal						getContactReplayThreshold()	const	{ return mContactReplayThreshold;									}
 
 	// general stuff
 					void						shiftOrigin(const PxVec3& shift);
@@ -171,6 +172,7 @@ public:
 					void						setCreateContactStream(bool to);
 	PX_FORCE_INLINE	void						setPCM(bool enabled)					{ mPCM = enabled;				}
 	PX_FORCE_INLINE	void						setContactCache(bool enabled)			{ mContactCache = enabled;		}
+	PX_FORCE_INLINE	void						setContactReplayThreshold(PxReal t)		{ mContactReplayThreshold = t;	}
 
 	PX_FORCE_INLINE	PxcScratchAllocator&		getScratchAllocator()					{ return mScratchAllocator;		}
 	PX_FORCE_INLINE PxsTransformCache&			getTransformCache()						{ return *mTransformCache;		}
@@ -300,6 +302,7 @@ private:
 					bool										mPCM;
 					bool										mContactCache;
 					bool										mCreateAveragePoint;
+					PxReal										mContactReplayThreshold;
 
 					PxsTransformCache*							mTransformCache;
 					Ps::Array<PxReal, Ps::VirtualAllocator>*	mContactDistance;
@@ -35,6 +35,7 @@
 #include "PsArray.h"
 #include "CmBitMap.h"
 #include "CmPriorityQueue.h"
+#include "PsMutex.h"
 
 namespace physx
 {
@@ -412,6 +413,33 @@ private:
 	NodeComparator& operator = (const NodeComparator&);
 };
 
+//! Maximum number of tasks re-validating islands in parallel after edges were lost
+#define IG_MAX_ISLAND_REPAIR_TASKS 8
+
+//Transient data used by the traversals that re-validate islands after edges were lost. Traversals never leave
+//the island they started in, so each task that re-validates a disjoint set of islands owns one of these.
+struct TraversalScratch
+{
+	Cm::PriorityQueue<QueueElement, NodeComparator> 
+		mPriorityQueue;										//! Priority queue used for graph traversal
+	Ps::Array<TraversalState> mVisitedNodes;				//! The list of nodes visited in the current traversal
+	Cm::BitMap mVisitedState;								//! Indicates whether a node has been visited
+	Ps::Array<EdgeIndex> mIslandSplitEdges[Edge::eEDGE_TYPE_COUNT];
+
+	void reset(const PxU32 nbNodes)
+	{
+		mVisitedState.resizeAndClear(nbNodes);
+		
+		//Reserve space on priority queue for at least 1024 nodes. It will resize if more memory is required during traversal.
+		mPriorityQueue.reserve(1024);
+
+		mIslandSplitEdges[0].reserve(1024);
+		mIslandSplitEdges[1].reserve(1024);
+
+		mVisitedNodes.reserve(nbNodes); //Make sure we have enough space for all nodes!
+	}
+};
+
 
 class IslandSim
 {
@@ -465,13 +493,16 @@ class IslandSim
 	Ps::Array<IslandId> mTempIslandIds;
 
 	
-	//Temporary, transient data used for traversals. TODO - move to PxsSimpleIslandManager. Or if we keep it here, we can 
-	//process multiple island simulations in parallel
-	Cm::PriorityQueue<QueueElement, NodeComparator> 
-		mPriorityQueue;										//! Priority queue used for graph traversal
-	Ps::Array<TraversalState> mVisitedNodes;				//! The list of nodes visited in the current traversal
-	Cm::BitMap mVisitedState;								//! Indicates whether a node has been visited
-	Ps::Array<EdgeIndex> mIslandSplitEdges[Edge::eEDGE_TYPE_COUNT];
+	//Temporary, transient data used for traversals
+	TraversalScratch mTraversalScratch;
+
+	//Parallel re-validation of the islands that lost edges, see prepareIslandRepair()
+	TraversalScratch mRepairScratch[IG_MAX_ISLAND_REPAIR_TASKS];
+	Ps::Array<PxU64> mDirtyIslandNodes;						//! Dirty nodes keyed by island id (high bits) and node index (low bits), sorted
+	Ps::Array<PxU32> mDirtyIslandStarts;					//! Start of each island's run of dirty nodes in mDirtyIslandNodes, plus an end marker
+	volatile PxI32 mDirtyIslandIndex;						//! The next run of dirty nodes to be claimed by a repair task
+	Ps::Array<IslandId> mRepairIslands;						//! Islands split off by the repair tasks, in the order their handles were allocated
+	Ps::Mutex mRepairIslandLock;							//! Serializes island creation in the repair tasks
 
 	Ps::Array<EdgeIndex> mDeactivatingEdges[Edge::eEDGE_TYPE_COUNT];
 
@@ -580,8 +611,15 @@ public:
 
 	PX_FORCE_INLINE const Node& getNode(const NodeIndex& nodeIndex) const { return mNodes[nodeIndex.index()]; }
 
+	PX_FORCE_INLINE const EdgeInstance& getEdgeInstance(const EdgeInstanceIndex instanceIndex) const { return mEdgeInstances[instanceIndex]; }
+
+	//The node at the other end of an edge instance. Edge instance 2*edgeIndex belongs to node 1 of the edge, 2*edgeIndex+1 to node 2.
+	PX_FORCE_INLINE NodeIndex getOpposingNodeIndex(const EdgeInstanceIndex instanceIndex) const { return mEdgeNodeIndices[instanceIndex ^ 1]; }
+
 	PX_FORCE_INLINE const Island& getIsland(const NodeIndex& nodeIndex) const { PX_ASSERT(mIslandIds[nodeIndex.index()] != IG_INVALID_ISLAND); return mIslands[mIslandIds[nodeIndex.index()]]; }
 
+	PX_FORCE_INLINE IslandId getIslandId(const NodeIndex& nodeIndex) const { return mIslandIds[nodeIndex.index()]; }
+
 	PX_FORCE_INLINE PxU32 getIslandStaticTouchCount(const NodeIndex& nodeIndex) const { PX_ASSERT(mIslandIds[nodeIndex.index()] != IG_INVALID_ISLAND); return mIslandStaticTouchCount[mIslandIds[nodeIndex.index()]]; }
 
 	PX_FORCE_INLINE const Cm::BitMap& getActiveContactManagerBitmap() const { return mActiveContactEdges; }
@@ -621,6 +659,24 @@ private:
 	void processNewEdges();
 	void processLostEdges(Ps::Array<NodeIndex>& destroyedNodes, bool allowDeactivation, bool permitKinematicDeactivation, PxU32 dirtyNodeLimit);
 
+	//processLostEdges() is made of these three steps. The second one can be replaced by the parallel island repair below.
+	void removeLostEdgesFromIslands();
+	void findPathsAndBreakIslands(PxU32 dirtyNodeLimit);
+	void finishLostEdges(Ps::Array<NodeIndex>& destroyedNodes, bool allowDeactivation, bool permitKinematicDeactivation);
+
+	//Parallel version of findPathsAndBreakIslands(). The dirty nodes are grouped by island and each task claims whole islands, 
+	//so the islands are re-validated independently. prepareIslandRepair() returns the number of tasks to run or 0 if the
+	//serial version should be used. finishIslandRepair() renumbers the split-off islands so the result is identical to
+	//the serial version. prepareIslandRepair() always returns 0 unless IG_PARALLEL_ISLAND_REPAIR is enabled.
+	PxU32 prepareIslandRepair(PxU32 maxTasks);
+	void repairIslands(PxU32 taskIndex);
+	void finishIslandRepair();
+
+	//Re-validates the island of a node that lost an edge, splitting it if the node can no longer reach the island's root.
+	void processDirtyNode(TraversalScratch& scratch, NodeIndex dirtyNodeIndex, bool parallel);
+
+	IslandId createSplitIsland(IslandId oldIslandId, bool parallel);
+
 	void removeConnectionInternal(EdgeIndex edgeIndex);
 
 	void addConnection(NodeIndex nodeHandle1, NodeIndex nodeHandle2, Edge::EdgeType edgeType, EdgeIndex handle);
@@ -639,7 +695,7 @@ private:
 	IslandSim& operator = (const IslandSim&);
 	IslandSim(const IslandSim&);
 
-	void unwindRoute(PxU32 traversalIndex, NodeIndex lastNode, PxU32 hopCount, IslandId id);
+	void unwindRoute(TraversalScratch& scratch, PxU32 traversalIndex, NodeIndex lastNode, PxU32 hopCount, IslandId id);
 
 	void activateIsland(IslandId island);
 
@@ -647,9 +703,9 @@ private:
 
 	bool canFindRoot(NodeIndex startNode, NodeIndex targetNode, Ps::Array<NodeIndex>* visitedNodes);
 
-	bool tryFastPath(NodeIndex startNode, NodeIndex targetNode, IslandId islandId);
+	bool tryFastPath(TraversalScratch& scratch, NodeIndex startNode, NodeIndex targetNode, IslandId islandId);
 
-	bool findRoute(NodeIndex startNode, NodeIndex targetNode, IslandId islandId);
+	bool findRoute(TraversalScratch& scratch, NodeIndex startNode, NodeIndex targetNode, IslandId islandId);
 
 	bool isPathTo(NodeIndex startNode, NodeIndex targetNode);
 
@@ -918,6 +974,8 @@ private:
 
 	friend class SimpleIslandManager;
 	friend class ThirdPassTask;
+	friend class IslandRepairTask;
+	friend class ThirdPassFinishTask;
 
 };
 
@@ -43,12 +43,14 @@ struct PxsContactManagers : PxsContactManagerBase
 	Ps::Array<PxsContactManagerOutput>			mOutputContactManagers;
 	Ps::Array<PxsContactManager*>				mContactManagerMapping;
 	Ps::Array<Gu::Cache>						mCaches;
+	Ps::Array<PxcNpContactPoses>				mContactPoses;	// shape poses at the last contact generation, see PxcNpContactPoses
 
 
 	PxsContactManagers(const PxU32 bucketId) : PxsContactManagerBase(bucketId),
 		mOutputContactManagers(PX_DEBUG_EXP("mOutputContactManagers")),
 		mContactManagerMapping(PX_DEBUG_EXP("mContactManagerMapping")),
-		mCaches(PX_DEBUG_EXP("mCaches"))
+		mCaches(PX_DEBUG_EXP("mCaches")),
+		mContactPoses(PX_DEBUG_EXP("mContactPoses"))
 	{
 	}
 		
@@ -57,6 +59,7 @@ struct PxsContactManagers : PxsContactManagerBase
 		mOutputContactManagers.forceSize_Unsafe(0);
 		mContactManagerMapping.forceSize_Unsafe(0);
 		mCaches.forceSize_Unsafe(0);
+		mContactPoses.forceSize_Unsafe(0);
 		
 	}
 private:
@@ -45,11 +45,61 @@ namespace IG
 
 	class SimpleIslandManager;
 
+//Re-validates a share of the islands that lost edges, see IslandSim::prepareIslandRepair()
+class IslandRepairTask : public Cm::Task
+{
+	IslandSim* mIslandSim;
+	PxU32 mTaskIndex;
+
+public:
+
+	IslandRepairTask() : Cm::Task(0, PxSceneMemoryCategory::eISLANDS), mIslandSim(NULL), mTaskIndex(0)
+	{
+	}
+
+	void setup(PxU64 contextID, IslandSim& islandSim, PxU32 taskIndex)
+	{
+		setContextId(contextID);
+		mIslandSim = &islandSim;
+		mTaskIndex = taskIndex;
+	}
+
+	virtual void runInternal();
+
+	virtual const char* getName() const
+	{
+		return "IslandRepairTask";
+	}
+};
+
+class ThirdPassFinishTask : public Cm::Task
+{
+	SimpleIslandManager& mIslandManager;
+	IslandSim& mIslandSim;
+
+public:
+
+	ThirdPassFinishTask(PxU64 contextID, SimpleIslandManager& islandManager, IslandSim& islandSim);
+
+	virtual void runInternal();
+
+	virtual const char* getName() const
+	{
+		return "ThirdPassFinishTask";
+	}
+
+private:
+	PX_NOCOPY(ThirdPassFinishTask)
+};
+
 class ThirdPassTask : public Cm::Task
 {
 	SimpleIslandManager& mIslandManager;
 	IslandSim& mIslandSim;
 
+	IslandRepairTask mRepairTasks[IG_MAX_ISLAND_REPAIR_TASKS];
+	ThirdPassFinishTask mFinishTask;
+
 public:
 
 	ThirdPassTask(PxU64 contextID, SimpleIslandManager& islandManager, IslandSim& islandSim);
@@ -188,6 +238,7 @@ public:
 private:
 
 	friend class ThirdPassTask;
+	friend class ThirdPassFinishTask;
 	friend class PostThirdPassTask;
 
 	bool validateDeactivations() const;
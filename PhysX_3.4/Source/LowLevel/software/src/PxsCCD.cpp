@@ -36,6 +36,7 @@
 #include "PxsCCD.h"
 #include "PsSort.h"
 #include "PsAtomic.h"
+#include "PsTime.h"
 #include "CmFlushPool.h"
 #include "PxsMaterialManager.h"
 #include "PxcMaterialMethodImpl.h"
@@ -194,14 +195,18 @@ namespace physx
 {
 
 	PxsCCDContext::PxsCCDContext(PxsContext* context, Dy::ThresholdStream& thresholdStream, PxvNphaseImplementationContext& nPhaseContext) :
-		mPostCCDSweepTask			(context->getContextId(), this, "PxsContext.postCCDSweep"),
-		mPostCCDAdvanceTask			(context->getContextId(), this, "PxsContext.postCCDAdvance"),
-		mPostCCDDepenetrateTask		(context->getContextId(), this, "PxsContext.postCCDDepenetrate"),
+		mPostCCDSweepTask			(context->getContextId(), this, "PxsContext.postCCDSweep", PxSceneMemoryCategory::eCCD),
+		mPostCCDAdvanceTask			(context->getContextId(), this, "PxsContext.postCCDAdvance", PxSceneMemoryCategory::eCCD),
+		mPostCCDDepenetrateTask		(context->getContextId(), this, "PxsContext.postCCDDepenetrate", PxSceneMemoryCategory::eCCD),
 		mDisableCCDResweep			(false),
 		miCCDPass					(0),
 		mSweepTotalHits				(0),
+		mNbSweeps					(0),
+		mNbSkippedSweeps			(0),
+		mPassStartTime				(0),
 		mCCDThreadContext			(NULL),
 		mCCDPairsPerBatch			(0),
+		mCCDAdvancePairsPerBatch	(0),
 		mCCDMaxPasses				(1),
 		mContext					(context),
 		mThresholdStream			(thresholdStream),
@@ -845,20 +850,44 @@ class PxsCCDSweepTask : public Cm::Task
 {
 	PxsCCDPair** 					mPairs;
 	PxU32							mNumPairs;
+	PxU32							mCCDPass;
+	PxI32*							mNbSweeps;
+	PxI32*							mNbSkippedSweeps;
 public:
-	PxsCCDSweepTask(PxU64 contextID, PxsCCDPair** pairs, PxU32 nPairs)
-		:	Cm::Task(contextID), mPairs(pairs), mNumPairs(nPairs)
+	PxsCCDSweepTask(PxU64 contextID, PxsCCDPair** pairs, PxU32 nPairs, PxU32 ccdPass, PxI32* nbSweeps, PxI32* nbSkippedSweeps)
+		:	Cm::Task(contextID, PxSceneMemoryCategory::eCCD), mPairs(pairs), mNumPairs(nPairs), mCCDPass(ccdPass), mNbSweeps(nbSweeps), mNbSkippedSweeps(nbSkippedSweeps)
 	{
 	}
 
+	static PX_FORCE_INLINE bool needsSweep(const PxsRigidBody* body)
+	{
+		return body && body->mCCD->mNeedsSweep;
+	}
+
 	virtual void runInternal()
 	{
+		PxI32 nbSkipped = 0;
 		for (PxU32 j = 0; j < mNumPairs; j++)
 		{
 			PxsCCDPair& pair = *mPairs[j];
-			pair.sweepEstimateToi();
 			pair.mEstimatePass = 0;
+
+			//After the first pass, only the bodies that were advanced or hit something in the previous pass have new trajectories.
+			//Pairs between other bodies were already swept without an impact, so sweeping them again cannot find one either.
+			if (mCCDPass > 0 && !needsSweep(pair.mBa0) && !needsSweep(pair.mBa1))
+			{
+				pair.mToiType = PxsCCDPair::eEstimate;
+				pair.mMinToi = PX_MAX_REAL;
+				nbSkipped++;
+				continue;
+			}
+
+			pair.sweepEstimateToi();
 		}
+
+		Ps::atomicAdd(mNbSweeps, PxI32(mNumPairs) - nbSkipped);
+		if (nbSkipped)
+			Ps::atomicAdd(mNbSkippedSweeps, nbSkipped);
 	}
 
 	virtual const char *getName() const
@@ -872,6 +901,9 @@ private:
 
 #define ENABLE_RESWEEP 1
 
+// number of island batches per worker thread handed out to PxsCCDAdvanceTask
+#define CCD_ADVANCE_BATCHES_PER_THREAD 4
+
 // --------------------------------------------------------------
 /**
 \brief Class to advance a set of islands
@@ -903,7 +935,7 @@ public:
 				PxU32 firstIslandPair, PxU32 firstThreadIsland, PxU32 islandsPerThread, PxU32 totalIslands, 
 				PxsCCDBody** islandBodies, PxU16* numIslandBodies, bool clipTrajectory, bool disableResweep,
 				PxI32* sweepTotalHits)
-		:	Cm::Task(context->getContextId()), mCCDPairs(pairs), mNumPairs(nPairs), mContext(context), mCCDContext(ccdContext), mDt(dt),
+		:	Cm::Task(context->getContextId(), PxSceneMemoryCategory::eCCD), mCCDPairs(pairs), mNumPairs(nPairs), mContext(context), mCCDContext(ccdContext), mDt(dt),
 			mCCDPass(ccdPass), mCCDBodies(ccdBodies), mFirstThreadIsland(firstThreadIsland), 
 			mIslandsPerThread(islandsPerThread), mTotalIslandCount(totalIslands), mFirstIslandPair(firstIslandPair),
 			mIslandBodies(islandBodies), mNumIslandBodies(numIslandBodies),	mSweepTotalHits(sweepTotalHits),
@@ -1079,6 +1111,13 @@ public:
 				if (advanced && pair.mMinToi <= 1.0f)
 				{
 					sweepTotalHits++;
+
+					//The next pass has to sweep this pair again. Kinematics are shared between islands and never move in the CCD so they are not flagged.
+					if (pair.mBa0 && !pair.mBa0->isKinematic())
+						pair.mBa0->mCCD->mHadHitThisPass = true;
+					if (pair.mBa1 && !pair.mBa1->isKinematic())
+						pair.mBa1->mCCD->mHadHitThisPass = true;
+
 					PxU32 islandStartIndex = iIsland == 0 ? 0 : PxU32(mNumIslandBodies[iIsland - 1]);
 					PxU32 islandEndIndex = mNumIslandBodies[iIsland];
 
@@ -1321,6 +1360,9 @@ void PxsCCDContext::updateCCD(PxReal dt, PxBaseTask* continuation, bool disableR
 		return;
 	}
 	mSweepTotalHits = 0;
+	mNbSweeps = 0;
+	mNbSkippedSweeps = 0;
+	mPassStartTime = Ps::Time::getCurrentCounterValue();
 
 	PX_ASSERT(continuation);
 	PX_ASSERT(continuation->getReference() > 0);
@@ -1489,6 +1531,9 @@ void PxsCCDContext::updateCCD(PxReal dt, PxBaseTask* continuation, bool disableR
 							b->mCCD->mUpdateCount = 0;
 							b->mCCD->mHasAnyPassDone = false;
 							b->mCCD->mNbInteractionsThisPass = 0;
+							b->mCCD->mPassStartUpdateCount = 0;
+							b->mCCD->mHadHitThisPass = false;
+							b->mCCD->mNeedsSweep = true;
 						}
 						b->mCCD->mPassDone = 0;
 						b->mCCD->mNbInteractionsThisPass++;
@@ -1714,6 +1759,9 @@ void PxsCCDContext::updateCCD(PxReal dt, PxBaseTask* continuation, bool disableR
 	const PxU32 nPairs = mCCDPtrPairs.size();
 	const PxU32 numThreads = PxMax(1u, mContext->mTaskManager->getCpuDispatcher()->getWorkerCount()); PX_ASSERT(numThreads > 0);
 	mCCDPairsPerBatch = PxMax<PxU32>((nPairs)/numThreads, 1);
+	//The cost of advancing an island varies a lot with its number of impacts and resweeps, so islands are handed out in smaller
+	//batches than the sweeps to balance the load
+	mCCDAdvancePairsPerBatch = PxMax<PxU32>((nPairs)/(numThreads*CCD_ADVANCE_BATCHES_PER_THREAD), 1);
 
 	for (PxU32 batchBegin = 0; batchBegin < nPairs; batchBegin += mCCDPairsPerBatch)
 	{
@@ -1721,7 +1769,8 @@ void PxsCCDContext::updateCCD(PxReal dt, PxBaseTask* continuation, bool disableR
 		PX_ASSERT_WITH_MESSAGE(ptr, "Failed to allocate PxsCCDSweepTask");
 		const PxU32 batchEnd = PxMin(nPairs, batchBegin + mCCDPairsPerBatch);
 		PX_ASSERT(batchEnd >= batchBegin);
-		PxsCCDSweepTask* task = PX_PLACEMENT_NEW(ptr, PxsCCDSweepTask)(mContext->getContextId(), mCCDPtrPairs.begin() + batchBegin, batchEnd - batchBegin);
+		PxsCCDSweepTask* task = PX_PLACEMENT_NEW(ptr, PxsCCDSweepTask)(mContext->getContextId(), mCCDPtrPairs.begin() + batchBegin, batchEnd - batchBegin,
+			miCCDPass, &mNbSweeps, &mNbSkippedSweeps);
 		task->setContinuation(*mContext->mTaskManager, &mPostCCDSweepTask);
 		task->removeReference();
 	}
@@ -1742,11 +1791,11 @@ void PxsCCDContext::postCCDSweep(PxBaseTask* continuation)
 		PxU32 pairSum = 0;
 		PxU32 lastIslandInBatch = firstIslandInBatch+1;
 		PxU32 j;
-		// add up the numbers in the histogram until we reach target pairsPerBatch
+		// add up the numbers in the histogram until we reach target advancePairsPerBatch
 		for (j = firstIslandInBatch; j < islandCount; j++)
 		{
 			pairSum += mCCDIslandHistogram[j];
-			if (pairSum > mCCDPairsPerBatch)
+			if (pairSum > mCCDAdvancePairsPerBatch)
 			{
 				lastIslandInBatch = j+1;
 				break;
@@ -1925,12 +1974,27 @@ void PxsCCDContext::postCCDDepenetrate(PxBaseTask* /*continuation*/)
 
 	for (PxU32 j = 0; j < mCCDBodies.size(); j ++)
 	{
-		mCCDBodies[j].mOverlappingObjects = NULL;
-		mCCDBodies[j].mNbInteractionsThisPass = 0;
+		PxsCCDBody& body = mCCDBodies[j];
+		body.mOverlappingObjects = NULL;
+		body.mNbInteractionsThisPass = 0;
+
+		// remember which bodies the next pass has to sweep again
+		body.mNeedsSweep = body.mHadHitThisPass || body.mUpdateCount != body.mPassStartUpdateCount;
+		body.mPassStartUpdateCount = body.mUpdateCount;
+		body.mHadHitThisPass = false;
 	}
 
 	mCCDOverlaps.clear_NoDelete();
 
+#if PX_ENABLE_SIM_STATS
+	PxvSimStats& simStats = mContext->getSimStats();
+	const PxU32 passTime = PxU32(Ps::Time::getCounterFrequency().toTensOfNanos(Ps::Time::getCurrentCounterValue() - mPassStartTime) / 100);
+	simStats.mCCDPassTime[PxMin(miCCDPass, PxU32(PxSimulationStatistics::eMAX_CCD_PASSES - 1))] += passTime;
+	simStats.mNbCCDPasses++;
+	simStats.mNbCCDSweeps += PxU32(mNbSweeps);
+	simStats.mNbCCDSkippedSweeps += PxU32(mNbSkippedSweeps);
+#endif
+
 	updateCCDEnd();
 
 	mContext->putNpThreadContext(mCCDThreadContext);
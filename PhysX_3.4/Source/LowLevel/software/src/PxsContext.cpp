@@ -76,6 +76,7 @@ PxsContext::PxsContext(const PxSceneDesc& desc, PxTaskManager* taskManager, Cm::
 	mPCM						(desc.flags & PxSceneFlag::eENABLE_PCM),
 	mContactCache				(false),
 	mCreateAveragePoint			(desc.flags & PxSceneFlag::eENABLE_AVERAGE_POINT),
+	mContactReplayThreshold		(desc.contactReplayThreshold),
 	mContextID					(contextID)
 {
 	clearManagerTouchEvents();
@@ -427,8 +428,19 @@ void PxsContext::mergeCMDiscreteUpdateResults(PxBaseTask* /*continuation*/)
 
 		mSimStats.mNbDiscreteContactPairsWithCacheHits += threadContext->mNbDiscreteContactPairsWithCacheHits;
 		mSimStats.mNbDiscreteContactPairsWithContacts += threadContext->mNbDiscreteContactPairsWithContacts;
+		mSimStats.mNbDiscreteContactPairsReplayed += threadContext->mNbDiscreteContactPairsReplayed;
 
 		mSimStats.mTotalCompressedContactSize += threadContext->mCompressedCacheSize;
+#endif
+		// give the blocks the thread context did not need this frame back to the shared pool
+		threadContext->mContactBlockStream.getMemBlockArena().releaseIdleBlocks();
+		threadContext->mNpCacheStreamPair.getMemBlockArena().releaseIdleBlocks();
+
+#if PX_ENABLE_SIM_STATS
+		const PxcNpMemBlockArena& contactArena = threadContext->mContactBlockStream.getMemBlockArena();
+		const PxcNpMemBlockArena& npCacheArena = threadContext->mNpCacheStreamPair.getMemBlockArena();
+		mSimStats.mNbNpArenaBlocks += contactArena.getNbBlocks() + npCacheArena.getNbBlocks();
+		mSimStats.mNbNpArenaOverflowBlocks += contactArena.getNbOverflowBlocks() + npCacheArena.getNbOverflowBlocks();
 		//KS - this data is not available yet
 		//mSimStats.mTotalConstraintSize += threadContext->mConstraintSize;
 		threadContext->clearStats();
@@ -593,6 +605,8 @@ bool PxsContext::fillManagerPatchChangedEvents(PxsContactManager** foundPatch, P
 
 void PxsContext::beginUpdate()
 {
+	mNpMemBlockPool.resetFramePeakUsedBlockCount();
+
 #if PX_ENABLE_SIM_STATS
 	mSimStats.clearAll();
 #endif
@@ -30,6 +30,7 @@
 #include "PxsIslandSim.h"
 #include "PsSort.h"
 #include "PsUtilities.h"
+#include "PsAtomic.h"
 #include "foundation/PxProfiler.h"
 
 #define IG_SANITY_CHECKS 0
@@ -59,9 +60,10 @@ namespace IG
 		mActivatingNodes(PX_DEBUG_EXP("IslandSim::mActivatingNodes")),
 		mDestroyedEdges(PX_DEBUG_EXP("IslandSim::mDestroyedEdges")),
 		mTempIslandIds(PX_DEBUG_EXP("IslandSim::mTempIslandIds")),
-		//mPriorityQueue(PX_DEBUG_EXP("IslandSim::mPriorityQueue")),
-		mVisitedNodes(PX_DEBUG_EXP("IslandSim::mVisitedNodes")),
-		//mVisitedState(PX_DEBUG_EXP("IslandSim::mVisitedState"))
+		mDirtyIslandNodes(PX_DEBUG_EXP("IslandSim::mDirtyIslandNodes")),
+		mDirtyIslandStarts(PX_DEBUG_EXP("IslandSim::mDirtyIslandStarts")),
+		mDirtyIslandIndex(0),
+		mRepairIslands(PX_DEBUG_EXP("IslandSim::mRepairIslands")),
 		mFirstPartitionEdges(firstPartitionEdges),
 		mEdgeNodeIndices(edgeNodeIndices),
 		mDestroyedPartitionEdges(destroyedPartitionEdges),
@@ -627,7 +629,7 @@ bool IslandSim::canFindRoot(NodeIndex startNode, NodeIndex targetNode, Ps::Array
 
 
 
-void IslandSim::unwindRoute(PxU32 traversalIndex, NodeIndex lastNode, PxU32 hopCount, IslandId id)
+void IslandSim::unwindRoute(TraversalScratch& scratch, PxU32 traversalIndex, NodeIndex lastNode, PxU32 hopCount, IslandId id)
 {
 	//We have found either a witness *or* the root node with this traversal. In the event of finding the root node, hopCount will be 0. In the event of finding
 	//a witness, hopCount will be the hopCount that witness reported as being the distance to the root.
@@ -636,7 +638,7 @@ void IslandSim::unwindRoute(PxU32 traversalIndex, NodeIndex lastNode, PxU32 hopC
 	PxU32 hc = hopCount+1; //Add on 1 for the hop to the witness/root node.
 	do
 	{
-		TraversalState& state = mVisitedNodes[currIndex];
+		TraversalState& state = scratch.mVisitedNodes[currIndex];
 		mHopCounts[state.mNodeIndex.index()] = hc++;
 		mIslandIds[state.mNodeIndex.index()] = id;
 		mFastRoute[state.mNodeIndex.index()] = lastNode;
@@ -1176,14 +1178,14 @@ bool IslandSim::isPathTo(NodeIndex startNode, NodeIndex targetNode)
 	return false;
 }
 
-bool IslandSim::tryFastPath(NodeIndex startNode, NodeIndex targetNode, IslandId islandId)
+bool IslandSim::tryFastPath(TraversalScratch& scratch, NodeIndex startNode, NodeIndex targetNode, IslandId islandId)
 {
 	PX_UNUSED(startNode);
 	PX_UNUSED(targetNode);
 
 	NodeIndex currentNode = startNode;
 
-	PxU32 currentVisitedNodes = mVisitedNodes.size();
+	PxU32 currentVisitedNodes = scratch.mVisitedNodes.size();
 
 	PxU32 depth = 0;
 	
@@ -1192,7 +1194,7 @@ bool IslandSim::tryFastPath(NodeIndex startNode, NodeIndex targetNode, IslandId
 	{
 		//Get the fast path from this node...
 		
-		if(mVisitedState.test(currentNode.index()))
+		if(scratch.mVisitedState.test(currentNode.index()))
 		{
 			found = mIslandIds[currentNode.index()] != IG_INVALID_ISLAND; //Already visited and not tagged with invalid island == a witness!
 			break;
@@ -1203,38 +1205,38 @@ bool IslandSim::tryFastPath(NodeIndex startNode, NodeIndex targetNode, IslandId
 			break;
 		}
 
-		mVisitedNodes.pushBack(TraversalState(currentNode, mVisitedNodes.size(), mVisitedNodes.size()-1, depth++));
+		scratch.mVisitedNodes.pushBack(TraversalState(currentNode, scratch.mVisitedNodes.size(), scratch.mVisitedNodes.size()-1, depth++));
 
 		PX_ASSERT(mFastRoute[currentNode.index()].index() == IG_INVALID_NODE || isPathTo(currentNode, mFastRoute[currentNode.index()]));
 
 		mIslandIds[currentNode.index()] = IG_INVALID_ISLAND;
-		mVisitedState.set(currentNode.index());
+		scratch.mVisitedState.set(currentNode.index());
 
 		currentNode = mFastRoute[currentNode.index()];
 	}
 	while(currentNode.index() != IG_INVALID_NODE);
 
-	for(PxU32 a = currentVisitedNodes; a < mVisitedNodes.size(); ++a)
+	for(PxU32 a = currentVisitedNodes; a < scratch.mVisitedNodes.size(); ++a)
 	{
-		TraversalState& state = mVisitedNodes[a];
+		TraversalState& state = scratch.mVisitedNodes[a];
 		mIslandIds[state.mNodeIndex.index()] = islandId;
 	}
 
 	if(!found)
 	{
-		for(PxU32 a = currentVisitedNodes; a < mVisitedNodes.size(); ++a)
+		for(PxU32 a = currentVisitedNodes; a < scratch.mVisitedNodes.size(); ++a)
 		{
-			TraversalState& state = mVisitedNodes[a];
-			mVisitedState.reset(state.mNodeIndex.index());
+			TraversalState& state = scratch.mVisitedNodes[a];
+			scratch.mVisitedState.reset(state.mNodeIndex.index());
 		}
 
-		mVisitedNodes.forceSize_Unsafe(currentVisitedNodes);
+		scratch.mVisitedNodes.forceSize_Unsafe(currentVisitedNodes);
 	}
 	return found;
 
 }
 
-bool IslandSim::findRoute(NodeIndex startNode, NodeIndex targetNode, IslandId islandId)
+bool IslandSim::findRoute(TraversalScratch& scratch, NodeIndex startNode, NodeIndex targetNode, IslandId islandId)
 {
 
 	//Firstly, traverse the fast path and tag up witnesses. TryFastPath can fail. In that case, no witnesses are left but this node is permitted to report
@@ -1242,7 +1244,7 @@ bool IslandSim::findRoute(NodeIndex startNode, NodeIndex targetNode, IslandId is
 	//and tagging up the visited nodes
 	if(mFastRoute[startNode.index()].index() != IG_INVALID_NODE)
 	{
-		if(tryFastPath(startNode, targetNode, islandId))
+		if(tryFastPath(scratch, startNode, targetNode, islandId))
 			return true;
 
 		//Try fast path can either be successful or not. If it was successful, then we had a valid fast path cached and all nodes on that fast path were tagged
@@ -1260,14 +1262,14 @@ bool IslandSim::findRoute(NodeIndex startNode, NodeIndex targetNode, IslandId is
 		//as new edges are formed or when traversals occur to re-establish islands. As a result, they may be inaccurate but they still serve the purpose
 		//of guiding our search to minimize the chances of us doing an exhaustive search to find the root node.
 		mIslandIds[startNode.index()] = IG_INVALID_ISLAND;
-		TraversalState* startTraversal = &mVisitedNodes.pushBack(TraversalState(startNode, mVisitedNodes.size(), IG_INVALID_NODE, 0));
-		mVisitedState.set(startNode.index());
+		TraversalState* startTraversal = &scratch.mVisitedNodes.pushBack(TraversalState(startNode, scratch.mVisitedNodes.size(), IG_INVALID_NODE, 0));
+		scratch.mVisitedState.set(startNode.index());
 		QueueElement element(startTraversal, mHopCounts[startNode.index()]);
-		mPriorityQueue.push(element);
+		scratch.mPriorityQueue.push(element);
 
 		do
 		{
-			QueueElement currentQE = mPriorityQueue.pop();
+			QueueElement currentQE = scratch.mPriorityQueue.pop();
 
 			TraversalState& currentState = *currentQE.mState;
 
@@ -1286,11 +1288,11 @@ bool IslandSim::findRoute(NodeIndex startNode, NodeIndex targetNode, IslandId is
 					{
 						if(nextIndex.index() == targetNode.index())
 						{
-							unwindRoute(currentState.mCurrentIndex, nextIndex, 0, islandId);
+							unwindRoute(scratch, currentState.mCurrentIndex, nextIndex, 0, islandId);
 							return true;
 						}
 
-						if(mVisitedState.test(nextIndex.index()))
+						if(scratch.mVisitedState.test(nextIndex.index()))
 						{
 							//We already visited this node. This means that it's either in the priority queue already or we 
 							//visited in on a previous pass. If it was visited on a previous pass, then it already knows what island it's in. 
@@ -1304,17 +1306,17 @@ bool IslandSim::findRoute(NodeIndex startNode, NodeIndex targetNode, IslandId is
 								//because that would caused me to have been visited already because totally separate islands trigger a full traversal on 
 								//the orphaned side.
 								PX_ASSERT(visitedIslandId == islandId);
-								unwindRoute(currentState.mCurrentIndex, nextIndex, mHopCounts[nextIndex.index()], islandId);
+								unwindRoute(scratch, currentState.mCurrentIndex, nextIndex, mHopCounts[nextIndex.index()], islandId);
 								return true;
 							}
 						}
 						else
 						{
 							//This node has not been visited yet, so we need to push it into the stack and continue traversing
-							TraversalState* state = &mVisitedNodes.pushBack(TraversalState(nextIndex, mVisitedNodes.size(), currentState.mCurrentIndex, currentState.mDepth+1));
+							TraversalState* state = &scratch.mVisitedNodes.pushBack(TraversalState(nextIndex, scratch.mVisitedNodes.size(), currentState.mCurrentIndex, currentState.mDepth+1));
 							QueueElement qe(state, mHopCounts[nextIndex.index()]);
-							mPriorityQueue.push(qe);
-							mVisitedState.set(nextIndex.index());
+							scratch.mPriorityQueue.push(qe);
+							scratch.mVisitedState.set(nextIndex.index());
 							PX_ASSERT(mIslandIds[nextIndex.index()] == islandId);
 							mIslandIds[nextIndex.index()] = IG_INVALID_ISLAND; //Flag as invalid island until we know whether we can find root or an island id.
 						}
@@ -1324,7 +1326,7 @@ bool IslandSim::findRoute(NodeIndex startNode, NodeIndex targetNode, IslandId is
 				edge = instance.mNextEdge;
 			}
 		}
-		while(mPriorityQueue.size());
+		while(scratch.mPriorityQueue.size());
 
 		return false;
 	}
@@ -1332,6 +1334,12 @@ bool IslandSim::findRoute(NodeIndex startNode, NodeIndex targetNode, IslandId is
 
 #define IG_LIMIT_DIRTY_NODES 0
 
+//The parallel island repair is disabled until a scene shows a win: in SnippetIslandSplitBenchmark the repair tasks queue
+//behind the solver and spend more time in total than the serial pass. Define to 1 to measure it.
+#ifndef IG_PARALLEL_ISLAND_REPAIR
+#define IG_PARALLEL_ISLAND_REPAIR 0
+#endif
+
 
 void IslandSim::processLostEdges(Ps::Array<NodeIndex>& destroyedNodes, bool allowDeactivation, bool permitKinematicDeactivation,
 	PxU32 dirtyNodeLimit)
@@ -1340,19 +1348,18 @@ void IslandSim::processLostEdges(Ps::Array<NodeIndex>& destroyedNodes, bool allo
 	PX_PROFILE_ZONE("Basic.processLostEdges", getContextId());
 	//At this point, all nodes and edges are activated. 
 
-	//Bit map for visited
-	mVisitedState.resizeAndClear(mNodes.size());
-	
-	//Reserve space on priority queue for at least 1024 nodes. It will resize if more memory is required during traversal.
-	mPriorityQueue.reserve(1024);
+	removeLostEdgesFromIslands();
+
+	if (allowDeactivation)
+		findPathsAndBreakIslands(dirtyNodeLimit);
 
-	mIslandSplitEdges[0].reserve(1024);
-	mIslandSplitEdges[1].reserve(1024);
+	finishLostEdges(destroyedNodes, allowDeactivation, permitKinematicDeactivation);
+}
 
-	mVisitedNodes.reserve(mNodes.size()); //Make sure we have enough space for all nodes!
+void IslandSim::removeLostEdgesFromIslands()
+{
+	mTraversalScratch.reset(mNodes.size());
 
-	const PxU32 nbDestroyedEdges = mDestroyedEdges.size();
-	PX_UNUSED(nbDestroyedEdges);
 	{
 		PX_PROFILE_ZONE("Basic.removeEdgesFromIslands", getContextId());
 		for(PxU32 a = 0; a < mDestroyedEdges.size(); ++a)
@@ -1415,281 +1422,452 @@ void IslandSim::processLostEdges(Ps::Array<NodeIndex>& destroyedNodes, bool allo
 			}
 		}
 	}
+}
 
-	if (allowDeactivation)
-	{
-		PX_PROFILE_ZONE("Basic.findPathsAndBreakIslands", getContextId());
-		
+void IslandSim::findPathsAndBreakIslands(PxU32 dirtyNodeLimit)
+{
+	PX_UNUSED(dirtyNodeLimit);
+	PX_PROFILE_ZONE("Basic.findPathsAndBreakIslands", getContextId());
+	
 
-		//KS - process only this many dirty nodes, deferring future dirty nodes to subsequent frames. 
-		//This means that it may take several frames for broken edges to trigger islands to completely break but this is better
-		//than triggering large performance spikes.
+	//KS - process only this many dirty nodes, deferring future dirty nodes to subsequent frames. 
+	//This means that it may take several frames for broken edges to trigger islands to completely break but this is better
+	//than triggering large performance spikes.
 #if IG_LIMIT_DIRTY_NODES
-		Cm::BitMap::CircularIterator iter(mDirtyMap, mLastMapIndex);
-		const PxU32 MaxCount = dirtyNodeLimit;// +10000000;
-		PxU32 lastMapIndex = mLastMapIndex;
-		PxU32 count = 0;
+	Cm::BitMap::CircularIterator iter(mDirtyMap, mLastMapIndex);
+	const PxU32 MaxCount = dirtyNodeLimit;// +10000000;
+	PxU32 lastMapIndex = mLastMapIndex;
+	PxU32 count = 0;
 #else
-		Cm::BitMap::Iterator iter(mDirtyMap);
+	Cm::BitMap::Iterator iter(mDirtyMap);
 #endif
 
-		
-		PxU32 dirtyIdx;
-		
+	
+	PxU32 dirtyIdx;
+	
 #if IG_LIMIT_DIRTY_NODES
-		while ((dirtyIdx = iter.getNext()) != Cm::BitMap::CircularIterator::DONE
-			&& (count++ < MaxCount)
+	while ((dirtyIdx = iter.getNext()) != Cm::BitMap::CircularIterator::DONE
+		&& (count++ < MaxCount)
 #else
-		while ((dirtyIdx = iter.getNext()) != Cm::BitMap::Iterator::DONE
+	while ((dirtyIdx = iter.getNext()) != Cm::BitMap::Iterator::DONE
 #endif
-			)
-		{
+		)
+	{
+#if IG_LIMIT_DIRTY_NODES
+		lastMapIndex = dirtyIdx + 1;
+#endif
+		processDirtyNode(mTraversalScratch, NodeIndex(dirtyIdx), false);
 #if IG_LIMIT_DIRTY_NODES
-			lastMapIndex = dirtyIdx + 1;
+		mDirtyMap.reset(dirtyIdx);
 #endif
-			//Process dirty nodes. Figure out if we can make our way from the dirty node to the root.
+	}
 
-			mPriorityQueue.clear(); //Clear the queue used for traversal
-			mVisitedNodes.forceSize_Unsafe(0); //Clear the list of nodes in this island
-			NodeIndex dirtyNodeIndex(dirtyIdx);
-			Node& dirtyNode = mNodes[dirtyNodeIndex.index()];
-		
-			//Check whether this node has already been touched. If it has been touched this frame, then its island state is reliable 
-			//and we can just unclear the dirty flag on the body. If we were already visited, then the state should have already been confirmed in a 
-			//previous pass.
-			if(!dirtyNode.isKinematic() && !dirtyNode.isDeleted() && !mVisitedState.test(dirtyNodeIndex.index()))
-			{
-				//We haven't visited this node in our island repair passes yet, so we still need to process until we've hit a visited node or found
-				//our root node. Note that, as soon as we hit a visited node that has already been processed in a previous pass, we know that we can rely
-				//on its island information although the hop counts may not be optimal. It also indicates that this island was not broken immediately because
-				//otherwise, the entire new sub-island would already have been visited and this node would have already had its new island state assigned.
+	
 
-				//Indicate that I've been visited
+#if IG_LIMIT_DIRTY_NODES
+	mLastMapIndex = lastMapIndex;
+	if (count < MaxCount)
+		mLastMapIndex = 0;
+#else
+	mDirtyMap.clear();
+#endif
+	
+	//mDirtyNodes.forceSize_Unsafe(0);
+}
 
-				IslandId islandId = mIslandIds[dirtyNodeIndex.index()];
-				Island& findIsland = mIslands[islandId];
+void IslandSim::processDirtyNode(TraversalScratch& scratch, NodeIndex dirtyNodeIndex, bool parallel)
+{
+	//Process dirty nodes. Figure out if we can make our way from the dirty node to the root.
 
-				NodeIndex searchNode = findIsland.mRootNode;//The node that we're searching for!
+	scratch.mPriorityQueue.clear(); //Clear the queue used for traversal
+	scratch.mVisitedNodes.forceSize_Unsafe(0); //Clear the list of nodes in this island
+	Node& dirtyNode = mNodes[dirtyNodeIndex.index()];
 
-				if(searchNode.index() != dirtyNodeIndex.index()) //If we are the root node, we don't need to do anything!
-				{
-					if(findRoute(dirtyNodeIndex, searchNode, islandId))
-					{
-						//We found the root node so let's let every visited node know that we found its root
-						//and we can also update our hop counts because we recorded how many hops it took to reach this
-						//node
+	//Check whether this node has already been touched. If it has been touched this frame, then its island state is reliable 
+	//and we can just unclear the dirty flag on the body. If we were already visited, then the state should have already been confirmed in a 
+	//previous pass.
+	if(!dirtyNode.isKinematic() && !dirtyNode.isDeleted() && !scratch.mVisitedState.test(dirtyNodeIndex.index()))
+	{
+		//We haven't visited this node in our island repair passes yet, so we still need to process until we've hit a visited node or found
+		//our root node. Note that, as soon as we hit a visited node that has already been processed in a previous pass, we know that we can rely
+		//on its island information although the hop counts may not be optimal. It also indicates that this island was not broken immediately because
+		//otherwise, the entire new sub-island would already have been visited and this node would have already had its new island state assigned.
+
+		//Indicate that I've been visited
+
+		IslandId islandId = mIslandIds[dirtyNodeIndex.index()];
+		Island& findIsland = mIslands[islandId];
+
+		NodeIndex searchNode = findIsland.mRootNode;//The node that we're searching for!
 
-						//We already filled in the path to the root/witness with accurate hop counts. Now we just need to fill in the estimates
-						//for the remaining nodes and re-define their islandIds. We approximate their path to the root by just routing them through
-						//the route we already found.
+		if(searchNode.index() != dirtyNodeIndex.index()) //If we are the root node, we don't need to do anything!
+		{
+			if(findRoute(scratch, dirtyNodeIndex, searchNode, islandId))
+			{
+				//We found the root node so let's let every visited node know that we found its root
+				//and we can also update our hop counts because we recorded how many hops it took to reach this
+				//node
+
+				//We already filled in the path to the root/witness with accurate hop counts. Now we just need to fill in the estimates
+				//for the remaining nodes and re-define their islandIds. We approximate their path to the root by just routing them through
+				//the route we already found.
 
-						//This loop works because mVisitedNodes are recorded in the order they were visited and we already filled in the critical path
-						//so the remainder of the paths will just fork from that path.
+				//This loop works because scratch.mVisitedNodes are recorded in the order they were visited and we already filled in the critical path
+				//so the remainder of the paths will just fork from that path.
 
-						//Verify state (that we can see the root from this node)...
+				//Verify state (that we can see the root from this node)...
 
 	#if IG_SANITY_CHECKS
-						PX_ASSERT(canFindRoot(dirtyNode, searchNode, NULL)); //Verify that we found the connection
+				PX_ASSERT(canFindRoot(dirtyNode, searchNode, NULL)); //Verify that we found the connection
 	#endif
 
-						for(PxU32 b = 0; b < mVisitedNodes.size(); ++b)
-						{
-							TraversalState& state = mVisitedNodes[b];
-							if(mIslandIds[state.mNodeIndex.index()] == IG_INVALID_ISLAND)
-							{
-								mHopCounts[state.mNodeIndex.index()] = mHopCounts[mVisitedNodes[state.mPrevIndex].mNodeIndex.index()]+1; 
-								mFastRoute[state.mNodeIndex.index()] = mVisitedNodes[state.mPrevIndex].mNodeIndex;
-								mIslandIds[state.mNodeIndex.index()] = islandId;
-							}
-						}
-					}
-					else
+				for(PxU32 b = 0; b < scratch.mVisitedNodes.size(); ++b)
+				{
+					TraversalState& state = scratch.mVisitedNodes[b];
+					if(mIslandIds[state.mNodeIndex.index()] == IG_INVALID_ISLAND)
 					{
-						//If I traversed and could not find the root node, then I have established a new island. In this island, I am the root node
-						//and I will point all my nodes towards me. Furthermore, I have established how many steps it took to reach all nodes in my island
+						mHopCounts[state.mNodeIndex.index()] = mHopCounts[scratch.mVisitedNodes[state.mPrevIndex].mNodeIndex.index()]+1; 
+						mFastRoute[state.mNodeIndex.index()] = scratch.mVisitedNodes[state.mPrevIndex].mNodeIndex;
+						mIslandIds[state.mNodeIndex.index()] = islandId;
+					}
+				}
+			}
+			else
+			{
+				//If I traversed and could not find the root node, then I have established a new island. In this island, I am the root node
+				//and I will point all my nodes towards me. Furthermore, I have established how many steps it took to reach all nodes in my island
 
-						//OK. We need to separate the islands. We have a list of nodes that are part of the new island (mVisitedNodes) and we know that the 
-						//first node in that list is the root node.
+				//OK. We need to separate the islands. We have a list of nodes that are part of the new island (scratch.mVisitedNodes) and we know that the 
+				//first node in that list is the root node.
 
 
-						//OK, we need to remove all these actors from their current island, then add them to the new island...
+				//OK, we need to remove all these actors from their current island, then add them to the new island...
 
-						Island& oldIsland = mIslands[islandId];
-						//We can just unpick these nodes from the island because they do not contain the root node (if they did, then we wouldn't be
-						//removing this node from the island at all). The only challenge is if we need to remove the last node. In that case
-						//we need to re-establish the new last node in the island but perhaps the simplest way to do that would be to traverse
-						//the island to establish the last node again
+				Island& oldIsland = mIslands[islandId];
+				//We can just unpick these nodes from the island because they do not contain the root node (if they did, then we wouldn't be
+				//removing this node from the island at all). The only challenge is if we need to remove the last node. In that case
+				//we need to re-establish the new last node in the island but perhaps the simplest way to do that would be to traverse
+				//the island to establish the last node again
 
 	#if IG_SANITY_CHECKS
-						PX_ASSERT(!canFindRoot(dirtyNode, searchNode, NULL));
+				PX_ASSERT(!canFindRoot(dirtyNode, searchNode, NULL));
 	#endif
 
-						PxU32 totalStaticTouchCount = 0;
-						mIslandSplitEdges[0].forceSize_Unsafe(0);
-						mIslandSplitEdges[1].forceSize_Unsafe(0);
-						PxU32 size[2] = {0,0};
+				PxU32 totalStaticTouchCount = 0;
+				scratch.mIslandSplitEdges[0].forceSize_Unsafe(0);
+				scratch.mIslandSplitEdges[1].forceSize_Unsafe(0);
+				PxU32 size[2] = {0,0};
 
-						//NodeIndex lastIndex = oldIsland.mLastNode;
+				//NodeIndex lastIndex = oldIsland.mLastNode;
 
-						//size[node.mType] = 1;
+				//size[node.mType] = 1;
 
-						for(PxU32 a = 0; a < mVisitedNodes.size(); ++a)
-						{
-							NodeIndex index = mVisitedNodes[a].mNodeIndex;
-							Node& node = mNodes[index.index()];
-
-							if(node.mNextNode.index() != IG_INVALID_NODE)
-								mNodes[node.mNextNode.index()].mPrevNode = node.mPrevNode;
-							else
-								oldIsland.mLastNode = node.mPrevNode;
-							if(node.mPrevNode.index() != IG_INVALID_NODE)
-								mNodes[node.mPrevNode.index()].mNextNode = node.mNextNode;
+				for(PxU32 a = 0; a < scratch.mVisitedNodes.size(); ++a)
+				{
+					NodeIndex index = scratch.mVisitedNodes[a].mNodeIndex;
+					Node& node = mNodes[index.index()];
 
-							size[node.mType]++;
+					if(node.mNextNode.index() != IG_INVALID_NODE)
+						mNodes[node.mNextNode.index()].mPrevNode = node.mPrevNode;
+					else
+						oldIsland.mLastNode = node.mPrevNode;
+					if(node.mPrevNode.index() != IG_INVALID_NODE)
+						mNodes[node.mPrevNode.index()].mNextNode = node.mNextNode;
 
-							node.mNextNode.setIndices(IG_INVALID_NODE, 0);
-							node.mPrevNode.setIndices(IG_INVALID_NODE, 0);
+					size[node.mType]++;
 
-							PX_ASSERT(mNodes[oldIsland.mLastNode.index()].mNextNode.index() == IG_INVALID_NODE);
+					node.mNextNode.setIndices(IG_INVALID_NODE, 0);
+					node.mPrevNode.setIndices(IG_INVALID_NODE, 0);
 
-							totalStaticTouchCount += node.mStaticTouchCount;
+					PX_ASSERT(mNodes[oldIsland.mLastNode.index()].mNextNode.index() == IG_INVALID_NODE);
 
-							EdgeInstanceIndex idx = node.mFirstEdgeIndex;
+					totalStaticTouchCount += node.mStaticTouchCount;
 
-							while(idx != IG_INVALID_EDGE)
-							{
-								EdgeInstance& instance = mEdgeInstances[idx];
-								const EdgeIndex edgeIndex = idx/2;
-								Edge& edge = mEdges[edgeIndex];
-								
-								//Only split the island if we're processing the first node or if the first node is infinte-mass
-								if (!(idx & 1) || (mEdgeNodeIndices[idx & (~1)].index() == IG_INVALID_NODE || mNodes[mEdgeNodeIndices[idx & (~1)].index()].isKinematic()))
-								{
-									//We will remove this edge from the island...
-									mIslandSplitEdges[edge.mEdgeType].pushBack(edgeIndex);
+					EdgeInstanceIndex idx = node.mFirstEdgeIndex;
 
-									removeEdgeFromIsland(oldIsland, edgeIndex);	
+					while(idx != IG_INVALID_EDGE)
+					{
+						EdgeInstance& instance = mEdgeInstances[idx];
+						const EdgeIndex edgeIndex = idx/2;
+						Edge& edge = mEdges[edgeIndex];
+						
+						//Only split the island if we're processing the first node or if the first node is infinte-mass
+						if (!(idx & 1) || (mEdgeNodeIndices[idx & (~1)].index() == IG_INVALID_NODE || mNodes[mEdgeNodeIndices[idx & (~1)].index()].isKinematic()))
+						{
+							//We will remove this edge from the island...
+							scratch.mIslandSplitEdges[edge.mEdgeType].pushBack(edgeIndex);
 
-								}
-								idx = instance.mNextEdge;
-							}
+							removeEdgeFromIsland(oldIsland, edgeIndex);	
 
 						}
+						idx = instance.mNextEdge;
+					}
 
-						//oldIsland.mStaticTouchCount -= totalStaticTouchCount;
-						mIslandStaticTouchCount[islandId] -= totalStaticTouchCount;
+				}
 
-						oldIsland.mSize[0] -= size[0];
-						oldIsland.mSize[1] -= size[1];
+				//oldIsland.mStaticTouchCount -= totalStaticTouchCount;
+				mIslandStaticTouchCount[islandId] -= totalStaticTouchCount;
 
-						//Now add all these nodes to the new island
+				oldIsland.mSize[0] -= size[0];
+				oldIsland.mSize[1] -= size[1];
 
-						//(1) Create the new island...
-						IslandId newIslandHandle = mIslandHandles.getHandle();
-						/*if(newIslandHandle == mIslands.capacity())
-						{
-							mIslands.reserve(2*mIslands.capacity() + 1);
-						}*/
-						mIslands.resize(PxMax(newIslandHandle+1, mIslands.size()));
-						mIslandStaticTouchCount.resize(PxMax(newIslandHandle+1, mIslandStaticTouchCount.size()));
-						Island& newIsland = mIslands[newIslandHandle];
-					
-						if(mIslandAwake.test(islandId))
-						{
-							newIsland.mActiveIndex = mActiveIslands.size();
-							mActiveIslands.pushBack(newIslandHandle);
-							mIslandAwake.growAndSet(newIslandHandle); //Separated island, so it should be awake
-						}
-						else
-						{
-							mIslandAwake.growAndReset(newIslandHandle);
-						}
+				//Now add all these nodes to the new island
 
-						newIsland.mRootNode = dirtyNodeIndex;
-						mHopCounts[dirtyNodeIndex.index()] = 0;
-						mIslandIds[dirtyNodeIndex.index()] = newIslandHandle;
-						//newIsland.mTotalSize = mVisitedNodes.size();
+				//(1) Create the new island...
+				IslandId newIslandHandle = createSplitIsland(islandId, parallel);
+				Island& newIsland = mIslands[newIslandHandle];
 
-						mNodes[dirtyNodeIndex.index()].mPrevNode.setIndices(IG_INVALID_NODE, 0); //First node so doesn't have a preceding node
-						mFastRoute[dirtyNodeIndex.index()].setIndices(IG_INVALID_NODE, 0);
+				newIsland.mRootNode = dirtyNodeIndex;
+				mHopCounts[dirtyNodeIndex.index()] = 0;
+				mIslandIds[dirtyNodeIndex.index()] = newIslandHandle;
+				//newIsland.mTotalSize = scratch.mVisitedNodes.size();
 
-						size[0] = 0; size[1] = 0;
+				mNodes[dirtyNodeIndex.index()].mPrevNode.setIndices(IG_INVALID_NODE, 0); //First node so doesn't have a preceding node
+				mFastRoute[dirtyNodeIndex.index()].setIndices(IG_INVALID_NODE, 0);
 
-						size[dirtyNode.mType] = 1;
-					
-						for(PxU32 a = 1; a < mVisitedNodes.size(); ++a)
-						{
-							NodeIndex index = mVisitedNodes[a].mNodeIndex;
-							Node& thisNode = mNodes[index.index()];
-							NodeIndex prevNodeIndex = mVisitedNodes[a-1].mNodeIndex;
-							thisNode.mPrevNode = prevNodeIndex;
-							mNodes[prevNodeIndex.index()].mNextNode = index;
-							size[thisNode.mType]++;
-							mIslandIds[index.index()] = newIslandHandle;
-							mHopCounts[index.index()] = mVisitedNodes[a].mDepth; //How many hops to root
-							mFastRoute[index.index()] = mVisitedNodes[mVisitedNodes[a].mPrevIndex].mNodeIndex;
-						}
+				size[0] = 0; size[1] = 0;
+
+				size[dirtyNode.mType] = 1;
+			
+				for(PxU32 a = 1; a < scratch.mVisitedNodes.size(); ++a)
+				{
+					NodeIndex index = scratch.mVisitedNodes[a].mNodeIndex;
+					Node& thisNode = mNodes[index.index()];
+					NodeIndex prevNodeIndex = scratch.mVisitedNodes[a-1].mNodeIndex;
+					thisNode.mPrevNode = prevNodeIndex;
+					mNodes[prevNodeIndex.index()].mNextNode = index;
+					size[thisNode.mType]++;
+					mIslandIds[index.index()] = newIslandHandle;
+					mHopCounts[index.index()] = scratch.mVisitedNodes[a].mDepth; //How many hops to root
+					mFastRoute[index.index()] = scratch.mVisitedNodes[scratch.mVisitedNodes[a].mPrevIndex].mNodeIndex;
+				}
 
-						newIsland.mSize[0] = size[0];
-						newIsland.mSize[1] = size[1];
-						//Last node in the island
-						NodeIndex lastIndex = mVisitedNodes[mVisitedNodes.size()-1].mNodeIndex;
-						mNodes[lastIndex.index()].mNextNode.setIndices(IG_INVALID_NODE, 0);
-						newIsland.mLastNode = lastIndex;
-						//newIsland.mStaticTouchCount = totalStaticTouchCount;
-						mIslandStaticTouchCount[newIslandHandle] = totalStaticTouchCount;
-						newIsland.mSize[0] = size[0];
-						newIsland.mSize[1] = size[1];
+				newIsland.mSize[0] = size[0];
+				newIsland.mSize[1] = size[1];
+				//Last node in the island
+				NodeIndex lastIndex = scratch.mVisitedNodes[scratch.mVisitedNodes.size()-1].mNodeIndex;
+				mNodes[lastIndex.index()].mNextNode.setIndices(IG_INVALID_NODE, 0);
+				newIsland.mLastNode = lastIndex;
+				//newIsland.mStaticTouchCount = totalStaticTouchCount;
+				mIslandStaticTouchCount[newIslandHandle] = totalStaticTouchCount;
+				newIsland.mSize[0] = size[0];
+				newIsland.mSize[1] = size[1];
 
-						PX_ASSERT(mNodes[newIsland.mLastNode.index()].mNextNode.index() == IG_INVALID_NODE);
+				PX_ASSERT(mNodes[newIsland.mLastNode.index()].mNextNode.index() == IG_INVALID_NODE);
 
-						for(PxU32 j = 0; j < 2; ++j)
+				for(PxU32 j = 0; j < 2; ++j)
+				{
+					Ps::Array<EdgeIndex>& splitEdges = scratch.mIslandSplitEdges[j];
+					const PxU32 splitEdgeSize = splitEdges.size();
+					if(splitEdgeSize)
+					{
+						splitEdges.pushBack(IG_INVALID_EDGE); //Push in a dummy invalid edge to complete the connectivity
+						mEdges[splitEdges[0]].mNextIslandEdge = splitEdges[1];
+						for(PxU32 a = 1; a < splitEdgeSize; ++a)
 						{
-							Ps::Array<EdgeIndex>& splitEdges = mIslandSplitEdges[j];
-							const PxU32 splitEdgeSize = splitEdges.size();
-							if(splitEdgeSize)
-							{
-								splitEdges.pushBack(IG_INVALID_EDGE); //Push in a dummy invalid edge to complete the connectivity
-								mEdges[splitEdges[0]].mNextIslandEdge = splitEdges[1];
-								for(PxU32 a = 1; a < splitEdgeSize; ++a)
-								{
-									EdgeIndex edgeIndex = splitEdges[a];
-									Edge& edge = mEdges[edgeIndex];
-									edge.mNextIslandEdge = splitEdges[a+1];
-									edge.mPrevIslandEdge = splitEdges[a-1];
-								}
-
-								newIsland.mFirstEdge[j] = splitEdges[0];
-								newIsland.mLastEdge[j] = splitEdges[splitEdgeSize-1];
-								newIsland.mEdgeCount[j] = splitEdgeSize;
-							}
+							EdgeIndex edgeIndex = splitEdges[a];
+							Edge& edge = mEdges[edgeIndex];
+							edge.mNextIslandEdge = splitEdges[a+1];
+							edge.mPrevIslandEdge = splitEdges[a-1];
 						}
 
+						newIsland.mFirstEdge[j] = splitEdges[0];
+						newIsland.mLastEdge[j] = splitEdges[splitEdgeSize-1];
+						newIsland.mEdgeCount[j] = splitEdgeSize;
 					}
 				}
 
 			}
-
-			dirtyNode.clearDirty();
-#if IG_LIMIT_DIRTY_NODES
-			mDirtyMap.reset(dirtyIdx);
-#endif
 		}
 
-		
+	}
 
-#if IG_LIMIT_DIRTY_NODES
-		mLastMapIndex = lastMapIndex;
-		if (count < MaxCount)
-			mLastMapIndex = 0;
+	dirtyNode.clearDirty();
+}
+
+IslandId IslandSim::createSplitIsland(IslandId oldIslandId, bool parallel)
+{
+	if(parallel)
+		mRepairIslandLock.lock();
+
+	IslandId newIslandHandle = mIslandHandles.getHandle();
+	
+	//The repair tasks hold references into these arrays so prepareIslandRepair() must have reserved enough space already
+	PX_ASSERT(!parallel || (newIslandHandle < mIslands.capacity() && mActiveIslands.size() < mActiveIslands.capacity()));
+	mIslands.resize(PxMax(newIslandHandle+1, mIslands.size()));
+	mIslandStaticTouchCount.resize(PxMax(newIslandHandle+1, mIslandStaticTouchCount.size()));
+
+	if(mIslandAwake.test(oldIslandId))
+	{
+		mIslands[newIslandHandle].mActiveIndex = mActiveIslands.size();
+		mActiveIslands.pushBack(newIslandHandle);
+		mIslandAwake.growAndSet(newIslandHandle); //Separated island, so it should be awake
+	}
+	else
+	{
+		mIslandAwake.growAndReset(newIslandHandle);
+	}
+
+	if(parallel)
+	{
+		mRepairIslands.pushBack(newIslandHandle);
+		mRepairIslandLock.unlock();
+	}
+
+	return newIslandHandle;
+}
+
+PxU32 IslandSim::prepareIslandRepair(PxU32 maxTasks)
+{
+#if IG_LIMIT_DIRTY_NODES || !IG_PARALLEL_ISLAND_REPAIR
+	//The serial version spreads the dirty nodes over several frames with IG_LIMIT_DIRTY_NODES
+	PX_UNUSED(maxTasks);
+	return 0;
 #else
-		mDirtyMap.clear();
+	if(maxTasks < 2)
+		return 0;
+
+	PX_PROFILE_ZONE("Basic.prepareIslandRepair", getContextId());
+
+	//Group the dirty nodes by island. Within an island, nodes stay sorted by index as in the serial version.
+	mDirtyIslandNodes.forceSize_Unsafe(0);
+	Cm::BitMap::Iterator iter(mDirtyMap);
+	PxU32 dirtyIdx;
+	while((dirtyIdx = iter.getNext()) != Cm::BitMap::Iterator::DONE)
+	{
+		Node& dirtyNode = mNodes[dirtyIdx];
+		const IslandId islandId = mIslandIds[dirtyIdx];
+		if(!dirtyNode.isKinematic() && !dirtyNode.isDeleted() && islandId != IG_INVALID_ISLAND)
+			mDirtyIslandNodes.pushBack((PxU64(islandId) << 32) | dirtyIdx);
+		else
+			dirtyNode.clearDirty(); //Nothing to re-validate
+	}
+
+	const PxU32 nbDirty = mDirtyIslandNodes.size();
+	if(nbDirty)
+		Ps::sort(mDirtyIslandNodes.begin(), nbDirty);
+
+	mDirtyIslandStarts.forceSize_Unsafe(0);
+	for(PxU32 a = 0; a < nbDirty; ++a)
+	{
+		if(a == 0 || (mDirtyIslandNodes[a] >> 32) != (mDirtyIslandNodes[a-1] >> 32))
+			mDirtyIslandStarts.pushBack(a);
+	}
+	const PxU32 nbIslands = mDirtyIslandStarts.size();
+	mDirtyIslandStarts.pushBack(nbDirty);
+
+	//Small workloads are not worth the task overhead
+	const PxU32 MinDirtyNodesPerTask = 128;
+	const PxU32 nbTasks = PxMin(PxMin(maxTasks, PxU32(IG_MAX_ISLAND_REPAIR_TASKS)), PxMin(nbIslands, nbDirty/MinDirtyNodesPerTask));
+	if(nbTasks < 2)
+		return 0;
+
+	//Each dirty node splits off at most one island. Reserve for the worst case so that the arrays are not reallocated
+	//while the repair tasks reference them.
+	mIslands.reserve(mIslands.size() + nbDirty);
+	mIslandStaticTouchCount.reserve(mIslandStaticTouchCount.size() + nbDirty);
+	mActiveIslands.reserve(mActiveIslands.size() + nbDirty);
+	mIslandAwake.resize(mIslands.size() + nbDirty);
+
+	mRepairIslands.forceSize_Unsafe(0);
+	mRepairIslands.reserve(nbDirty);
+	mDirtyIslandIndex = 0;
+
+	return nbTasks;
 #endif
-		
-		//mDirtyNodes.forceSize_Unsafe(0);
+}
+
+void IslandSim::repairIslands(PxU32 taskIndex)
+{
+	PX_PROFILE_ZONE("Basic.repairIslands", getContextId());
+
+	TraversalScratch& scratch = mRepairScratch[taskIndex];
+	scratch.reset(mNodes.size());
+
+	const PxU32 nbIslands = mDirtyIslandStarts.size() - 1;
+	PxU32 islandIndex;
+	while((islandIndex = PxU32(Ps::atomicIncrement(&mDirtyIslandIndex) - 1)) < nbIslands)
+	{
+		const PxU32 end = mDirtyIslandStarts[islandIndex+1];
+		for(PxU32 a = mDirtyIslandStarts[islandIndex]; a < end; ++a)
+			processDirtyNode(scratch, NodeIndex(PxU32(mDirtyIslandNodes[a])), true);
+	}
+}
+
+void IslandSim::finishIslandRepair()
+{
+	PX_PROFILE_ZONE("Basic.finishIslandRepair", getContextId());
+
+	mDirtyMap.clear();
+
+	//The serial version creates the split-off islands in the order of their root (dirty) nodes and hands out the handles
+	//in the order they were popped from the handle manager. Move each island to the handle the serial version would have
+	//given it so that the island ids do not depend on the task scheduling.
+	const PxU32 nbNewIslands = mRepairIslands.size();
+	if(nbNewIslands == 0)
+		return;
+
+	Ps::Array<PxU64> roots;
+	roots.reserve(nbNewIslands);
+	for(PxU32 a = 0; a < nbNewIslands; ++a)
+		roots.pushBack((PxU64(mIslands[mRepairIslands[a]].mRootNode.index()) << 32) | mRepairIslands[a]);
+	Ps::sort(roots.begin(), nbNewIslands);
+
+	bool identity = true;
+	for(PxU32 a = 0; a < nbNewIslands; ++a)
+		identity = identity && IslandId(roots[a]) == mRepairIslands[a];
+	if(identity)
+		return;
+
+	Ps::Array<Island> islands;
+	Ps::Array<PxU32> staticTouchCounts;
+	Ps::Array<bool> awake;
+	islands.reserve(nbNewIslands);
+	staticTouchCounts.reserve(nbNewIslands);
+	awake.reserve(nbNewIslands);
+
+	PxU32 firstActiveIndex = mActiveIslands.size();
+	for(PxU32 a = 0; a < nbNewIslands; ++a)
+	{
+		const IslandId islandId = IslandId(roots[a]);
+		islands.pushBack(mIslands[islandId]);
+		staticTouchCounts.pushBack(mIslandStaticTouchCount[islandId]);
+		awake.pushBack(mIslandAwake.test(islandId) != 0);
+		if(awake[a])
+			firstActiveIndex = PxMin(firstActiveIndex, mIslands[islandId].mActiveIndex);
 	}
 
+	//All split-off active islands were appended to the active island list, re-append them in the serial order
+	mActiveIslands.forceSize_Unsafe(firstActiveIndex);
 
+	for(PxU32 a = 0; a < nbNewIslands; ++a)
+	{
+		const IslandId islandId = mRepairIslands[a];
+		Island& island = mIslands[islandId];
+		island = islands[a];
+		mIslandStaticTouchCount[islandId] = staticTouchCounts[a];
+		if(awake[a])
+		{
+			mIslandAwake.set(islandId);
+			island.mActiveIndex = mActiveIslands.size();
+			mActiveIslands.pushBack(islandId);
+		}
+		else
+		{
+			mIslandAwake.reset(islandId);
+		}
+
+		NodeIndex nodeIndex = island.mRootNode;
+		while(nodeIndex.index() != IG_INVALID_NODE)
+		{
+			mIslandIds[nodeIndex.index()] = islandId;
+			nodeIndex = mNodes[nodeIndex.index()].mNextNode;
+		}
+	}
+}
+
+void IslandSim::finishLostEdges(Ps::Array<NodeIndex>& destroyedNodes, bool allowDeactivation, bool permitKinematicDeactivation)
+{
 	{
 		PX_PROFILE_ZONE("Basic.clearDestroyedEdges", getContextId());
 		//Now process the lost edges...
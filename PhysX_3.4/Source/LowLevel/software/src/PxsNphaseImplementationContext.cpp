@@ -44,10 +44,105 @@
 #include "PxvDynamics.h"
 
 #include "PxcNpContactPrepShared.h"
+#include "PsAtomic.h"
+#include "PsThread.h"
 
 using namespace physx;
 using namespace physx::shdfnd;
 
+// Shares the jobs of a single contact pair between the worker that runs the pair and helper tasks spawned on the other
+// workers. It is allocated from the context's task pool rather than the stack so that a helper starting after all the
+// jobs have been claimed can still read it.
+struct PxsNpJobQueue
+{
+	Gu::NarrowPhaseJob*	mJob;
+	PxI32				mNbJobs;
+	volatile PxI32		mNextJob;
+	volatile PxI32		mNbCompletedJobs;
+
+	void runJobs()
+	{
+		for(;;)
+		{
+			const PxI32 jobIndex = Ps::atomicIncrement(&mNextJob) - 1;
+			if(jobIndex >= mNbJobs)
+				break;
+			mJob->runJob(PxU32(jobIndex));
+			Ps::atomicIncrement(&mNbCompletedJobs);
+		}
+	}
+};
+
+class PxsNpJobHelperTask : public Cm::Task
+{
+	PxsNpJobHelperTask& operator=(const PxsNpJobHelperTask&);
+public:
+	PxsNpJobHelperTask(PxU64 contextId, PxsNpJobQueue& queue) : Cm::Task(contextId, PxSceneMemoryCategory::eNARROW_PHASE), mQueue(queue)
+	{
+	}
+
+	virtual void runInternal()
+	{
+		mQueue.runJobs();
+	}
+
+	virtual const char* getName() const
+	{
+		return "PxsContext.contactManagerJobHelper";
+	}
+
+private:
+	PxsNpJobQueue& mQueue;
+};
+
+// Runs the jobs of a pair on the calling worker and on as many helper tasks as there are other workers. The helpers
+// keep a reference on the batch's continuation, and the caller only returns once every job has completed, so the jobs
+// can safely reference the caller's stack.
+class PxsNpJobDispatcher : public Gu::NarrowPhaseJobDispatcher
+{
+	PxsNpJobDispatcher& operator=(const PxsNpJobDispatcher&);
+public:
+	PxsNpJobDispatcher(PxsContext& context, PxBaseTask* continuation) : mContext(context), mContinuation(continuation)
+	{
+	}
+
+	virtual void run(Gu::NarrowPhaseJob& job, PxU32 nbJobs)
+	{
+		const PxU32 nbWorkers = mContinuation ? mContinuation->getTaskManager()->getCpuDispatcher()->getWorkerCount() : 0;
+		const PxU32 nbHelpers = PxMin(nbJobs, nbWorkers) > 1 ? PxMin(nbJobs, nbWorkers) - 1 : 0;
+		if(!nbHelpers)
+		{
+			for(PxU32 i=0; i<nbJobs; ++i)
+				job.runJob(i);
+			return;
+		}
+
+		Cm::FlushPool& pool = mContext.getTaskPool();
+		PxsNpJobQueue* queue = reinterpret_cast<PxsNpJobQueue*>(pool.allocate(sizeof(PxsNpJobQueue)));
+		queue->mJob = &job;
+		queue->mNbJobs = PxI32(nbJobs);
+		queue->mNextJob = 0;
+		queue->mNbCompletedJobs = 0;
+
+		for(PxU32 i=0; i<nbHelpers; ++i)
+		{
+			PxsNpJobHelperTask* task = PX_PLACEMENT_NEW(pool.allocate(sizeof(PxsNpJobHelperTask)), PxsNpJobHelperTask)(mContext.getContextId(), *queue);
+			task->setContinuation(mContinuation);
+			task->removeReference();
+		}
+
+		queue->runJobs();
+
+		// Jobs claimed by the helpers may still be running
+		while(queue->mNbCompletedJobs != PxI32(nbJobs))
+			Ps::Thread::yield();
+		Ps::memoryBarrier();
+	}
+
+private:
+	PxsContext&		mContext;
+	PxBaseTask*		mContinuation;
+};
 
 class PxsCMUpdateTask : public Cm::Task
 {
@@ -55,11 +150,12 @@ public:
 
 	static const PxU32 BATCH_SIZE = 128;
 
-	PxsCMUpdateTask(PxsContext* context, PxReal dt, PxsContactManager** cmArray, PxsContactManagerOutput* cmOutputs, Gu::Cache* caches, PxU32 cmCount, PxContactModifyCallback* callback) :
-			Cm::Task	(context->getContextId()),
+	PxsCMUpdateTask(PxsContext* context, PxReal dt, PxsContactManager** cmArray, PxsContactManagerOutput* cmOutputs, Gu::Cache* caches, PxcNpContactPoses* contactPoses, PxU32 cmCount, PxContactModifyCallback* callback) :
+			Cm::Task	(context->getContextId(), PxSceneMemoryCategory::eNARROW_PHASE),
 			mCmArray	(cmArray),
 			mCmOutputs	(cmOutputs),
 			mCaches		(caches),
+			mContactPoses(contactPoses),
 			mCmCount	(cmCount),
 			mDt			(dt),
 			mContext	(context),
@@ -80,6 +176,7 @@ protected:
 	PxsContactManager**	mCmArray;
 	PxsContactManagerOutput* mCmOutputs;
 	Gu::Cache* mCaches;
+	PxcNpContactPoses*	mContactPoses;
 	PxU32				mCmCount;
 	PxReal				mDt;		//we could probably retrieve from context to save space?
 	PxsContext*			mContext;
@@ -104,9 +201,9 @@ void PxsCMUpdateTask::release()
 class PxsCMDiscreteUpdateTask : public PxsCMUpdateTask
 {
 public:
-	PxsCMDiscreteUpdateTask(PxsContext* context, PxReal dt, PxsContactManager** cms, PxsContactManagerOutput* cmOutputs, Gu::Cache* caches, PxU32 nbCms,
+	PxsCMDiscreteUpdateTask(PxsContext* context, PxReal dt, PxsContactManager** cms, PxsContactManagerOutput* cmOutputs, Gu::Cache* caches, PxcNpContactPoses* contactPoses, PxU32 nbCms,
 		PxContactModifyCallback* callback):
-	  PxsCMUpdateTask(context, dt, cms, cmOutputs, caches, nbCms, callback) 
+	  PxsCMUpdateTask(context, dt, cms, cmOutputs, caches, contactPoses, nbCms, callback) 
 	{}
 
 	virtual ~PxsCMDiscreteUpdateTask()
@@ -390,7 +487,7 @@ public:
 	}
 
 
-	template < void (*NarrowPhase)(PxcNpThreadContext&, const PxcNpWorkUnit&, Gu::Cache&, PxsContactManagerOutput&)>
+	template < void (*NarrowPhase)(PxcNpThreadContext&, const PxcNpWorkUnit&, Gu::Cache&, PxcNpContactPoses&, PxsContactManagerOutput&)>
 	void processCms(PxcNpThreadContext* threadContext)
 	{
 		// PT: use local variables to avoid reading class members N times, if possible
@@ -436,7 +533,7 @@ public:
 
 				Gu::Cache& cache = mCaches[i];
 
-				NarrowPhase(*threadContext, unit, cache, output);
+				NarrowPhase(*threadContext, unit, cache, mContactPoses[i], output);
 				
 				PxU16 newTouch = Ps::to8(output.statusFlag & PxsContactManagerStatusFlag::eHAS_TOUCH);
 				
@@ -504,12 +601,16 @@ public:
 		threadContext->mPCM = pcm;
 		threadContext->mCreateAveragePoint = mContext->getCreateAveragePoint();
 		threadContext->mContactCache = mContext->getContactCacheFlag();
+		threadContext->mContactReplayThreshold = mContext->getContactReplayThreshold();
 		threadContext->mTransformCache = &mContext->getTransformCache();
 		threadContext->mContactDistance = mContext->getContactDistance();
 
 		if(pcm)
 		{
+			PxsNpJobDispatcher jobDispatcher(*mContext, mCont);
+			threadContext->mNarrowPhaseParams.mJobDispatcher = &jobDispatcher;
 			processCms<PxcDiscreteNarrowPhasePCM>(threadContext);
+			threadContext->mNarrowPhaseParams.mJobDispatcher = NULL;
 		}
 		else
 		{
@@ -536,7 +637,7 @@ void PxsNphaseImplementationContext::processContactManager(PxReal dt, PxsContact
 		void* ptr = mContext.mTaskPool.allocateNotThreadSafe(sizeof(PxsCMDiscreteUpdateTask));
 		PxU32 nbToProcess = PxMin(nbCmsToProcess - a, PxsCMUpdateTask::BATCH_SIZE);
 		PxsCMDiscreteUpdateTask* task = PX_PLACEMENT_NEW(ptr, PxsCMDiscreteUpdateTask)(&mContext, dt, mNarrowPhasePairs.mContactManagerMapping.begin() + a, 
-			cmOutputs + a, mNarrowPhasePairs.mCaches.begin() + a, nbToProcess, mModifyCallback);
+			cmOutputs + a, mNarrowPhasePairs.mCaches.begin() + a, mNarrowPhasePairs.mContactPoses.begin() + a, nbToProcess, mModifyCallback);
 
 		a += nbToProcess;
 
@@ -558,7 +659,7 @@ void PxsNphaseImplementationContext::processContactManagerSecondPass(PxReal dt,
 		void* ptr = mContext.mTaskPool.allocateNotThreadSafe(sizeof(PxsCMDiscreteUpdateTask));
 		PxU32 nbToProcess = PxMin(nbCmsToProcess - a, PxsCMUpdateTask::BATCH_SIZE);
 		PxsCMDiscreteUpdateTask* task = PX_PLACEMENT_NEW(ptr, PxsCMDiscreteUpdateTask)(&mContext, dt, mNewNarrowPhasePairs.mContactManagerMapping.begin() + a, 
-			mNewNarrowPhasePairs.mOutputContactManagers.begin() + a, mNewNarrowPhasePairs.mCaches.begin() + a, nbToProcess,
+			mNewNarrowPhasePairs.mOutputContactManagers.begin() + a, mNewNarrowPhasePairs.mCaches.begin() + a, mNewNarrowPhasePairs.mContactPoses.begin() + a, nbToProcess,
 			mModifyCallback);
 
 		a += nbToProcess;
@@ -581,6 +682,7 @@ void PxsNphaseImplementationContext::updateContactManager(PxReal dt, bool /*hasB
 	mContext.mSimStats.mNbDiscreteContactPairsTotal = 0;
 	mContext.mSimStats.mNbDiscreteContactPairsWithCacheHits = 0;
 	mContext.mSimStats.mNbDiscreteContactPairsWithContacts = 0;
+	mContext.mSimStats.mNbDiscreteContactPairsReplayed = 0;
 #endif
 
 	
@@ -661,6 +763,9 @@ void PxsNphaseImplementationContext::registerContactManager(PxsContactManager* c
 
 	mNewNarrowPhasePairs.mOutputContactManagers.pushBack(output);
 	mNewNarrowPhasePairs.mCaches.pushBack(cache);
+	PxcNpContactPoses contactPoses;
+	contactPoses.invalidate();
+	mNewNarrowPhasePairs.mContactPoses.pushBack(contactPoses);
 	mNewNarrowPhasePairs.mContactManagerMapping.pushBack(cm);
 	PxU32 newSz = mNewNarrowPhasePairs.mOutputContactManagers.size();
 	cm->getWorkUnit().mNpIndex = mNewNarrowPhasePairs.computeId(newSz - 1) | PxsContactManagerBase::NEW_CONTACT_MANAGER_MASK;
@@ -797,15 +902,18 @@ void PxsNphaseImplementationContext::appendContactManagers()
 		mNarrowPhasePairs.mContactManagerMapping.reserve(newSz);
 		mNarrowPhasePairs.mOutputContactManagers.reserve(newSz);
 		mNarrowPhasePairs.mCaches.reserve(newSz);
+		mNarrowPhasePairs.mContactPoses.reserve(newSz);
 	}
 
 	mNarrowPhasePairs.mContactManagerMapping.forceSize_Unsafe(newSize);
 	mNarrowPhasePairs.mOutputContactManagers.forceSize_Unsafe(newSize);
 	mNarrowPhasePairs.mCaches.forceSize_Unsafe(newSize);
+	mNarrowPhasePairs.mContactPoses.forceSize_Unsafe(newSize);
 
 	PxMemCopy(mNarrowPhasePairs.mContactManagerMapping.begin() + existingSize, mNewNarrowPhasePairs.mContactManagerMapping.begin(), sizeof(PxsContactManager*)*nbToAdd);
 	PxMemCopy(mNarrowPhasePairs.mOutputContactManagers.begin() + existingSize, mNewNarrowPhasePairs.mOutputContactManagers.begin(), sizeof(PxsContactManagerOutput)*nbToAdd);
 	PxMemCopy(mNarrowPhasePairs.mCaches.begin() + existingSize, mNewNarrowPhasePairs.mCaches.begin(), sizeof(Gu::Cache)*nbToAdd);
+	PxMemCopy(mNarrowPhasePairs.mContactPoses.begin() + existingSize, mNewNarrowPhasePairs.mContactPoses.begin(), sizeof(PxcNpContactPoses)*nbToAdd);
 
 	PxU32* edgeNodeIndices = mIslandSim->getEdgeNodeIndexPtr();
 
@@ -849,16 +957,19 @@ void PxsNphaseImplementationContext::appendContactManagersFallback(PxsContactMan
 
 		mNarrowPhasePairs.mContactManagerMapping.reserve(newSz);
 		mNarrowPhasePairs.mCaches.reserve(newSz);
+		mNarrowPhasePairs.mContactPoses.reserve(newSz);
 		/*mNarrowPhasePairs.mLostFoundPairsCms.reserve(2 * newSz);
 		mNarrowPhasePairs.mLostFoundPairsOutputData.reserve(2*newSz);*/
 	}
 
 	mNarrowPhasePairs.mContactManagerMapping.forceSize_Unsafe(newSize);
 	mNarrowPhasePairs.mCaches.forceSize_Unsafe(newSize);
+	mNarrowPhasePairs.mContactPoses.forceSize_Unsafe(newSize);
 
 	PxMemCopy(mNarrowPhasePairs.mContactManagerMapping.begin() + existingSize, mNewNarrowPhasePairs.mContactManagerMapping.begin(), sizeof(PxsContactManager*)*nbToAdd);
 	PxMemCopy(cmOutputs + existingSize, mNewNarrowPhasePairs.mOutputContactManagers.begin(), sizeof(PxsContactManagerOutput)*nbToAdd);
 	PxMemCopy(mNarrowPhasePairs.mCaches.begin() + existingSize, mNewNarrowPhasePairs.mCaches.begin(), sizeof(Gu::Cache)*nbToAdd);
+	PxMemCopy(mNarrowPhasePairs.mContactPoses.begin() + existingSize, mNewNarrowPhasePairs.mContactPoses.begin(), sizeof(PxcNpContactPoses)*nbToAdd);
 
 	PxU32* edgeNodeIndices = mIslandSim->getEdgeNodeIndexPtr();
 
@@ -921,6 +1032,7 @@ void PxsNphaseImplementationContext::unregisterContactManagerInternal(PxU32 npIn
 
 	managers.mContactManagerMapping[index] = replaceManager;
 	managers.mCaches[index] = managers.mCaches[replaceIndex];
+	managers.mContactPoses[index] = managers.mContactPoses[replaceIndex];
 	cmOutputs[index] = cmOutputs[replaceIndex];
 
 	PxU32* edgeNodeIndices = mIslandSim->getEdgeNodeIndexPtr();
@@ -942,6 +1054,7 @@ void PxsNphaseImplementationContext::unregisterContactManagerInternal(PxU32 npIn
 
 	managers.mContactManagerMapping.forceSize_Unsafe(replaceIndex);
 	managers.mCaches.forceSize_Unsafe(replaceIndex);
+	managers.mContactPoses.forceSize_Unsafe(replaceIndex);
 }
 
 PxsContactManagerOutput& PxsNphaseImplementationContext::getNewContactManagerOutput(PxU32 npId)
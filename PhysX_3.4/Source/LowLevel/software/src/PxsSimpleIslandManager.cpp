@@ -40,11 +40,18 @@ namespace physx
 namespace IG
 {
 
-	ThirdPassTask::ThirdPassTask(PxU64 contextID, SimpleIslandManager& islandManager, IslandSim& islandSim) : Cm::Task(contextID), mIslandManager(islandManager), mIslandSim(islandSim)
+	ThirdPassTask::ThirdPassTask(PxU64 contextID, SimpleIslandManager& islandManager, IslandSim& islandSim) : Cm::Task(contextID, PxSceneMemoryCategory::eISLANDS), mIslandManager(islandManager), mIslandSim(islandSim),
+		mFinishTask(contextID, islandManager, islandSim)
 	{
+		for(PxU32 a = 0; a < IG_MAX_ISLAND_REPAIR_TASKS; ++a)
+			mRepairTasks[a].setup(contextID, islandSim, a);
 	}
 
-	PostThirdPassTask::PostThirdPassTask(PxU64 contextID, SimpleIslandManager& islandManager) : Cm::Task(contextID), mIslandManager(islandManager)
+	ThirdPassFinishTask::ThirdPassFinishTask(PxU64 contextID, SimpleIslandManager& islandManager, IslandSim& islandSim) : Cm::Task(contextID, PxSceneMemoryCategory::eISLANDS), mIslandManager(islandManager), mIslandSim(islandSim)
+	{
+	}
+
+	PostThirdPassTask::PostThirdPassTask(PxU64 contextID, SimpleIslandManager& islandManager) : Cm::Task(contextID, PxSceneMemoryCategory::eISLANDS), mIslandManager(islandManager)
 	{
 	}
 
@@ -255,7 +262,36 @@ void ThirdPassTask::runInternal()
 {
 	PX_PROFILE_ZONE("Basic.thirdPassIslandGen", mIslandSim.getContextId());
 	mIslandSim.removeDestroyedEdges();
-	mIslandSim.processLostEdges(mIslandManager.mDestroyedNodes, true, true, mIslandManager.mMaxDirtyNodesPerFrame);
+
+	//Same as processLostEdges() but the islands that lost edges are re-validated in parallel if there are enough of them
+	mIslandSim.removeLostEdgesFromIslands();
+
+	const PxU32 nbRepairTasks = mIslandSim.prepareIslandRepair(getTaskManager()->getCpuDispatcher()->getWorkerCount());
+	if(nbRepairTasks == 0)
+	{
+		mIslandSim.findPathsAndBreakIslands(mIslandManager.mMaxDirtyNodesPerFrame);
+		mIslandSim.finishLostEdges(mIslandManager.mDestroyedNodes, true, true);
+		return;
+	}
+
+	mFinishTask.setContinuation(mCont);
+	for(PxU32 a = 0; a < nbRepairTasks; ++a)
+	{
+		mRepairTasks[a].setContinuation(&mFinishTask);
+		mRepairTasks[a].removeReference();
+	}
+	mFinishTask.removeReference();
+}
+
+void IslandRepairTask::runInternal()
+{
+	mIslandSim->repairIslands(mTaskIndex);
+}
+
+void ThirdPassFinishTask::runInternal()
+{
+	mIslandSim.finishIslandRepair();
+	mIslandSim.finishLostEdges(mIslandManager.mDestroyedNodes, true, true);
 }
 
 void PostThirdPassTask::runInternal()
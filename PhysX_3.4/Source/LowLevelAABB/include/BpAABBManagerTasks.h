@@ -45,7 +45,7 @@ namespace Bp
 	{
 		public:
 										AggregateBoundsComputationTask(PxU64 contextId) :
-											Cm::Task	(contextId),
+											Cm::Task	(contextId, PxSceneMemoryCategory::eBROAD_PHASE),
 											mManager	(NULL),
 											mStart		(0),
 											mNbToGo		(0),
@@ -76,7 +76,7 @@ namespace Bp
 	{
 		public:
 										FinalizeUpdateTask(PxU64 contextId) :
-											Cm::Task				(contextId),
+											Cm::Task				(contextId, PxSceneMemoryCategory::eBROAD_PHASE),
 											mManager				(NULL),
 											mNumCpuTasks			(0),
 											mScratchAllocator		(NULL),
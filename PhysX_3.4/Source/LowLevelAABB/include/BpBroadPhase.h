@@ -33,6 +33,7 @@
 
 #include "foundation/PxUnionCast.h"
 #include "PxBroadPhase.h"
+#include "PxSimulationStatistics.h"
 #include "BpSimpleAABBManager.h"
 
 namespace physx
@@ -169,6 +170,22 @@ class BroadPhaseBase
 	{ 
 		return NULL;					
 	}
+
+	/*
+	\brief Enables the automatic region layout and rebalancing. See PxSceneFlag::eENABLE_ADAPTIVE_BROADPHASE_REGIONS.
+	*/
+	virtual	void						setAdaptiveRegions(bool enabled)
+	{
+		PX_UNUSED(enabled);
+	}
+
+	/*
+	\brief Writes the region-related figures (number of regions, splits, merges, etc) to the simulation statistics.
+	*/
+	virtual	void						getRegionStatistics(PxSimulationStatistics& stats)	const
+	{
+		PX_UNUSED(stats);
+	}
 };
 
 
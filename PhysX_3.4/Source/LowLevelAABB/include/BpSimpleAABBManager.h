@@ -305,7 +305,7 @@ namespace Bp
 		PX_NOCOPY(PostBroadPhaseStage2Task)
 	public:
 
-		PostBroadPhaseStage2Task(PxU64 contextID, SimpleAABBManager& manager) : Cm::Task(contextID), mFlushPool(NULL), mManager(manager)
+		PostBroadPhaseStage2Task(PxU64 contextID, SimpleAABBManager& manager) : Cm::Task(contextID, PxSceneMemoryCategory::eBROAD_PHASE), mFlushPool(NULL), mManager(manager)
 		{
 		}
 
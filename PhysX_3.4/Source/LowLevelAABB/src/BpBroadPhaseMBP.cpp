@@ -33,6 +33,7 @@
 #include "CmRadixSortBuffered.h"
 #include "CmUtils.h"
 #include "PsUtilities.h"
+#include "PsSort.h"
 #include "PsFoundation.h"
 #include "PsVecMath.h"
 
@@ -376,6 +377,7 @@ static PX_FORCE_INLINE void clearBit(BitArray& bitmap, MBP_ObjectIndex objectInd
 						PxU32*				mNext;
 						MBP_Pair*			mActivePairs;
 						PxU32				mReservedMemory;
+						PxU32				mNbReportedPairs;	// Overlaps reported by the regions, including duplicates and filtered pairs
 
 						const Bp::FilterGroup::Enum*	mGroups;
 						const MBP_Object*				mObjects;
@@ -464,6 +466,23 @@ static PX_FORCE_INLINE void clearBit(BitArray& bitmap, MBP_ObjectIndex objectInd
 		BIP_Input			mBIPInput;
 	};
 
+	// PT: overlaps found by a region when regions are processed in parallel. Each region task only writes to its
+	// own buffer, and the buffers are added to the shared pair manager afterwards, in region order. This gives the
+	// same results as the single-threaded code path, which adds the pairs to the pair manager directly.
+	struct MBP_RegionPairs
+	{
+							MBP_RegionPairs() : mNbReportedPairs(0)	{}
+
+		PX_FORCE_INLINE	void	addPair(PxU32 id0, PxU32 id1)
+								{
+									mPairs.pushBack(id0);
+									mPairs.pushBack(id1);
+								}
+
+		Ps::Array<PxU32>	mPairs;				// MBP handles, two per pair
+		PxU32				mNbReportedPairs;
+	};
+
 	class Region : public Ps::UserAllocated
 	{
 							PX_NOCOPY(Region)
@@ -477,7 +496,8 @@ static PX_FORCE_INLINE void clearBit(BitArray& bitmap, MBP_ObjectIndex objectInd
 		MBP_Handle			retrieveBounds(MBP_AABB& bounds, MBP_Index handle)	const;
 		void				setBounds(MBP_Index handle, const MBP_AABB& bounds);
 		void				prepareOverlaps();
-		void				findOverlaps(MBP_PairManager& pairManager);
+		template<class PairOutputT>
+		void				findOverlaps(PairOutputT& pairManager);
 
 //		private:
 		BoxPruning_Input	PX_ALIGN(16, mInput);
@@ -496,6 +516,8 @@ static PX_FORCE_INLINE void clearBit(BitArray& bitmap, MBP_ObjectIndex objectInd
 		PxU32*				mPosList;
 		PxU32				mNbUpdatedBoxes;
 		PxU32				mPrevNbUpdatedBoxes;
+		PxU32				mNbOverlaps;		// Overlaps reported by the last findOverlaps() call that had updated boxes
+		MBP_RegionPairs		mPairs;				// Overlaps found when regions are processed in parallel
 		BitArray			mStaticBits;
 		RadixSortBuffered	mRS;
 		bool				mNeedsSorting;
@@ -548,16 +570,33 @@ struct RegionData : public Ps::UserAllocated
 						void					findOverlaps(const Bp::FilterGroup::Enum* PX_RESTRICT groups
 #ifdef BP_FILTERING_USES_TYPE_IN_GROUP
 	, const bool* PX_RESTRICT lut
+#endif
+							);
+						void					mergeRegionPairs(const Bp::FilterGroup::Enum* PX_RESTRICT groups
+#ifdef BP_FILTERING_USES_TYPE_IN_GROUP
+	, const bool* PX_RESTRICT lut
 #endif
 							);
 						PxU32					finalize(BroadPhaseMBP* mbp);
 						void					shiftOrigin(const PxVec3& shift);
 
 						void					setTransientBounds(const PxBounds3* bounds, const PxReal* contactDistance); 
+
+						// Adaptive region layout
+						PxU32					getNbActiveRegions()	const;
+						void					rebalanceRegions();
+						void					growRegions(const PxBounds3& objectBounds);
+						bool					splitRegion(PxU32 handle);
+						bool					mergeRegions(PxU32 handle0, PxU32 handle1);
+						void					transferRegionObjects(PxU32 handle);
 //		private:
 						PxU32					mNbRegions;
 						MBP_ObjectIndex			mFirstFreeIndex;	// First free recycled index for mMBP_Objects
 						PxU32					mFirstFreeIndexBP;	// First free recycled index for mRegions
+						bool					mAdaptiveRegions;	// Automatically split/merge regions
+						PxU32					mRebalanceCounter;	// Frames since the last rebalancing pass
+						PxU32					mNbRegionSplits;	// Splits performed during the last update
+						PxU32					mNbRegionMerges;	// Merges performed during the last update
 						Ps::Array<RegionData>	mRegions;
 						Ps::Array<MBP_Object>	mMBP_Objects;
 						MBP_PairManager			mPairManager;
@@ -640,6 +679,7 @@ MBP_PairManager::MBP_PairManager() :
 	mNext			(NULL),
 	mActivePairs	(NULL),
 	mReservedMemory (0),
+	mNbReportedPairs(0),
 	mGroups			(NULL),
 	mObjects		(NULL)
 #ifdef BP_FILTERING_USES_TYPE_IN_GROUP
@@ -984,6 +1024,7 @@ Region::Region() :
 	mPosList				(NULL),
 	mNbUpdatedBoxes			(0),
 	mPrevNbUpdatedBoxes		(0),
+	mNbOverlaps				(0),
 	mNeedsSorting			(false),
 	mNeedsSortingSleeping	(true)
 {
@@ -1487,7 +1528,8 @@ static PX_FORCE_INLINE bool intersect3D(const MBP_AABB& a, const MBP_AABB& b)
 static PxU32 gNbOverlaps = 0;
 #endif
 
-static PX_FORCE_INLINE void outputPair(	MBP_PairManager& pairManager,
+template<class PairOutputT>
+static PX_FORCE_INLINE void outputPair(	PairOutputT& pairManager,
 										PxU32 index0, PxU32 index1,
 										const MBP_Index* PX_RESTRICT inToOut0, const MBP_Index* PX_RESTRICT inToOut1,
 										const MBPEntry* PX_RESTRICT objects)
@@ -1495,6 +1537,7 @@ static PX_FORCE_INLINE void outputPair(	MBP_PairManager& pairManager,
 #ifdef CHECK_NB_OVERLAPS
 	gNbOverlaps++;
 #endif
+	pairManager.mNbReportedPairs++;
 	const MBP_Index objectIndex0 = inToOut0[index0];
 	const MBP_Index objectIndex1 = inToOut1[index1];
 	PX_ASSERT(objectIndex0!=objectIndex1);
@@ -1744,7 +1787,8 @@ void Region::prepareBIPPruning(const MBPOS_TmpBuffers& buffers)
 	mInput.mBIPInput.mNeeded			= true;
 }
 
-static void doCompleteBoxPruning(MBP_PairManager* PX_RESTRICT pairManager, const BoxPruning_Input& input)
+template<class PairOutputT>
+static void doCompleteBoxPruning(PairOutputT* PX_RESTRICT pairManager, const BoxPruning_Input& input)
 {
 	const MBPEntry* PX_RESTRICT objects						= input.mObjects;
 	const MBP_AABB* PX_RESTRICT updatedDynamicBoxes			= input.mUpdatedDynamicBoxes;
@@ -1849,7 +1893,8 @@ static void doCompleteBoxPruning(MBP_PairManager* PX_RESTRICT pairManager, const
 	}
 }
 
-static void doBipartiteBoxPruning(MBP_PairManager* PX_RESTRICT pairManager, const BIP_Input& input)
+template<class PairOutputT>
+static void doBipartiteBoxPruning(PairOutputT* PX_RESTRICT pairManager, const BIP_Input& input)
 {
 	// ### crashes because the code expects the dynamic array to be sorted, but mDynamicBoxes is not
 	// ### we should instead modify mNbUpdatedBoxes so that mNbUpdatedBoxes == mNbDynamicBoxes, and
@@ -1963,18 +2008,24 @@ void Region::prepareOverlaps()
 	prepareBIPPruning(mTmpBuffers);
 }
 
-void Region::findOverlaps(MBP_PairManager& pairManager)
+template<class PairOutputT>
+void Region::findOverlaps(PairOutputT& pairManager)
 {
 	PX_ASSERT(!mNeedsSorting);
+	// PT: a region without updated boxes (e.g. all its objects are asleep) keeps its last overlap count, since the
+	// pairs are still there even if they are not reported again
 	if(!mNbUpdatedBoxes)
 		return;
 
+	const PxU32 nbReportedPairs = pairManager.mNbReportedPairs;
+
 	if(mInput.mNeeded)
 		doCompleteBoxPruning(&pairManager, mInput);
 
 	if(mInput.mBIPInput.mNeeded)
 		doBipartiteBoxPruning(&pairManager, mInput.mBIPInput);
 
+	mNbOverlaps = pairManager.mNbReportedPairs - nbReportedPairs;
 	mNbUpdatedBoxes = 0;
 }
 
@@ -1983,7 +2034,11 @@ void Region::findOverlaps(MBP_PairManager& pairManager)
 MBP::MBP() :
 	mNbRegions			(0),
 	mFirstFreeIndex		(INVALID_ID),
-	mFirstFreeIndexBP	(INVALID_ID)
+	mFirstFreeIndexBP	(INVALID_ID),
+	mAdaptiveRegions	(false),
+	mRebalanceCounter	(0),
+	mNbRegionSplits		(0),
+	mNbRegionMerges		(0)
 #ifdef MBP_REGION_BOX_PRUNING
 	,mNbActiveRegions	(0),
 	mDirtyRegions		(true)
@@ -2486,6 +2541,353 @@ const Region* MBP::getRegion(PxU32 i) const
 	return regions[i].mBP;
 }
 
+///////////////////////////////////////////////////////////////////////////
+
+// PT: adaptive region layout. Regions whose load (resident objects + overlaps) goes above the split threshold are cut
+// in two along their longest axis, and neighbouring regions whose combined load falls below the merge threshold are
+// fused back. The gap between both thresholds avoids oscillations. Only one structural change is done per period.
+#define MBP_REBALANCE_PERIOD	8
+#define MBP_SPLIT_THRESHOLD		1024
+#define MBP_MERGE_THRESHOLD		256
+
+// PT: mNbObjects counts all objects resident in the region, static, moving or sleeping ones
+static PX_FORCE_INLINE PxU32 getRegionLoad(const Region& region)
+{
+	return region.mNbObjects + region.mNbOverlaps;
+}
+
+PxU32 MBP::getNbActiveRegions() const
+{
+	const PxU32 nb = mNbRegions;
+	const RegionData* PX_RESTRICT regions = mRegions.begin();
+	PxU32 nbActiveRegions = 0;
+	for(PxU32 i=0;i<nb;i++)
+	{
+		if(regions[i].mBP)
+			nbActiveRegions++;
+	}
+	return nbActiveRegions;
+}
+
+// PT: two regions can be fused into a single box if they are identical on two axes and touching on the third one
+static PX_FORCE_INLINE PxU32 classifyAxis(PxU32 min0, PxU32 max0, PxU32 min1, PxU32 max1)
+{
+	if(min0==min1 && max0==max1)
+		return 0;	// Identical
+	if(max0==min1 || max1==min0)
+		return 1;	// Touching
+	return 2;
+}
+
+static bool canBeMerged(const MBP_AABB& box0, const MBP_AABB& box1)
+{
+	const PxU32 x = classifyAxis(box0.mMinX, box0.mMaxX, box1.mMinX, box1.mMaxX);
+	const PxU32 y = classifyAxis(box0.mMinY, box0.mMaxY, box1.mMinY, box1.mMaxY);
+	const PxU32 z = classifyAxis(box0.mMinZ, box0.mMaxZ, box1.mMinZ, box1.mMaxZ);
+	return (x|y|z)==1 && x+y+z==1;
+}
+
+void MBP::rebalanceRegions()
+{
+	mNbRegionSplits = 0;
+	mNbRegionMerges = 0;
+
+	if(++mRebalanceCounter<MBP_REBALANCE_PERIOD)
+		return;
+	mRebalanceCounter = 0;
+
+	const PxU32 nb = mNbRegions;
+	const RegionData* PX_RESTRICT regions = mRegions.begin();
+
+	// Split the most loaded region first, if we can afford two more regions
+	PxU32 maxLoad = 0;
+	PxU32 splitCandidate = INVALID_ID;
+	for(PxU32 i=0;i<nb;i++)
+	{
+		if(!regions[i].mBP)
+			continue;
+
+		const PxU32 load = getRegionLoad(*regions[i].mBP);
+		if(load>maxLoad)
+		{
+			maxLoad = load;
+			splitCandidate = i;
+		}
+	}
+
+	if(maxLoad>=MBP_SPLIT_THRESHOLD && getNbActiveRegions()+2<=MAX_NB_MBP)
+	{
+		if(splitRegion(splitCandidate))
+		{
+			mNbRegionSplits++;
+			return;
+		}
+	}
+
+	// Otherwise merge the two lightest neighbours
+	PxU32 minLoad = MBP_MERGE_THRESHOLD;
+	PxU32 mergeCandidate0 = INVALID_ID;
+	PxU32 mergeCandidate1 = INVALID_ID;
+	for(PxU32 i=0;i<nb;i++)
+	{
+		if(!regions[i].mBP)
+			continue;
+
+		const PxU32 load0 = getRegionLoad(*regions[i].mBP);
+		if(load0>=minLoad)
+			continue;
+
+		for(PxU32 j=i+1;j<nb;j++)
+		{
+			if(!regions[j].mBP)
+				continue;
+
+			const PxU32 load = load0 + getRegionLoad(*regions[j].mBP);
+			if(load<minLoad && canBeMerged(regions[i].mBox, regions[j].mBox))
+			{
+				minLoad = load;
+				mergeCandidate0 = i;
+				mergeCandidate1 = j;
+			}
+		}
+	}
+
+	if(mergeCandidate0!=INVALID_ID && mergeRegions(mergeCandidate0, mergeCandidate1))
+		mNbRegionMerges++;
+}
+
+bool MBP::splitRegion(PxU32 handle)
+{
+	const RegionData& parent = mRegions[handle];
+	const Region* PX_RESTRICT bp = parent.mBP;
+	PX_ASSERT(bp);
+
+	PxBounds3 parentBounds;
+	parent.mBox.decode(parentBounds);
+
+	Ps::Array<PxBounds3> objectBounds;
+	objectBounds.reserve(bp->mNbObjects);
+	const PxU32 maxNbObjects = bp->mMaxNbObjects;
+	for(PxU32 j=0;j<maxNbObjects;j++)
+	{
+		if(bp->mObjects[j].mMBPHandle==INVALID_ID)
+			continue;
+
+		MBP_AABB box;
+		bp->retrieveBounds(box, MBP_Index(j));
+		PxBounds3 decoded;
+		box.decode(decoded);
+		objectBounds.pushBack(decoded);
+	}
+
+	const PxU32 nbObjects = objectBounds.size();
+	if(nbObjects<2)
+		return false;
+
+	// Try the axes from the longest to the shortest, and cut at the median of the object centers. A cut is only
+	// accepted if both children end up with at most 3/4 of the objects, otherwise straddling objects make it useless.
+	const PxVec3 extents = parentBounds.getExtents();
+	PxU32 axes[3] = { 0, 1, 2 };
+	if(extents[axes[1]]>extents[axes[0]])	Ps::swap(axes[0], axes[1]);
+	if(extents[axes[2]]>extents[axes[1]])	Ps::swap(axes[1], axes[2]);
+	if(extents[axes[1]]>extents[axes[0]])	Ps::swap(axes[0], axes[1]);
+
+	Ps::Array<PxReal> centers;
+	centers.resize(nbObjects);
+	const PxU32 maxPerChild = (nbObjects*3)/4;
+	for(PxU32 a=0;a<3;a++)
+	{
+		const PxU32 axis = axes[a];
+		for(PxU32 i=0;i<nbObjects;i++)
+			centers[i] = (objectBounds[i].minimum[axis] + objectBounds[i].maximum[axis])*0.5f;
+		Ps::sort(centers.begin(), nbObjects);
+
+		const PxReal splitValue = centers[nbObjects/2];
+		if(!(splitValue>parentBounds.minimum[axis] && splitValue<parentBounds.maximum[axis]))
+			continue;
+
+		PxU32 nbBelow = 0;
+		PxU32 nbAbove = 0;
+		for(PxU32 i=0;i<nbObjects;i++)
+		{
+			if(objectBounds[i].minimum[axis]<=splitValue)
+				nbBelow++;
+			if(objectBounds[i].maximum[axis]>=splitValue)
+				nbAbove++;
+		}
+		if(nbBelow>maxPerChild || nbAbove>maxPerChild)
+			continue;
+
+		PxBroadPhaseRegion child0;
+		child0.bounds				= parentBounds;
+		child0.bounds.maximum[axis]	= splitValue;
+		child0.userData				= parent.mUserData;
+
+		PxBroadPhaseRegion child1;
+		child1.bounds				= parentBounds;
+		child1.bounds.minimum[axis]	= splitValue;
+		child1.userData				= parent.mUserData;
+
+		// PT: 'parent' is invalid after this point, addRegion() can resize mRegions
+		addRegion(child0, false);
+		addRegion(child1, false);
+		transferRegionObjects(handle);
+		return true;
+	}
+	return false;
+}
+
+bool MBP::mergeRegions(PxU32 handle0, PxU32 handle1)
+{
+	PxBounds3 bounds0;
+	PxBounds3 bounds1;
+	mRegions[handle0].mBox.decode(bounds0);
+	mRegions[handle1].mBox.decode(bounds1);
+
+	PxBroadPhaseRegion merged;
+	merged.bounds	= bounds0;
+	merged.bounds.include(bounds1);
+	merged.userData	= mRegions[handle0].mUserData;
+
+	if(addRegion(merged, false)==INVALID_ID)
+		return false;
+
+	transferRegionObjects(handle0);
+	transferRegionObjects(handle1);
+	return true;
+}
+
+// PT: makes the layout cover 'objectBounds'. Without any region a first one is created around the objects, with some
+// room to move. Otherwise the regions touching the sides of the layout crossed by the objects are stretched, so that
+// the layout remains a box partitioned by the regions and the objects do not go out-of-bounds. The layout grows by
+// its own size on those sides to amortize the object transfers.
+void MBP::growRegions(const PxBounds3& objectBounds)
+{
+	if(objectBounds.isEmpty())
+		return;
+
+	const PxU32 nb = mNbRegions;
+	PxBounds3 layoutBounds = PxBounds3::empty();
+	for(PxU32 i=0;i<nb;i++)
+	{
+		if(!mRegions[i].mBP)
+			continue;
+
+		PxBounds3 regionBounds;
+		mRegions[i].mBox.decode(regionBounds);
+		layoutBounds.include(regionBounds);
+	}
+
+	if(layoutBounds.isEmpty())
+	{
+		PxBroadPhaseRegion region;
+		region.bounds	= objectBounds;
+		region.bounds.fattenFast(PxMax(objectBounds.getExtents().maxElement(), 1.0f));
+		region.userData	= NULL;
+		addRegion(region, true);
+		return;
+	}
+
+	if(objectBounds.isInside(layoutBounds))
+		return;
+
+	PxBounds3 newLayoutBounds = layoutBounds;
+	newLayoutBounds.include(objectBounds);
+	const PxVec3 margin = newLayoutBounds.getExtents().maximum(PxVec3(1.0f));
+	for(PxU32 axis=0;axis<3;axis++)
+	{
+		if(newLayoutBounds.minimum[axis]<layoutBounds.minimum[axis])
+			newLayoutBounds.minimum[axis] -= margin[axis];
+		if(newLayoutBounds.maximum[axis]>layoutBounds.maximum[axis])
+			newLayoutBounds.maximum[axis] += margin[axis];
+	}
+
+	// PT: gather the regions to stretch first, since resizing them adds and removes regions
+	PxU32 handles[MAX_NB_MBP];
+	PxBounds3 bounds[MAX_NB_MBP];
+	PxU32 nbToResize = 0;
+	for(PxU32 i=0;i<nb;i++)
+	{
+		if(!mRegions[i].mBP)
+			continue;
+
+		PxBounds3 regionBounds;
+		mRegions[i].mBox.decode(regionBounds);
+
+		bool stretched = false;
+		for(PxU32 axis=0;axis<3;axis++)
+		{
+			if(regionBounds.minimum[axis]==layoutBounds.minimum[axis] && newLayoutBounds.minimum[axis]<layoutBounds.minimum[axis])
+			{
+				regionBounds.minimum[axis] = newLayoutBounds.minimum[axis];
+				stretched = true;
+			}
+			if(regionBounds.maximum[axis]==layoutBounds.maximum[axis] && newLayoutBounds.maximum[axis]>layoutBounds.maximum[axis])
+			{
+				regionBounds.maximum[axis] = newLayoutBounds.maximum[axis];
+				stretched = true;
+			}
+		}
+
+		if(stretched)
+		{
+			handles[nbToResize] = i;
+			bounds[nbToResize] = regionBounds;
+			nbToResize++;
+		}
+	}
+
+	// PT: each region is replaced by a bigger copy. The copy is added before the objects are transferred, so they
+	// directly land in it. If the max number of regions is reached the remaining objects go out-of-bounds as usual.
+	for(PxU32 i=0;i<nbToResize;i++)
+	{
+		PxBroadPhaseRegion region;
+		region.bounds	= bounds[i];
+		region.userData	= mRegions[handles[i]].mUserData;
+		if(addRegion(region, false)==INVALID_ID)
+			break;
+		transferRegionObjects(handles[i]);
+	}
+}
+
+// PT: moves all objects of a region to the regions now covering them, then deletes the region. We cannot use
+// populateNewRegion() for this since it skips objects marked as "fully inside" their current regions. Going
+// through updateObject() also marks the objects as updated, so their pairs are recomputed in their new regions
+// instead of being lost.
+void MBP::transferRegionObjects(PxU32 handle)
+{
+	RegionData& region = mRegions[handle];
+	Region* bp = region.mBP;
+	PX_ASSERT(bp);
+
+	PxBounds3 empty;
+	empty.setEmpty();
+	region.mBox.initFrom2(empty);
+
+	// PT: gather objects first since updateObject() removes them from the region
+	Ps::Array<MBP_Handle> handles;
+	Ps::Array<MBP_AABB> boxes;
+	handles.reserve(bp->mNbObjects);
+	boxes.reserve(bp->mNbObjects);
+	const PxU32 maxNbObjects = bp->mMaxNbObjects;
+	for(PxU32 j=0;j<maxNbObjects;j++)
+	{
+		if(bp->mObjects[j].mMBPHandle==INVALID_ID)
+			continue;
+
+		MBP_AABB box;
+		handles.pushBack(bp->retrieveBounds(box, MBP_Index(j)));
+		boxes.pushBack(box);
+	}
+
+	const PxU32 nbObjects = handles.size();
+	for(PxU32 i=0;i<nbObjects;i++)
+		updateObject(handles[i], boxes[i]);
+
+	PX_ASSERT(!bp->mNbObjects);
+	removeRegion(handle);
+}
+
 #ifdef MBP_REGION_BOX_PRUNING
 void MBP::buildRegionData()
 {
@@ -3107,6 +3509,37 @@ void MBP::findOverlaps(const Bp::FilterGroup::Enum* PX_RESTRICT groups
 	}
 }
 
+void MBP::mergeRegionPairs(const Bp::FilterGroup::Enum* PX_RESTRICT groups
+#ifdef BP_FILTERING_USES_TYPE_IN_GROUP
+	, const bool* PX_RESTRICT lut
+#endif
+	)
+{
+	PxU32 nb = mNbRegions;
+	const RegionData* PX_RESTRICT regions = mRegions.begin();
+	const MBP_Object* objects = mMBP_Objects.begin();
+
+	mPairManager.mObjects = objects;
+	mPairManager.mGroups = groups;
+#ifdef BP_FILTERING_USES_TYPE_IN_GROUP
+	mPairManager.mLUT = lut;
+#endif
+
+	for(PxU32 i=0;i<nb;i++)
+	{
+		Region* bp = regions[i].mBP;
+		if(!bp)
+			continue;
+
+		const PxU32 nbPairs = bp->mPairs.mPairs.size()/2;
+		const PxU32* PX_RESTRICT pairs = bp->mPairs.mPairs.begin();
+		for(PxU32 j=0;j<nbPairs;j++)
+			mPairManager.addPair(pairs[j*2+0], pairs[j*2+1]);
+		mPairManager.mNbReportedPairs += nbPairs;
+		bp->mPairs.mPairs.clear();
+	}
+}
+
 PxU32 MBP::finalize(BroadPhaseMBP* mbp)
 {
 	const MBP_Object* objects = mMBP_Objects.begin();
@@ -3131,6 +3564,9 @@ void MBP::reset()
 	mNbRegions			= 0;
 	mFirstFreeIndex		= INVALID_ID;
 	mFirstFreeIndexBP	= INVALID_ID;
+	mRebalanceCounter	= 0;
+	mNbRegionSplits		= 0;
+	mNbRegionMerges		= 0;
 	for(PxU32 i=0;i<MAX_NB_MBP+1;i++)
 	{
 		mHandles[i].clear();
@@ -3219,6 +3655,7 @@ BroadPhaseMBP::BroadPhaseMBP(	PxU32 maxNbRegions,
 								PxU64 contextID) :
 	mMBPUpdateWorkTask		(contextID),
 	mMBPPostUpdateWorkTask	(contextID),
+	mContextID				(contextID),
 	mMapping				(NULL),
 	mCapacity				(0),
 	mGroups					(NULL)
@@ -3261,7 +3698,7 @@ bool BroadPhaseMBP::getCaps(PxBroadPhaseCaps& caps) const
 {
 	caps.maxNbRegions			= 256;
 	caps.maxNbObjects			= 0;
-	caps.needsPredefinedBounds	= true;
+	caps.needsPredefinedBounds	= !mMBP->mAdaptiveRegions;	// PT: the adaptive mode creates its own regions
 	return true;
 }
 
@@ -3300,6 +3737,7 @@ PxU32 BroadPhaseMBP::getRegions(PxBroadPhaseRegionInfo* userBuffer, PxU32 buffer
 			userBuffer[i].overlap			= regions[i].mOverlap!=0;
 			userBuffer[i].nbStaticObjects	= regions[i].mBP->mNbStaticBoxes;
 			userBuffer[i].nbDynamicObjects	= regions[i].mBP->mNbDynamicBoxes;
+			userBuffer[i].nbOverlaps		= regions[i].mBP->mNbOverlaps;
 		}
 		else
 		{
@@ -3309,6 +3747,7 @@ PxU32 BroadPhaseMBP::getRegions(PxBroadPhaseRegionInfo* userBuffer, PxU32 buffer
 			userBuffer[i].overlap			= false;
 			userBuffer[i].nbStaticObjects	= 0;
 			userBuffer[i].nbDynamicObjects	= 0;
+			userBuffer[i].nbOverlaps		= 0;
 		}
 	}
 	return writeCount;
@@ -3324,6 +3763,37 @@ bool BroadPhaseMBP::removeRegion(PxU32 handle)
 	return mMBP->removeRegion(handle);
 }
 
+void BroadPhaseMBP::setAdaptiveRegions(bool enabled)
+{
+	mMBP->mAdaptiveRegions = enabled;
+}
+
+void BroadPhaseMBP::getRegionStatistics(PxSimulationStatistics& stats) const
+{
+	const PxU32 size = mMBP->mNbRegions;
+	const RegionData* PX_RESTRICT regions = mMBP->mRegions.begin();
+
+	PxU32 nbActiveRegions = 0;
+	PxU32 maxNbObjects = 0;
+	PxU32 maxNbOverlaps = 0;
+	for(PxU32 i=0;i<size;i++)
+	{
+		const Region* bp = regions[i].mBP;
+		if(bp)
+		{
+			nbActiveRegions++;
+			maxNbObjects = PxMax(maxNbObjects, bp->mNbObjects);
+			maxNbOverlaps = PxMax(maxNbOverlaps, bp->mNbOverlaps);
+		}
+	}
+
+	stats.nbBroadPhaseRegions			= nbActiveRegions;
+	stats.nbBroadPhaseRegionSplits		= mMBP->mNbRegionSplits;
+	stats.nbBroadPhaseRegionMerges		= mMBP->mNbRegionMerges;
+	stats.maxNbBroadPhaseRegionObjects	= maxNbObjects;
+	stats.maxNbBroadPhaseRegionOverlaps	= maxNbOverlaps;
+}
+
 void BroadPhaseMBP::update(const PxU32 numCpuTasks, PxcScratchAllocator* scratchAllocator, const BroadPhaseUpdateData& updateData, physx::PxBaseTask* continuation, physx::PxBaseTask* narrowPhaseUnblockTask)
 {
 #if PX_CHECKED
@@ -3336,8 +3806,11 @@ void BroadPhaseMBP::update(const PxU32 numCpuTasks, PxcScratchAllocator* scratch
 
 	setUpdateData(updateData);
 
-	if(1)
+	// PT: regions are independent box-pruning problems. When several of them have work to do we process them
+	// in parallel, otherwise the task overhead isn't worth it.
+	if(numCpuTasks<2 || getNbRegionsToUpdate()<2)
 	{
+		mMBP->prepareOverlaps();
 		update();
 		postUpdate();
 	}
@@ -3354,10 +3827,75 @@ void BroadPhaseMBP::update(const PxU32 numCpuTasks, PxcScratchAllocator* scratch
 	}
 }
 
+// PT: a region has work to do if some of its boxes moved, or if its static boxes need sorting
+static PX_FORCE_INLINE bool needsUpdate(const Region& region)
+{
+	return region.mNbUpdatedBoxes || region.mNeedsSorting;
+}
+
+PxU32 BroadPhaseMBP::getNbRegionsToUpdate() const
+{
+	const PxU32 nb = mMBP->mNbRegions;
+	const RegionData* PX_RESTRICT regions = mMBP->mRegions.begin();
+	PxU32 nbRegionsToUpdate = 0;
+	for(PxU32 i=0;i<nb;i++)
+	{
+		if(regions[i].mBP && needsUpdate(*regions[i].mBP))
+			nbRegionsToUpdate++;
+	}
+	return nbRegionsToUpdate;
+}
+
+// PT: spawns one task per region with work to do. Each task sorts its region and writes the overlaps to the
+// region's own pair buffer, so they don't need any synchronization. The buffers are merged in postUpdate.
+void BroadPhaseMBP::updateRegions(PxBaseTask* continuation)
+{
+	const PxU32 nb = mMBP->mNbRegions;
+	RegionData* PX_RESTRICT regions = mMBP->mRegions.begin();
+
+	if(mMBPRegionWorkTasks.size()<nb)
+		mMBPRegionWorkTasks.resize(nb, MBPRegionWorkTask(mContextID));
+
+	for(PxU32 i=0;i<nb;i++)
+	{
+		Region* bp = regions[i].mBP;
+		if(!bp)
+			continue;
+
+		bp->mPairs.mPairs.clear();
+		// PT: like the serial path, a region with nothing to do keeps its last overlap count for the rebalancing
+		if(!needsUpdate(*bp))
+			continue;
+
+		MBPRegionWorkTask& task = mMBPRegionWorkTasks[i];
+		task.set(this, i);
+		task.setContinuation(continuation);
+		task.removeReference();
+	}
+}
+
+void BroadPhaseMBP::updateRegion(PxU32 regionIndex)
+{
+	Region* bp = mMBP->mRegions[regionIndex].mBP;
+	PX_ASSERT(bp);
+	bp->prepareOverlaps();
+	bp->findOverlaps(bp->mPairs);
+}
+
+void BroadPhaseMBP::mergeRegionPairs()
+{
+	mMBP->mergeRegionPairs(mGroups
+#ifdef BP_FILTERING_USES_TYPE_IN_GROUP
+	, mLUT
+#endif
+		);
+}
+
 void BroadPhaseMBP::singleThreadedUpdate(PxcScratchAllocator* /*scratchAllocator*/, const BroadPhaseUpdateData& updateData)
 {
 	// PT: TODO: the scratchAllocator isn't actually needed, is it?
 	setUpdateData(updateData);
+	mMBP->prepareOverlaps();
 	update();
 	postUpdate();
 }
@@ -3425,11 +3963,17 @@ static PX_FORCE_INLINE void computeMBPBounds(MBP_AABB& aabb, const PxBounds3* PX
 
 void MBPUpdateWorkTask::runInternal()
 {
-	mMBP->update();
+	mMBP->updateRegions(getContinuation());
+}
+
+void MBPRegionWorkTask::runInternal()
+{
+	mMBP->updateRegion(mRegionIndex);
 }
 
 void MBPPostUpdateWorkTask::runInternal()
 {
+	mMBP->mergeRegionPairs();
 	mMBP->postUpdate();
 }
 
@@ -3500,6 +4044,36 @@ void BroadPhaseMBP::addObjects(const BroadPhaseUpdateData& updateData)
 	}
 }
 
+// PT: unbounded objects like planes are skipped, they would make the layout infinite and they overlap it anyway
+static PX_FORCE_INLINE void includeBounds(PxBounds3& dst, const BpHandle* PX_RESTRICT handles, PxU32 nbHandles, const PxBounds3* PX_RESTRICT boundsXYZ, const PxReal* PX_RESTRICT contactDistances)
+{
+	while(nbHandles--)
+	{
+		const BpHandle index = *handles++;
+		PxBounds3 bounds = boundsXYZ[index];
+		if(bounds.getDimensions().maxElement()>=PX_MAX_BOUNDS_EXTENTS)
+			continue;
+		bounds.fattenFast(contactDistances[index]);
+		dst.include(bounds);
+	}
+}
+
+// PT: adaptive mode: creates the first region around the initial objects, and grows the layout when new or moving
+// objects would leave it. The layout is then refined by the rebalancing code.
+void BroadPhaseMBP::growRegions(const BroadPhaseUpdateData& updateData)
+{
+	const PxBounds3* PX_RESTRICT boundsXYZ = updateData.getAABBs();
+	const PxReal* PX_RESTRICT contactDistances = updateData.getContactDistance();
+
+	PxBounds3 objectBounds = PxBounds3::empty();
+	if(updateData.getCreatedHandles())
+		includeBounds(objectBounds, updateData.getCreatedHandles(), updateData.getNumCreatedHandles(), boundsXYZ, contactDistances);
+	if(updateData.getUpdatedHandles())
+		includeBounds(objectBounds, updateData.getUpdatedHandles(), updateData.getNumUpdatedHandles(), boundsXYZ, contactDistances);
+
+	mMBP->growRegions(objectBounds);
+}
+
 void BroadPhaseMBP::setUpdateData(const BroadPhaseUpdateData& updateData)
 {
 	mMBP->setTransientBounds(updateData.getAABBs(), updateData.getContactDistance());
@@ -3526,13 +4100,17 @@ void BroadPhaseMBP::setUpdateData(const BroadPhaseUpdateData& updateData)
 	// ### TODO: get rid of AABB conversions
 
 	removeObjects(updateData);
+	if(mMBP->mAdaptiveRegions)
+		growRegions(updateData);
 	addObjects(updateData);
 	updateObjects(updateData);
 
+	// PT: done once boxes are up-to-date, so that objects are transferred with their final bounds for this frame
+	if(mMBP->mAdaptiveRegions)
+		mMBP->rebalanceRegions();
+
 	PX_ASSERT(!mCreated.size());
 	PX_ASSERT(!mDeleted.size());
-
-	mMBP->prepareOverlaps();
 }
 
 void BroadPhaseMBP::update()
@@ -34,6 +34,7 @@
 #include "BpBroadPhase.h"
 #include "BpBroadPhaseMBPCommon.h"
 #include "BpMBPTasks.h"
+#include "PsArray.h"
 
 	class MBP;
 	
@@ -61,6 +62,8 @@ namespace Bp
 		virtual	bool						removeRegion(PxU32 handle);
 		virtual	PxU32						getNbOutOfBoundsObjects()	const;
 		virtual	const PxU32*				getOutOfBoundsObjects()		const;
+		virtual	void						setAdaptiveRegions(bool enabled);
+		virtual	void						getRegionStatistics(PxSimulationStatistics& stats)	const;
 	//~BroadPhaseBase
 
 	// BroadPhase
@@ -84,6 +87,8 @@ namespace Bp
 
 				MBPUpdateWorkTask			mMBPUpdateWorkTask;
 				MBPPostUpdateWorkTask		mMBPPostUpdateWorkTask;
+				Ps::Array<MBPRegionWorkTask>	mMBPRegionWorkTasks;	// One per region, indexed by region handle
+				PxU64						mContextID;
 
 				MBP*						mMBP;		// PT: TODO: aggregate
 
@@ -97,12 +102,17 @@ namespace Bp
 				const bool*					mLUT;
 #endif
 				void						setUpdateData(const BroadPhaseUpdateData& updateData);
+				void						growRegions(const BroadPhaseUpdateData& updateData);
 				void						addObjects(const BroadPhaseUpdateData& updateData);
 				void						removeObjects(const BroadPhaseUpdateData& updateData);
 				void						updateObjects(const BroadPhaseUpdateData& updateData);
 
 				void						update();
 				void						postUpdate();
+				PxU32						getNbRegionsToUpdate()	const;
+				void						updateRegions(PxBaseTask* continuation);
+				void						updateRegion(PxU32 regionIndex);
+				void						mergeRegionPairs();
 				void						allocateMappingArray(PxU32 newCapacity);
 	};
 
@@ -54,6 +54,7 @@ BroadPhaseSap::BroadPhaseSap(
 	PxU64 contextID) :
 	mScratchAllocator		(NULL),
 	mSapUpdateWorkTask		(contextID),
+	mSapBatchUpdateStage2Task(contextID),
 	mSapPostUpdateWorkTask	(contextID),
 	mContextID				(contextID)
 {
@@ -77,13 +78,17 @@ BroadPhaseSap::BroadPhaseSap(
 		mBoxEndPts[2][i].mMinMax[0]=BP_INVALID_BP_HANDLE;
 		mBoxEndPts[2][i].mMinMax[1]=BP_INVALID_BP_HANDLE;
 	}
+	mBoxEndPtsPrev = reinterpret_cast<SapBox1D*>(PX_ALLOC(ALIGN_SIZE_16((sizeof(SapBox1D)*mBoxesCapacity)), "SapBox1D"));
 		
 	//End points
 	mEndPointsCapacity = mBoxesCapacity*2 + NUM_SENTINELS;
 
 	mBoxesUpdated = reinterpret_cast<PxU8*>(PX_ALLOC(ALIGN_SIZE_16((sizeof(PxU8)*mBoxesCapacity)), "BoxesUpdated"));
-	mSortedUpdateElements = reinterpret_cast<BpHandle*>(PX_ALLOC(ALIGN_SIZE_16((sizeof(BpHandle)*mEndPointsCapacity)), "SortedUpdateElements"));
-	mActivityPockets = reinterpret_cast<BroadPhaseActivityPocket*>(PX_ALLOC(ALIGN_SIZE_16((sizeof(BroadPhaseActivityPocket)*mEndPointsCapacity)), "BroadPhaseActivityPocket"));
+	for(PxU32 i=0;i<3;i++)
+	{
+		mSortedUpdateElements[i] = reinterpret_cast<BpHandle*>(PX_ALLOC(ALIGN_SIZE_16((sizeof(BpHandle)*mEndPointsCapacity)), "SortedUpdateElements"));
+		mActivityPockets[i] = reinterpret_cast<BroadPhaseActivityPocket*>(PX_ALLOC(ALIGN_SIZE_16((sizeof(BroadPhaseActivityPocket)*mEndPointsCapacity)), "BroadPhaseActivityPocket"));
+	}
 
 	mEndPointValues[0] = reinterpret_cast<ValType*>(PX_ALLOC(ALIGN_SIZE_16((sizeof(ValType)*(mEndPointsCapacity))), "ValType"));
 	mEndPointValues[1] = reinterpret_cast<ValType*>(PX_ALLOC(ALIGN_SIZE_16((sizeof(ValType)*(mEndPointsCapacity))), "ValType"));
@@ -100,16 +105,22 @@ BroadPhaseSap::BroadPhaseSap(
 	setMinSentinel(mEndPointValues[2][0],mEndPointDatas[2][0]);
 	setMaxSentinel(mEndPointValues[2][1],mEndPointDatas[2][1]);
 
-	mListNext = reinterpret_cast<BpHandle*>(PX_ALLOC(ALIGN_SIZE_16((sizeof(BpHandle)*mEndPointsCapacity)), "NextList"));
-	mListPrev = reinterpret_cast<BpHandle*>(PX_ALLOC(ALIGN_SIZE_16((sizeof(BpHandle)*mEndPointsCapacity)), "PrevList"));
-
-	for(PxU32 a = 1; a < mEndPointsCapacity; ++a)
+	for(PxU32 i=0;i<3;i++)
 	{
-		mListNext[a-1] = BpHandle(a);
-		mListPrev[a] = BpHandle(a-1);
+		BpHandle* listNext = reinterpret_cast<BpHandle*>(PX_ALLOC(ALIGN_SIZE_16((sizeof(BpHandle)*mEndPointsCapacity)), "NextList"));
+		BpHandle* listPrev = reinterpret_cast<BpHandle*>(PX_ALLOC(ALIGN_SIZE_16((sizeof(BpHandle)*mEndPointsCapacity)), "PrevList"));
+
+		for(PxU32 a = 1; a < mEndPointsCapacity; ++a)
+		{
+			listNext[a-1] = BpHandle(a);
+			listPrev[a] = BpHandle(a-1);
+		}
+		listNext[mEndPointsCapacity-1] = BpHandle(mEndPointsCapacity-1);
+		listPrev[0] = 0;
+
+		mListNext[i] = listNext;
+		mListPrev[i] = listPrev;
 	}
-	mListNext[mEndPointsCapacity-1] = BpHandle(mEndPointsCapacity-1);
-	mListPrev[0] = 0;
 
 	mDefaultPairsCapacity = PxMax(maxNbBroadPhaseOverlaps, PxU32(DEFAULT_CREATEDDELETED_PAIR_ARRAY_CAPACITY));
 
@@ -146,6 +157,7 @@ BroadPhaseSap::~BroadPhaseSap()
 	PX_FREE(mBoxEndPts[0]);
 	PX_FREE(mBoxEndPts[1]);
 	PX_FREE(mBoxEndPts[2]);
+	PX_FREE(mBoxEndPtsPrev);
 
 	PX_FREE(mEndPointValues[0]);
 	PX_FREE(mEndPointValues[1]);
@@ -154,11 +166,14 @@ BroadPhaseSap::~BroadPhaseSap()
 	PX_FREE(mEndPointDatas[1]);
 	PX_FREE(mEndPointDatas[2]);
 
-	PX_FREE(mListNext);
-	PX_FREE(mListPrev);
+	for(PxU32 i=0;i<3;i++)
+	{
+		PX_FREE(mListNext[i]);
+		PX_FREE(mListPrev[i]);
 
-	PX_FREE(mSortedUpdateElements);
-	PX_FREE(mActivityPockets);
+		PX_FREE(mSortedUpdateElements[i]);
+		PX_FREE(mActivityPockets[i]);
+	}
 	PX_FREE(mBoxesUpdated);
 
 	mPairs.release();
@@ -468,9 +483,11 @@ void BroadPhaseSap::update(const PxU32 numCpuTasks, PxcScratchAllocator* scratch
 		resizeBuffers();
 
 		mSapPostUpdateWorkTask.setBroadPhase(this);
+		mSapBatchUpdateStage2Task.setBroadPhase(this);
 		mSapUpdateWorkTask.setBroadPhase(this);
 
 		mSapPostUpdateWorkTask.set(numCpuTasks);
+		mSapBatchUpdateStage2Task.set(numCpuTasks);
 		mSapUpdateWorkTask.set(numCpuTasks);
 
 		mSapPostUpdateWorkTask.setContinuation(continuation);
@@ -560,6 +577,9 @@ bool BroadPhaseSap::setUpdateData(const BroadPhaseUpdateData& updateData)
 		mBoxEndPts[2] = newBoxEndPts2;
 		mBoxesCapacity = newBoxesCapacity;
 
+		PX_FREE(mBoxEndPtsPrev);
+		mBoxEndPtsPrev = reinterpret_cast<SapBox1D*>(PX_ALLOC(ALIGN_SIZE_16((sizeof(SapBox1D)*newBoxesCapacity)), "SapBox1D"));
+
 		
 
 		PX_FREE(mBoxesUpdated);
@@ -578,20 +598,25 @@ bool BroadPhaseSap::setUpdateData(const BroadPhaseUpdateData& updateData)
 		BpHandle* newEndPointDatasY = reinterpret_cast<BpHandle*>(PX_ALLOC(ALIGN_SIZE_16((sizeof(BpHandle)*(newEndPointsCapacity))), "BpHandle"));
 		BpHandle* newEndPointDatasZ = reinterpret_cast<BpHandle*>(PX_ALLOC(ALIGN_SIZE_16((sizeof(BpHandle)*(newEndPointsCapacity))), "BpHandle"));
 
-		PX_FREE(mListNext);
-		PX_FREE(mListPrev);
+		for(PxU32 i=0;i<3;i++)
+		{
+			PX_FREE(mListNext[i]);
+			PX_FREE(mListPrev[i]);
 
-		mListNext = reinterpret_cast<BpHandle*>(PX_ALLOC(ALIGN_SIZE_16((sizeof(BpHandle)*newEndPointsCapacity)), "NextList"));
-		mListPrev = reinterpret_cast<BpHandle*>(PX_ALLOC(ALIGN_SIZE_16((sizeof(BpHandle)*newEndPointsCapacity)), "Prev"));
+			BpHandle* listNext = reinterpret_cast<BpHandle*>(PX_ALLOC(ALIGN_SIZE_16((sizeof(BpHandle)*newEndPointsCapacity)), "NextList"));
+			BpHandle* listPrev = reinterpret_cast<BpHandle*>(PX_ALLOC(ALIGN_SIZE_16((sizeof(BpHandle)*newEndPointsCapacity)), "Prev"));
 
+			for(PxU32 a = 1; a < newEndPointsCapacity; ++a)
+			{
+				listNext[a-1] = BpHandle(a);
+				listPrev[a] = BpHandle(a-1);
+			}
+			listNext[newEndPointsCapacity-1] = BpHandle(newEndPointsCapacity-1);
+			listPrev[0] = 0;
 
-		for(PxU32 a = 1; a < newEndPointsCapacity; ++a)
-		{
-			mListNext[a-1] = BpHandle(a);
-			mListPrev[a] = BpHandle(a-1);
+			mListNext[i] = listNext;
+			mListPrev[i] = listPrev;
 		}
-		mListNext[newEndPointsCapacity-1] = BpHandle(newEndPointsCapacity-1);
-		mListPrev[0] = 0;
 
 		PxMemCopy(newEndPointValuesX, mEndPointValues[0], sizeof(ValType)*(mBoxesSize*2+NUM_SENTINELS));
 		PxMemCopy(newEndPointValuesY, mEndPointValues[1], sizeof(ValType)*(mBoxesSize*2+NUM_SENTINELS));
@@ -613,10 +638,13 @@ bool BroadPhaseSap::setUpdateData(const BroadPhaseUpdateData& updateData)
 		mEndPointDatas[2] = newEndPointDatasZ;
 		mEndPointsCapacity = newEndPointsCapacity;
 
-		PX_FREE(mSortedUpdateElements);
-		PX_FREE(mActivityPockets);
-		mSortedUpdateElements = reinterpret_cast<BpHandle*>(PX_ALLOC(ALIGN_SIZE_16((sizeof(BpHandle)*newEndPointsCapacity)), "SortedUpdateElements"));
-		mActivityPockets = reinterpret_cast<BroadPhaseActivityPocket*>(PX_ALLOC(ALIGN_SIZE_16((sizeof(BroadPhaseActivityPocket)*newEndPointsCapacity)), "BroadPhaseActivityPocket"));
+		for(PxU32 i=0;i<3;i++)
+		{
+			PX_FREE(mSortedUpdateElements[i]);
+			PX_FREE(mActivityPockets[i]);
+			mSortedUpdateElements[i] = reinterpret_cast<BpHandle*>(PX_ALLOC(ALIGN_SIZE_16((sizeof(BpHandle)*newEndPointsCapacity)), "SortedUpdateElements"));
+			mActivityPockets[i] = reinterpret_cast<BroadPhaseActivityPocket*>(PX_ALLOC(ALIGN_SIZE_16((sizeof(BroadPhaseActivityPocket)*newEndPointsCapacity)), "BroadPhaseActivityPocket"));
+		}
 	}
 
 	PxMemZero(mBoxesUpdated, sizeof(PxU8) * (mBoxesCapacity));	
@@ -643,17 +671,24 @@ void BroadPhaseSap::postUpdate()
 
 	for(PxU32 i=0;i<3;i++)
 	{
-		const PxU32 numPairs=mBatchUpdateTasks[i].getPairsSize();
-		const BroadPhasePair* PX_RESTRICT pairs=mBatchUpdateTasks[i].getPairs();
-		for(PxU32 j=0;j<numPairs;j++)
+		//The pairs of an axis with a deferred overlap test are the ones kept by the filter tasks. The filter tasks cover
+		//consecutive ranges so the pairs are added/removed in the same order as with a single-threaded update.
+		const bool deferred=mBatchUpdateTasks[i].hasDeferredOverlapTest();
+		const PxU32 nbRanges=deferred ? mBatchFilterTasks.size() : 1;
+		for(PxU32 k=0;k<nbRanges;k++)
 		{
-			const BroadPhasePair& pair=pairs[j];
-			const BpHandle volA=pair.mVolA;
-			const BpHandle volB=pair.mVolB;
-			if(volA > volB)
-				addPair(volA, volB, mScratchAllocator, mPairs, da);
-			else
-				removePair(volA, volB, mScratchAllocator, mPairs, da);
+			const PxU32 numPairs=deferred ? mBatchFilterTasks[k].getNbKeptPairs() : mBatchUpdateTasks[i].getPairsSize();
+			const BroadPhasePair* PX_RESTRICT pairs=mBatchUpdateTasks[i].getPairs() + (deferred ? mBatchFilterTasks[k].getStart() : 0);
+			for(PxU32 j=0;j<numPairs;j++)
+			{
+				const BroadPhasePair& pair=pairs[j];
+				const BpHandle volA=pair.mVolA;
+				const BpHandle volB=pair.mVolB;
+				if(volA > volB)
+					addPair(volA, volB, mScratchAllocator, mPairs, da);
+				else
+					removePair(volA, volB, mScratchAllocator, mPairs, da);
+			}
 		}
 	}
 
@@ -688,7 +723,12 @@ void BroadPhaseSap::deletePairs()
 void BroadPhaseBatchUpdateWorkTask::runInternal()
 {
 	mPairsSize=0;
-	mSap->batchUpdate(mAxis, mPairs, mPairsSize, mPairsCapacity);
+	mSap->batchUpdate(mAxis, mBoxMinMax0, mBoxMinMax1, mPairs, mPairsSize, mPairsCapacity);
+}
+
+void BroadPhaseBatchFilterWorkTask::runInternal()
+{
+	mNbKeptPairs = mSap->filterBatchUpdatePairs(mSap->mBatchUpdateTasks[1].getPairs() + mStart, mNbPairs);
 }
 
 void BroadPhaseSap::update()
@@ -702,11 +742,99 @@ void BroadPhaseSap::update()
 	PX_ASSERT(0==mBatchUpdateTasks[1].getPairsSize());
 	PX_ASSERT(0==mBatchUpdateTasks[2].getPairsSize());
 
+	mBatchUpdateTasks[0].setOverlapTestRanks(mBoxEndPts[1], mBoxEndPts[2]);
+	mBatchUpdateTasks[1].setOverlapTestRanks(mBoxEndPts[2], mBoxEndPts[0]);
+	mBatchUpdateTasks[2].setOverlapTestRanks(mBoxEndPts[0], mBoxEndPts[1]);
+
 	mBatchUpdateTasks[0].runInternal();
 	mBatchUpdateTasks[1].runInternal();
 	mBatchUpdateTasks[2].runInternal();
 }
 
+//Multithreaded version of update(). Each axis has its own sorted lists and scratch buffers, the dependency between
+//the axes is in the overlap tests: the pairs found along an axis are tested against the ranks of the axes updated 
+//before it. Axes 0 and 1 are sorted first, concurrently, with axis 0 testing against a copy of the ranks of axis 1.
+//Axis 2 is then sorted while the test of the axis 1 pairs along axis 0 runs over several tasks. The pairs are 
+//merged in axis order in postUpdate() so the result is the same as update().
+void BroadPhaseSap::update(const PxU32 numCpuTasks, PxBaseTask* continuation)
+{
+	if(numCpuTasks<2 || !mUpdatedSize)
+	{
+		update();
+		return;
+	}
+
+	{
+		PX_PROFILE_ZONE("BroadPhase.SapUpdate", mContextID);
+
+		batchRemove();
+
+		PX_ASSERT(0==mBatchUpdateTasks[0].getPairsSize());
+		PX_ASSERT(0==mBatchUpdateTasks[1].getPairsSize());
+		PX_ASSERT(0==mBatchUpdateTasks[2].getPairsSize());
+
+		PxMemCopy(mBoxEndPtsPrev, mBoxEndPts[1], sizeof(SapBox1D)*mBoxesCapacity);
+	}
+
+	mBatchUpdateTasks[0].setOverlapTestRanks(mBoxEndPtsPrev, mBoxEndPts[2]);
+	mBatchUpdateTasks[1].setOverlapTestRanks(mBoxEndPts[2], NULL);
+	mBatchUpdateTasks[2].setOverlapTestRanks(mBoxEndPts[0], mBoxEndPts[1]);
+
+	mSapBatchUpdateStage2Task.setContinuation(continuation);
+	mBatchUpdateTasks[0].setContinuation(&mSapBatchUpdateStage2Task);
+	mBatchUpdateTasks[1].setContinuation(&mSapBatchUpdateStage2Task);
+	mBatchUpdateTasks[0].removeReference();
+	mBatchUpdateTasks[1].removeReference();
+	mSapBatchUpdateStage2Task.removeReference();
+}
+
+#define BP_SAP_MIN_FILTER_PAIRS_PER_TASK 1024
+
+void BroadPhaseSap::launchBatchUpdateStage2(const PxU32 numCpuTasks, PxBaseTask* continuation)
+{
+	mBatchUpdateTasks[2].setContinuation(continuation);
+	mBatchUpdateTasks[2].removeReference();
+
+	const PxU32 nbPairs = mBatchUpdateTasks[1].getPairsSize();
+	const PxU32 nbPairsPerTask = PxMax(PxU32(BP_SAP_MIN_FILTER_PAIRS_PER_TASK), (nbPairs + numCpuTasks - 2)/(numCpuTasks - 1));
+
+	mBatchFilterTasks.clear();
+	for(PxU32 start=0;start<nbPairs;start+=nbPairsPerTask)
+	{
+		BroadPhaseBatchFilterWorkTask task(mContextID);
+		task.set(this, start, PxMin(nbPairsPerTask, nbPairs - start));
+		mBatchFilterTasks.pushBack(task);
+	}
+
+	const PxU32 nbFilterTasks = mBatchFilterTasks.size();
+	for(PxU32 i=0;i<nbFilterTasks;i++)
+	{
+		mBatchFilterTasks[i].setContinuation(continuation);
+		mBatchFilterTasks[i].removeReference();
+	}
+}
+
+PxU32 BroadPhaseSap::filterBatchUpdatePairs(BroadPhasePair* PX_RESTRICT pairs, const PxU32 nbPairs) const
+{
+	const SapBox1D* PX_RESTRICT boxMinMax = mBoxEndPts[0];
+
+	PxU32 nbKeptPairs=0;
+	for(PxU32 i=0;i<nbPairs;i++)
+	{
+		const BpHandle volA=pairs[i].mVolA;
+		const BpHandle volB=pairs[i].mVolB;
+
+#if BP_SAP_USE_OVERLAP_TEST_ON_REMOVES
+		if(Intersect1D_Handle(boxMinMax[volA], boxMinMax[volB]))
+#else
+		//Removed pairs are stored with volA < volB and are not tested.
+		if(volA < volB || Intersect1D_Handle(boxMinMax[volA], boxMinMax[volB]))
+#endif
+			pairs[nbKeptPairs++]=pairs[i];
+	}
+	return nbKeptPairs;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 static PX_FORCE_INLINE void InsertEndPoints(const ValType* PX_RESTRICT newEndPointValues, const BpHandle* PX_RESTRICT newEndPointDatas, PxU32 numNewEndPoints,
@@ -1123,7 +1251,7 @@ static BroadPhasePair* resizeBroadPhasePairArray(const PxU32 oldMaxNb, const PxU
 
 
 void BroadPhaseSap::batchUpdate
-(const PxU32 Axis, BroadPhasePair*& pairs, PxU32& pairsSize, PxU32& pairsCapacity)
+(const PxU32 Axis, const SapBox1D* PX_RESTRICT boxMinMax0, const SapBox1D* PX_RESTRICT boxMinMax1, BroadPhasePair*& pairs, PxU32& pairsSize, PxU32& pairsCapacity)
 {
 	//Nothin updated so don't do anything
 	if(mUpdatedSize == 0)
@@ -1132,7 +1260,7 @@ void BroadPhaseSap::batchUpdate
 		//If number updated is sufficiently fewer than number of boxes (say less than 20%)
 	if((mUpdatedSize*5) < mBoxesSize)
 	{
-		batchUpdateFewUpdates(Axis, pairs, pairsSize, pairsCapacity);
+		batchUpdateFewUpdates(Axis, boxMinMax0, boxMinMax1, pairs, pairsSize, pairsCapacity);
 		return;
 	}
 
@@ -1140,10 +1268,6 @@ void BroadPhaseSap::batchUpdate
 	PxU32 maxNumPairs=pairsCapacity;
 
 	const PxBounds3* PX_RESTRICT boxMinMax3D = mBoxBoundsMinMax;
-	SapBox1D* boxMinMax2D[6]={mBoxEndPts[1],mBoxEndPts[2],mBoxEndPts[2],mBoxEndPts[0],mBoxEndPts[0],mBoxEndPts[1]};
-
-	const SapBox1D* PX_RESTRICT boxMinMax0=boxMinMax2D[2*Axis+0];
-	const SapBox1D* PX_RESTRICT boxMinMax1=boxMinMax2D[2*Axis+1];
 
 #if BP_SAP_TEST_GROUP_ID_CREATEUPDATE 
 	const Bp::FilterGroup::Enum* PX_RESTRICT asapBoxGroupIds=mBoxGroups;
@@ -1159,6 +1283,10 @@ void BroadPhaseSap::batchUpdate
 
 	PxU8* PX_RESTRICT updated = mBoxesUpdated;
 
+	BpHandle* PX_RESTRICT listNext = mListNext[Axis];
+	BpHandle* PX_RESTRICT listPrev = mListPrev[Axis];
+	BroadPhaseActivityPocket* PX_RESTRICT activityPockets = mActivityPockets[Axis];
+
 	//KS - can we lazy create these inside the loop? Might benefit us
 
 	//There are no extents, jus the sentinels, so exit early.
@@ -1185,7 +1313,7 @@ void BroadPhaseSap::batchUpdate
 	//We'll never overlap with this sentinel but it just ensures that we don't need to branch to see if
 	//there's a pocket that we need to test against
 	
-	BroadPhaseActivityPocket* PX_RESTRICT currentPocket = mActivityPockets;
+	BroadPhaseActivityPocket* PX_RESTRICT currentPocket = activityPockets;
 
 	currentPocket->mEndIndex = 0;
 	currentPocket->mStartIndex = 0;
@@ -1221,7 +1349,7 @@ void BroadPhaseSap::batchUpdate
 
 			//We always iterate back through the list...
 
-			BpHandle CurrentIndex = mListPrev[ThisIndex];
+			BpHandle CurrentIndex = listPrev[ThisIndex];
 			ValType CurrentValue = BaseEPValues[CurrentIndex];
 			//PxBpHandle CurrentData = BaseEPDatas[CurrentIndex];
 
@@ -1261,9 +1389,7 @@ void BroadPhaseSap::batchUpdate
 							if(
 								BaseEPValues[id1->mMinMax[0]] < boxMax && 
 								//2D intersection test using up-to-date values
-								Intersect2D_Handle(boxMinMax0[handle].mMinMax[0], boxMinMax0[handle].mMinMax[1], boxMinMax1[handle].mMinMax[0], boxMinMax1[handle].mMinMax[1],
-								            boxMinMax0[ownerId].mMinMax[0],boxMinMax0[ownerId].mMinMax[1],boxMinMax1[ownerId].mMinMax[0],boxMinMax1[ownerId].mMinMax[1])
-
+								Intersect2D_Handle(boxMinMax0, boxMinMax1, handle, ownerId)
 	#if BP_SAP_TEST_GROUP_ID_CREATEUPDATE
 		#ifdef BP_FILTERING_USES_TYPE_IN_GROUP
 								&& groupFiltering(group, asapBoxGroupIds[ownerId], mLUT)
@@ -1290,7 +1416,7 @@ void BroadPhaseSap::batchUpdate
 						}
 	#endif
 						startIndex--;
-						CurrentIndex = mListPrev[CurrentIndex];
+						CurrentIndex = listPrev[CurrentIndex];
 						CurrentValue = BaseEPValues[CurrentIndex];
 					}
 					while(ThisValue < CurrentValue);
@@ -1312,8 +1438,7 @@ void BroadPhaseSap::batchUpdate
 #if 1
 							if(
 #if BP_SAP_USE_OVERLAP_TEST_ON_REMOVES
-								Intersect2D_Handle(boxMinMax0[handle].mMinMax[0], boxMinMax0[handle].mMinMax[1], boxMinMax1[handle].mMinMax[0], boxMinMax1[handle].mMinMax[1],
-								       boxMinMax0[ownerId].mMinMax[0],boxMinMax0[ownerId].mMinMax[1],boxMinMax1[ownerId].mMinMax[0],boxMinMax1[ownerId].mMinMax[1])
+								Intersect2D_Handle(boxMinMax0, boxMinMax1, handle, ownerId)
 #endif
 #if BP_SAP_TEST_GROUP_ID_CREATEUPDATE
 	#ifdef BP_FILTERING_USES_TYPE_IN_GROUP
@@ -1342,7 +1467,7 @@ void BroadPhaseSap::batchUpdate
 						}
 	#endif
 						startIndex--;
-						CurrentIndex = mListPrev[CurrentIndex];
+						CurrentIndex = listPrev[CurrentIndex];
 						CurrentValue = BaseEPValues[CurrentIndex];
 					}
 					while(ThisValue < CurrentValue);
@@ -1351,21 +1476,21 @@ void BroadPhaseSap::batchUpdate
 				//This test is unnecessary. If we entered the outer loop, we're doing the swap in here
 				{
 					//Unlink from old position and re-link to new position
-					BpHandle oldNextIndex = mListNext[ThisIndex];
-					BpHandle oldPrevIndex = mListPrev[ThisIndex];
+					BpHandle oldNextIndex = listNext[ThisIndex];
+					BpHandle oldPrevIndex = listPrev[ThisIndex];
 
-					BpHandle newNextIndex = mListNext[CurrentIndex];
+					BpHandle newNextIndex = listNext[CurrentIndex];
 					BpHandle newPrevIndex = CurrentIndex;
 					
 					//Unlink this node
-					mListNext[oldPrevIndex] = oldNextIndex;
-					mListPrev[oldNextIndex] = oldPrevIndex;
+					listNext[oldPrevIndex] = oldNextIndex;
+					listPrev[oldNextIndex] = oldPrevIndex;
 
 					//Link it to it's new place in the list
-					mListNext[ThisIndex] = newNextIndex;
-					mListPrev[ThisIndex] = newPrevIndex;
-					mListPrev[newNextIndex] = ThisIndex;
-					mListNext[newPrevIndex] = ThisIndex;
+					listNext[ThisIndex] = newNextIndex;
+					listPrev[ThisIndex] = newPrevIndex;
+					listPrev[newNextIndex] = ThisIndex;
+					listNext[newPrevIndex] = ThisIndex;
 				}
 
 				//There is a sentinel with 0 index, so we don't need
@@ -1375,7 +1500,7 @@ void BroadPhaseSap::batchUpdate
 					currentPocket--;
 				}
 				//If our start index > currentPocket->mEndIndex, then we don't overlap so create a new pocket
-				if(currentPocket == mActivityPockets || startIndex > (currentPocket->mEndIndex+1))
+				if(currentPocket == activityPockets || startIndex > (currentPocket->mEndIndex+1))
 				{
 					currentPocket++;
 					currentPocket->mStartIndex = startIndex;
@@ -1393,13 +1518,13 @@ void BroadPhaseSap::batchUpdate
 	pairsCapacity=maxNumPairs;
 
 
-	BroadPhaseActivityPocket* pocket = mActivityPockets+1;
+	BroadPhaseActivityPocket* pocket = activityPockets+1;
 
 	while(pocket <= currentPocket)
 	{
 		for(PxU32 a = pocket->mStartIndex; a <= pocket->mEndIndex; ++a)
 		{
-			mListPrev[a] = BpHandle(a);
+			listPrev[a] = BpHandle(a);
 		}
 
 		//Now copy all the data to the array, updating the remap table
@@ -1407,9 +1532,9 @@ void BroadPhaseSap::batchUpdate
 		PxU32 CurrIndex = pocket->mStartIndex-1;
 		for(PxU32 a = pocket->mStartIndex; a <= pocket->mEndIndex; ++a)
 		{
-			CurrIndex = mListNext[CurrIndex];
+			CurrIndex = listNext[CurrIndex];
 			PxU32 origIndex =  CurrIndex;
-			BpHandle remappedIndex = mListPrev[origIndex];
+			BpHandle remappedIndex = listPrev[origIndex];
 
 			if(origIndex != a)
 			{
@@ -1424,9 +1549,9 @@ void BroadPhaseSap::batchUpdate
 				BaseEPValues[remappedIndex] = tmp;
 				BaseEPDatas[remappedIndex] = tmpHandle;
 
-				mListPrev[remappedIndex] = mListPrev[a];
+				listPrev[remappedIndex] = listPrev[a];
 				//Write back remap index (should be an immediate jump to original index)
-				mListPrev[mListPrev[a]] = remappedIndex;
+				listPrev[listPrev[a]] = remappedIndex;
 				asapBoxes[ownerId].mMinMax[IsMax] = BpHandle(a);
 			}
 			
@@ -1435,24 +1560,23 @@ void BroadPhaseSap::batchUpdate
 		////Reset next and prev ptrs back
 		for(PxU32 a = pocket->mStartIndex-1; a <= pocket->mEndIndex; ++a)
 		{
-			mListPrev[a+1] = BpHandle(a);
-			mListNext[a] = BpHandle(a+1);
+			listPrev[a+1] = BpHandle(a);
+			listNext[a] = BpHandle(a+1);
 		}
 
 		pocket++;
 	}
-	mListPrev[0] = 0;
+	listPrev[0] = 0;
 }
 
 
 void BroadPhaseSap::batchUpdateFewUpdates
-(const PxU32 Axis, BroadPhasePair*& pairs, PxU32& pairsSize, PxU32& pairsCapacity)
+(const PxU32 Axis, const SapBox1D* PX_RESTRICT boxMinMax0, const SapBox1D* PX_RESTRICT boxMinMax1, BroadPhasePair*& pairs, PxU32& pairsSize, PxU32& pairsCapacity)
 {
 	PxU32 numPairs=0;
 	PxU32 maxNumPairs=pairsCapacity;
 
 	const PxBounds3* PX_RESTRICT boxMinMax3D = mBoxBoundsMinMax;
-	SapBox1D* boxMinMax2D[6]={mBoxEndPts[1],mBoxEndPts[2],mBoxEndPts[2],mBoxEndPts[0],mBoxEndPts[0],mBoxEndPts[1]};
 
 #if BP_SAP_TEST_GROUP_ID_CREATEUPDATE 
 	const Bp::FilterGroup::Enum* PX_RESTRICT asapBoxGroupIds=mBoxGroups;
@@ -1460,8 +1584,6 @@ void BroadPhaseSap::batchUpdateFewUpdates
 
 	SapBox1D* PX_RESTRICT asapBoxes=mBoxEndPts[Axis];
 
-	/*const BPValType* PX_RESTRICT boxMinMax0=boxMinMax2D[2*Axis];
-	const BPValType* PX_RESTRICT boxMinMax1=boxMinMax2D[2*Axis+1];*/
 
 	ValType* PX_RESTRICT asapEndPointValues=mEndPointValues[Axis];
 	BpHandle* PX_RESTRICT asapEndPointDatas=mEndPointDatas[Axis];
@@ -1469,11 +1591,13 @@ void BroadPhaseSap::batchUpdateFewUpdates
 	ValType* const PX_RESTRICT BaseEPValues = asapEndPointValues;
 	BpHandle* const PX_RESTRICT BaseEPDatas = asapEndPointDatas;			
 
-	const SapBox1D* PX_RESTRICT boxMinMax0=boxMinMax2D[2*Axis+0];
-	const SapBox1D* PX_RESTRICT boxMinMax1=boxMinMax2D[2*Axis+1];
-
 	PxU8* PX_RESTRICT updated = mBoxesUpdated;
 
+	BpHandle* PX_RESTRICT listNext = mListNext[Axis];
+	BpHandle* PX_RESTRICT listPrev = mListPrev[Axis];
+	BroadPhaseActivityPocket* PX_RESTRICT activityPockets = mActivityPockets[Axis];
+	BpHandle* PX_RESTRICT sortedUpdateElements = mSortedUpdateElements[Axis];
+
 	const PxU32 endPointSize = mBoxesSize*2 + 1;
 
 	//There are no extents, just the sentinels, so exit early.
@@ -1507,10 +1631,10 @@ void BroadPhaseSap::batchUpdateFewUpdates
 			BaseEPValues[Object->mMinMax[0]] = boxMin;
 			BaseEPValues[Object->mMinMax[1]] = boxMax;
 
-			mSortedUpdateElements[ind_++] = Object->mMinMax[0];
-			mSortedUpdateElements[ind_++] = Object->mMinMax[1];
+			sortedUpdateElements[ind_++] = Object->mMinMax[0];
+			sortedUpdateElements[ind_++] = Object->mMinMax[1];
 		}
-		Ps::sort(mSortedUpdateElements, ind_);
+		Ps::sort(sortedUpdateElements, ind_);
 	}
 	else
 	{
@@ -1527,7 +1651,7 @@ void BroadPhaseSap::batchUpdateFewUpdates
 				ValType ThisValue = isMax(ThisData) ? encodeMax(boxMinMax3D[owner], Axis, mContactDistance[owner])
 													: encodeMin(boxMinMax3D[owner], Axis, mContactDistance[owner]);
 				BaseEPValues[index] = ThisValue;
-				mSortedUpdateElements[ind_++] = BpHandle(index);
+				sortedUpdateElements[ind_++] = BpHandle(index);
 			}
 		}
 	}
@@ -1536,13 +1660,13 @@ void BroadPhaseSap::batchUpdateFewUpdates
 	
 	//We'll never overlap with this sentinel but it just ensures that we don't need to branch to see if
 	//there's a pocket that we need to test against
-	BroadPhaseActivityPocket* PX_RESTRICT currentPocket = mActivityPockets;
+	BroadPhaseActivityPocket* PX_RESTRICT currentPocket = activityPockets;
 	currentPocket->mEndIndex = 0;
 	currentPocket->mStartIndex = 0;
 
 	for(PxU32 a = 0; a < updateCounter; ++a)
 	{
-		BpHandle ind = mSortedUpdateElements[a];
+		BpHandle ind = sortedUpdateElements[a];
 
 		BpHandle NextData;
 		BpHandle PrevData;
@@ -1570,7 +1694,7 @@ void BroadPhaseSap::batchUpdateFewUpdates
 			const ValType boxMax=encodeMax(boxMinMax3D[handle], Axis, mContactDistance[handle]);
 
 			//We always iterate back through the list...
-			BpHandle CurrentIndex = mListPrev[ThisIndex];
+			BpHandle CurrentIndex = listPrev[ThisIndex];
 			ValType CurrentValue = BaseEPValues[CurrentIndex];
 
 			if(CurrentValue > ThisValue)
@@ -1604,8 +1728,7 @@ void BroadPhaseSap::batchUpdateFewUpdates
 							if(
 								BaseEPValues[id1->mMinMax[0]] < boxMax && 
 								//2D intersection test using up-to-date values
-								Intersect2D_Handle(boxMinMax0[handle].mMinMax[0], boxMinMax0[handle].mMinMax[1], boxMinMax1[handle].mMinMax[0], boxMinMax1[handle].mMinMax[1],
-								       boxMinMax0[ownerId].mMinMax[0],boxMinMax0[ownerId].mMinMax[1],boxMinMax1[ownerId].mMinMax[0],boxMinMax1[ownerId].mMinMax[1])
+								Intersect2D_Handle(boxMinMax0, boxMinMax1, handle, ownerId)
 	#if BP_SAP_TEST_GROUP_ID_CREATEUPDATE
 		#ifdef BP_FILTERING_USES_TYPE_IN_GROUP
 								&& groupFiltering(group, asapBoxGroupIds[ownerId], mLUT)
@@ -1632,7 +1755,7 @@ void BroadPhaseSap::batchUpdateFewUpdates
 						}
 	#endif
 						startIndex--;
-						CurrentIndex = mListPrev[CurrentIndex];
+						CurrentIndex = listPrev[CurrentIndex];
 						CurrentValue = BaseEPValues[CurrentIndex];
 					}
 					while(ThisValue < CurrentValue);
@@ -1654,8 +1777,7 @@ void BroadPhaseSap::batchUpdateFewUpdates
 #if 1
 							if(
 #if BP_SAP_USE_OVERLAP_TEST_ON_REMOVES
-								Intersect2D_Handle(boxMinMax0[handle].mMinMax[0], boxMinMax0[handle].mMinMax[1], boxMinMax1[handle].mMinMax[0], boxMinMax1[handle].mMinMax[1],
-								       boxMinMax0[ownerId].mMinMax[0],boxMinMax0[ownerId].mMinMax[1],boxMinMax1[ownerId].mMinMax[0],boxMinMax1[ownerId].mMinMax[1])
+								Intersect2D_Handle(boxMinMax0, boxMinMax1, handle, ownerId)
 #endif
 #if BP_SAP_TEST_GROUP_ID_CREATEUPDATE
 	#ifdef BP_FILTERING_USES_TYPE_IN_GROUP
@@ -1684,7 +1806,7 @@ void BroadPhaseSap::batchUpdateFewUpdates
 						}
 	#endif
 						startIndex--;
-						CurrentIndex = mListPrev[CurrentIndex];
+						CurrentIndex = listPrev[CurrentIndex];
 						CurrentValue = BaseEPValues[CurrentIndex];
 					}
 					while(ThisValue < CurrentValue);
@@ -1693,21 +1815,21 @@ void BroadPhaseSap::batchUpdateFewUpdates
 				//This test is unnecessary. If we entered the outer loop, we're doing the swap in here
 				{
 					//Unlink from old position and re-link to new position
-					BpHandle oldNextIndex = mListNext[ThisIndex];
-					BpHandle oldPrevIndex = mListPrev[ThisIndex];
+					BpHandle oldNextIndex = listNext[ThisIndex];
+					BpHandle oldPrevIndex = listPrev[ThisIndex];
 
-					BpHandle newNextIndex = mListNext[CurrentIndex];
+					BpHandle newNextIndex = listNext[CurrentIndex];
 					BpHandle newPrevIndex = CurrentIndex;
 					
 					//Unlink this node
-					mListNext[oldPrevIndex] = oldNextIndex;
-					mListPrev[oldNextIndex] = oldPrevIndex;
+					listNext[oldPrevIndex] = oldNextIndex;
+					listPrev[oldNextIndex] = oldPrevIndex;
 
 					//Link it to it's new place in the list
-					mListNext[ThisIndex] = newNextIndex;
-					mListPrev[ThisIndex] = newPrevIndex;
-					mListPrev[newNextIndex] = ThisIndex;
-					mListNext[newPrevIndex] = ThisIndex;
+					listNext[ThisIndex] = newNextIndex;
+					listPrev[ThisIndex] = newPrevIndex;
+					listPrev[newNextIndex] = ThisIndex;
+					listNext[newPrevIndex] = ThisIndex;
 				}
 
 				//Loop over the activity pocket stack to make sure this set of shuffles didn't 
@@ -1718,7 +1840,7 @@ void BroadPhaseSap::batchUpdateFewUpdates
 					currentPocket--;
 				}
 				//If our start index > currentPocket->mEndIndex, then we don't overlap so create a new pocket
-				if(currentPocket == mActivityPockets || startIndex > (currentPocket->mEndIndex+1))
+				if(currentPocket == activityPockets || startIndex > (currentPocket->mEndIndex+1))
 				{
 					currentPocket++;
 					currentPocket->mStartIndex = startIndex;
@@ -1728,7 +1850,7 @@ void BroadPhaseSap::batchUpdateFewUpdates
 			//Get prev and next ptr...
 
 			NextData = BaseEPDatas[++ind];
-			PrevData = BaseEPDatas[mListPrev[ind]];
+			PrevData = BaseEPDatas[listPrev[ind]];
 
 		}while(!isSentinel(NextData) && !updated[getOwner(NextData)] && updated[getOwner(PrevData)]);
 		
@@ -1738,23 +1860,23 @@ void BroadPhaseSap::batchUpdateFewUpdates
 	pairsCapacity=maxNumPairs;
 
 
-	BroadPhaseActivityPocket* pocket = mActivityPockets+1;
+	BroadPhaseActivityPocket* pocket = activityPockets+1;
 
 	while(pocket <= currentPocket)
 	{
-		//PxU32 CurrIndex = mListPrev[pocket->mStartIndex];
+		//PxU32 CurrIndex = listPrev[pocket->mStartIndex];
 		for(PxU32 a = pocket->mStartIndex; a <= pocket->mEndIndex; ++a)
 		{
-			mListPrev[a] = BpHandle(a);
+			listPrev[a] = BpHandle(a);
 		}
 
 		//Now copy all the data to the array, updating the remap table
 		PxU32 CurrIndex = pocket->mStartIndex-1;
 		for(PxU32 a = pocket->mStartIndex; a <= pocket->mEndIndex; ++a)
 		{
-			CurrIndex = mListNext[CurrIndex];
+			CurrIndex = listNext[CurrIndex];
 			PxU32 origIndex =  CurrIndex;
-			BpHandle remappedIndex = mListPrev[origIndex];
+			BpHandle remappedIndex = listPrev[origIndex];
 
 			if(origIndex != a)
 			{
@@ -1769,9 +1891,9 @@ void BroadPhaseSap::batchUpdateFewUpdates
 				BaseEPValues[remappedIndex] = tmp;
 				BaseEPDatas[remappedIndex] = tmpHandle;
 
-				mListPrev[remappedIndex] = mListPrev[a];
+				listPrev[remappedIndex] = listPrev[a];
 				//Write back remap index (should be an immediate jump to original index)
-				mListPrev[mListPrev[a]] = remappedIndex;
+				listPrev[listPrev[a]] = remappedIndex;
 				asapBoxes[ownerId].mMinMax[IsMax] = BpHandle(a);
 			}
 			
@@ -1779,8 +1901,8 @@ void BroadPhaseSap::batchUpdateFewUpdates
 
 		for(PxU32 a = pocket->mStartIndex-1; a <= pocket->mEndIndex; ++a)
 		{
-			mListPrev[a+1] = BpHandle(a);
-			mListNext[a] = BpHandle(a+1);
+			listPrev[a+1] = BpHandle(a);
+			listNext[a] = BpHandle(a+1);
 		}
 		pocket++;
 	}
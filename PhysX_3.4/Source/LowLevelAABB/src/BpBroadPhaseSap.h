@@ -37,6 +37,7 @@
 #include "CmPhysXCommon.h"
 #include "BpSAPTasks.h"
 #include "PsUserAllocated.h"
+#include "PsArray.h"
 
 namespace physx
 {
@@ -61,9 +62,11 @@ class BroadPhaseBatchUpdateWorkTask: public Cm::Task
 public:
 
 	BroadPhaseBatchUpdateWorkTask(PxU64 contextId=0) :
-		Cm::Task(contextId),
+		Cm::Task(contextId, PxSceneMemoryCategory::eBROAD_PHASE),
 		mSap(NULL),
 		mAxis(0xffffffff),
+		mBoxMinMax0(NULL),
+		mBoxMinMax1(NULL),
 		mPairs(NULL),
 		mPairsSize(0),
 		mPairsCapacity(0)
@@ -76,6 +79,10 @@ public:
 
 	void set(class BroadPhaseSap* sap, const PxU32 axis) {mSap = sap; mAxis = axis;}
 
+	//Ranks along the two other axes used for the 2D overlap tests. boxMinMax1 is NULL if that axis is sorted concurrently.
+	void setOverlapTestRanks(const SapBox1D* boxMinMax0, const SapBox1D* boxMinMax1) {mBoxMinMax0 = boxMinMax0; mBoxMinMax1 = boxMinMax1;}
+	bool hasDeferredOverlapTest() const {return mBoxMinMax1 == NULL;}
+
 	BroadPhasePair* getPairs() const {return mPairs;}
 	PxU32 getPairsSize() const {return mPairsSize;}
 	PxU32 getPairsCapacity() const {return mPairsCapacity;}
@@ -88,12 +95,46 @@ private:
 
 	class BroadPhaseSap* mSap;
 	PxU32 mAxis;
+	const SapBox1D* mBoxMinMax0;
+	const SapBox1D* mBoxMinMax1;
 
 	BroadPhasePair* mPairs;
 	PxU32 mPairsSize;
 	PxU32 mPairsCapacity;
 };
 
+//Axis 1 is sorted at the same time as axis 0 so its overlap test along axis 0 is deferred until axis 0 has been sorted.
+//Each task runs that test on a range of the pairs found along axis 1.
+class BroadPhaseBatchFilterWorkTask: public Cm::Task
+{
+public:
+
+	BroadPhaseBatchFilterWorkTask(PxU64 contextId=0) :
+		Cm::Task(contextId, PxSceneMemoryCategory::eBROAD_PHASE),
+		mSap(NULL),
+		mStart(0),
+		mNbPairs(0),
+		mNbKeptPairs(0)
+	{
+	}
+
+	virtual void runInternal();
+
+	virtual const char* getName() const { return "BpBroadphaseSap.batchFilter"; }
+
+	void set(class BroadPhaseSap* sap, const PxU32 start, const PxU32 nbPairs) {mSap = sap; mStart = start; mNbPairs = nbPairs; mNbKeptPairs = 0;}
+
+	PxU32 getStart() const {return mStart;}
+	PxU32 getNbKeptPairs() const {return mNbKeptPairs;}
+
+private:
+
+	class BroadPhaseSap* mSap;
+	PxU32 mStart;
+	PxU32 mNbPairs;
+	PxU32 mNbKeptPairs;
+};
+
 //KS - TODO, this could be reduced to U16 in smaller scenes
 struct BroadPhaseActivityPocket
 {
@@ -108,7 +149,9 @@ class BroadPhaseSap : public BroadPhase, public Ps::UserAllocated
 public:
 
 	friend class BroadPhaseBatchUpdateWorkTask;
+	friend class BroadPhaseBatchFilterWorkTask;
 	friend class SapUpdateWorkTask;
+	friend class SapBatchUpdateStage2Task;
 	friend class SapPostUpdateWorkTask;
 
 										BroadPhaseSap(const PxU32 maxNbBroadPhaseOverlaps, const PxU32 maxNbStaticShapes, const PxU32 maxNbDynamicShapes, PxU64 contextID);
@@ -139,6 +182,7 @@ private:
 			PxcScratchAllocator*		mScratchAllocator;
 
 			SapUpdateWorkTask			mSapUpdateWorkTask;
+			SapBatchUpdateStage2Task	mSapBatchUpdateStage2Task;
 			SapPostUpdateWorkTask		mSapPostUpdateWorkTask;
 
 	//Data passed in from updateV.
@@ -159,16 +203,18 @@ private:
 
 	//Boxes.
 			SapBox1D*					mBoxEndPts[3];			//Position of box min/max in sorted arrays of end pts (needs to have mBoxesCapacity).
+			SapBox1D*					mBoxEndPtsPrev;			//Copy of mBoxEndPts[1] used by axis 0 while axis 1 is being sorted (needs to have mBoxesCapacity).
 
 	//End pts (endpts of boxes sorted along each axis).
 			ValType*					mEndPointValues[3];		//Sorted arrays of min and max box coords
 			BpHandle*					mEndPointDatas[3];		//Corresponding owner id and isMin/isMax for each entry in the sorted arrays of min and max box coords.
 
 			PxU8*						mBoxesUpdated;	
-			BpHandle*					mSortedUpdateElements;	
-			BroadPhaseActivityPocket*	mActivityPockets;
-			BpHandle*					mListNext;
-			BpHandle*					mListPrev;
+	//Per-axis scratch used by the batch update so that the three axes can be sorted concurrently.
+			BpHandle*					mSortedUpdateElements[3];	
+			BroadPhaseActivityPocket*	mActivityPockets[3];
+			BpHandle*					mListNext[3];
+			BpHandle*					mListPrev[3];
 
 			PxU32						mBoxesSize;				//Number of sorted boxes + number of unsorted (new) boxes
 			PxU32						mBoxesSizePrev;			//Number of sorted boxes 
@@ -196,6 +242,8 @@ private:
 
 			bool						setUpdateData(const BroadPhaseUpdateData& updateData);
 			void						update();
+			void						update(const PxU32 numCpuTasks, PxBaseTask* continuation);
+			void						launchBatchUpdateStage2(const PxU32 numCpuTasks, PxBaseTask* continuation);
 			void						postUpdate();
 
 	//Batch create/remove/update.
@@ -203,14 +251,17 @@ private:
 			void						batchRemove();
 			void						batchUpdate();
 
-			void						batchUpdate(const PxU32 Axis, BroadPhasePair*& pairs, PxU32& pairsSize, PxU32& pairsCapacity);
+			void						batchUpdate(const PxU32 Axis, const SapBox1D* PX_RESTRICT boxMinMax0, const SapBox1D* PX_RESTRICT boxMinMax1, BroadPhasePair*& pairs, PxU32& pairsSize, PxU32& pairsCapacity);
+
+			void						batchUpdateFewUpdates(const PxU32 Axis, const SapBox1D* PX_RESTRICT boxMinMax0, const SapBox1D* PX_RESTRICT boxMinMax1, BroadPhasePair*& pairs, PxU32& pairsSize, PxU32& pairsCapacity);
 
-			void						batchUpdateFewUpdates(const PxU32 Axis, BroadPhasePair*& pairs, PxU32& pairsSize, PxU32& pairsCapacity);
+			PxU32						filterBatchUpdatePairs(BroadPhasePair* PX_RESTRICT pairs, const PxU32 nbPairs) const;
 
 			void						ComputeSortedLists(	BpHandle* PX_RESTRICT newBoxIndicesSorted, PxU32& newBoxIndicesCount, BpHandle* PX_RESTRICT oldBoxIndicesSorted, PxU32& oldBoxIndicesCount,
 															bool& allNewBoxesStatics, bool& allOldBoxesStatics);
 
 			BroadPhaseBatchUpdateWorkTask mBatchUpdateTasks[3];
+			Ps::Array<BroadPhaseBatchFilterWorkTask> mBatchFilterTasks;
 
 			PxU64						mContextID;
 #if PX_DEBUG
@@ -278,6 +278,18 @@ PX_FORCE_INLINE bool Intersect2D_Handle
 			bDir2Max > cDir2Min && cDir2Max > bDir2Min);        
 }
 
+PX_FORCE_INLINE bool Intersect1D_Handle(const SapBox1D& b, const SapBox1D& c)
+{
+	return (b.mMinMax[1] > c.mMinMax[0] && c.mMinMax[1] > b.mMinMax[0]);
+}
+
+//2D intersection test used by the batch update. The ranks of the second axis are NULL when that axis is being sorted concurrently, 
+//in which case the test along that axis is done once it has been sorted (see BroadPhaseSap::filterBatchUpdatePairs).
+PX_FORCE_INLINE bool Intersect2D_Handle(const SapBox1D* PX_RESTRICT boxMinMax0, const SapBox1D* PX_RESTRICT boxMinMax1, const BpHandle b, const BpHandle c)
+{
+	return Intersect1D_Handle(boxMinMax0[b], boxMinMax0[c]) && (!boxMinMax1 || Intersect1D_Handle(boxMinMax1[b], boxMinMax1[c]));
+}
+
 } //namespace Bp
 
 } //namespace physx
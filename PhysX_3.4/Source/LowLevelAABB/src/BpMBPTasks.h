@@ -47,7 +47,7 @@ namespace physx
 	class MBPTask : public Cm::Task, public shdfnd::UserAllocated
 	{
 		public:
-												MBPTask(PxU64 contextId) : Cm::Task(contextId), mMBP(NULL), mNumCpuTasks(0)		{}
+												MBPTask(PxU64 contextId) : Cm::Task(contextId, PxSceneMemoryCategory::eBROAD_PHASE), mMBP(NULL), mNumCpuTasks(0)		{}
 
 		PX_FORCE_INLINE	void					set(Bp::BroadPhaseMBP* mbp, PxcScratchAllocator* sa, PxU32 numCpuTasks)
 												{
@@ -81,8 +81,36 @@ namespace physx
 		MBPUpdateWorkTask& operator=(const MBPUpdateWorkTask&);
 	};
 
-	// PT: this task runs after MBPUpdateWorkTask. This is where MBP_PairManager::removeMarkedPairs is called, to finalize
-	// the work and come up with created/removed lists. This is single-threaded.
+	// PT: this task sorts and prunes a single region. Regions are independent so these tasks run in parallel, each
+	// of them writing the overlaps to its region's own pair buffer. They are spawned by MBPUpdateWorkTask.
+	class MBPRegionWorkTask : public Cm::Task, public shdfnd::UserAllocated
+	{
+	public:
+								MBPRegionWorkTask(PxU64 contextId) : Cm::Task(contextId, PxSceneMemoryCategory::eBROAD_PHASE), mMBP(NULL), mRegionIndex(0)	{}
+								~MBPRegionWorkTask()																	{}
+
+		PX_FORCE_INLINE	void	set(Bp::BroadPhaseMBP* mbp, PxU32 regionIndex)
+								{
+									mMBP = mbp;
+									mRegionIndex = regionIndex;
+								}
+
+		// PxBaseTask
+		virtual const char*		getName() const { return "BpMBP.regionWork"; }
+		//~PxBaseTask
+
+		// Cm::Task
+		virtual void			runInternal();
+		//~Cm::Task
+
+	private:
+				Bp::BroadPhaseMBP*	mMBP;
+				PxU32				mRegionIndex;
+	};
+
+	// PT: this task runs after MBPUpdateWorkTask. This is where the region pair buffers are merged and
+	// MBP_PairManager::removeMarkedPairs is called, to finalize the work and come up with created/removed lists.
+	// This is single-threaded.
 	class MBPPostUpdateWorkTask : public MBPTask
 	{
 	public:
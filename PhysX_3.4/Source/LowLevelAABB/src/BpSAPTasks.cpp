@@ -52,7 +52,12 @@ namespace Bp
 
 void SapUpdateWorkTask::runInternal()
 {
-	mSAP->update();
+	mSAP->update(mNumCpuTasks, getContinuation());
+}
+
+void SapBatchUpdateStage2Task::runInternal()
+{
+	mSAP->launchBatchUpdateStage2(mNumCpuTasks, getContinuation());
 }
 
 void SapPostUpdateWorkTask::runInternal()
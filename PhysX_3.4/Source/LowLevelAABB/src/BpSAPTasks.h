@@ -44,7 +44,7 @@ namespace Bp
 	{
 	public:
 
-		SapUpdateWorkTask(PxU64 contextId) : Cm::Task(contextId)
+		SapUpdateWorkTask(PxU64 contextId) : Cm::Task(contextId, PxSceneMemoryCategory::eBROAD_PHASE)
 		{
 		}
 
@@ -68,11 +68,39 @@ namespace Bp
 		PxU32 mNumCpuTasks;
 	};
 
+	class SapBatchUpdateStage2Task: public Cm::Task
+	{
+	public:
+
+		SapBatchUpdateStage2Task(PxU64 contextId) : Cm::Task(contextId, PxSceneMemoryCategory::eBROAD_PHASE)
+		{
+		}
+
+		void setBroadPhase(BroadPhaseSap* sap) 
+		{
+			mSAP = sap;
+		}
+
+		void set(const PxU32 numCpuTasks) 
+		{
+			mNumCpuTasks = numCpuTasks; 
+		}
+
+		virtual void runInternal();
+
+		virtual const char* getName() const { return "BpSAP.batchUpdateStage2"; }
+
+	private:
+
+		BroadPhaseSap* mSAP;
+		PxU32 mNumCpuTasks;
+	};
+
 	class SapPostUpdateWorkTask: public Cm::Task
 	{
 	public:
 
-		SapPostUpdateWorkTask(PxU64 contextId) : Cm::Task(contextId)
+		SapPostUpdateWorkTask(PxU64 contextId) : Cm::Task(contextId, PxSceneMemoryCategory::eBROAD_PHASE)
 		{
 		
 		}
@@ -1586,7 +1586,7 @@ SimpleAABBManager::SimpleAABBManager(	BroadPhase& bp, BoundsArray& boundsArray,
 										PxU32 maxNbAggregates, PxU32 maxNbShapes, Ps::VirtualAllocator& allocator, PxU64 contextID,
 										PxPairFilteringMode::Enum kineKineFilteringMode, PxPairFilteringMode::Enum staticKineFilteringMode) :
 	mPostBroadPhase2			(contextID, *this),
-	mPostBroadPhase3			(contextID, this, "SimpleAABBManager::postBroadPhaseStage3"),
+	mPostBroadPhase3			(contextID, this, "SimpleAABBManager::postBroadPhaseStage3", PxSceneMemoryCategory::eBROAD_PHASE),
 	mFinalizeUpdateTask			(contextID),
 	mChangedHandleMap			(allocator),
 	mGroups						(allocator),
@@ -2607,7 +2607,7 @@ public:
 	PairData mCreatedPairs[2];
 	PairData mDestroyedPairs[2];
 
-	ProcessAggPairsBase(PxU64 contextID) : Cm::Task(contextID)
+	ProcessAggPairsBase(PxU64 contextID) : Cm::Task(contextID, PxSceneMemoryCategory::eBROAD_PHASE)
 	{
 	}
 
@@ -2698,7 +2698,7 @@ public:
 	PxU32 mNbAggs;
 	Bp::SimpleAABBManager* mManager;
 
-	SortAggregateBoundsParallel(PxU64 contextID, Aggregate** aggs, PxU32 nbAggs) : Cm::Task(contextID),
+	SortAggregateBoundsParallel(PxU64 contextID, Aggregate** aggs, PxU32 nbAggs) : Cm::Task(contextID, PxSceneMemoryCategory::eBROAD_PHASE),
 		mAggregates(aggs), mNbAggs(nbAggs)
 	{
 	}
@@ -106,6 +106,12 @@ public:
 	*/
 	PX_FORCE_INLINE PxReal				getCCDSeparationThreshold()		const	{ return mCCDSeparationThreshold; }
 
+	/**
+	\brief Returns the solver residual tolerance
+	\return The residual tolerance below which an island stops iterating. 0 if early termination is disabled.
+	*/
+	PX_FORCE_INLINE PxReal				getSolverResidualTolerance()	const	{ return mSolverResidualTolerance; }
+
 	/**
 	\brief Sets the bounce threshold
 	\param[in] f The bounce threshold
@@ -131,6 +137,11 @@ public:
 	\param[in] offset The friction offset threshold
 	*/
 	PX_FORCE_INLINE void				setCCDSeparationThreshold(PxReal offset)		{ mCCDSeparationThreshold = offset; }
+	/**
+	\brief Sets the solver residual tolerance
+	\param[in] tolerance The residual tolerance. 0 disables early termination.
+	*/
+	PX_FORCE_INLINE void				setSolverResidualTolerance(PxReal tolerance)	{ mSolverResidualTolerance = tolerance; }
 
 
 	/**
@@ -155,6 +166,12 @@ public:
 	*/
 	PX_FORCE_INLINE PxFrictionType::Enum getFrictionType() const				{ return mFrictionType; }
 
+	/**
+	\brief Returns the solver type being used.
+	\return The solver type being used.
+	*/
+	PX_FORCE_INLINE PxSolverType::Enum	getSolverType()					const	{ return mSolverType; }
+
 	/**
 	\brief Returns the threshold stream
 	\return The threshold stream
@@ -175,6 +192,12 @@ public:
 	*/
 	PX_FORCE_INLINE void				setFrictionType(PxFrictionType::Enum f) 	{ mFrictionType = f; }
 
+	/**
+	\brief Sets the solver type to be used.
+	\param[in] s The solver type to be used.
+	*/
+	PX_FORCE_INLINE void				setSolverType(PxSolverType::Enum s) 		{ mSolverType = s; }
+
 	/**
 	\brief Destroys this dynamics context
 	*/
@@ -266,7 +289,9 @@ protected:
 		mUseAdaptiveForce			(useAdaptiveForce),
 
 		mBounceThreshold(-2.0f),
+		mSolverResidualTolerance(0.0f),
 		mSolverBatchSize(32),
+		mSolverType(PxSolverType::ePGS),
 		mConstraintWriteBackPool(Ps::VirtualAllocator(allocatorCallback)),
 		mSimStats(simStats)
 		 {
@@ -336,6 +361,11 @@ protected:
 	*/
 	PxReal						mCCDSeparationThreshold;
 
+	/**
+	\brief Islands stop iterating once no impulse changed by more than this in an iteration. 0 disables early termination.
+	*/
+	PxReal						mSolverResidualTolerance;
+
 	/**
 	\brief Threshold for controlling friction correlation
 	*/
@@ -350,6 +380,11 @@ protected:
 	*/
 	PxFrictionType::Enum		mFrictionType;
 
+	/**
+	\brief The current solver type being used
+	*/
+	PxSolverType::Enum			mSolverType;
+
 	/**
 	\brief Structure to encapsulate contact stream allocations. Used by GPU solver to reference pre-allocated pinned host memory
 	*/
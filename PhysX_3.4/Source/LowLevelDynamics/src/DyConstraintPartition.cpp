@@ -426,6 +426,189 @@ void writeConstraintDesc(const PxSolverConstraintDesc* PX_RESTRICT descs, const
 	}
 }
 
+#define MAX_CONSTRAINT_DEGREE 255
+
+//The progress counters of the two ends of a constraint. Articulation links share the counter of their articulation.
+PX_FORCE_INLINE PxU32& getSolverProgressA(PxSolverConstraintDesc& desc)
+{
+	return desc.linkIndexA == PxSolverConstraintDesc::NO_LINK ? desc.bodyA->solverProgress : desc.articulationA->solverProgress;
+}
+
+PX_FORCE_INLINE PxU32& getSolverProgressB(PxSolverConstraintDesc& desc)
+{
+	return desc.linkIndexB == PxSolverConstraintDesc::NO_LINK ? desc.bodyB->solverProgress : desc.articulationB->solverProgress;
+}
+
+//Orders the constraints by the number of dynamic constraints acting on their two bodies, largest first. Greedy colouring
+//in this order needs fewer partitions, and the constraints of hub bodies with many contacts claim the leading partitions,
+//so the constraints of the other bodies fill up those partitions rather than trailing behind the hub in a tail of
+//nearly-empty ones. The sort is stable, so the result only depends on the constraints of the island itself.
+template <typename Classification>
+void orderConstraintsByDegree(PxSolverConstraintDesc* PX_RESTRICT descs, const PxU32 numConstraints, Classification& classification,
+							  PxSolverConstraintDesc* PX_RESTRICT eaTempConstraintDescriptors)
+{
+	//solverProgress isn't used before the constraints are classified, so it counts the dynamic constraints of each body here
+	for(PxU32 i = 0; i < numConstraints; ++i)
+	{
+		uintptr_t indexA, indexB;
+		bool activeA, activeB;
+		if(classification.classifyConstraint(descs[i], indexA, indexB, activeA, activeB))
+		{
+			getSolverProgressA(descs[i])++;
+			getSolverProgressB(descs[i])++;
+		}
+	}
+
+	PxU32 offsets[MAX_CONSTRAINT_DEGREE + 1];
+	PxMemZero(offsets, sizeof(offsets));
+
+	for(PxU32 i = 0; i < numConstraints; ++i)
+	{
+		uintptr_t indexA, indexB;
+		bool activeA, activeB;
+		//Constraints against static or kinematic bodies aren't coloured, they go last
+		const PxU32 degree = classification.classifyConstraint(descs[i], indexA, indexB, activeA, activeB) ? 
+			PxMin(getSolverProgressA(descs[i]) + getSolverProgressB(descs[i]), PxU32(MAX_CONSTRAINT_DEGREE)) : 0;
+		offsets[degree]++;
+	}
+
+	PxU32 accumulation = 0;
+	for(PxU32 a = MAX_CONSTRAINT_DEGREE + 1; a > 0; --a)
+	{
+		const PxU32 count = offsets[a-1];
+		offsets[a-1] = accumulation;
+		accumulation += count;
+	}
+
+	for(PxU32 i = 0; i < numConstraints; ++i)
+	{
+		uintptr_t indexA, indexB;
+		bool activeA, activeB;
+		const PxU32 degree = classification.classifyConstraint(descs[i], indexA, indexB, activeA, activeB) ? 
+			PxMin(getSolverProgressA(descs[i]) + getSolverProgressB(descs[i]), PxU32(MAX_CONSTRAINT_DEGREE)) : 0;
+		eaTempConstraintDescriptors[offsets[degree]++] = descs[i];
+	}
+
+	PxMemCopy(descs, eaTempConstraintDescriptors, sizeof(PxSolverConstraintDesc) * numConstraints);
+
+	classification.clearState();
+}
+
+}
+
+#define MAX_MERGED_PARTITION_SIZE 4
+
+//Moves the constraints of partitions that can't fill a single batch into earlier partitions that don't touch their bodies.
+//Every partition costs the parallel solver a barrier per iteration, so a partition that can be emptied this way is removed.
+//Returns the number of partitions removed.
+template<typename Classification>
+PxU32 mergeSmallPartitions(Ps::Array<PxU32>& accumulatedConstraintsPerPartition, PxSolverConstraintDesc* PX_RESTRICT eaOrderedConstraintDescriptors, 
+	Ps::Array<PxU32>& bitField, const Classification& classification, const PxU32 numBodies, const PxU32 numArticulations)
+{
+	PxU32 numPartitions = 0;
+	
+	PxU32 prevAccumulation = 0;
+	for(; numPartitions < accumulatedConstraintsPerPartition.size() && accumulatedConstraintsPerPartition[numPartitions] > prevAccumulation; 
+		prevAccumulation = accumulatedConstraintsPerPartition[numPartitions++]);
+
+	if(numPartitions < 2)
+		return 0;
+
+	bitField.reserve((numBodies + numArticulations + 31)/32);
+	bitField.forceSize_Unsafe((numBodies + numArticulations + 31)/32);
+	PxMemZero(bitField.begin(), sizeof(PxU32)*bitField.size());
+
+	PxU32 numRemoved = 0;
+
+	for(PxU32 partitionIndex = numPartitions - 1; partitionIndex > 0; --partitionIndex)
+	{
+		if(accumulatedConstraintsPerPartition[partitionIndex] - accumulatedConstraintsPerPartition[partitionIndex-1] >= MAX_MERGED_PARTITION_SIZE)
+			continue;
+
+		for(PxU32 target = 0; target < partitionIndex && accumulatedConstraintsPerPartition[partitionIndex] > accumulatedConstraintsPerPartition[partitionIndex-1]; ++target)
+		{
+			//Mark the bodies of the target partition...
+			const PxU32 startIndex = target == 0 ? 0 : accumulatedConstraintsPerPartition[target-1];
+			for(PxU32 a = startIndex; a < accumulatedConstraintsPerPartition[target]; ++a)
+			{
+				uintptr_t indexA, indexB;
+				bool activeA, activeB;
+				classification.classifyConstraint(eaOrderedConstraintDescriptors[a], indexA, indexB, activeA, activeB);
+				if(activeA)
+					bitField[PxU32(indexA)/32] |= getBit(indexA & 31);
+				if(activeB)
+					bitField[PxU32(indexB)/32] |= getBit(indexB & 31);
+			}
+
+			//...and pull in every constraint of the small partition that doesn't touch them. Removing a constraint moves the first
+			//constraint of the small partition into its slot, so the same slot is examined again.
+			PxU32 b = accumulatedConstraintsPerPartition[partitionIndex];
+			while(b > accumulatedConstraintsPerPartition[partitionIndex-1])
+			{
+				const PxU32 ind = b-1;
+				uintptr_t indexA, indexB;
+				bool activeA, activeB;
+				classification.classifyConstraint(eaOrderedConstraintDescriptors[ind], indexA, indexB, activeA, activeB);
+
+				if((activeA && (bitField[PxU32(indexA)/32] & getBit(indexA & 31))) || (activeB && (bitField[PxU32(indexB)/32] & getBit(indexB & 31))))
+				{
+					b--;
+					continue;
+				}
+
+				if(activeA)
+					bitField[PxU32(indexA)/32] |= getBit(indexA & 31);
+				if(activeB)
+					bitField[PxU32(indexB)/32] |= getBit(indexB & 31);
+
+				//Shift the first constraint of each partition in between to its end to open up a slot at the end of the target
+				const PxSolverConstraintDesc tmp = eaOrderedConstraintDescriptors[ind];
+				PxU32 index = ind;
+				for(PxU32 c = partitionIndex; c > target; --c)
+				{
+					const PxU32 newIndex = accumulatedConstraintsPerPartition[c-1]++;
+					if(index != newIndex)
+						eaOrderedConstraintDescriptors[index] = eaOrderedConstraintDescriptors[newIndex];
+					index = newIndex;
+				}
+				eaOrderedConstraintDescriptors[index] = tmp;
+			}
+
+			//Clear the marks again, which is cheaper than clearing the whole bit field for large islands
+			const PxU32 targetStartIndex = target == 0 ? 0 : accumulatedConstraintsPerPartition[target-1];
+			for(PxU32 a = targetStartIndex; a < accumulatedConstraintsPerPartition[target]; ++a)
+			{
+				uintptr_t indexA, indexB;
+				bool activeA, activeB;
+				classification.classifyConstraint(eaOrderedConstraintDescriptors[a], indexA, indexB, activeA, activeB);
+				if(activeA)
+					bitField[PxU32(indexA)/32] &= ~getBit(indexA & 31);
+				if(activeB)
+					bitField[PxU32(indexB)/32] &= ~getBit(indexB & 31);
+			}
+		}
+
+		if(accumulatedConstraintsPerPartition[partitionIndex] == accumulatedConstraintsPerPartition[partitionIndex-1])
+			numRemoved++;
+	}
+
+	if(numRemoved)
+	{
+		PxU32 partitionCount = 0;
+		PxU32 lastPartitionCount = 0;
+		for(PxU32 a = 0; a < numPartitions; ++a)
+		{
+			const PxU32 constraintCount = accumulatedConstraintsPerPartition[a];
+			if(constraintCount != lastPartitionCount)
+			{
+				accumulatedConstraintsPerPartition[partitionCount++] = constraintCount;
+				lastPartitionCount = constraintCount;
+			}
+		}
+		accumulatedConstraintsPerPartition.forceSize_Unsafe(partitionCount);
+	}
+
+	return numRemoved;
 }
 
 #define PX_NORMALIZE_PARTITIONS 1
@@ -554,6 +737,84 @@ PxU32 normalizePartitions(Ps::Array<PxU32>& accumulatedConstraintsPerPartition,
 
 #endif
 
+namespace
+{
+
+enum ConstraintKind
+{
+	eDYNAMIC_CONTACT,
+	eSTATIC_CONTACT,
+	eJOINT,
+	eOTHER,
+	eKIND_COUNT
+};
+
+template<typename Classification>
+PX_FORCE_INLINE PxU32 getConstraintKind(const PxSolverConstraintDesc& desc, const Classification& classification)
+{
+	if(isArticulationConstraint(desc))
+		return eOTHER;
+
+	if(desc.constraintLengthOver16 == DY_SC_TYPE_RB_CONTACT)
+	{
+		uintptr_t indexA, indexB;
+		bool activeA, activeB;
+		const bool notContainsStatic = classification.classifyConstraint(desc, indexA, indexB, activeA, activeB);
+		return notContainsStatic ? PxU32(eDYNAMIC_CONTACT) : PxU32(eSTATIC_CONTACT);
+	}
+
+	return desc.constraintLengthOver16 == DY_SC_TYPE_RB_1D ? PxU32(eJOINT) : PxU32(eOTHER);
+}
+
+}
+
+//Stable-sorts the constraints inside each partition by kind: dynamic contacts, contacts against a static or kinematic
+//body, rigid body joints and everything else. Batches of 4 are only formed from consecutive constraints of the same
+//kind, so this yields more full batches, and it places batches of the same block type next to each other so the
+//solver can process them as 8-wide pairs. Reordering within a partition is safe as its constraints share no dynamic body.
+template<typename Classification>
+void groupPartitionsByConstraintKind(const Ps::Array<PxU32>& accumulatedConstraintsPerPartition, const PxU32 numPartitions,
+	PxSolverConstraintDesc* PX_RESTRICT eaOrderedConstraintDescriptors, PxSolverConstraintDesc* PX_RESTRICT eaTempConstraintDescriptors,
+	const Classification& classification)
+{
+	PxU32 startIndex = 0;
+	for(PxU32 a = 0; a < numPartitions; ++a)
+	{
+		const PxU32 endIndex = accumulatedConstraintsPerPartition[a];
+
+		PxU32 counts[eKIND_COUNT] = { 0, 0, 0, 0 };
+		for(PxU32 b = startIndex; b < endIndex; ++b)
+			counts[getConstraintKind(eaOrderedConstraintDescriptors[b], classification)]++;
+
+		PxU32 largestCount = 0;
+		for(PxU32 k = 0; k < eKIND_COUNT; ++k)
+			largestCount = PxMax(largestCount, counts[k]);
+
+		//Nothing to do if the partition only holds one kind of constraint
+		if(largestCount != endIndex - startIndex)
+		{
+			PxU32 offsets[eKIND_COUNT];
+			PxU32 accumulation = startIndex;
+			for(PxU32 k = 0; k < eKIND_COUNT; ++k)
+			{
+				offsets[k] = accumulation;
+				accumulation += counts[k];
+			}
+
+			for(PxU32 b = startIndex; b < endIndex; ++b)
+			{
+				const PxSolverConstraintDesc& desc = eaOrderedConstraintDescriptors[b];
+				eaTempConstraintDescriptors[offsets[getConstraintKind(desc, classification)]++] = desc;
+			}
+
+			PxMemCopy(eaOrderedConstraintDescriptors + startIndex, eaTempConstraintDescriptors + startIndex, 
+				sizeof(PxSolverConstraintDesc) * (endIndex - startIndex));
+		}
+
+		startIndex = endIndex;
+	}
+}
+
 PxU32 partitionContactConstraints(ConstraintPartitionArgs& args) 
 {
 	PxU32 maxPartition = 0;
@@ -570,6 +831,7 @@ PxU32 partitionContactConstraints(ConstraintPartitionArgs& args)
 
 	Ps::Array<PxU32>& constraintsPerPartition = *args.mConstraintsPerPartition;
 	constraintsPerPartition.forceSize_Unsafe(0);
+	args.mNumMergedPartitions = 0;
 
 	for(PxU32 a = 0; a < numBodies; ++a)
 	{
@@ -590,6 +852,7 @@ PxU32 partitionContactConstraints(ConstraintPartitionArgs& args)
 	if(numArticulations == 0)
 	{
 		RigidBodyClassification classification(eaAtoms, numBodies);
+		orderConstraintsByDegree(eaConstraintDescriptors, numConstraintDescriptors, classification, eaTempConstraintDescriptors);
 		classifyConstraintDesc(eaConstraintDescriptors, numConstraintDescriptors, classification, constraintsPerPartition,
 			eaTempConstraintDescriptors);
 		
@@ -618,8 +881,14 @@ PxU32 partitionContactConstraints(ConstraintPartitionArgs& args)
 		numOrderedConstraints = numConstraintDescriptors;
 
 		if(!args.enhancedDeterminism)
+		{
+			args.mNumMergedPartitions = mergeSmallPartitions(constraintsPerPartition, eaOrderedConstraintDescriptors, *args.mBitField,
+				classification, numBodies, 0);
 			maxPartition = normalizePartitions(constraintsPerPartition, eaOrderedConstraintDescriptors, numConstraintDescriptors, *args.mBitField,
 				classification, numBodies, 0);
+			groupPartitionsByConstraintKind(constraintsPerPartition, maxPartition, eaOrderedConstraintDescriptors, eaTempConstraintDescriptors,
+				classification);
+		}
 
 	}
 	else
@@ -638,6 +907,7 @@ PxU32 partitionContactConstraints(ConstraintPartitionArgs& args)
 		}
 		ExtendedRigidBodyClassification classification(eaAtoms, numBodies, eaFsDatas, numArticulations);
 
+		orderConstraintsByDegree(eaConstraintDescriptors, numConstraintDescriptors, classification, eaTempConstraintDescriptors);
 		classifyConstraintDesc(eaConstraintDescriptors, numConstraintDescriptors, classification, 
 			constraintsPerPartition, eaTempConstraintDescriptors);
 
@@ -673,8 +943,14 @@ PxU32 partitionContactConstraints(ConstraintPartitionArgs& args)
 		numOrderedConstraints = numConstraintDescriptors;
 
 		if (!args.enhancedDeterminism)
+		{
+			args.mNumMergedPartitions = mergeSmallPartitions(constraintsPerPartition, eaOrderedConstraintDescriptors, *args.mBitField,
+				classification, numBodies, numArticulations);
 			maxPartition = normalizePartitions(constraintsPerPartition, eaOrderedConstraintDescriptors,  
 				numConstraintDescriptors, *args.mBitField, classification, numBodies, numArticulations);
+			groupPartitionsByConstraintKind(constraintsPerPartition, maxPartition, eaOrderedConstraintDescriptors, eaTempConstraintDescriptors,
+				classification);
+		}
 
 	}
 
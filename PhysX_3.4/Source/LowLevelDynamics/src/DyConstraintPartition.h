@@ -60,6 +60,7 @@ struct ConstraintPartitionArgs
 	PxU32									mNumSelfConstraintBlocks;
 	PxU32									mNumDifferentBodyConstraints;
 	PxU32									mNumSelfConstraints;
+	PxU32									mNumMergedPartitions;		//partitions removed by merging them into others
 	Ps::Array<PxU32>*						mConstraintsPerPartition;
 	//Ps::Array<PxU32>*						mStartIndices;
 	Ps::Array<PxU32>*						mBitField;
@@ -515,9 +515,12 @@ PxReal dt, PxReal invdt)
 		const PxReal velBias = initVel * s.velMultiplier;
 		s.constant += velBias;
 		s.unbiasedConstant += velBias;
+		s.initVelocity = initVel;
 
 		if(c.flags & Px1DConstraintFlag::eOUTPUT_FORCE)
 			s.flags |= DY_SC_FLAG_OUTPUT_FORCE;
+		if(tracksGeometricError(c))
+			s.flags |= DY_SC_FLAG_TRACK_ERROR;
 
 		constraints += stride;
 	}
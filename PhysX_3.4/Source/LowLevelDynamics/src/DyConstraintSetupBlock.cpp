@@ -512,6 +512,7 @@ PxConstraintAllocator& allocator, PxU32 maxRows)
 			const Vec4V velBias = V4Mul(c->velMultiplier, normalVel);
 			c->constant = V4Add(c->constant, velBias);
 			c->unbiasedConstant = V4Add(c->unbiasedConstant, velBias);
+			c->initVelocity = normalVel;
 
 			if(con0->flags & Px1DConstraintFlag::eOUTPUT_FORCE)
 				c->flags[0] |= DY_SC_FLAG_OUTPUT_FORCE;
@@ -521,6 +522,15 @@ PxConstraintAllocator& allocator, PxU32 maxRows)
 				c->flags[2] |= DY_SC_FLAG_OUTPUT_FORCE;
 			if(con3->flags & Px1DConstraintFlag::eOUTPUT_FORCE)
 				c->flags[3] |= DY_SC_FLAG_OUTPUT_FORCE;
+
+			if(tracksGeometricError(*con0))
+				c->flags[0] |= DY_SC_FLAG_TRACK_ERROR;
+			if(tracksGeometricError(*con1))
+				c->flags[1] |= DY_SC_FLAG_TRACK_ERROR;
+			if(tracksGeometricError(*con2))
+				c->flags[2] |= DY_SC_FLAG_TRACK_ERROR;
+			if(tracksGeometricError(*con3))
+				c->flags[3] |= DY_SC_FLAG_TRACK_ERROR;
 		}
 		*(reinterpret_cast<PxU32*>(currPtr)) = 0;
 		*(reinterpret_cast<PxU32*>(currPtr + 4)) = 0;
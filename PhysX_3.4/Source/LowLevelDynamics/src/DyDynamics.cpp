@@ -189,6 +189,9 @@ DynamicsContext::DynamicsContext(	PxcNpMemBlockPool* memBlockPool,
 	mExceededForceThresholdStream[1] = PX_PLACEMENT_NEW(PX_ALLOC(sizeof(ThresholdStream), PX_DEBUG_EXP("ExceededForceThresholdStream[1]")), ThresholdStream(*allocatorCallback));
 	mThresholdStreamOut = 0;
 	mCurrentIndex = 0;
+	mSolverBarrierStats.clear();
+	mSolverIterationStats.clear();
+	mSolverPartitionStats.clear();
 	mWorldSolverBody.linearVelocity = PxVec3(0);
 	mWorldSolverBody.angularState = PxVec3(0);
 	mWorldSolverBodyData.invMass = 0;
@@ -375,7 +378,7 @@ public:
 							const PxU32			startIndex,
 							const PxU32			numToIntegrate,
 							const PxVec3&		gravity) :
-		Cm::Task(context.getContextId()),
+		Cm::Task(context.getContextId(), PxSceneMemoryCategory::eSOLVER),
 		mContext(context),
 		mBodyArray(bodyArray),
 		mOriginalBodyArray(originalBodyArray),
@@ -423,7 +426,7 @@ class PxsParallelSolverTask : public Cm::Task
 public:
 
 	PxsParallelSolverTask(SolverIslandParams& params, DynamicsContext& context, PxFrictionType::Enum frictionType, IG::IslandSim& islandSim)
-		: Cm::Task(context.getContextId()), mParams(params), mContext(context), mFrictionType(frictionType), mIslandSim(islandSim)
+		: Cm::Task(context.getContextId(), PxSceneMemoryCategory::eSOLVER), mParams(params), mContext(context), mFrictionType(frictionType), mIslandSim(islandSim)
 	{
 	}
 
@@ -459,7 +462,7 @@ public:
 		PxU32 stride,
 		PxsMaterialManager* materialManager,
 		PxsContactManagerOutputIterator& iterator) :
-		Cm::Task(context.getContextId()),
+		Cm::Task(context.getContextId(), PxSceneMemoryCategory::eSOLVER),
 		mContext(context), 
 		mThreadContext(threadContext),
 		mObjects(objects),
@@ -611,7 +614,7 @@ class PxsForceThresholdTask  : public Cm::Task
 	PxsForceThresholdTask& operator=(const PxsForceThresholdTask&);
 public:
 
-	PxsForceThresholdTask(DynamicsContext& context) : Cm::Task(context.getContextId()), mDynamicsContext(context) 
+	PxsForceThresholdTask(DynamicsContext& context) : Cm::Task(context.getContextId(), PxSceneMemoryCategory::eSOLVER), mDynamicsContext(context) 
 	{
 	}
 
@@ -753,7 +756,7 @@ public:
 
 	SolverArticulationUpdateTask(ThreadContext& islandThreadContext, Articulation** articulations, ArticulationSolverDesc* articulationDescArray, PxU32 nbToProcess, Dy::DynamicsContext& context,
 		PxU32 startIdx):
-		Cm::Task(context.getContextId()), mIslandThreadContext(islandThreadContext), mArticulations(articulations), mArticulationDescArray(articulationDescArray), mNbToProcess(nbToProcess), mContext(context), mStartIdx(startIdx)
+		Cm::Task(context.getContextId(), PxSceneMemoryCategory::eSOLVER), mIslandThreadContext(islandThreadContext), mArticulations(articulations), mArticulationDescArray(articulationDescArray), mNbToProcess(nbToProcess), mContext(context), mStartIdx(startIdx)
 	{
 	}
 
@@ -832,7 +835,7 @@ public:
 		PxsContactManagerOutputIterator& iterator,
 		bool enhancedDeterminism
 		) :
-		Cm::Task				(context.getContextId()),
+		Cm::Task				(context.getContextId(), PxSceneMemoryCategory::eSOLVER),
 		mContext				(context), 
 		mIslandContext			(islandContext),
 		mObjects				(objects),
@@ -895,35 +898,102 @@ public:
 			const IG::IslandSim& islandSim = mIslandManager.getAccurateIslandSim();
 
 			PxU32 bodyIndex = 0, articIndex = 0;
-			for (PxU32 i = 0; i < nbIslands; ++i)
+			if (mEnhancedDeterminism)
 			{
-				const IG::Island& island = islandSim.getIsland(islandIds[i]);
+				for (PxU32 i = 0; i < nbIslands; ++i)
+				{
+					const IG::Island& island = islandSim.getIsland(islandIds[i]);
+
+					IG::NodeIndex currentIndex = island.mRootNode;
+
+					while (currentIndex.isValid())
+					{
+						const IG::Node& node = islandSim.getNode(currentIndex);
+
+						if (node.getNodeType() == IG::Node::eARTICULATION_TYPE)
+						{
+							articulationPtr[articIndex++] = node.getArticulation();
+						}
+						else
+						{
+							PX_ASSERT(bodyIndex < (mIslandContext.mCounts.bodies + mContext.mKinematicCount + 1));
+							nodeIndexArray[bodyIndex++] = currentIndex.index();
+						}
 
-				IG::NodeIndex currentIndex = island.mRootNode;
+						currentIndex = node.mNextNode;
+					}
+				}
 
-				while (currentIndex.isValid())
+				//Bodies can come in a slightly jumbled order from islandGen. It's deterministic if the scene is 
+				//identical but can vary if there are additional bodies in the scene in a different island.
+				Ps::sort(nodeIndexArray, bodyIndex);
+			}
+			else
+			{
+				//The island's node list loses its connectivity order as islands merge and split, so bodies that share constraints
+				//can end up far apart in the solver body pool. Order the bodies breadth-first along their edges instead, so that 
+				//the solver, which reaches the bodies through the constraints, touches neighbouring memory.
+				//nodeIndexArray doubles as the traversal queue and bodyRemapTable as the visited marker.
+				for (PxU32 i = 0; i < nbIslands; ++i)
 				{
-					const IG::Node& node = islandSim.getNode(currentIndex);
+					const IG::Island& island = islandSim.getIsland(islandIds[i]);
 
-					if (node.getNodeType() == IG::Node::eARTICULATION_TYPE)
+					IG::NodeIndex currentIndex = island.mRootNode;
+
+					while (currentIndex.isValid())
 					{
-						articulationPtr[articIndex++] = node.getArticulation();
+						const IG::Node& node = islandSim.getNode(currentIndex);
+
+						if (node.getNodeType() == IG::Node::eARTICULATION_TYPE)
+							articulationPtr[articIndex++] = node.getArticulation();
+						else
+							bodyRemapTable[islandSim.getActiveNodeIndex(currentIndex)] = IG_INVALID_NODE;
+
+						currentIndex = node.mNextNode;
 					}
-					else
+
+					currentIndex = island.mRootNode;
+
+					while (currentIndex.isValid())
 					{
-						PX_ASSERT(bodyIndex < (mIslandContext.mCounts.bodies + mContext.mKinematicCount + 1));
-						nodeIndexArray[bodyIndex++] = currentIndex.index();
-					}
+						const IG::Node& node = islandSim.getNode(currentIndex);
 
-					currentIndex = node.mNextNode;
-				}
-			}
+						if (node.getNodeType() != IG::Node::eARTICULATION_TYPE && bodyRemapTable[islandSim.getActiveNodeIndex(currentIndex)] == IG_INVALID_NODE)
+						{
+							PxU32 queueIndex = bodyIndex;
+							bodyRemapTable[islandSim.getActiveNodeIndex(currentIndex)] = bodyIndex;
+							nodeIndexArray[bodyIndex++] = currentIndex.index();
 
-			//Bodies can come in a slightly jumbled order from islandGen. It's deterministic if the scene is 
-			//identical but can vary if there are additional bodies in the scene in a different island.
-			if (mEnhancedDeterminism)
-			{
-				Ps::sort(nodeIndexArray, bodyIndex);
+							while (queueIndex < bodyIndex)
+							{
+								const IG::Node& queuedNode = islandSim.getNode(IG::NodeIndex(nodeIndexArray[queueIndex++]));
+
+								IG::EdgeInstanceIndex instanceIndex = queuedNode.mFirstEdgeIndex;
+								while (instanceIndex != IG_INVALID_EDGE)
+								{
+									const IG::NodeIndex otherIndex = islandSim.getOpposingNodeIndex(instanceIndex);
+									if (otherIndex.isValid())
+									{
+										const IG::Node& otherNode = islandSim.getNode(otherIndex);
+										if (otherNode.getNodeType() == IG::Node::eRIGID_BODY_TYPE && !otherNode.isKinematic() && islandSim.getIslandId(otherIndex) == islandIds[i])
+										{
+											PxU32& remap = bodyRemapTable[islandSim.getActiveNodeIndex(otherIndex)];
+											if (remap == IG_INVALID_NODE)
+											{
+												PX_ASSERT(bodyIndex < (mIslandContext.mCounts.bodies + mContext.mKinematicCount + 1));
+												remap = bodyIndex;
+												nodeIndexArray[bodyIndex++] = otherIndex.index();
+											}
+										}
+									}
+									instanceIndex = islandSim.getEdgeInstance(instanceIndex).mNextEdge;
+								}
+							}
+						}
+
+						currentIndex = node.mNextNode;
+					}
+				}
 			}
 
 			for (PxU32 a = 0; a < bodyIndex; ++a)
@@ -1396,7 +1466,7 @@ public:
 		IslandContext& islandContext,
 		const SolverIslandObjects& objects,				  
 		const PxU32 solverBodyOffset, bool enhancedDeterminism) :
-		Cm::Task(context.getContextId()),
+		Cm::Task(context.getContextId(), PxSceneMemoryCategory::eSOLVER),
 		mContext(context), 
 		mIslandContext(islandContext),
 		mObjects(objects),
@@ -1459,7 +1529,7 @@ public:
 				args.mNumContactConstraintDescriptors = descCount;
 				args.mOrderedContactConstraintDescriptors = mThreadContext.orderedContactConstraints;
 				args.mTempContactConstraintDescriptors = mThreadContext.tempConstraintDescArray;
-				args.mNumDifferentBodyConstraints = args.mNumSelfConstraints = args.mNumSelfConstraintBlocks = 0;
+				args.mNumDifferentBodyConstraints = args.mNumSelfConstraints = args.mNumSelfConstraintBlocks = args.mNumMergedPartitions = 0;
 				args.mConstraintsPerPartition = &mThreadContext.mConstraintsPerPartition;
 				args.mBitField = &mThreadContext.mPartitionNormalizationBitmap;
 				args.enhancedDeterminism = mEnhancedDeterminism;
@@ -1468,6 +1538,8 @@ public:
 				mThreadContext.mNumDifferentBodyConstraints = args.mNumDifferentBodyConstraints;
 				mThreadContext.mNumSelfConstraints = args.mNumSelfConstraints;
 				mThreadContext.mNumSelfConstraintBlocks = args.mNumSelfConstraintBlocks;
+				if(args.mNumMergedPartitions)
+					Ps::atomicAdd(&mContext.getSolverPartitionStats().nbMergedPartitions, PxI32(args.mNumMergedPartitions));
 			}
 			else
 			{
@@ -1488,6 +1560,39 @@ public:
 	bool						mEnhancedDeterminism;
 };
 
+//With PxSolverType::eSUBSTEPPED_JOINTS each position iteration of an island is a substep. Only the patch friction solver implements
+//substepping, and articulations don't support it.
+static PX_FORCE_INLINE PxU32 getNbSolverSubsteps(const DynamicsContext& context, ThreadContext& threadContext)
+{
+	if(context.getSolverType() != PxSolverType::eSUBSTEPPED_JOINTS || context.getFrictionType() != PxFrictionType::ePATCH || threadContext.getArticulations().size())
+		return 1;
+	return PxMax(1u, threadContext.mMaxSolverPositionIterations);
+}
+
+//Joints correct their geometric error over a single substep, clamped by the maximum bias coefficient like the contacts
+static PX_FORCE_INLINE PxReal getJointInvDt(const DynamicsContext& context, const PxU32 nbSubsteps)
+{
+	return PxMin(context.getMaxBiasCoefficient(), context.getInvDt() * PxReal(nbSubsteps));
+}
+
+static void recordSolverIterations(SolverIterationStats& stats, const SolverIslandParams& params)
+{
+	Ps::atomicIncrement(&stats.nbIslands);
+	if(PxU32(params.positionIterationsUsed) < params.positionIterations || PxU32(params.velocityIterationsUsed) < params.velocityIterations)
+		Ps::atomicIncrement(&stats.nbIslandsTerminatedEarly);
+	Ps::atomicAdd(&stats.positionIterations, params.positionIterationsUsed);
+	Ps::atomicAdd(&stats.velocityIterations, params.velocityIterationsUsed);
+	Ps::atomicMax(&stats.maxPositionIterations, params.positionIterationsUsed);
+	Ps::atomicMax(&stats.maxVelocityIterations, params.velocityIterationsUsed);
+}
+
+static void recordSolverPartitions(SolverPartitionStats& stats, const SolverIslandParams& params, const PxU32 nbConstraints)
+{
+	Ps::atomicAdd(&stats.nbPartitions, PxI32(params.nbPartitions));
+	Ps::atomicMax(&stats.maxPartitions, PxI32(params.nbPartitions));
+	Ps::atomicAdd(&stats.nbBatches, PxI32(params.numConstraintHeaders));
+	Ps::atomicAdd(&stats.nbBatchedConstraints, PxI32(nbConstraints));
+}
 
 class PxsSolverSetupSolveTask : public Cm::Task
 {
@@ -1500,7 +1605,7 @@ public:
 		const SolverIslandObjects& objects,				  
 		const PxU32 solverBodyOffset,
 		IG::IslandSim& islandSim) :
-		Cm::Task(context.getContextId()),
+		Cm::Task(context.getContextId(), PxSceneMemoryCategory::eSOLVER),
 		mContext(context), 
 		mIslandContext(islandContext),
 		mObjects(objects),
@@ -1776,6 +1881,25 @@ public:
 				params.thresholdStream = mContext.getThresholdStream().begin();
 				params.thresholdStreamLength = mContext.getThresholdStream().size();
 				params.outThresholdPairs = thresholdPairsOut;
+				params.barrierStats = &mContext.getSolverBarrierStats();
+				params.positionIterationsUsed = 0;
+				params.velocityIterationsUsed = 0;
+				params.nbSubsteps = getNbSolverSubsteps(mContext, mThreadContext);
+				//Between substeps the error moves by the substep duration times the row velocity, and the joints turn an error
+				//into a bias velocity with the (possibly clamped) joint inverse time step
+				params.substepErrorScale = getJointInvDt(mContext, params.nbSubsteps) * mContext.getDt() / PxReal(params.nbSubsteps);
+				params.substepBodyIndex = 0;
+				params.substepBodyIndex2 = 0;
+				//The articulation solve kernels don't report a residual, so islands with articulations always run all iterations.
+				//Substeps advance the simulation time, so they can't be skipped either.
+				params.residualTolerance = (mIslandContext.mCounts.articulations || params.nbSubsteps > 1) ? 0.0f : mContext.getSolverResidualTolerance();
+				params.iterationResiduals = NULL;
+				if(params.residualTolerance > 0.0f)
+				{
+					const PxU32 nbIterations = params.positionIterations + params.velocityIterations;
+					params.iterationResiduals = reinterpret_cast<PxI32*>(mContext.getTaskPool().allocate(sizeof(PxI32) * nbIterations));
+					PxMemZero(params.iterationResiduals, sizeof(PxI32) * nbIterations);
+				}
 				params.motionVelocityArray = mThreadContext.motionVelocityArray;
 				params.bodyArray = mThreadContext.mBodyCoreArray;
 				params.numObjectsIntegrated = 0;
@@ -1791,6 +1915,8 @@ public:
 				params.frictionConstraintIndex = 0;
 				params.frictionConstraintList = frictionDescs;
 
+				recordSolverPartitions(mContext.getSolverPartitionStats(), params, mThreadContext.mNumDifferentBodyConstraints);
+
 				const PxU32 unrollSize = 8;
 				const PxU32 denom = PxMax(1u, (mThreadContext.mMaxPartitions*unrollSize));
 				const PxU32 MaxTasks = getTaskManager()->getCpuDispatcher()->getWorkerCount();
@@ -1827,6 +1953,8 @@ public:
 
 					WAIT_FOR_PROGRESS_NO_TIMER(numObjectsIntegrated, numBodiesPlusArtics);
 
+					recordSolverIterations(mContext.getSolverIterationStats(), params);
+
 				}
 				else
 				{
@@ -1834,6 +1962,8 @@ public:
 					//Only one task - a small island so do a sequential solve (avoid the atomic overheads)
 					solveVBlock(mContext.mSolverCore[mContext.getFrictionType()], params);
 
+					recordSolverIterations(mContext.getSolverIterationStats(), params);
+
 					const PxU32 bodyCountMin1 = mIslandContext.mCounts.bodies - 1u;
 					PxSolverBodyData* solverBodyData2 = solverBodyDatas + mSolverBodyOffset + 1;
 					for(PxU32 k=0; k < mIslandContext.mCounts.bodies; k++)
@@ -1893,7 +2023,7 @@ public:
 		const SolverIslandObjects& objects,				  
 		const PxU32 solverBodyOffset,
 		PxsContactManagerOutputIterator& cmOutputs) :
-		Cm::Task			(context.getContextId()),
+		Cm::Task			(context.getContextId(), PxSceneMemoryCategory::eSOLVER),
 		mContext			(context), 
 		mIslandContext		(islandContext),
 		mObjects			(objects),
@@ -1997,7 +2127,7 @@ public:
 		PxU32 solverDataOffset,
 		PxsContactManagerOutputIterator& outputs,
 		bool enhancedDeterminism) : 
-		Cm::Task				(context.getContextId()),
+		Cm::Task				(context.getContextId(), PxSceneMemoryCategory::eSOLVER),
 		mContext				(context),
 		mIslandContext			(islandContext),
 		mSolverDataOffset		(solverDataOffset),
@@ -2118,6 +2248,9 @@ void DynamicsContext::update(IG::SimpleIslandManager& simpleIslandManager, PxBas
 #endif
 
 	mThresholdStreamOut = 0;
+	mSolverBarrierStats.clear();
+	mSolverIterationStats.clear();
+	mSolverPartitionStats.clear();
 
 	resetThreadContexts();
 
@@ -2349,6 +2482,26 @@ void DynamicsContext::mergeResults()
 		threadStats.clear();
 		threadContext = threadContextIt.getNext();
 	}	
+
+	for(PxU32 a = 0; a < SolverBarrierStats::eMAX_PARTITIONS; ++a)
+	{
+		mSimStats.mSolverPartitionWaitTime[a] = PxU32(mSolverBarrierStats.partitionWaitTime[a]);
+		mSimStats.mSolverFrictionPartitionWaitTime[a] = PxU32(mSolverBarrierStats.frictionPartitionWaitTime[a]);
+	}
+	mSimStats.mSolverVelocitySaveWaitTime = PxU32(mSolverBarrierStats.velocitySaveWaitTime);
+	mSimStats.mNbSolverBarrierWaits = PxU32(mSolverBarrierStats.nbWaits);
+	mSimStats.mNbSolverBarrierYields = PxU32(mSolverBarrierStats.nbYields);
+	mSimStats.mNbSolverIslands = PxU32(mSolverIterationStats.nbIslands);
+	mSimStats.mNbSolverIslandsTerminatedEarly = PxU32(mSolverIterationStats.nbIslandsTerminatedEarly);
+	mSimStats.mSolverPositionIterations = PxU32(mSolverIterationStats.positionIterations);
+	mSimStats.mSolverVelocityIterations = PxU32(mSolverIterationStats.velocityIterations);
+	mSimStats.mMaxSolverPositionIterations = PxU32(mSolverIterationStats.maxPositionIterations);
+	mSimStats.mMaxSolverVelocityIterations = PxU32(mSolverIterationStats.maxVelocityIterations);
+	mSimStats.mNbSolverPartitions = PxU32(mSolverPartitionStats.nbPartitions);
+	mSimStats.mMaxSolverPartitions = PxU32(mSolverPartitionStats.maxPartitions);
+	mSimStats.mNbSolverMergedPartitions = PxU32(mSolverPartitionStats.nbMergedPartitions);
+	mSimStats.mNbSolverConstraintBatches = PxU32(mSolverPartitionStats.nbBatches);
+	mSimStats.mNbSolverBatchedConstraints = PxU32(mSolverPartitionStats.nbBatchedConstraints);
 #endif
 }
 
@@ -2629,6 +2782,10 @@ static PxU32 createFinalizeContacts_Parallel(PxSolverBodyData* solverBodyData, T
 	const PxReal dt = context.getDt();
 	const PxReal invDt = PxMin(context.getMaxBiasCoefficient(), context.getInvDt());
 
+	//Joints correct their geometric error over a single substep. Impulse limits, break thresholds and springs
+	//still use the full time step because the applied impulse accumulates over all substeps.
+	const PxReal jointInvDt = getJointInvDt(context, getNbSolverSubsteps(context, mThreadContext));
+
 	PxSolverConstraintDesc* contactDescPtr = mThreadContext.orderedContactConstraints;
 
 	PxConstraintBatchHeader* headers = mThreadContext.contactConstraintBatchHeaders;
@@ -2800,7 +2957,7 @@ static PxU32 createFinalizeContacts_Parallel(PxSolverBodyData* solverBodyData, T
 			{
 				PxU32 totalRows;
 				state = setupSolverConstraint4
-					(shaderDescs, descs, dt, invDt, totalRows,
+					(shaderDescs, descs, dt, jointInvDt, totalRows,
 					blockAllocator);
 
 				axisConstraintCount += totalRows;
@@ -2810,7 +2967,7 @@ static PxU32 createFinalizeContacts_Parallel(PxSolverBodyData* solverBodyData, T
 			{
 				for(PxU32 i = 0; i < header.mStride; ++i)
 				{
-					axisConstraintCount += SetupSolverConstraint(shaderDescs[i], descs[i], blockAllocator, dt, invDt);
+					axisConstraintCount += SetupSolverConstraint(shaderDescs[i], descs[i], blockAllocator, dt, jointInvDt);
 				}
 			}
 		}
@@ -2828,7 +2985,7 @@ class PxsCreateFinalizeContactsTask : public Cm::Task
 public:
 	PxsCreateFinalizeContactsTask( const PxU32 numConstraints, PxSolverConstraintDesc* descArray, PxSolverBodyData* solverBodyData,
 		ThreadContext& threadContext, DynamicsContext& context, PxU32 startIndex, PxU32 endIndex, PxsContactManagerOutputIterator& outputs) :
-			Cm::Task(context.getContextId()),
+			Cm::Task(context.getContextId(), PxSceneMemoryCategory::eSOLVER),
 			mNumConstraints(numConstraints), mDescArray(descArray), mSolverBodyData(solverBodyData),
 			mThreadContext(threadContext), mDynamicsContext(context),
 			mOutputs(outputs),
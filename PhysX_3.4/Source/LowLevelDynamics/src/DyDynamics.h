@@ -39,6 +39,7 @@
 #include "DyThreadContext.h"
 #include "PxcConstraintBlockStream.h"
 #include "DySolverBody.h"
+#include "DySolverCore.h"
 #include "DyContext.h"
 #include "PxsIslandManagerTypes.h"
 #include "PxvNphaseImplementationContext.h"
@@ -197,6 +198,12 @@ public:
 
 	PX_FORCE_INLINE PxvSimStats&			getSimStats()							{ return mSimStats;			}
 
+	PX_FORCE_INLINE SolverBarrierStats&	getSolverBarrierStats()					{ return mSolverBarrierStats; }
+
+	PX_FORCE_INLINE SolverIterationStats&	getSolverIterationStats()				{ return mSolverIterationStats; }
+
+	PX_FORCE_INLINE SolverPartitionStats&	getSolverPartitionStats()				{ return mSolverPartitionStats; }
+
 #if PX_ENABLE_SIM_STATS
 	void									addThreadStats(const ThreadContext::ThreadSimStats& stats);
 #endif
@@ -443,6 +450,21 @@ protected:
 	*/
 	PxI32						mThresholdStreamOut;
 
+	/**
+	\brief Time the parallel solver threads spent waiting for each other in the current step.
+	*/
+	SolverBarrierStats			mSolverBarrierStats;
+
+	/**
+	\brief Solver iterations used by the islands in the current step.
+	*/
+	SolverIterationStats		mSolverIterationStats;
+
+	/**
+	\brief Constraint partitioning of the islands in the current step.
+	*/
+	SolverPartitionStats		mSolverPartitionStats;
+
 	
 
 	PxsMaterialManager*			mMaterialManager;
@@ -85,7 +85,7 @@ public:
 	PxReal		impulseMultiplier;		//!< constraint impulse multiplier
 
 	PxVec3		ang0Writeback;			//!< unscaled angular velocity projection (body 0)
-	PxU32		pad;
+	PxReal		initVelocity;			//!< constraint velocity of the unconstrained bodies, needed to re-evaluate the error between substeps
 
 	PxReal		minImpulse;				//!< Lower bound on impulse magnitude	 
 	PxReal		maxImpulse;				//!< Upper bound on impulse magnitude
@@ -143,6 +143,13 @@ PX_FORCE_INLINE bool needsNormalVel(const Px1DConstraint &c)
 		|| (c.flags & Px1DConstraintFlag::eSPRING && c.flags & Px1DConstraintFlag::eACCELERATION_SPRING);
 }
 
+//Only hard rows that drive their geometric error to zero re-evaluate it between substeps. Springs, restitution and
+//rows with a velocity target (drives, motors) don't, and their bias must stay as prepared.
+PX_FORCE_INLINE bool tracksGeometricError(const Px1DConstraint &c)
+{
+	return !(c.flags & Px1DConstraintFlag::eSPRING || c.flags & Px1DConstraintFlag::eRESTITUTION) && c.velocityTarget == 0.0f;
+}
+
 PX_FORCE_INLINE void setSolverConstants(PxReal& constant,
 										PxReal& unbiasedConstant,
 										PxReal& velMultiplier,
@@ -83,10 +83,11 @@ public:
 	Vec4V		minImpulse;
 	Vec4V		maxImpulse;
 	Vec4V		appliedForce;
+	Vec4V		initVelocity;
 	PxU32		flags[4];
 };
 
-PX_COMPILE_TIME_ASSERT(sizeof(SolverConstraint1DBase4) == 272);
+PX_COMPILE_TIME_ASSERT(sizeof(SolverConstraint1DBase4) == 288);
 
 struct SolverConstraint1DDynamic4 : public SolverConstraint1DBase4
 {
@@ -97,7 +98,7 @@ struct SolverConstraint1DDynamic4 : public SolverConstraint1DBase4
 	Vec4V		ang1Y;
 	Vec4V		ang1Z;
 };
-PX_COMPILE_TIME_ASSERT(sizeof(SolverConstraint1DDynamic4) == 368);
+PX_COMPILE_TIME_ASSERT(sizeof(SolverConstraint1DDynamic4) == 384);
 
 }
 
@@ -59,7 +59,8 @@ enum SolverConstraintType
 
 enum SolverConstraintFlags
 {
-	DY_SC_FLAG_OUTPUT_FORCE		= (1<<1)
+	DY_SC_FLAG_OUTPUT_FORCE		= (1<<1),
+	DY_SC_FLAG_TRACK_ERROR		= (1<<2)	// the constant term corrects a geometric error, which is re-evaluated between solver substeps
 };
 
 }
@@ -52,7 +52,6 @@ namespace Dy
 //Port of scalar implementation to SIMD maths with some interleaving of instructions
 void solve1D(const PxSolverConstraintDesc& desc, SolverContext& cache)
 {
-	PX_UNUSED(cache);
 	PxSolverBody& b0 = *desc.bodyA;
 	PxSolverBody& b1 = *desc.bodyB;
 
@@ -74,6 +73,7 @@ void solve1D(const PxSolverConstraintDesc& desc, SolverContext& cache)
 	const FloatV invInertiaScale0 = FLoad(header->angularInvMassScale0);
 	const FloatV invInertiaScale1 = FLoad(header->angularInvMassScale1);
 
+	FloatV residual = FLoad(cache.residual);
 
 	for(PxU32 i=0; i<header->count;++i, base++)
 	{
@@ -101,6 +101,7 @@ void solve1D(const PxSolverConstraintDesc& desc, SolverContext& cache)
 		const FloatV unclampedForce = FScaleAdd(iMul, appliedForce, FScaleAdd(vMul, normalVel, constant));
 		const FloatV clampedForce = FMin(maxImpulse, (FMax(minImpulse, unclampedForce)));
 		const FloatV deltaF = FSub(clampedForce, appliedForce);
+		residual = FMax(residual, FAbs(deltaF));
 			
 		FStore(clampedForce, &c.appliedForce);
 		linVel0 = V3ScaleAdd(clinVel0, FMul(deltaF, invMass0), linVel0);			
@@ -111,6 +112,8 @@ void solve1D(const PxSolverConstraintDesc& desc, SolverContext& cache)
 
 	}
 
+	FStore(residual, &cache.residual);
+
 	V3StoreA(linVel0, b0.linearVelocity);
 	V3StoreA(angState0, b0.angularState);
 	V3StoreA(linVel1, b1.linearVelocity);
@@ -122,6 +125,41 @@ void solve1D(const PxSolverConstraintDesc& desc, SolverContext& cache)
 	PX_ASSERT(b1.angularState.isFinite());
 }
 
+//Re-evaluates the geometric error of the rows at the end of a substep. The bodies moved by h*J*v during the substep of
+//duration h, which changes the bias term of a rigid row by velMultiplier*J*v*h*invDt. h*invDt is substepErrorScale.
+void substep1D(const PxSolverConstraintDesc& desc, SolverContext& cache)
+{
+	const PxSolverBody& b0 = *desc.bodyA;
+	const PxSolverBody& b1 = *desc.bodyB;
+
+	PxU8* PX_RESTRICT bPtr = desc.constraint;
+	if (bPtr == NULL)
+		return;
+
+	const SolverConstraint1DHeader* PX_RESTRICT  header = reinterpret_cast<const SolverConstraint1DHeader*>(bPtr);
+	SolverConstraint1D* PX_RESTRICT base = reinterpret_cast<SolverConstraint1D*>(bPtr + sizeof(SolverConstraint1DHeader));
+
+	const Vec3V linVel0 = V3LoadA(b0.linearVelocity);
+	const Vec3V linVel1 = V3LoadA(b1.linearVelocity);
+	const Vec3V angState0 = V3LoadA(b0.angularState);
+	const Vec3V angState1 = V3LoadA(b1.angularState);
+	const FloatV errorScale = FLoad(cache.substepErrorScale);
+
+	for(PxU32 i=0; i<header->count;++i, base++)
+	{
+		SolverConstraint1D& c = *base;
+		if(!(c.flags & DY_SC_FLAG_TRACK_ERROR))
+			continue;
+
+		const Vec3V v0 = V3MulAdd(linVel0, V3LoadA(c.lin0), V3Mul(angState0, V3LoadA(c.ang0)));
+		const Vec3V v1 = V3MulAdd(linVel1, V3LoadA(c.lin1), V3Mul(angState1, V3LoadA(c.ang1)));
+
+		//The solver bodies only hold the velocity change, the initial velocity was folded into the constant by the prep
+		const FloatV constraintVel = FAdd(FLoad(c.initVelocity), V3SumElems(V3Sub(v0, v1)));
+		FStore(FScaleAdd(FMul(FLoad(c.velMultiplier), errorScale), constraintVel, FLoad(c.constant)), &c.constant);
+	}
+}
+
 void conclude1D(const PxSolverConstraintDesc& desc, SolverContext& /*cache*/)
 {
 	SolverConstraint1DHeader* header = reinterpret_cast<SolverConstraint1DHeader*>(desc.constraint);
@@ -153,6 +191,8 @@ void solveContact(const PxSolverConstraintDesc& desc, SolverContext& cache)
 	Vec3V angState0 = V3LoadA(b0.angularState);
 	Vec3V angState1 = V3LoadA(b1.angularState);
 
+	FloatV residual = FLoad(cache.residual);
+
 	const PxU8* PX_RESTRICT last = desc.constraint + getConstraintLength(desc);
 
 	//hopefully pointer aliasing doesn't bite.
@@ -185,7 +225,7 @@ void solveContact(const PxSolverConstraintDesc& desc, SolverContext& cache)
 		const Vec3V contactNormal = hdr->normal;
 
 		const FloatV accumulatedNormalImpulse = solveDynamicContacts(contacts, numNormalConstr, contactNormal, invMassA, invMassB, 
-			angDom0, angDom1, linVel0, angState0, linVel1, angState1, forceBuffer); 
+			angDom0, angDom1, linVel0, angState0, linVel1, angState1, forceBuffer, residual); 
 
 		if(cache.doFriction && numFrictionConstr)
 		{
@@ -255,6 +295,7 @@ void solveContact(const PxSolverConstraintDesc& desc, SolverContext& cache)
 				broken = BOr(broken, clamp);
 
 				FloatV deltaF = FSub(newAppliedForce, appliedForce);
+				residual = FMax(residual, FAbs(deltaF));
 
 				// we could get rid of the stall here by calculating and clamping delta separately, but
 				// the complexity isn't really worth it.
@@ -278,6 +319,8 @@ void solveContact(const PxSolverConstraintDesc& desc, SolverContext& cache)
 	PX_ASSERT(b1.linearVelocity.isFinite());
 	PX_ASSERT(b1.angularState.isFinite());
 
+	FStore(residual, &cache.residual);
+
 	// Write back
 	V3StoreU(linVel0, b0.linearVelocity);
 	V3StoreU(linVel1, b1.linearVelocity);
@@ -300,6 +343,8 @@ void solveContact_BStatic(const PxSolverConstraintDesc& desc, SolverContext& cac
 	Vec3V linVel0 = V3LoadA(b0.linearVelocity);
 	Vec3V angState0 = V3LoadA(b0.angularState);
 
+	FloatV residual = FLoad(cache.residual);
+
 	const PxU8* PX_RESTRICT last = desc.constraint + getConstraintLength(desc);
 
 	//hopefully pointer aliasing doesn't bite.
@@ -332,7 +377,7 @@ void solveContact_BStatic(const PxSolverConstraintDesc& desc, SolverContext& cac
 
 
 		const FloatV accumulatedNormalImpulse = solveStaticContacts(contacts, numNormalConstr, contactNormal,
-			invMassA, angDom0, linVel0, angState0, forceBuffer);
+			invMassA, angDom0, linVel0, angState0, forceBuffer, residual);
 
 		if(cache.doFriction && numFrictionConstr)
 		{
@@ -397,6 +442,7 @@ void solveContact_BStatic(const PxSolverConstraintDesc& desc, SolverContext& cac
 				const FloatV newAppliedForce = FSel(clamp, totalClamped,totalImpulse);
 
 				FloatV deltaF = FSub(newAppliedForce, appliedForce);
+				residual = FMax(residual, FAbs(deltaF));
 
 				// we could get rid of the stall here by calculating and clamping delta separately, but
 				// the complexity isn't really worth it.
@@ -415,6 +461,8 @@ void solveContact_BStatic(const PxSolverConstraintDesc& desc, SolverContext& cac
 	PX_ASSERT(b0.linearVelocity.isFinite());
 	PX_ASSERT(b0.angularState.isFinite());
 
+	FStore(residual, &cache.residual);
+
 	// Write back
 	V3StoreA(linVel0, b0.linearVelocity);
 	V3StoreA(angState0, b0.angularState);
@@ -603,6 +651,12 @@ void solve1DConcludeBlock (const PxSolverConstraintDesc* PX_RESTRICT desc, const
 	conclude1D(desc[constraintCount-1], cache);
 }
 
+void substep1DBlock (const PxSolverConstraintDesc* PX_RESTRICT desc, const PxU32 constraintCount, SolverContext& cache)
+{
+	for(PxU32 a = 0; a < constraintCount; ++a)
+		substep1D(desc[a], cache);
+}
+
 void solve1DBlockWriteBack (const PxSolverConstraintDesc* PX_RESTRICT desc, const PxU32 constraintCount, SolverContext& cache)
 {
 	for(PxU32 a = 1; a < constraintCount; ++a)
@@ -51,6 +51,16 @@ namespace physx
 namespace Dy
 {
 
+// defined in DySolverConstraintsBlockAVX.cpp
+bool solveContact4x2_Block(const PxSolverConstraintDesc* PX_RESTRICT descA, const PxSolverConstraintDesc* PX_RESTRICT descB, SolverContext& cache);
+bool solveContact4x2_StaticBlock(const PxSolverConstraintDesc* PX_RESTRICT descA, const PxSolverConstraintDesc* PX_RESTRICT descB, SolverContext& cache);
+
+//Folds the largest impulse change of a batch into the residual of the calling thread
+static PX_FORCE_INLINE void storeResidual(const Vec4V residual, SolverContext& cache)
+{
+	FStore(FMax(FLoad(cache.residual), V4ExtractMax(residual)), &cache.residual);
+}
+
 static void solveContact4_Block(const PxSolverConstraintDesc* PX_RESTRICT desc, SolverContext& cache)
 {
 	PxSolverBody& b00 = *desc[0].bodyA;
@@ -64,6 +74,8 @@ static void solveContact4_Block(const PxSolverConstraintDesc* PX_RESTRICT desc,
 
 	//We'll need this.
 	const Vec4V vZero	= V4Zero();	
+
+	Vec4V residual = vZero;
 	
 	Vec4V linVel00 = V4LoadA(&b00.linearVelocity.x);
 	Vec4V linVel01 = V4LoadA(&b01.linearVelocity.x);
@@ -194,6 +206,7 @@ static void solveContact4_Block(const PxSolverConstraintDesc* PX_RESTRICT desc,
 			deltaF = V4Max(deltaF,  V4Neg(appliedForce));
 			const Vec4V newAppliedForce = V4Min(V4Add(appliedForce, deltaF), maxImpulse);
 			deltaF = V4Sub(newAppliedForce, appliedForce);
+			residual = V4Max(residual, V4Abs(deltaF));
 
 			accumDeltaF = V4Add(accumDeltaF, deltaF);
 
@@ -294,6 +307,7 @@ static void solveContact4_Block(const PxSolverConstraintDesc* PX_RESTRICT desc,
 				const Vec4V newAppliedForce = V4Sel(broken, V4Min(maxDynFrictionImpulse, V4Max(negMaxDynFrictionImpulse, totalImpulse)), totalImpulse);
 
 				const Vec4V deltaF =V4Sub(newAppliedForce, appliedForce);
+				residual = V4Max(residual, V4Abs(deltaF));
 
 				frictionAppliedForce[i] = newAppliedForce;
 
@@ -327,6 +341,8 @@ static void solveContact4_Block(const PxSolverConstraintDesc* PX_RESTRICT desc,
 	PX_TRANSPOSE_44(angState0T0, angState0T1, angState0T2, angState0T3, angState00, angState10, angState20, angState30);
 	PX_TRANSPOSE_44(angState1T0, angState1T1, angState1T2, angState1T3, angState01, angState11, angState21, angState31);
 
+	storeResidual(residual, cache);
+
 	PX_ASSERT(b00.linearVelocity.isFinite());
 	PX_ASSERT(b00.angularState.isFinite());
 	PX_ASSERT(b10.linearVelocity.isFinite());
@@ -410,6 +426,8 @@ static void solveContact4_StaticBlock(const PxSolverConstraintDesc* PX_RESTRICT
 
 	//We'll need this.
 	const Vec4V vZero	= V4Zero();
+
+	Vec4V residual = vZero;
 	
 	Vec4V linVel00 = V4LoadA(&b00.linearVelocity.x);
 	Vec4V angState00 = V4LoadA(&b00.angularState.x);
@@ -501,6 +519,7 @@ static void solveContact4_StaticBlock(const PxSolverConstraintDesc* PX_RESTRICT
 			Vec4V newAppliedForce(V4Add(appliedForce, _deltaF));
 			newAppliedForce = V4Min(newAppliedForce, maxImpulse);
 			const Vec4V deltaF = V4Sub(newAppliedForce, appliedForce);
+			residual = V4Max(residual, V4Abs(deltaF));
 			const Vec4V angDeltaF = V4Mul(angD0, deltaF);
 
 			accumDeltaF = V4Add(accumDeltaF, deltaF);
@@ -581,6 +600,7 @@ static void solveContact4_StaticBlock(const PxSolverConstraintDesc* PX_RESTRICT
 				const Vec4V newAppliedForce = V4Sel(broken, V4Min(maxDynFrictionImpulse, V4Max(negMaxDynFrictionImpulse, totalImpulse)), totalImpulse);
 
 				const Vec4V deltaF =V4Sub(newAppliedForce, appliedForce);
+				residual = V4Max(residual, V4Abs(deltaF));
 
 				const Vec4V deltaFInvMass = V4Mul(invMass0, deltaF);
 				const Vec4V angDeltaF = V4Mul(angD0, deltaF);
@@ -607,6 +627,8 @@ static void solveContact4_StaticBlock(const PxSolverConstraintDesc* PX_RESTRICT
 	PX_TRANSPOSE_44(linVel0T0, linVel0T1, linVel0T2, linVel0T3, linVel00, linVel10, linVel20, linVel30);
 	PX_TRANSPOSE_44(angState0T0, angState0T1, angState0T2, angState0T3, angState00, angState10, angState20, angState30);
 
+	storeResidual(residual, cache);
+
 	PX_ASSERT(b00.linearVelocity.isFinite());
 	PX_ASSERT(b00.angularState.isFinite());
 	PX_ASSERT(b10.linearVelocity.isFinite());
@@ -798,7 +820,7 @@ void writeBackContact4_Block(const PxSolverConstraintDesc* PX_RESTRICT desc, Sol
 	}
 }
 
-static void solve1D4_Block(const PxSolverConstraintDesc* PX_RESTRICT desc, SolverContext& /*cache*/)
+static void solve1D4_Block(const PxSolverConstraintDesc* PX_RESTRICT desc, SolverContext& cache)
 {
 
 	PxSolverBody& b00 = *desc[0].bodyA;
@@ -820,6 +842,8 @@ static void solve1D4_Block(const PxSolverConstraintDesc* PX_RESTRICT desc, Solve
 	SolverConstraint1DDynamic4* PX_RESTRICT base = reinterpret_cast<SolverConstraint1DDynamic4*>(header+1);
 
 	//const FloatV fZero = FZero();
+	Vec4V residual = V4Zero();
+
 	Vec4V linVel00 = V4LoadA(&b00.linearVelocity.x);
 	Vec4V linVel01 = V4LoadA(&b01.linearVelocity.x);
 	Vec4V angState00 = V4LoadA(&b00.angularState.x);
@@ -896,6 +920,7 @@ static void solve1D4_Block(const PxSolverConstraintDesc* PX_RESTRICT desc, Solve
 		const Vec4V unclampedForce = V4MulAdd(appliedForce, c.impulseMultiplier, V4MulAdd(normalVel, c.velMultiplier, c.constant));
 		const Vec4V clampedForce = V4Max(c.minImpulse, V4Min(c.maxImpulse, unclampedForce));
 		const Vec4V deltaF = V4Sub(clampedForce, appliedForce);
+		residual = V4Max(residual, V4Abs(deltaF));
 		c.appliedForce = clampedForce;
 
 		const Vec4V deltaFInvMass0 = V4Mul(deltaF, invMass0D0);
@@ -920,6 +945,8 @@ static void solve1D4_Block(const PxSolverConstraintDesc* PX_RESTRICT desc, Solve
 		angState1T2 = V4NegMulSub(c.ang1Z, angDeltaFInvMass1, angState1T2);
 	}
 
+	storeResidual(residual, cache);
+
 	PX_TRANSPOSE_44(linVel0T0, linVel0T1, linVel0T2, linVel0T3, linVel00, linVel10, linVel20, linVel30);
 	PX_TRANSPOSE_44(linVel1T0, linVel1T1, linVel1T2, linVel1T3, linVel01, linVel11, linVel21, linVel31);
 	PX_TRANSPOSE_44(angState0T0, angState0T1, angState0T2, angState0T3, angState00, angState10, angState20, angState30);
@@ -964,6 +991,87 @@ static void conclude1D4_Block(const PxSolverConstraintDesc* PX_RESTRICT desc, So
 	PX_ASSERT(desc[0].constraint + getConstraintLength(desc[0]) == base);
 }
 
+//4-wide version of substep1D: re-evaluates the geometric error of the rows at the end of a substep
+static void substep1D4_Block(const PxSolverConstraintDesc* PX_RESTRICT desc, SolverContext& cache)
+{
+	const PxSolverBody& b00 = *desc[0].bodyA;
+	const PxSolverBody& b01 = *desc[0].bodyB;
+	const PxSolverBody& b10 = *desc[1].bodyA;
+	const PxSolverBody& b11 = *desc[1].bodyB;
+	const PxSolverBody& b20 = *desc[2].bodyA;
+	const PxSolverBody& b21 = *desc[2].bodyB;
+	const PxSolverBody& b30 = *desc[3].bodyA;
+	const PxSolverBody& b31 = *desc[3].bodyB;
+
+	SolverConstraint1DHeader4* PX_RESTRICT header = reinterpret_cast<SolverConstraint1DHeader4*>(desc[0].constraint);
+	SolverConstraint1DDynamic4* PX_RESTRICT base = reinterpret_cast<SolverConstraint1DDynamic4*>(header+1);
+
+	Vec4V linVel00 = V4LoadA(&b00.linearVelocity.x);
+	Vec4V linVel01 = V4LoadA(&b01.linearVelocity.x);
+	Vec4V angState00 = V4LoadA(&b00.angularState.x);
+	Vec4V angState01 = V4LoadA(&b01.angularState.x);
+
+	Vec4V linVel10 = V4LoadA(&b10.linearVelocity.x);
+	Vec4V linVel11 = V4LoadA(&b11.linearVelocity.x);
+	Vec4V angState10 = V4LoadA(&b10.angularState.x);
+	Vec4V angState11 = V4LoadA(&b11.angularState.x);
+
+	Vec4V linVel20 = V4LoadA(&b20.linearVelocity.x);
+	Vec4V linVel21 = V4LoadA(&b21.linearVelocity.x);
+	Vec4V angState20 = V4LoadA(&b20.angularState.x);
+	Vec4V angState21 = V4LoadA(&b21.angularState.x);
+
+	Vec4V linVel30 = V4LoadA(&b30.linearVelocity.x);
+	Vec4V linVel31 = V4LoadA(&b31.linearVelocity.x);
+	Vec4V angState30 = V4LoadA(&b30.angularState.x);
+	Vec4V angState31 = V4LoadA(&b31.angularState.x);
+
+	Vec4V linVel0T0, linVel0T1, linVel0T2;
+	Vec4V linVel1T0, linVel1T1, linVel1T2;
+	Vec4V angState0T0, angState0T1, angState0T2;
+	Vec4V angState1T0, angState1T1, angState1T2;
+
+	PX_TRANSPOSE_44_34(linVel00, linVel10, linVel20, linVel30, linVel0T0, linVel0T1, linVel0T2);
+	PX_TRANSPOSE_44_34(linVel01, linVel11, linVel21, linVel31, linVel1T0, linVel1T1, linVel1T2);
+	PX_TRANSPOSE_44_34(angState00, angState10, angState20, angState30, angState0T0, angState0T1, angState0T2);
+	PX_TRANSPOSE_44_34(angState01, angState11, angState21, angState31, angState1T0, angState1T1, angState1T2);
+
+	for(PxU32 a = 0; a < header->count; ++a, base++)
+	{
+		SolverConstraint1DDynamic4& c = *base;
+
+		const PxU32 trackError0 = c.flags[0] & DY_SC_FLAG_TRACK_ERROR;
+		const PxU32 trackError1 = c.flags[1] & DY_SC_FLAG_TRACK_ERROR;
+		const PxU32 trackError2 = c.flags[2] & DY_SC_FLAG_TRACK_ERROR;
+		const PxU32 trackError3 = c.flags[3] & DY_SC_FLAG_TRACK_ERROR;
+		if(!(trackError0 | trackError1 | trackError2 | trackError3))
+			continue;
+
+		Vec4V linProj0(V4Mul(c.lin0X, linVel0T0));
+		Vec4V linProj1(V4Mul(c.lin1X, linVel1T0));
+		Vec4V angProj0(V4Mul(c.ang0X, angState0T0));
+		Vec4V angProj1(V4Mul(c.ang1X, angState1T0));
+
+		linProj0 = V4MulAdd(c.lin0Y, linVel0T1, linProj0);
+		linProj1 = V4MulAdd(c.lin1Y, linVel1T1, linProj1);
+		angProj0 = V4MulAdd(c.ang0Y, angState0T1, angProj0);
+		angProj1 = V4MulAdd(c.ang1Y, angState1T1, angProj1);
+		
+		linProj0 = V4MulAdd(c.lin0Z, linVel0T2, linProj0);
+		linProj1 = V4MulAdd(c.lin1Z, linVel1T2, linProj1);
+		angProj0 = V4MulAdd(c.ang0Z, angState0T2, angProj0);
+		angProj1 = V4MulAdd(c.ang1Z, angState1T2, angProj1);
+
+		const Vec4V normalVel = V4Sub(V4Add(linProj0, angProj0), V4Add(linProj1, angProj1));
+		const Vec4V constraintVel = V4Add(c.initVelocity, normalVel);
+		const PxReal errorScale = cache.substepErrorScale;
+		const Vec4V scale = V4LoadXYZW(trackError0 ? errorScale : 0.0f, trackError1 ? errorScale : 0.0f, trackError2 ? errorScale : 0.0f, 
+			trackError3 ? errorScale : 0.0f);
+
+		c.constant = V4MulAdd(V4Mul(c.velMultiplier, scale), constraintVel, c.constant);
+	}
+}
+
 void writeBack1D4(const PxSolverConstraintDesc* PX_RESTRICT desc, SolverContext& /*cache*/,
 							 const PxSolverBodyData** PX_RESTRICT /*bd0*/, const PxSolverBodyData** PX_RESTRICT /*bd1*/)
 {
@@ -1082,10 +1190,8 @@ void solveContactPreBlock_ConcludeStatic(const PxSolverConstraintDesc* PX_RESTRI
 	concludeContact4_Block(desc, cache, sizeof(SolverContactBatchPointBase4), sizeof(SolverContactFrictionBase4));
 }
 
-void solveContactPreBlock_WriteBack(const PxSolverConstraintDesc* PX_RESTRICT desc, const PxU32  /*constraintCount*/, SolverContext& cache)
+static void contactPreBlock_WriteBackAndFlush(const PxSolverConstraintDesc* PX_RESTRICT desc, SolverContext& cache)
 {
-	solveContact4_Block(desc, cache);
-
 	const PxSolverBodyData* bd0[4] = {	&cache.solverBodyArray[desc[0].bodyADataIndex], 
 										&cache.solverBodyArray[desc[1].bodyADataIndex],
 										&cache.solverBodyArray[desc[2].bodyADataIndex],
@@ -1110,33 +1216,77 @@ void solveContactPreBlock_WriteBack(const PxSolverConstraintDesc* PX_RESTRICT de
 	}
 }
 
+void solveContactPreBlock_WriteBack(const PxSolverConstraintDesc* PX_RESTRICT desc, const PxU32  /*constraintCount*/, SolverContext& cache)
+{
+	solveContact4_Block(desc, cache);
+	contactPreBlock_WriteBackAndFlush(desc, cache);
+}
+
 void solveContactPreBlock_WriteBackStatic(const PxSolverConstraintDesc* PX_RESTRICT desc, const PxU32  /*constraintCount*/, SolverContext& cache)
 {
 	solveContact4_StaticBlock(desc, cache);
-	const PxSolverBodyData* bd0[4] = {	&cache.solverBodyArray[desc[0].bodyADataIndex], 
-										&cache.solverBodyArray[desc[1].bodyADataIndex],
-										&cache.solverBodyArray[desc[2].bodyADataIndex],
-										&cache.solverBodyArray[desc[3].bodyADataIndex]};
+	contactPreBlock_WriteBackAndFlush(desc, cache);
+}
 
-	const PxSolverBodyData* bd1[4] = {	&cache.solverBodyArray[desc[0].bodyBDataIndex], 
-										&cache.solverBodyArray[desc[1].bodyBDataIndex],
-										&cache.solverBodyArray[desc[2].bodyBDataIndex],
-										&cache.solverBodyArray[desc[3].bodyBDataIndex]};
+//Pairs of 4-wide contact batches from the same partition. These use the AVX kernels when both batches have the same
+//row layout and fall back to solving the batches one after the other otherwise.
 
-	writeBackContact4_Block(desc, cache, bd0, bd1);
+static PX_FORCE_INLINE void solveContactPreBlockPairInternal(const PxSolverConstraintDesc* PX_RESTRICT descA, const PxSolverConstraintDesc* PX_RESTRICT descB, SolverContext& cache)
+{
+	if(!solveContact4x2_Block(descA, descB, cache))
+	{
+		solveContact4_Block(descA, cache);
+		solveContact4_Block(descB, cache);
+	}
+}
 
-	if(cache.mThresholdStreamIndex > (cache.mThresholdStreamLength - 4))
+static PX_FORCE_INLINE void solveContactPreBlockPairInternal_Static(const PxSolverConstraintDesc* PX_RESTRICT descA, const PxSolverConstraintDesc* PX_RESTRICT descB, SolverContext& cache)
+{
+	if(!solveContact4x2_StaticBlock(descA, descB, cache))
 	{
-		//Write back to global buffer
-		PxI32 threshIndex = physx::shdfnd::atomicAdd(cache.mSharedOutThresholdPairs, PxI32(cache.mThresholdStreamIndex)) - PxI32(cache.mThresholdStreamIndex);
-		for(PxU32 a = 0; a < cache.mThresholdStreamIndex; ++a)
-		{
-			cache.mSharedThresholdStream[a + threshIndex] = cache.mThresholdStream[a];
-		}
-		cache.mThresholdStreamIndex = 0;
+		solveContact4_StaticBlock(descA, cache);
+		solveContact4_StaticBlock(descB, cache);
 	}
 }
 
+void solveContactPreBlockPair(const PxSolverConstraintDesc* PX_RESTRICT descA, const PxSolverConstraintDesc* PX_RESTRICT descB, SolverContext& cache)
+{
+	solveContactPreBlockPairInternal(descA, descB, cache);
+}
+
+void solveContactPreBlockPair_Static(const PxSolverConstraintDesc* PX_RESTRICT descA, const PxSolverConstraintDesc* PX_RESTRICT descB, SolverContext& cache)
+{
+	solveContactPreBlockPairInternal_Static(descA, descB, cache);
+}
+
+void solveContactPreBlockPair_Conclude(const PxSolverConstraintDesc* PX_RESTRICT descA, const PxSolverConstraintDesc* PX_RESTRICT descB, SolverContext& cache)
+{
+	solveContactPreBlockPairInternal(descA, descB, cache);
+	concludeContact4_Block(descA, cache, sizeof(SolverContactBatchPointDynamic4), sizeof(SolverContactFrictionDynamic4));
+	concludeContact4_Block(descB, cache, sizeof(SolverContactBatchPointDynamic4), sizeof(SolverContactFrictionDynamic4));
+}
+
+void solveContactPreBlockPair_ConcludeStatic(const PxSolverConstraintDesc* PX_RESTRICT descA, const PxSolverConstraintDesc* PX_RESTRICT descB, SolverContext& cache)
+{
+	solveContactPreBlockPairInternal_Static(descA, descB, cache);
+	concludeContact4_Block(descA, cache, sizeof(SolverContactBatchPointBase4), sizeof(SolverContactFrictionBase4));
+	concludeContact4_Block(descB, cache, sizeof(SolverContactBatchPointBase4), sizeof(SolverContactFrictionBase4));
+}
+
+void solveContactPreBlockPair_WriteBack(const PxSolverConstraintDesc* PX_RESTRICT descA, const PxSolverConstraintDesc* PX_RESTRICT descB, SolverContext& cache)
+{
+	solveContactPreBlockPairInternal(descA, descB, cache);
+	contactPreBlock_WriteBackAndFlush(descA, cache);
+	contactPreBlock_WriteBackAndFlush(descB, cache);
+}
+
+void solveContactPreBlockPair_WriteBackStatic(const PxSolverConstraintDesc* PX_RESTRICT descA, const PxSolverConstraintDesc* PX_RESTRICT descB, SolverContext& cache)
+{
+	solveContactPreBlockPairInternal_Static(descA, descB, cache);
+	contactPreBlock_WriteBackAndFlush(descA, cache);
+	contactPreBlock_WriteBackAndFlush(descB, cache);
+}
+
 void solve1D4_Block(const PxSolverConstraintDesc* PX_RESTRICT desc, const PxU32  /*constraintCount*/, SolverContext& cache)
 {
 	solve1D4_Block(desc, cache);
@@ -1150,6 +1300,11 @@ void solve1D4Block_Conclude(const PxSolverConstraintDesc* PX_RESTRICT desc, cons
 }
 
 
+void substep1D4Block(const PxSolverConstraintDesc* PX_RESTRICT desc, const PxU32  /*constraintCount*/, SolverContext& cache)
+{
+	substep1D4_Block(desc, cache);
+}
+
 void solve1D4Block_WriteBack(const PxSolverConstraintDesc* PX_RESTRICT desc, const PxU32  /*constraintCount*/, SolverContext& cache)
 {
 	solve1D4_Block(desc, cache);
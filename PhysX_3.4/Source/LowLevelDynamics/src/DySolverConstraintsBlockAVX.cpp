@@ -0,0 +1,776 @@
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Copyright (c) 2008-2018 NVIDIA Corporation. All rights reserved.
+// Copyright (c) 2004-2008 AGEIA Technologies, Inc. All rights reserved.
+// Copyright (c) 2001-2004 NovodeX AG. All rights reserved.  
+
+
+#include "foundation/PxPreprocessor.h"
+#include "PsVecMath.h"
+
+#include "CmPhysXCommon.h"
+#include "DySolverBody.h"
+#include "DySolverContact4.h"
+#include "DySolverConstraintDesc.h"
+#include "DySolverContext.h"
+#include "DySolverConstraintTypes.h"
+
+// The AVX path solves two independent 4-wide contact batches in one pass, using the low and high halves of each 
+// 256-bit register. It keeps the existing 4-wide constraint layout so prep, conclude and writeback are shared with
+// the SSE path. Only mul/add/sub/min/max are used (no FMA) so the results are bit-identical to the 4-wide solver.
+// Define DY_AVX_SOLVER to 0 to build without it, e.g. to compare against the 4-wide solver.
+#ifndef DY_AVX_SOLVER
+#define DY_AVX_SOLVER ((PX_X86 || PX_X64) && ((PX_WINDOWS_FAMILY && PX_VC >= 11) || (PX_GCC_FAMILY && (PX_LINUX || PX_OSX))))
+#endif
+
+#if DY_AVX_SOLVER
+#if PX_GCC_FAMILY
+#include <cpuid.h>
+#define DY_AVX_FUNC __attribute__((target("avx")))
+#else
+#include <intrin.h>
+#define DY_AVX_FUNC
+#endif
+#include <immintrin.h>
+#endif
+
+namespace physx
+{
+
+namespace Dy
+{
+
+#if DY_AVX_SOLVER
+
+namespace
+{
+
+bool getAvxSupport()
+{
+	// Checking for AVX requires 3 things:
+	// 1) CPUID indicates that the OS uses XSAVE and XRSTORE
+	// 2) CPUID indicates support for AVX
+	// 3) XGETBV indicates registers are saved and restored on context switch
+#if PX_GCC_FAMILY
+	unsigned int eax, ebx, ecx, edx;
+	if(!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+		return false;
+	const unsigned int avxFlags = 3u << 27;
+	if((ecx & avxFlags) != avxFlags)
+		return false;
+	unsigned int xcr0Lo, xcr0Hi;
+	__asm__ __volatile__("xgetbv" : "=a"(xcr0Lo), "=d"(xcr0Hi) : "c"(0));
+	return (xcr0Lo & 0x6) == 0x6;
+#else
+	int cpuInfo[4];
+	__cpuid(cpuInfo, 1);
+	const int avxFlags = 3 << 27;
+	if((cpuInfo[2] & avxFlags) != avxFlags)
+		return false;
+	return (_xgetbv(0) & 0x6) == 0x6;
+#endif
+}
+
+const bool sAvxSupport = getAvxSupport();
+
+typedef __m256 Vec8V;
+typedef __m256 BoolV8;
+
+PX_FORCE_INLINE DY_AVX_FUNC Vec8V V8Load2(const Vec4V lo, const Vec4V hi)	{ return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1); }
+PX_FORCE_INLINE DY_AVX_FUNC void V8Store2(const Vec8V v, Vec4V& lo, Vec4V& hi)	{ lo = _mm256_castps256_ps128(v); hi = _mm256_extractf128_ps(v, 1); }
+PX_FORCE_INLINE DY_AVX_FUNC Vec8V V8Zero()									{ return _mm256_setzero_ps(); }
+PX_FORCE_INLINE DY_AVX_FUNC Vec8V V8Add(const Vec8V a, const Vec8V b)		{ return _mm256_add_ps(a, b); }
+PX_FORCE_INLINE DY_AVX_FUNC Vec8V V8Sub(const Vec8V a, const Vec8V b)		{ return _mm256_sub_ps(a, b); }
+PX_FORCE_INLINE DY_AVX_FUNC Vec8V V8Mul(const Vec8V a, const Vec8V b)		{ return _mm256_mul_ps(a, b); }
+PX_FORCE_INLINE DY_AVX_FUNC Vec8V V8Max(const Vec8V a, const Vec8V b)		{ return _mm256_max_ps(a, b); }
+PX_FORCE_INLINE DY_AVX_FUNC Vec8V V8Min(const Vec8V a, const Vec8V b)		{ return _mm256_min_ps(a, b); }
+PX_FORCE_INLINE DY_AVX_FUNC Vec8V V8Neg(const Vec8V a)						{ return _mm256_sub_ps(_mm256_setzero_ps(), a); }
+PX_FORCE_INLINE DY_AVX_FUNC Vec8V V8Abs(const Vec8V a)						{ return V8Max(a, V8Neg(a)); }
+PX_FORCE_INLINE DY_AVX_FUNC Vec8V V8MulAdd(const Vec8V a, const Vec8V b, const Vec8V c)		{ return V8Add(V8Mul(a, b), c); }
+PX_FORCE_INLINE DY_AVX_FUNC Vec8V V8NegMulSub(const Vec8V a, const Vec8V b, const Vec8V c)	{ return V8Sub(c, V8Mul(a, b)); }
+PX_FORCE_INLINE DY_AVX_FUNC BoolV8 V8IsGrtr(const Vec8V a, const Vec8V b)	{ return _mm256_cmp_ps(a, b, _CMP_GT_OS); }
+PX_FORCE_INLINE DY_AVX_FUNC BoolV8 B8Or(const BoolV8 a, const BoolV8 b)		{ return _mm256_or_ps(a, b); }
+PX_FORCE_INLINE DY_AVX_FUNC Vec8V V8Sel(const BoolV8 c, const Vec8V a, const Vec8V b)	{ return _mm256_or_ps(_mm256_andnot_ps(c, b), _mm256_and_ps(c, a)); }
+
+//Folds the largest impulse change of both batches into the residual of the calling thread
+PX_FORCE_INLINE DY_AVX_FUNC void storeResidual(const Vec8V residual, SolverContext& cache)
+{
+	Vec4V lo, hi;
+	V8Store2(residual, lo, hi);
+	FStore(FMax(FLoad(cache.residual), V4ExtractMax(V4Max(lo, hi))), &cache.residual);
+}
+
+//Loads the velocities of one side (body A or body B) of a 4-wide batch in transposed form. The w row is kept so
+//that the solver progress counters stored there survive the round trip.
+PX_FORCE_INLINE void loadBodies4(const PxSolverConstraintDesc* PX_RESTRICT desc, const bool bodyB, Vec4V* PX_RESTRICT linT, Vec4V* PX_RESTRICT angT)
+{
+	const PxSolverBody& b0 = bodyB ? *desc[0].bodyB : *desc[0].bodyA;
+	const PxSolverBody& b1 = bodyB ? *desc[1].bodyB : *desc[1].bodyA;
+	const PxSolverBody& b2 = bodyB ? *desc[2].bodyB : *desc[2].bodyA;
+	const PxSolverBody& b3 = bodyB ? *desc[3].bodyB : *desc[3].bodyA;
+
+	Vec4V linVel0 = V4LoadA(&b0.linearVelocity.x);
+	Vec4V linVel1 = V4LoadA(&b1.linearVelocity.x);
+	Vec4V linVel2 = V4LoadA(&b2.linearVelocity.x);
+	Vec4V linVel3 = V4LoadA(&b3.linearVelocity.x);
+
+	Vec4V angState0 = V4LoadA(&b0.angularState.x);
+	Vec4V angState1 = V4LoadA(&b1.angularState.x);
+	Vec4V angState2 = V4LoadA(&b2.angularState.x);
+	Vec4V angState3 = V4LoadA(&b3.angularState.x);
+
+	PX_TRANSPOSE_44(linVel0, linVel1, linVel2, linVel3, linT[0], linT[1], linT[2], linT[3]);
+	PX_TRANSPOSE_44(angState0, angState1, angState2, angState3, angT[0], angT[1], angT[2], angT[3]);
+}
+
+//Stores one side of a 4-wide batch back. Body B is skipped when it is the shared static body (data index 0).
+PX_FORCE_INLINE void storeBodies4(const PxSolverConstraintDesc* PX_RESTRICT desc, const bool bodyB, Vec4V* PX_RESTRICT linT, Vec4V* PX_RESTRICT angT)
+{
+	Vec4V linVel[4], angState[4];
+	PX_TRANSPOSE_44(linT[0], linT[1], linT[2], linT[3], linVel[0], linVel[1], linVel[2], linVel[3]);
+	PX_TRANSPOSE_44(angT[0], angT[1], angT[2], angT[3], angState[0], angState[1], angState[2], angState[3]);
+
+	for(PxU32 i = 0; i < 4; ++i)
+	{
+		if(bodyB && desc[i].bodyBDataIndex == 0)
+			continue;
+
+		PxSolverBody& b = bodyB ? *desc[i].bodyB : *desc[i].bodyA;
+		V4StoreA(linVel[i], &b.linearVelocity.x);
+		V4StoreA(angState[i], &b.angularState.x);
+		PX_ASSERT(b.linearVelocity.isFinite());
+		PX_ASSERT(b.angularState.isFinite());
+	}
+}
+
+template <typename ContactType, typename FrictionType>
+struct ContactBlockSection4
+{
+	Vec4V*						appliedForces;
+	const ContactType*			contacts;
+	SolverFrictionSharedData4*	fd;
+	Vec4V*						frictionAppliedForces;
+	const FrictionType*			frictions;
+
+	PX_FORCE_INLINE PxU8* parse(PxU8* currPtr, const PxU32 numNormalConstr, const PxU32 numFrictionConstr)
+	{
+		appliedForces = reinterpret_cast<Vec4V*>(currPtr);
+		currPtr += sizeof(Vec4V)*numNormalConstr;
+		contacts = reinterpret_cast<const ContactType*>(currPtr);
+		currPtr += sizeof(ContactType)*numNormalConstr;
+		fd = reinterpret_cast<SolverFrictionSharedData4*>(currPtr);
+		if(numFrictionConstr)
+			currPtr += sizeof(SolverFrictionSharedData4);
+		frictionAppliedForces = reinterpret_cast<Vec4V*>(currPtr);
+		currPtr += sizeof(Vec4V)*numFrictionConstr;
+		frictions = reinterpret_cast<const FrictionType*>(currPtr);
+		currPtr += sizeof(FrictionType)*numFrictionConstr;
+		return currPtr;
+	}
+};
+
+//Two batches can only be solved in lock-step if every contact patch header has the same number of normal and
+//friction rows; the row layout of each batch is padded per batch during prep.
+template <typename ContactType, typename FrictionType>
+bool blockLayoutsMatch(const PxSolverConstraintDesc& descA, const PxSolverConstraintDesc& descB)
+{
+	const PxU32 length = getConstraintLength(descA);
+	if(length != getConstraintLength(descB))
+		return false;
+
+	const PxU8* PX_RESTRICT currPtrA = descA.constraint;
+	const PxU8* PX_RESTRICT currPtrB = descB.constraint;
+	const PxU8* PX_RESTRICT last = currPtrA + length;
+	while(currPtrA < last)
+	{
+		const SolverContactHeader4* PX_RESTRICT hdrA = reinterpret_cast<const SolverContactHeader4*>(currPtrA);
+		const SolverContactHeader4* PX_RESTRICT hdrB = reinterpret_cast<const SolverContactHeader4*>(currPtrB);
+		const PxU32 numNormalConstr = hdrA->numNormalConstr;
+		const PxU32 numFrictionConstr = hdrA->numFrictionConstr;
+		if(numNormalConstr != hdrB->numNormalConstr || numFrictionConstr != hdrB->numFrictionConstr)
+			return false;
+
+		const PxU32 size = sizeof(SolverContactHeader4) + numNormalConstr * (sizeof(Vec4V) + sizeof(ContactType)) +
+			(numFrictionConstr ? sizeof(SolverFrictionSharedData4) : 0) + numFrictionConstr * (sizeof(Vec4V) + sizeof(FrictionType));
+		currPtrA += size;
+		currPtrB += size;
+	}
+	return true;
+}
+
+DY_AVX_FUNC void solveContact8_Block(const PxSolverConstraintDesc* PX_RESTRICT descA, const PxSolverConstraintDesc* PX_RESTRICT descB, SolverContext& cache)
+{
+	Vec4V linVelA0[4], linVelA1[4], angStateA0[4], angStateA1[4];
+	Vec4V linVelB0[4], linVelB1[4], angStateB0[4], angStateB1[4];
+
+	loadBodies4(descA, false, linVelA0, angStateA0);
+	loadBodies4(descA, true, linVelA1, angStateA1);
+	loadBodies4(descB, false, linVelB0, angStateB0);
+	loadBodies4(descB, true, linVelB1, angStateB1);
+
+	Vec8V residual = V8Zero();
+
+	//Lanes 0-3 belong to batch A, lanes 4-7 to batch B.
+	Vec8V linVel0T0 = V8Load2(linVelA0[0], linVelB0[0]);
+	Vec8V linVel0T1 = V8Load2(linVelA0[1], linVelB0[1]);
+	Vec8V linVel0T2 = V8Load2(linVelA0[2], linVelB0[2]);
+	Vec8V linVel1T0 = V8Load2(linVelA1[0], linVelB1[0]);
+	Vec8V linVel1T1 = V8Load2(linVelA1[1], linVelB1[1]);
+	Vec8V linVel1T2 = V8Load2(linVelA1[2], linVelB1[2]);
+	Vec8V angState0T0 = V8Load2(angStateA0[0], angStateB0[0]);
+	Vec8V angState0T1 = V8Load2(angStateA0[1], angStateB0[1]);
+	Vec8V angState0T2 = V8Load2(angStateA0[2], angStateB0[2]);
+	Vec8V angState1T0 = V8Load2(angStateA1[0], angStateB1[0]);
+	Vec8V angState1T1 = V8Load2(angStateA1[1], angStateB1[1]);
+	Vec8V angState1T2 = V8Load2(angStateA1[2], angStateB1[2]);
+
+	const Vec8V vZero = V8Zero();
+
+	const PxU8* PX_RESTRICT last = descA[0].constraint + getConstraintLength(descA[0]);
+
+	PxU8* PX_RESTRICT currPtrA = descA[0].constraint;
+	PxU8* PX_RESTRICT currPtrB = descB[0].constraint;
+
+	const PxU8* PX_RESTRICT prefetchAddressA = currPtrA + sizeof(SolverContactHeader4) + sizeof(SolverContactBatchPointDynamic4);
+	const PxU8* PX_RESTRICT prefetchAddressB = currPtrB + sizeof(SolverContactHeader4) + sizeof(SolverContactBatchPointDynamic4);
+
+	const SolverContactHeader4* PX_RESTRICT hdrA = reinterpret_cast<SolverContactHeader4*>(currPtrA);
+	const SolverContactHeader4* PX_RESTRICT hdrB = reinterpret_cast<SolverContactHeader4*>(currPtrB);
+
+	const Vec8V invMassA = V8Load2(hdrA->invMass0D0, hdrB->invMass0D0);
+	const Vec8V invMassB = V8Load2(hdrA->invMass1D1, hdrB->invMass1D1);
+
+	const Vec8V sumInvMass = V8Add(invMassA, invMassB);
+
+	while(currPtrA < last)
+	{
+		hdrA = reinterpret_cast<const SolverContactHeader4*>(currPtrA);
+		hdrB = reinterpret_cast<const SolverContactHeader4*>(currPtrB);
+
+		PX_ASSERT(hdrA->type == DY_SC_TYPE_BLOCK_RB_CONTACT);
+		PX_ASSERT(hdrB->type == DY_SC_TYPE_BLOCK_RB_CONTACT);
+
+		const PxU32 numNormalConstr = hdrA->numNormalConstr;
+		const PxU32	numFrictionConstr = hdrA->numFrictionConstr;
+
+		ContactBlockSection4<SolverContactBatchPointDynamic4, SolverContactFrictionDynamic4> sectionA, sectionB;
+		currPtrA = sectionA.parse(reinterpret_cast<PxU8*>(const_cast<SolverContactHeader4*>(hdrA) + 1), numNormalConstr, numFrictionConstr);
+		currPtrB = sectionB.parse(reinterpret_cast<PxU8*>(const_cast<SolverContactHeader4*>(hdrB) + 1), numNormalConstr, numFrictionConstr);
+
+		Vec8V accumulatedNormalImpulse = vZero;
+
+		const Vec8V angD0 = V8Load2(hdrA->angDom0, hdrB->angDom0);
+		const Vec8V angD1 = V8Load2(hdrA->angDom1, hdrB->angDom1);
+
+		const Vec8V _normalT0 = V8Load2(hdrA->normalX, hdrB->normalX);
+		const Vec8V _normalT1 = V8Load2(hdrA->normalY, hdrB->normalY);
+		const Vec8V _normalT2 = V8Load2(hdrA->normalZ, hdrB->normalZ);
+
+		Vec8V contactNormalVel1 = V8Mul(linVel0T0, _normalT0);
+		Vec8V contactNormalVel3 = V8Mul(linVel1T0, _normalT0);
+		contactNormalVel1 = V8MulAdd(linVel0T1, _normalT1, contactNormalVel1);
+		contactNormalVel3 = V8MulAdd(linVel1T1, _normalT1, contactNormalVel3);
+		contactNormalVel1 = V8MulAdd(linVel0T2, _normalT2, contactNormalVel1);
+		contactNormalVel3 = V8MulAdd(linVel1T2, _normalT2, contactNormalVel3);
+
+		Vec8V relVel1 = V8Sub(contactNormalVel1, contactNormalVel3);
+
+		Vec8V accumDeltaF = vZero;
+
+		for(PxU32 i=0;i<numNormalConstr;i++)
+		{
+			const SolverContactBatchPointDynamic4& cA = sectionA.contacts[i];
+			const SolverContactBatchPointDynamic4& cB = sectionB.contacts[i];
+
+			PxU32 offset = 0;
+			Ps::prefetchLine(prefetchAddressA, offset += 64);
+			Ps::prefetchLine(prefetchAddressA, offset += 64);
+			Ps::prefetchLine(prefetchAddressA, offset += 64);
+			prefetchAddressA += offset;
+			offset = 0;
+			Ps::prefetchLine(prefetchAddressB, offset += 64);
+			Ps::prefetchLine(prefetchAddressB, offset += 64);
+			Ps::prefetchLine(prefetchAddressB, offset += 64);
+			prefetchAddressB += offset;
+
+			const Vec8V appliedForce = V8Load2(sectionA.appliedForces[i], sectionB.appliedForces[i]);
+			const Vec8V maxImpulse = V8Load2(cA.maxContactImpulse, cB.maxContactImpulse);
+
+			const Vec8V raXnX = V8Load2(cA.raXnX, cB.raXnX);
+			const Vec8V raXnY = V8Load2(cA.raXnY, cB.raXnY);
+			const Vec8V raXnZ = V8Load2(cA.raXnZ, cB.raXnZ);
+			const Vec8V rbXnX = V8Load2(cA.rbXnX, cB.rbXnX);
+			const Vec8V rbXnY = V8Load2(cA.rbXnY, cB.rbXnY);
+			const Vec8V rbXnZ = V8Load2(cA.rbXnZ, cB.rbXnZ);
+
+			Vec8V contactNormalVel2 = V8Mul(raXnX, angState0T0);
+			Vec8V contactNormalVel4 = V8Mul(rbXnX, angState1T0);
+
+			contactNormalVel2 = V8MulAdd(raXnY, angState0T1, contactNormalVel2);
+			contactNormalVel4 = V8MulAdd(rbXnY, angState1T1, contactNormalVel4);
+
+			contactNormalVel2 = V8MulAdd(raXnZ, angState0T2, contactNormalVel2);
+			contactNormalVel4 = V8MulAdd(rbXnZ, angState1T2, contactNormalVel4);
+
+			const Vec8V normalVel = V8Add(relVel1, V8Sub(contactNormalVel2, contactNormalVel4));
+
+			Vec8V deltaF = V8NegMulSub(normalVel, V8Load2(cA.velMultiplier, cB.velMultiplier), V8Load2(cA.biasedErr, cB.biasedErr));
+
+			deltaF = V8Max(deltaF, V8Neg(appliedForce));
+			const Vec8V newAppliedForce = V8Min(V8Add(appliedForce, deltaF), maxImpulse);
+			deltaF = V8Sub(newAppliedForce, appliedForce);
+			residual = V8Max(residual, V8Abs(deltaF));
+
+			accumDeltaF = V8Add(accumDeltaF, deltaF);
+
+			const Vec8V angDetaF0 = V8Mul(deltaF, angD0);
+			const Vec8V angDetaF1 = V8Mul(deltaF, angD1);
+
+			relVel1 = V8MulAdd(sumInvMass, deltaF, relVel1);
+
+			angState0T0 = V8MulAdd(raXnX, angDetaF0, angState0T0);
+			angState1T0 = V8NegMulSub(rbXnX, angDetaF1, angState1T0);
+
+			angState0T1 = V8MulAdd(raXnY, angDetaF0, angState0T1);
+			angState1T1 = V8NegMulSub(rbXnY, angDetaF1, angState1T1);
+
+			angState0T2 = V8MulAdd(raXnZ, angDetaF0, angState0T2);
+			angState1T2 = V8NegMulSub(rbXnZ, angDetaF1, angState1T2);
+
+			V8Store2(newAppliedForce, sectionA.appliedForces[i], sectionB.appliedForces[i]);
+
+			accumulatedNormalImpulse = V8Add(accumulatedNormalImpulse, newAppliedForce);
+		}
+
+		const Vec8V accumDeltaF_IM0 = V8Mul(accumDeltaF, invMassA);
+		const Vec8V accumDeltaF_IM1 = V8Mul(accumDeltaF, invMassB);
+
+		linVel0T0 = V8MulAdd(_normalT0, accumDeltaF_IM0, linVel0T0);
+		linVel1T0 = V8NegMulSub(_normalT0, accumDeltaF_IM1, linVel1T0);
+		linVel0T1 = V8MulAdd(_normalT1, accumDeltaF_IM0, linVel0T1);
+		linVel1T1 = V8NegMulSub(_normalT1, accumDeltaF_IM1, linVel1T1);
+		linVel0T2 = V8MulAdd(_normalT2, accumDeltaF_IM0, linVel0T2);
+		linVel1T2 = V8NegMulSub(_normalT2, accumDeltaF_IM1, linVel1T2);
+
+		if(cache.doFriction && numFrictionConstr)
+		{
+			SolverFrictionSharedData4* PX_RESTRICT fdA = sectionA.fd;
+			SolverFrictionSharedData4* PX_RESTRICT fdB = sectionB.fd;
+
+			const Vec8V staticFric = V8Load2(hdrA->staticFriction, hdrB->staticFriction);
+			const Vec8V dynamicFric = V8Load2(hdrA->dynamicFriction, hdrB->dynamicFriction);
+
+			const Vec8V maxFrictionImpulse = V8Mul(staticFric, accumulatedNormalImpulse);
+			const Vec8V maxDynFrictionImpulse = V8Mul(dynamicFric, accumulatedNormalImpulse);
+			const Vec8V negMaxDynFrictionImpulse = V8Neg(maxDynFrictionImpulse);
+			BoolV8 broken = vZero;
+
+			if(cache.writeBackIteration)
+			{
+				Ps::prefetchLine(fdA->frictionBrokenWritebackByte[0]);
+				Ps::prefetchLine(fdA->frictionBrokenWritebackByte[1]);
+				Ps::prefetchLine(fdA->frictionBrokenWritebackByte[2]);
+				Ps::prefetchLine(fdB->frictionBrokenWritebackByte[0]);
+				Ps::prefetchLine(fdB->frictionBrokenWritebackByte[1]);
+				Ps::prefetchLine(fdB->frictionBrokenWritebackByte[2]);
+			}
+
+			for(PxU32 i=0;i<numFrictionConstr;i++)
+			{
+				const SolverContactFrictionDynamic4& fA = sectionA.frictions[i];
+				const SolverContactFrictionDynamic4& fB = sectionB.frictions[i];
+
+				PxU32 offset = 0;
+				Ps::prefetchLine(prefetchAddressA, offset += 64);
+				Ps::prefetchLine(prefetchAddressA, offset += 64);
+				Ps::prefetchLine(prefetchAddressA, offset += 64);
+				Ps::prefetchLine(prefetchAddressA, offset += 64);
+				prefetchAddressA += offset;
+				offset = 0;
+				Ps::prefetchLine(prefetchAddressB, offset += 64);
+				Ps::prefetchLine(prefetchAddressB, offset += 64);
+				Ps::prefetchLine(prefetchAddressB, offset += 64);
+				Ps::prefetchLine(prefetchAddressB, offset += 64);
+				prefetchAddressB += offset;
+
+				const Vec8V appliedForce = V8Load2(sectionA.frictionAppliedForces[i], sectionB.frictionAppliedForces[i]);
+
+				const Vec8V normalT0 = V8Load2(fdA->normalX[i&1], fdB->normalX[i&1]);
+				const Vec8V normalT1 = V8Load2(fdA->normalY[i&1], fdB->normalY[i&1]);
+				const Vec8V normalT2 = V8Load2(fdA->normalZ[i&1], fdB->normalZ[i&1]);
+
+				const Vec8V raXnX = V8Load2(fA.raXnX, fB.raXnX);
+				const Vec8V raXnY = V8Load2(fA.raXnY, fB.raXnY);
+				const Vec8V raXnZ = V8Load2(fA.raXnZ, fB.raXnZ);
+				const Vec8V rbXnX = V8Load2(fA.rbXnX, fB.rbXnX);
+				const Vec8V rbXnY = V8Load2(fA.rbXnY, fB.rbXnY);
+				const Vec8V rbXnZ = V8Load2(fA.rbXnZ, fB.rbXnZ);
+
+				Vec8V normalVel1 = V8Mul(linVel0T0, normalT0);
+				Vec8V normalVel2 = V8Mul(raXnX, angState0T0);
+				Vec8V normalVel3 = V8Mul(linVel1T0, normalT0);
+				Vec8V normalVel4 = V8Mul(rbXnX, angState1T0);
+
+				normalVel1 = V8MulAdd(linVel0T1, normalT1, normalVel1);
+				normalVel2 = V8MulAdd(raXnY, angState0T1, normalVel2);
+				normalVel3 = V8MulAdd(linVel1T1, normalT1, normalVel3);
+				normalVel4 = V8MulAdd(rbXnY, angState1T1, normalVel4);
+
+				normalVel1 = V8MulAdd(linVel0T2, normalT2, normalVel1);
+				normalVel2 = V8MulAdd(raXnZ, angState0T2, normalVel2);
+				normalVel3 = V8MulAdd(linVel1T2, normalT2, normalVel3);
+				normalVel4 = V8MulAdd(rbXnZ, angState1T2, normalVel4);
+
+				const Vec8V _normalVel = V8Add(normalVel1, normalVel2);
+				const Vec8V __normalVel = V8Add(normalVel3, normalVel4);
+
+				const Vec8V normalVel = V8Sub(_normalVel, __normalVel);
+
+				const Vec8V tmp1 = V8Sub(appliedForce, V8Load2(fA.scaledBias, fB.scaledBias));
+
+				const Vec8V totalImpulse = V8NegMulSub(normalVel, V8Load2(fA.velMultiplier, fB.velMultiplier), tmp1);
+
+				broken = B8Or(broken, V8IsGrtr(V8Abs(totalImpulse), maxFrictionImpulse));
+
+				const Vec8V newAppliedForce = V8Sel(broken, V8Min(maxDynFrictionImpulse, V8Max(negMaxDynFrictionImpulse, totalImpulse)), totalImpulse);
+
+				const Vec8V deltaF = V8Sub(newAppliedForce, appliedForce);
+				residual = V8Max(residual, V8Abs(deltaF));
+
+				V8Store2(newAppliedForce, sectionA.frictionAppliedForces[i], sectionB.frictionAppliedForces[i]);
+
+				const Vec8V deltaFIM0 = V8Mul(deltaF, invMassA);
+				const Vec8V deltaFIM1 = V8Mul(deltaF, invMassB);
+
+				const Vec8V angDetaF0 = V8Mul(deltaF, angD0);
+				const Vec8V angDetaF1 = V8Mul(deltaF, angD1);
+
+				linVel0T0 = V8MulAdd(normalT0, deltaFIM0, linVel0T0);
+				linVel1T0 = V8NegMulSub(normalT0, deltaFIM1, linVel1T0);
+				angState0T0 = V8MulAdd(raXnX, angDetaF0, angState0T0);
+				angState1T0 = V8NegMulSub(rbXnX, angDetaF1, angState1T0);
+
+				linVel0T1 = V8MulAdd(normalT1, deltaFIM0, linVel0T1);
+				linVel1T1 = V8NegMulSub(normalT1, deltaFIM1, linVel1T1);
+				angState0T1 = V8MulAdd(raXnY, angDetaF0, angState0T1);
+				angState1T1 = V8NegMulSub(rbXnY, angDetaF1, angState1T1);
+
+				linVel0T2 = V8MulAdd(normalT2, deltaFIM0, linVel0T2);
+				linVel1T2 = V8NegMulSub(normalT2, deltaFIM1, linVel1T2);
+				angState0T2 = V8MulAdd(raXnZ, angDetaF0, angState0T2);
+				angState1T2 = V8NegMulSub(rbXnZ, angDetaF1, angState1T2);
+			}
+			V8Store2(broken, fdA->broken, fdB->broken);
+		}
+	}
+
+	V8Store2(linVel0T0, linVelA0[0], linVelB0[0]);
+	V8Store2(linVel0T1, linVelA0[1], linVelB0[1]);
+	V8Store2(linVel0T2, linVelA0[2], linVelB0[2]);
+	V8Store2(linVel1T0, linVelA1[0], linVelB1[0]);
+	V8Store2(linVel1T1, linVelA1[1], linVelB1[1]);
+	V8Store2(linVel1T2, linVelA1[2], linVelB1[2]);
+	V8Store2(angState0T0, angStateA0[0], angStateB0[0]);
+	V8Store2(angState0T1, angStateA0[1], angStateB0[1]);
+	V8Store2(angState0T2, angStateA0[2], angStateB0[2]);
+	V8Store2(angState1T0, angStateA1[0], angStateB1[0]);
+	V8Store2(angState1T1, angStateA1[1], angStateB1[1]);
+	V8Store2(angState1T2, angStateA1[2], angStateB1[2]);
+
+	storeResidual(residual, cache);
+
+	storeBodies4(descA, false, linVelA0, angStateA0);
+	storeBodies4(descA, true, linVelA1, angStateA1);
+	storeBodies4(descB, false, linVelB0, angStateB0);
+	storeBodies4(descB, true, linVelB1, angStateB1);
+}
+
+DY_AVX_FUNC void solveContact8_StaticBlock(const PxSolverConstraintDesc* PX_RESTRICT descA, const PxSolverConstraintDesc* PX_RESTRICT descB, SolverContext& cache)
+{
+	Vec4V linVelA0[4], angStateA0[4];
+	Vec4V linVelB0[4], angStateB0[4];
+
+	loadBodies4(descA, false, linVelA0, angStateA0);
+	loadBodies4(descB, false, linVelB0, angStateB0);
+
+	Vec8V residual = V8Zero();
+
+	Vec8V linVel0T0 = V8Load2(linVelA0[0], linVelB0[0]);
+	Vec8V linVel0T1 = V8Load2(linVelA0[1], linVelB0[1]);
+	Vec8V linVel0T2 = V8Load2(linVelA0[2], linVelB0[2]);
+	Vec8V angState0T0 = V8Load2(angStateA0[0], angStateB0[0]);
+	Vec8V angState0T1 = V8Load2(angStateA0[1], angStateB0[1]);
+	Vec8V angState0T2 = V8Load2(angStateA0[2], angStateB0[2]);
+
+	const Vec8V vZero = V8Zero();
+
+	const PxU8* PX_RESTRICT last = descA[0].constraint + getConstraintLength(descA[0]);
+
+	PxU8* PX_RESTRICT currPtrA = descA[0].constraint;
+	PxU8* PX_RESTRICT currPtrB = descB[0].constraint;
+
+	const PxU8* PX_RESTRICT prefetchAddressA = currPtrA + sizeof(SolverContactHeader4) + sizeof(SolverContactBatchPointBase4);
+	const PxU8* PX_RESTRICT prefetchAddressB = currPtrB + sizeof(SolverContactHeader4) + sizeof(SolverContactBatchPointBase4);
+
+	const SolverContactHeader4* PX_RESTRICT hdrA = reinterpret_cast<SolverContactHeader4*>(currPtrA);
+	const SolverContactHeader4* PX_RESTRICT hdrB = reinterpret_cast<SolverContactHeader4*>(currPtrB);
+
+	const Vec8V invMass0 = V8Load2(hdrA->invMass0D0, hdrB->invMass0D0);
+
+	while(currPtrA < last)
+	{
+		hdrA = reinterpret_cast<const SolverContactHeader4*>(currPtrA);
+		hdrB = reinterpret_cast<const SolverContactHeader4*>(currPtrB);
+
+		PX_ASSERT(hdrA->type == DY_SC_TYPE_BLOCK_STATIC_RB_CONTACT);
+		PX_ASSERT(hdrB->type == DY_SC_TYPE_BLOCK_STATIC_RB_CONTACT);
+
+		const PxU32 numNormalConstr = hdrA->numNormalConstr;
+		const PxU32	numFrictionConstr = hdrA->numFrictionConstr;
+
+		ContactBlockSection4<SolverContactBatchPointBase4, SolverContactFrictionBase4> sectionA, sectionB;
+		currPtrA = sectionA.parse(reinterpret_cast<PxU8*>(const_cast<SolverContactHeader4*>(hdrA) + 1), numNormalConstr, numFrictionConstr);
+		currPtrB = sectionB.parse(reinterpret_cast<PxU8*>(const_cast<SolverContactHeader4*>(hdrB) + 1), numNormalConstr, numFrictionConstr);
+
+		Vec8V accumulatedNormalImpulse = vZero;
+
+		const Vec8V angD0 = V8Load2(hdrA->angDom0, hdrB->angDom0);
+		const Vec8V _normalT0 = V8Load2(hdrA->normalX, hdrB->normalX);
+		const Vec8V _normalT1 = V8Load2(hdrA->normalY, hdrB->normalY);
+		const Vec8V _normalT2 = V8Load2(hdrA->normalZ, hdrB->normalZ);
+
+		Vec8V contactNormalVel1 = V8Mul(linVel0T0, _normalT0);
+		contactNormalVel1 = V8MulAdd(linVel0T1, _normalT1, contactNormalVel1);
+		contactNormalVel1 = V8MulAdd(linVel0T2, _normalT2, contactNormalVel1);
+
+		Vec8V accumDeltaF = vZero;
+
+		for(PxU32 i=0;i<numNormalConstr;i++)
+		{
+			const SolverContactBatchPointBase4& cA = sectionA.contacts[i];
+			const SolverContactBatchPointBase4& cB = sectionB.contacts[i];
+
+			PxU32 offset = 0;
+			Ps::prefetchLine(prefetchAddressA, offset += 64);
+			Ps::prefetchLine(prefetchAddressA, offset += 64);
+			Ps::prefetchLine(prefetchAddressA, offset += 64);
+			prefetchAddressA += offset;
+			offset = 0;
+			Ps::prefetchLine(prefetchAddressB, offset += 64);
+			Ps::prefetchLine(prefetchAddressB, offset += 64);
+			Ps::prefetchLine(prefetchAddressB, offset += 64);
+			prefetchAddressB += offset;
+
+			const Vec8V appliedForce = V8Load2(sectionA.appliedForces[i], sectionB.appliedForces[i]);
+			const Vec8V maxImpulse = V8Load2(cA.maxContactImpulse, cB.maxContactImpulse);
+
+			const Vec8V raXnX = V8Load2(cA.raXnX, cB.raXnX);
+			const Vec8V raXnY = V8Load2(cA.raXnY, cB.raXnY);
+			const Vec8V raXnZ = V8Load2(cA.raXnZ, cB.raXnZ);
+
+			Vec8V contactNormalVel2 = V8MulAdd(raXnX, angState0T0, contactNormalVel1);
+			contactNormalVel2 = V8MulAdd(raXnY, angState0T1, contactNormalVel2);
+			const Vec8V normalVel = V8MulAdd(raXnZ, angState0T2, contactNormalVel2);
+
+			const Vec8V _deltaF = V8Max(V8NegMulSub(normalVel, V8Load2(cA.velMultiplier, cB.velMultiplier), V8Load2(cA.biasedErr, cB.biasedErr)), V8Neg(appliedForce));
+
+			Vec8V newAppliedForce(V8Add(appliedForce, _deltaF));
+			newAppliedForce = V8Min(newAppliedForce, maxImpulse);
+			const Vec8V deltaF = V8Sub(newAppliedForce, appliedForce);
+			residual = V8Max(residual, V8Abs(deltaF));
+			const Vec8V angDeltaF = V8Mul(angD0, deltaF);
+
+			accumDeltaF = V8Add(accumDeltaF, deltaF);
+
+			contactNormalVel1 = V8MulAdd(invMass0, deltaF, contactNormalVel1);
+			angState0T0 = V8MulAdd(raXnX, angDeltaF, angState0T0);
+			angState0T1 = V8MulAdd(raXnY, angDeltaF, angState0T1);
+			angState0T2 = V8MulAdd(raXnZ, angDeltaF, angState0T2);
+
+			V8Store2(newAppliedForce, sectionA.appliedForces[i], sectionB.appliedForces[i]);
+
+			accumulatedNormalImpulse = V8Add(accumulatedNormalImpulse, newAppliedForce);
+		}
+
+		const Vec8V deltaFInvMass0 = V8Mul(accumDeltaF, invMass0);
+
+		linVel0T0 = V8MulAdd(_normalT0, deltaFInvMass0, linVel0T0);
+		linVel0T1 = V8MulAdd(_normalT1, deltaFInvMass0, linVel0T1);
+		linVel0T2 = V8MulAdd(_normalT2, deltaFInvMass0, linVel0T2);
+
+		if(cache.doFriction && numFrictionConstr)
+		{
+			SolverFrictionSharedData4* PX_RESTRICT fdA = sectionA.fd;
+			SolverFrictionSharedData4* PX_RESTRICT fdB = sectionB.fd;
+
+			const Vec8V staticFric = V8Load2(hdrA->staticFriction, hdrB->staticFriction);
+			const Vec8V dynamicFric = V8Load2(hdrA->dynamicFriction, hdrB->dynamicFriction);
+
+			const Vec8V maxFrictionImpulse = V8Mul(staticFric, accumulatedNormalImpulse);
+			const Vec8V maxDynFrictionImpulse = V8Mul(dynamicFric, accumulatedNormalImpulse);
+			const Vec8V negMaxDynFrictionImpulse = V8Neg(maxDynFrictionImpulse);
+
+			BoolV8 broken = vZero;
+
+			if(cache.writeBackIteration)
+			{
+				Ps::prefetchLine(fdA->frictionBrokenWritebackByte[0]);
+				Ps::prefetchLine(fdA->frictionBrokenWritebackByte[1]);
+				Ps::prefetchLine(fdA->frictionBrokenWritebackByte[2]);
+				Ps::prefetchLine(fdA->frictionBrokenWritebackByte[3]);
+				Ps::prefetchLine(fdB->frictionBrokenWritebackByte[0]);
+				Ps::prefetchLine(fdB->frictionBrokenWritebackByte[1]);
+				Ps::prefetchLine(fdB->frictionBrokenWritebackByte[2]);
+				Ps::prefetchLine(fdB->frictionBrokenWritebackByte[3]);
+			}
+
+			for(PxU32 i=0;i<numFrictionConstr;i++)
+			{
+				const SolverContactFrictionBase4& fA = sectionA.frictions[i];
+				const SolverContactFrictionBase4& fB = sectionB.frictions[i];
+
+				PxU32 offset = 0;
+				Ps::prefetchLine(prefetchAddressA, offset += 64);
+				Ps::prefetchLine(prefetchAddressA, offset += 64);
+				Ps::prefetchLine(prefetchAddressA, offset += 64);
+				prefetchAddressA += offset;
+				offset = 0;
+				Ps::prefetchLine(prefetchAddressB, offset += 64);
+				Ps::prefetchLine(prefetchAddressB, offset += 64);
+				Ps::prefetchLine(prefetchAddressB, offset += 64);
+				prefetchAddressB += offset;
+
+				const Vec8V appliedForce = V8Load2(sectionA.frictionAppliedForces[i], sectionB.frictionAppliedForces[i]);
+
+				const Vec8V normalT0 = V8Load2(fdA->normalX[i&1], fdB->normalX[i&1]);
+				const Vec8V normalT1 = V8Load2(fdA->normalY[i&1], fdB->normalY[i&1]);
+				const Vec8V normalT2 = V8Load2(fdA->normalZ[i&1], fdB->normalZ[i&1]);
+
+				const Vec8V raXnX = V8Load2(fA.raXnX, fB.raXnX);
+				const Vec8V raXnY = V8Load2(fA.raXnY, fB.raXnY);
+				const Vec8V raXnZ = V8Load2(fA.raXnZ, fB.raXnZ);
+
+				Vec8V normalVel1 = V8Mul(linVel0T0, normalT0);
+				Vec8V normalVel2 = V8Mul(raXnX, angState0T0);
+
+				normalVel1 = V8MulAdd(linVel0T1, normalT1, normalVel1);
+				normalVel2 = V8MulAdd(raXnY, angState0T1, normalVel2);
+
+				normalVel1 = V8MulAdd(linVel0T2, normalT2, normalVel1);
+				normalVel2 = V8MulAdd(raXnZ, angState0T2, normalVel2);
+
+				const Vec8V normalVel = V8Add(normalVel1, normalVel2);
+
+				const Vec8V tmp1 = V8Sub(appliedForce, V8Load2(fA.scaledBias, fB.scaledBias));
+
+				const Vec8V totalImpulse = V8NegMulSub(normalVel, V8Load2(fA.velMultiplier, fB.velMultiplier), tmp1);
+
+				broken = B8Or(broken, V8IsGrtr(V8Abs(totalImpulse), maxFrictionImpulse));
+
+				const Vec8V newAppliedForce = V8Sel(broken, V8Min(maxDynFrictionImpulse, V8Max(negMaxDynFrictionImpulse, totalImpulse)), totalImpulse);
+
+				const Vec8V deltaF = V8Sub(newAppliedForce, appliedForce);
+				residual = V8Max(residual, V8Abs(deltaF));
+
+				const Vec8V deltaFInvMass = V8Mul(invMass0, deltaF);
+				const Vec8V angDeltaF = V8Mul(angD0, deltaF);
+
+				linVel0T0 = V8MulAdd(normalT0, deltaFInvMass, linVel0T0);
+				angState0T0 = V8MulAdd(raXnX, angDeltaF, angState0T0);
+
+				linVel0T1 = V8MulAdd(normalT1, deltaFInvMass, linVel0T1);
+				angState0T1 = V8MulAdd(raXnY, angDeltaF, angState0T1);
+
+				linVel0T2 = V8MulAdd(normalT2, deltaFInvMass, linVel0T2);
+				angState0T2 = V8MulAdd(raXnZ, angDeltaF, angState0T2);
+
+				V8Store2(newAppliedForce, sectionA.frictionAppliedForces[i], sectionB.frictionAppliedForces[i]);
+			}
+
+			V8Store2(broken, fdA->broken, fdB->broken);
+		}
+	}
+
+	V8Store2(linVel0T0, linVelA0[0], linVelB0[0]);
+	V8Store2(linVel0T1, linVelA0[1], linVelB0[1]);
+	V8Store2(linVel0T2, linVelA0[2], linVelB0[2]);
+	V8Store2(angState0T0, angStateA0[0], angStateB0[0]);
+	V8Store2(angState0T1, angStateA0[1], angStateB0[1]);
+	V8Store2(angState0T2, angStateA0[2], angStateB0[2]);
+
+	storeResidual(residual, cache);
+
+	storeBodies4(descA, false, linVelA0, angStateA0);
+	storeBodies4(descB, false, linVelB0, angStateB0);
+}
+
+} // namespace
+
+bool isAVXBlockSolverSupported()
+{
+	return sAvxSupport;
+}
+
+bool solveContact4x2_Block(const PxSolverConstraintDesc* PX_RESTRICT descA, const PxSolverConstraintDesc* PX_RESTRICT descB, SolverContext& cache)
+{
+	if(!blockLayoutsMatch<SolverContactBatchPointDynamic4, SolverContactFrictionDynamic4>(descA[0], descB[0]))
+		return false;
+
+	solveContact8_Block(descA, descB, cache);
+	return true;
+}
+
+bool solveContact4x2_StaticBlock(const PxSolverConstraintDesc* PX_RESTRICT descA, const PxSolverConstraintDesc* PX_RESTRICT descB, SolverContext& cache)
+{
+	if(!blockLayoutsMatch<SolverContactBatchPointBase4, SolverContactFrictionBase4>(descA[0], descB[0]))
+		return false;
+
+	solveContact8_StaticBlock(descA, descB, cache);
+	return true;
+}
+
+#else
+
+bool isAVXBlockSolverSupported()
+{
+	return false;
+}
+
+bool solveContact4x2_Block(const PxSolverConstraintDesc* PX_RESTRICT, const PxSolverConstraintDesc* PX_RESTRICT, SolverContext&)
+{
+	return false;
+}
+
+bool solveContact4x2_StaticBlock(const PxSolverConstraintDesc* PX_RESTRICT, const PxSolverConstraintDesc* PX_RESTRICT, SolverContext&)
+{
+	return false;
+}
+
+#endif
+
+}
+
+}
@@ -50,7 +50,7 @@ namespace Dy
 {
 	PX_FORCE_INLINE static FloatV solveDynamicContacts(SolverContactPoint* contacts, const PxU32 nbContactPoints, const Vec3VArg contactNormal,
 	const FloatVArg invMassA, const FloatVArg invMassB, const FloatVArg angDom0, const FloatVArg angDom1, Vec3V& linVel0_, Vec3V& angState0_, 
-	Vec3V& linVel1_, Vec3V& angState1_, PxF32* PX_RESTRICT forceBuffer)
+	Vec3V& linVel1_, Vec3V& angState1_, PxF32* PX_RESTRICT forceBuffer, FloatV& residual)
 {
 	Vec3V linVel0 = linVel0_;
 	Vec3V angState0 = angState0_;
@@ -90,6 +90,8 @@ namespace Dy
 		const FloatV newForce = FMin(_newForce, maxImpulse);
 		const FloatV deltaF = FSub(newForce, appliedForce);
 
+		residual = FMax(residual, FAbs(deltaF));
+
 		linVel0 = V3ScaleAdd(delLinVel0, deltaF, linVel0);
 		linVel1 = V3NegScaleSub(delLinVel1, deltaF, linVel1);
 		angState0 = V3ScaleAdd(raXn, FMul(deltaF, angDom0), angState0);
@@ -108,7 +110,7 @@ namespace Dy
 }
 
 PX_FORCE_INLINE static FloatV solveStaticContacts(SolverContactPoint* contacts, const PxU32 nbContactPoints, const Vec3VArg contactNormal,
-	const FloatVArg invMassA, const FloatVArg angDom0, Vec3V& linVel0_, Vec3V& angState0_, PxF32* PX_RESTRICT forceBuffer)
+	const FloatVArg invMassA, const FloatVArg angDom0, Vec3V& linVel0_, Vec3V& angState0_, PxF32* PX_RESTRICT forceBuffer, FloatV& residual)
 {
 	Vec3V linVel0 = linVel0_;
 	Vec3V angState0 = angState0_;
@@ -143,6 +145,8 @@ PX_FORCE_INLINE static FloatV solveStaticContacts(SolverContactPoint* contacts,
 		const FloatV newForce = FMin(_newForce, maxImpulse);
 		const FloatV deltaF = FSub(newForce, appliedForce);
 
+		residual = FMax(residual, FAbs(deltaF));
+
 		linVel0 = V3ScaleAdd(delLinVel0, deltaF, linVel0);
 		angState0 = V3ScaleAdd(raXn, FMul(deltaF, angDom0), angState0);
 
@@ -45,6 +45,12 @@ struct SolverContext
 	bool doFriction;
 	bool writeBackIteration;
 
+	// largest change of an applied impulse seen by the solve kernels since the last reset, for residual-based early termination
+	PxReal residual;
+
+	// substep duration times the inverse time step the joints were prepared with, scales the error update between substeps
+	PxReal substepErrorScale;
+
 	// for threshold stream output
 	ThresholdStreamElement*				mThresholdStream;
 	PxU32								mThresholdStreamIndex;
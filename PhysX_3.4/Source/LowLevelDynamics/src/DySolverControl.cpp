@@ -41,6 +41,7 @@
 #include "DyArticulationHelper.h"
 #include "PsAtomic.h"
 #include "PsIntrinsics.h"
+#include "PsFPU.h"
 #include "DyArticulationPImpl.h"
 #include "PsThread.h"
 #include "DySolverConstraintDesc.h"
@@ -82,6 +83,18 @@ void solveContactPreBlock_WriteBack		(const PxSolverConstraintDesc* PX_RESTRICT
 void solveContactPreBlock_WriteBackStatic(const PxSolverConstraintDesc* PX_RESTRICT desc, const PxU32 constraintCount, SolverContext& cache);
 void solve1D4Block_WriteBack			(const PxSolverConstraintDesc* PX_RESTRICT desc, const PxU32 constraintCount, SolverContext& cache);
 
+void substep1DBlock						(const PxSolverConstraintDesc* PX_RESTRICT desc, const PxU32 constraintCount, SolverContext& cache);
+void substep1D4Block					(const PxSolverConstraintDesc* PX_RESTRICT desc, const PxU32 constraintCount, SolverContext& cache);
+
+void solveContactPreBlockPair					(const PxSolverConstraintDesc* PX_RESTRICT descA, const PxSolverConstraintDesc* PX_RESTRICT descB, SolverContext& cache);
+void solveContactPreBlockPair_Static			(const PxSolverConstraintDesc* PX_RESTRICT descA, const PxSolverConstraintDesc* PX_RESTRICT descB, SolverContext& cache);
+void solveContactPreBlockPair_Conclude			(const PxSolverConstraintDesc* PX_RESTRICT descA, const PxSolverConstraintDesc* PX_RESTRICT descB, SolverContext& cache);
+void solveContactPreBlockPair_ConcludeStatic	(const PxSolverConstraintDesc* PX_RESTRICT descA, const PxSolverConstraintDesc* PX_RESTRICT descB, SolverContext& cache);
+void solveContactPreBlockPair_WriteBack			(const PxSolverConstraintDesc* PX_RESTRICT descA, const PxSolverConstraintDesc* PX_RESTRICT descB, SolverContext& cache);
+void solveContactPreBlockPair_WriteBackStatic	(const PxSolverConstraintDesc* PX_RESTRICT descA, const PxSolverConstraintDesc* PX_RESTRICT descB, SolverContext& cache);
+
+bool isAVXBlockSolverSupported();
+
 void writeBack1DBlock				(const PxSolverConstraintDesc* PX_RESTRICT desc, const PxU32 constraintCount, SolverContext& cache);
 void contactBlockWriteBack			(const PxSolverConstraintDesc* PX_RESTRICT desc, const PxU32 constraintCount, SolverContext& cache);
 void extContactBlockWriteBack		(const PxSolverConstraintDesc* PX_RESTRICT desc, const PxU32 constraintCount, SolverContext& cache);
@@ -141,6 +154,137 @@ static SolveBlockMethod gVTableSolveConcludeBlock[] PX_UNUSED_ATTRIBUTE =
 	solve1D4Block_Conclude,													// DY_SC_TYPE_BLOCK_1D,
 };
 
+//Pair methods solve two 4-wide batches of the same partition together (8 lanes on AVX capable CPUs).
+static SolveBlockPairMethod gVTableSolveBlockPair[] PX_UNUSED_ATTRIBUTE = 
+{
+	0,
+	0,																		// DY_SC_TYPE_RB_CONTACT
+	0,																		// DY_SC_TYPE_RB_1D
+	0,																		// DY_SC_TYPE_EXT_CONTACT
+	0,																		// DY_SC_TYPE_EXT_1D
+	0,																		// DY_SC_TYPE_STATIC_CONTACT
+	0,																		// DY_SC_TYPE_NOFRICTION_RB_CONTACT
+	solveContactPreBlockPair,												// DY_SC_TYPE_BLOCK_RB_CONTACT
+	solveContactPreBlockPair_Static,										// DY_SC_TYPE_BLOCK_STATIC_RB_CONTACT
+	0,																		// DY_SC_TYPE_BLOCK_1D,
+};
+
+static SolveBlockPairMethod gVTableSolveConcludeBlockPair[] PX_UNUSED_ATTRIBUTE = 
+{
+	0,
+	0,																		// DY_SC_TYPE_RB_CONTACT
+	0,																		// DY_SC_TYPE_RB_1D
+	0,																		// DY_SC_TYPE_EXT_CONTACT
+	0,																		// DY_SC_TYPE_EXT_1D
+	0,																		// DY_SC_TYPE_STATIC_CONTACT
+	0,																		// DY_SC_TYPE_NOFRICTION_RB_CONTACT
+	solveContactPreBlockPair_Conclude,										// DY_SC_TYPE_BLOCK_RB_CONTACT
+	solveContactPreBlockPair_ConcludeStatic,								// DY_SC_TYPE_BLOCK_STATIC_RB_CONTACT
+	0,																		// DY_SC_TYPE_BLOCK_1D,
+};
+
+static SolveBlockPairMethod gVTableSolveWriteBackBlockPair[] PX_UNUSED_ATTRIBUTE = 
+{
+	0,
+	0,																		// DY_SC_TYPE_RB_CONTACT
+	0,																		// DY_SC_TYPE_RB_1D
+	0,																		// DY_SC_TYPE_EXT_CONTACT
+	0,																		// DY_SC_TYPE_EXT_1D
+	0,																		// DY_SC_TYPE_STATIC_CONTACT
+	0,																		// DY_SC_TYPE_NOFRICTION_RB_CONTACT
+	solveContactPreBlockPair_WriteBack,										// DY_SC_TYPE_BLOCK_RB_CONTACT
+	solveContactPreBlockPair_WriteBackStatic,								// DY_SC_TYPE_BLOCK_STATIC_RB_CONTACT
+	0,																		// DY_SC_TYPE_BLOCK_1D,
+};
+
+//Contacts are prepared for the full time step, only the joint rows re-evaluate their error between substeps
+static void skipSubstepBlock(const PxSolverConstraintDesc* PX_RESTRICT, const PxU32, SolverContext&)
+{
+}
+
+static SolveBlockMethod gVTableSubstepBlock[] PX_UNUSED_ATTRIBUTE = 
+{
+	0,
+	skipSubstepBlock,														// DY_SC_TYPE_RB_CONTACT
+	substep1DBlock,															// DY_SC_TYPE_RB_1D
+	skipSubstepBlock,														// DY_SC_TYPE_EXT_CONTACT
+	skipSubstepBlock,														// DY_SC_TYPE_EXT_1D
+	skipSubstepBlock,														// DY_SC_TYPE_STATIC_CONTACT
+	skipSubstepBlock,														// DY_SC_TYPE_NOFRICTION_RB_CONTACT
+	skipSubstepBlock,														// DY_SC_TYPE_BLOCK_RB_CONTACT
+	skipSubstepBlock,														// DY_SC_TYPE_BLOCK_STATIC_RB_CONTACT
+	substep1D4Block,														// DY_SC_TYPE_BLOCK_1D,
+};
+
+//With substepping, the motion velocity is the average velocity of the substeps so integrating it over the full
+//time step moves the bodies by the sum of the substep displacements.
+static PX_FORCE_INLINE void accumulateSubstepVelocity(Cm::SpatialVector& motionVel, const PxSolverBody& body, const bool firstSubstep)
+{
+	if(firstSubstep)
+	{
+		motionVel.linear = body.linearVelocity;
+		motionVel.angular = body.angularState;
+	}
+	else
+	{
+		motionVel.linear += body.linearVelocity;
+		motionVel.angular += body.angularState;
+	}
+}
+
+static PX_FORCE_INLINE void concludeSubstepVelocity(Cm::SpatialVector& motionVel, const PxSolverBody& body, const PxReal invNbSubsteps)
+{
+	motionVel.linear = (motionVel.linear + body.linearVelocity) * invNbSubsteps;
+	motionVel.angular = (motionVel.angular + body.angularState) * invNbSubsteps;
+}
+
+//The pair tables are only used when the CPU can run the 8-wide kernels; otherwise pairing would only add overhead.
+static PX_FORCE_INLINE SolveBlockPairMethod* getPairTable(SolveBlockPairMethod* table)
+{
+	return isAVXBlockSolverSupported() ? table : NULL;
+}
+
+//Solves all headers of one iteration in partition order. Pairing never crosses a partition boundary because only
+//constraints inside the same partition are guaranteed not to share a dynamic body.
+static void solveBlockPartitions(PxSolverConstraintDesc* PX_RESTRICT constraintList, const PxU32* headersPerPartition, const PxU32 nbPartitions,
+								 const PxI32 batchCount, SolverContext& cache, BatchIterator& iterator, SolveBlockMethod solveTable[],
+								 SolveBlockPairMethod pairTable[], const PxI32 iteration)
+{
+	PxI32 index = iteration * batchCount;
+	PxI32 nbSolved = 0;
+	if(pairTable)
+	{
+		for(PxU32 a = 0; a < nbPartitions; ++a)
+		{
+			const PxI32 nbHeaders = PxI32(headersPerPartition[a]);
+			SolveBlockParallel(constraintList, nbHeaders, index + nbSolved, batchCount, cache, iterator, solveTable, iteration, pairTable);
+			nbSolved += nbHeaders;
+		}
+	}
+	if(nbSolved < batchCount)
+		SolveBlockParallel(constraintList, batchCount - nbSolved, index + nbSolved, batchCount, cache, iterator, solveTable, iteration);
+}
+
+//With residual-based early termination, a position iteration may be skipped once the previous one changed no impulse by more than
+//the tolerance. The first friction iteration and the conclude iteration always run so friction and the bias removal are applied.
+static PX_FORCE_INLINE bool canSkipPositionIteration(const PxU32 a, const PxU32 positionIterations)
+{
+	const PxU32 firstFrictionIteration = positionIterations > 3 ? positionIterations - 3 : 0;
+	return a != 0 && a != firstFrictionIteration && a != positionIterations - 1;
+}
+
+//Residuals are non-negative, so their bit patterns order the same way as the floats and can be combined with an integer atomic max.
+static PX_FORCE_INLINE void publishResidual(PxI32* iterationResiduals, const PxI32 iteration, PxReal residual)
+{
+	Ps::atomicMax(&iterationResiduals[iteration], PxI32(PX_IR(residual)));
+}
+
+static PX_FORCE_INLINE bool hasConverged(const PxI32* iterationResiduals, const PxI32 iteration, const PxReal tolerance)
+{
+	PxI32 residual = static_cast<const volatile PxI32*>(iterationResiduals)[iteration];
+	return PX_FR(residual) < tolerance;
+}
+
 void SolverCoreRegisterArticulationFns()
 {
 	gVTableSolveBlock[DY_SC_TYPE_EXT_CONTACT] = solveExtContactBlock;
@@ -196,10 +340,12 @@ void SolverCoreGeneral::solveV_Blocks(SolverIslandParams& params) const
 
 	SolverContext cache;
 	cache.solverBodyArray			= params.bodyDataList;
+	cache.substepErrorScale			= params.substepErrorScale;
 	cache.mThresholdStream			= tempThresholdStream;
 	cache.mThresholdStreamLength	= TempThresholdStreamSize;
 	cache.mThresholdStreamIndex		= 0;
 	cache.writeBackIteration		= false;
+	cache.residual					= 0.0f;
 
 	PxI32 batchCount = PxI32(params.numConstraintHeaders);
 
@@ -233,6 +379,8 @@ void SolverCoreGeneral::solveV_Blocks(SolverIslandParams& params) const
 		for (PxU32 i = 0; i < articulationListSize; i++)
 			ArticulationPImpl::saveVelocity(articulationListStart[i]);
 
+		params.positionIterationsUsed = PxI32(positionIterations);
+		params.velocityIterationsUsed = PxI32(velocityIterations);
 		return;
 	}
 
@@ -240,25 +388,68 @@ void SolverCoreGeneral::solveV_Blocks(SolverIslandParams& params) const
 
 	PxSolverConstraintDesc* PX_RESTRICT constraintList = params.constraintList;
 
+	const PxU32* headersPerPartition = params.headersPerPartition;
+	const PxU32 nbPartitions = params.nbPartitions;
+
+	SolveBlockPairMethod* solvePairTable = getPairTable(gVTableSolveBlockPair);
+	SolveBlockPairMethod* concludePairTable = getPairTable(gVTableSolveConcludeBlockPair);
+	SolveBlockPairMethod* writeBackPairTable = getPairTable(gVTableSolveWriteBackBlockPair);
+
+	const PxReal residualTolerance = params.residualTolerance;
+	const bool earlyTermination = residualTolerance > 0.0f;
+	bool converged = false;
+	PxI32 positionIterationsUsed = 0;
+
+	//With substepping, every position iteration is a substep
+	const bool substepping = params.nbSubsteps > 1;
+	PX_ASSERT(!substepping || (params.nbSubsteps == positionIterations && !earlyTermination));
+
 	//0-(n-1) iterations
 	PxI32 normalIter = 0;
 
-	for (PxU32 iteration = positionIterations; iteration > 0; iteration--)	//decreasing positive numbers == position iters
+	for (PxU32 a = 0; a < positionIterations; ++a)
 	{
-		cache.doFriction = iteration<=3;
+		const PxU32 iteration = positionIterations - a;	//decreasing positive numbers == position iters
 
-		SolveBlockParallel(constraintList, batchCount, normalIter * batchCount, batchCount, 
-			cache, contactIterator, iteration == 1 ? gVTableSolveConcludeBlock : gVTableSolveBlock, normalIter);
+		if(!(converged && canSkipPositionIteration(a, positionIterations)))
+		{
+			cache.doFriction = substepping || iteration<=3;
+			cache.residual = 0.0f;
+
+			solveBlockPartitions(constraintList, headersPerPartition, nbPartitions, batchCount, cache, contactIterator, 
+				iteration == 1 ? gVTableSolveConcludeBlock : gVTableSolveBlock, iteration == 1 ? concludePairTable : solvePairTable, normalIter);
+
+			converged = earlyTermination && cache.residual < residualTolerance;
+			++positionIterationsUsed;
+		}
+
+		if(substepping && iteration > 1)
+		{
+			solveBlockPartitions(constraintList, headersPerPartition, nbPartitions, batchCount, cache, contactIterator, 
+				gVTableSubstepBlock, NULL, normalIter);
+
+			for (PxU32 baIdx = 0; baIdx < bodyListSize; baIdx++)
+				accumulateSubstepVelocity(motionVelocityArray[baIdx], bodyListStart[baIdx], a == 0);
+		}
 
 		++normalIter;
 	}
 
-	for (PxU32 baIdx = 0; baIdx < bodyListSize; baIdx++)
+	if(substepping)
+	{
+		const PxReal invNbSubsteps = 1.0f / PxReal(params.nbSubsteps);
+		for (PxU32 baIdx = 0; baIdx < bodyListSize; baIdx++)
+			concludeSubstepVelocity(motionVelocityArray[baIdx], bodyListStart[baIdx], invNbSubsteps);
+	}
+	else
 	{
-		const PxSolverBody& atom = bodyListStart[baIdx];
-		Cm::SpatialVector& motionVel = motionVelocityArray[baIdx];
-		motionVel.linear = atom.linearVelocity;
-		motionVel.angular = atom.angularState;
+		for (PxU32 baIdx = 0; baIdx < bodyListSize; baIdx++)
+		{
+			const PxSolverBody& atom = bodyListStart[baIdx];
+			Cm::SpatialVector& motionVel = motionVelocityArray[baIdx];
+			motionVel.linear = atom.linearVelocity;
+			motionVel.angular = atom.angularState;
+		}
 	}
 	
 
@@ -270,15 +461,29 @@ void SolverCoreGeneral::solveV_Blocks(SolverIslandParams& params) const
 
 	PxI32 iteration = 0;
 
+	//The first velocity iteration always runs; the residual of the conclude iteration still contains the position bias
+	converged = false;
+	PxI32 velocityIterationsUsed = 1;	//write back iteration
+
 	for(; iteration < velItersMinOne; ++iteration)
 	{	
+		if(!converged)
+		{
+			cache.residual = 0.0f;
+
+			solveBlockPartitions(constraintList, headersPerPartition, nbPartitions, batchCount, cache, contactIterator, 
+				gVTableSolveBlock, solvePairTable, normalIter);
 
-		SolveBlockParallel(constraintList, batchCount, normalIter * batchCount, batchCount, 
-			cache, contactIterator, gVTableSolveBlock, normalIter);
+			converged = earlyTermination && cache.residual < residualTolerance;
+			++velocityIterationsUsed;
+		}
 		++normalIter;
 
 	}
 
+	params.positionIterationsUsed = positionIterationsUsed;
+	params.velocityIterationsUsed = velocityIterationsUsed;
+
 	PxI32* outThresholdPairs = params.outThresholdPairs;
 	ThresholdStreamElement* PX_RESTRICT thresholdStream = params.thresholdStream;
 	PxU32 thresholdStreamLength = params.thresholdStreamLength;
@@ -290,8 +495,8 @@ void SolverCoreGeneral::solveV_Blocks(SolverIslandParams& params) const
 	for(; iteration < PxI32(velocityIterations); ++iteration)
 	{
 
-		SolveBlockParallel(constraintList, batchCount, normalIter * batchCount, batchCount, 
-			cache, contactIterator, gVTableSolveWriteBackBlock, normalIter);
+		solveBlockPartitions(constraintList, headersPerPartition, nbPartitions, batchCount, cache, contactIterator, 
+			gVTableSolveWriteBackBlock, writeBackPairTable, normalIter);
 		++normalIter;
 
 	}	
@@ -312,14 +517,11 @@ void SolverCoreGeneral::solveV_Blocks(SolverIslandParams& params) const
 PxI32 SolverCoreGeneral::solveVParallelAndWriteBack
 (SolverIslandParams& params) const
 {
-#if PX_PROFILE_SOLVE_STALLS
-	PxU64 startTime = readTimer();
-
-	PxU64 stallCount = 0;
-#endif
+	SolverBarrier barrier(params.barrierStats);
 
 	SolverContext cache;
 	cache.solverBodyArray = params.bodyDataList;
+	cache.substepErrorScale = params.substepErrorScale;
 	const PxU32 batchSize = params.batchSize;
 
 	const PxI32 UnrollCount = PxI32(batchSize);
@@ -337,6 +539,7 @@ PxI32 SolverCoreGeneral::solveVParallelAndWriteBack
 	cache.mThresholdStreamLength = TempThresholdStreamSize;
 	cache.mThresholdStreamIndex = 0;
 	cache.writeBackIteration = false;
+	cache.residual = 0.0f;
 
 	const PxI32 positionIterations = PxI32(params.positionIterations);
 	const PxI32 velocityIterations = PxI32(params.velocityIterations);
@@ -350,6 +553,9 @@ PxI32 SolverCoreGeneral::solveVParallelAndWriteBack
 
 	PxU32* headersPerPartition = params.headersPerPartition;
 
+	PxSolverBody* PX_RESTRICT bodyListStart = params.bodyListStart;
+	Cm::SpatialVector* PX_RESTRICT motionVelocityArray = params.motionVelocityArray;
+
 	PX_UNUSED(velocityIterations);
 
 	PX_ASSERT(velocityIterations >= 1);
@@ -360,6 +566,24 @@ PxI32 SolverCoreGeneral::solveVParallelAndWriteBack
 	
 	BatchIterator contactIter(params.constraintBatchHeaders, params.numConstraintHeaders);
 
+	//Early termination: every thread reads the residual of the previous iteration once it has completed (i.e. after the
+	//first partition barrier) and so makes the same decision. Skipped iterations still hand out and retire their indices
+	//to keep the counters consistent, they just don't solve anything.
+	const PxReal residualTolerance = params.residualTolerance;
+	const bool earlyTermination = residualTolerance > 0.0f;
+	PxI32* iterationResiduals = params.iterationResiduals;
+	PxI32 positionIterationsUsed = 0;
+
+	//Substepping: after each substep but the last, the joint errors are re-evaluated in an extra pass over the headers
+	//and the substep's velocities are accumulated for integration. The bodies are handed out with their own counters.
+	const bool substepping = params.nbSubsteps > 1;
+	PX_ASSERT(!substepping || (PxI32(params.nbSubsteps) == positionIterations && !earlyTermination));
+	PxI32* substepBodyIndex = &params.substepBodyIndex;
+	PxI32* substepBodyIndex2 = &params.substepBodyIndex2;
+	PxI32 endSubstepBodyCount = SaveUnrollCount;
+	PxI32 substepBodyIndex3 = substepping ? physx::shdfnd::atomicAdd(substepBodyIndex, SaveUnrollCount) - SaveUnrollCount : 0;
+	PxI32 maxSubstepBodyIndex = 0;
+
 	PxI32 maxNormalIndex = 0;
 	PxI32 normalIteration = 0;
 	PxU32 a = 0;
@@ -367,12 +591,18 @@ PxI32 SolverCoreGeneral::solveVParallelAndWriteBack
 	for(PxU32 i = 0; i < 2; ++i)
 	{
 		SolveBlockMethod* solveTable = i == 0 ? gVTableSolveBlock : gVTableSolveConcludeBlock;
+		SolveBlockPairMethod* pairTable = getPairTable(i == 0 ? gVTableSolveBlockPair : gVTableSolveConcludeBlockPair);
 		for(; a < positionIterations - 1 + i; ++a)
 		{
-			cache.doFriction = (positionIterations - a) <= 3;
+			cache.doFriction = substepping || (positionIterations - a) <= 3;
+			cache.residual = 0.0f;
+			bool skip = false;
 			for(PxU32 b = 0; b < nbPartitions; ++b)
 			{
-				WAIT_FOR_PROGRESS(constraintIndex2, targetConstraintIndex);
+				barrier.wait(constraintIndex2, targetConstraintIndex, b);
+
+				if(b == 0)
+					skip = earlyTermination && canSkipPositionIteration(a, PxU32(positionIterations)) && hasConverged(iterationResiduals, normalIteration - 1, residualTolerance);
 
 				maxNormalIndex += headersPerPartition[b];
 				
@@ -380,8 +610,11 @@ PxI32 SolverCoreGeneral::solveVParallelAndWriteBack
 				while(index < maxNormalIndex)
 				{
 					const PxI32 remainder = PxMin(maxNormalIndex - index, endIndexCount);
-					SolveBlockParallel(constraintList, remainder, index, batchCount, cache, contactIter, solveTable, 
-						normalIteration);
+					if(!skip)
+					{
+						SolveBlockParallel(constraintList, remainder, index, batchCount, cache, contactIter, solveTable, 
+							normalIteration, pairTable);
+					}
 					index += remainder;
 					endIndexCount -= remainder;
 					nbSolved += remainder;
@@ -393,29 +626,92 @@ PxI32 SolverCoreGeneral::solveVParallelAndWriteBack
 				}
 				if(nbSolved)
 				{
+					if(earlyTermination && !skip)
+						publishResidual(iterationResiduals, normalIteration, cache.residual);
 					Ps::memoryBarrier();
 					physx::shdfnd::atomicAdd(constraintIndex2, nbSolved);
 				}
 				targetConstraintIndex += headersPerPartition[b]; //Increment target constraint index by batch count
 			}
+			if(!skip)
+				++positionIterationsUsed;
 			++normalIteration;
+
+			if(substepping && i == 0)
+			{
+				//All substep solves have to complete before the errors and motion can be evaluated
+				barrier.wait(constraintIndex2, targetConstraintIndex, SolverBarrier::eVELOCITY_SAVE);
+
+				maxNormalIndex += batchCount;
+
+				PxI32 nbSolved = 0;
+				while(index < maxNormalIndex)
+				{
+					const PxI32 remainder = PxMin(maxNormalIndex - index, endIndexCount);
+					SolveBlockParallel(constraintList, remainder, index, batchCount, cache, contactIter, gVTableSubstepBlock, 
+						normalIteration);
+					index += remainder;
+					endIndexCount -= remainder;
+					nbSolved += remainder;
+					if(endIndexCount == 0)
+					{
+						endIndexCount = UnrollCount;
+						index = physx::shdfnd::atomicAdd(constraintIndex, UnrollCount) - UnrollCount;
+					}
+				}
+				if(nbSolved)
+				{
+					Ps::memoryBarrier();
+					physx::shdfnd::atomicAdd(constraintIndex2, nbSolved);
+				}
+				targetConstraintIndex += batchCount;
+				++normalIteration;
+
+				maxSubstepBodyIndex += bodyListSize;
+				const PxI32 substepStartIndex = maxSubstepBodyIndex - bodyListSize;
+
+				PxI32 nbAccumulated = 0;
+				while(substepBodyIndex3 < maxSubstepBodyIndex)
+				{
+					const PxI32 remainder = PxMin(maxSubstepBodyIndex - substepBodyIndex3, endSubstepBodyCount);
+					for(PxI32 b = substepBodyIndex3 - substepStartIndex, end = b + remainder; b < end; ++b)
+						accumulateSubstepVelocity(motionVelocityArray[b], bodyListStart[b], a == 0);
+
+					substepBodyIndex3 += remainder;
+					endSubstepBodyCount -= remainder;
+					nbAccumulated += remainder;
+					if(endSubstepBodyCount == 0)
+					{
+						endSubstepBodyCount = SaveUnrollCount;
+						substepBodyIndex3 = physx::shdfnd::atomicAdd(substepBodyIndex, SaveUnrollCount) - SaveUnrollCount;
+					}
+				}
+				if(nbAccumulated)
+				{
+					Ps::memoryBarrier();
+					physx::shdfnd::atomicAdd(substepBodyIndex2, nbAccumulated);
+				}
+
+				//The next substep changes the velocities again
+				barrier.wait(substepBodyIndex2, maxSubstepBodyIndex, SolverBarrier::eVELOCITY_SAVE);
+			}
 		}
 	}
+	Ps::atomicMax(&params.positionIterationsUsed, positionIterationsUsed);
 
 	PxI32* bodyListIndex = &params.bodyListIndex;
 	PxI32* bodyListIndex2 = &params.bodyListIndex2;
 
 	ArticulationSolverDesc* PX_RESTRICT articulationListStart = params.articulationListStart;
 
-	PxSolverBody* PX_RESTRICT bodyListStart = params.bodyListStart;
-	Cm::SpatialVector* PX_RESTRICT motionVelocityArray = params.motionVelocityArray;
 
+	const PxReal invNbSubsteps = 1.0f / PxReal(params.nbSubsteps);
 
 	//Save velocity - articulated
 	PxI32 endIndexCount2 = SaveUnrollCount;
 	PxI32 index2 = physx::shdfnd::atomicAdd(bodyListIndex, SaveUnrollCount) - SaveUnrollCount;
 	{
-		WAIT_FOR_PROGRESS(constraintIndex2, targetConstraintIndex);
+		barrier.wait(constraintIndex2, targetConstraintIndex, SolverBarrier::eVELOCITY_SAVE);
 		PxI32 nbConcluded = 0;
 		while(index2 < articulationListSize)
 		{
@@ -448,8 +744,15 @@ PxI32 SolverCoreGeneral::solveVParallelAndWriteBack
 				Ps::prefetchLine(&motionVelocityArray[index2 + 8]);
 				PxSolverBody& body = bodyListStart[index2];
 				Cm::SpatialVector& motionVel = motionVelocityArray[index2];
-				motionVel.linear = body.linearVelocity;
-				motionVel.angular = body.angularState;
+				if(substepping)
+				{
+					concludeSubstepVelocity(motionVel, body, invNbSubsteps);
+				}
+				else
+				{
+					motionVel.linear = body.linearVelocity;
+					motionVel.angular = body.angularState;
+				}
 				PX_ASSERT(motionVel.linear.isFinite());
 				PX_ASSERT(motionVel.angular.isFinite());
 			}
@@ -472,14 +775,22 @@ PxI32 SolverCoreGeneral::solveVParallelAndWriteBack
 	}
 
 
-	WAIT_FOR_PROGRESS(bodyListIndex2, (bodyListSize + articulationListSize));
+	barrier.wait(bodyListIndex2, (bodyListSize + articulationListSize), SolverBarrier::eVELOCITY_SAVE);
+
+	PxI32 velocityIterationsUsed = 1;	//write back iteration
 
 	a = 1;
 	for(; a < params.velocityIterations; ++a)
 	{
+		cache.residual = 0.0f;
+		bool skip = false;
 		for(PxU32 b = 0; b < nbPartitions; ++b)
 		{
-			WAIT_FOR_PROGRESS(constraintIndex2, targetConstraintIndex);
+			barrier.wait(constraintIndex2, targetConstraintIndex, b);
+
+			//The first velocity iteration always runs; the residual of the conclude iteration still contains the position bias
+			if(b == 0)
+				skip = earlyTermination && a > 1 && hasConverged(iterationResiduals, normalIteration - 1, residualTolerance);
 
 			maxNormalIndex += headersPerPartition[b];
 			
@@ -487,8 +798,11 @@ PxI32 SolverCoreGeneral::solveVParallelAndWriteBack
 			while(index < maxNormalIndex)
 			{
 				const PxI32 remainder = PxMin(maxNormalIndex - index, endIndexCount);
-				SolveBlockParallel(constraintList, remainder, index, batchCount, cache, contactIter, gVTableSolveBlock, 
-					normalIteration);
+				if(!skip)
+				{
+					SolveBlockParallel(constraintList, remainder, index, batchCount, cache, contactIter, gVTableSolveBlock, 
+						normalIteration, getPairTable(gVTableSolveBlockPair));
+				}
 				index += remainder;
 				endIndexCount -= remainder;
 				nbSolved += remainder;
@@ -500,13 +814,18 @@ PxI32 SolverCoreGeneral::solveVParallelAndWriteBack
 			}
 			if(nbSolved)
 			{
+				if(earlyTermination && !skip)
+					publishResidual(iterationResiduals, normalIteration, cache.residual);
 				Ps::memoryBarrier();
 				physx::shdfnd::atomicAdd(constraintIndex2, nbSolved);
 			}
 			targetConstraintIndex += headersPerPartition[b]; //Increment target constraint index by batch count
 		}
+		if(!skip)
+			++velocityIterationsUsed;
 		++normalIteration;
 	}
+	Ps::atomicMax(&params.velocityIterationsUsed, velocityIterationsUsed);
 
 	ThresholdStreamElement* PX_RESTRICT thresholdStream = params.thresholdStream;
 	PxU32 thresholdStreamLength = params.thresholdStreamLength;
@@ -521,7 +840,7 @@ PxI32 SolverCoreGeneral::solveVParallelAndWriteBack
 	{
 		for(PxU32 b = 0; b < nbPartitions; ++b)
 		{
-			WAIT_FOR_PROGRESS(constraintIndex2, targetConstraintIndex);
+			barrier.wait(constraintIndex2, targetConstraintIndex, b);
 
 			maxNormalIndex += headersPerPartition[b];
 			
@@ -531,7 +850,7 @@ PxI32 SolverCoreGeneral::solveVParallelAndWriteBack
 				const PxI32 remainder = PxMin(maxNormalIndex - index, endIndexCount);
 
 				SolveBlockParallel(constraintList, remainder, index, batchCount, cache, contactIter, gVTableSolveWriteBackBlock, 
-					normalIteration);
+					normalIteration, getPairTable(gVTableSolveWriteBackBlockPair));
 
 				index += remainder;
 				endIndexCount -= remainder;
@@ -565,21 +884,7 @@ PxI32 SolverCoreGeneral::solveVParallelAndWriteBack
 
 	}
 
-#if PX_PROFILE_SOLVE_STALLS
-
-	
-	PxU64 endTime = readTimer();
-	PxReal totalTime = (PxReal)(endTime - startTime);
-	PxReal stallTime = (PxReal)stallCount;
-	PxReal stallRatio = stallTime/totalTime;
-	if(0)//stallRatio > 0.2f)
-	{
-		LARGE_INTEGER frequency;
-		QueryPerformanceFrequency( &frequency );
-		printf("Warning -- percentage time stalled = %f; stalled for %f seconds; total Time took %f seconds\n", 
-			stallRatio * 100.f, stallTime/(PxReal)frequency.QuadPart, totalTime/(PxReal)frequency.QuadPart);
-	}
-#endif
+	barrier.flush();
 
 	return normalIteration * batchCount;
 
@@ -88,10 +88,13 @@ private:
 };
 
 
+//pairTable is optional. When it is provided, two consecutive headers of the same type with a pair method are solved
+//together. The caller must ensure that the range only covers headers of a single partition.
 inline void SolveBlockParallel	(PxSolverConstraintDesc* PX_RESTRICT constraintList, const PxI32 batchCount, const PxI32 index,  
 						 const PxI32 headerCount, SolverContext& cache, BatchIterator& iterator,
 						 SolveBlockMethod solveTable[],
-						 const PxI32 iteration
+						 const PxI32 iteration,
+						 SolveBlockPairMethod pairTable[] = NULL
 						)
 {
 	const PxI32 indA = index - (iteration * headerCount);
@@ -114,6 +117,23 @@ inline void SolveBlockParallel	(PxSolverConstraintDesc* PX_RESTRICT constraintLi
 			Ps::prefetchLine(block[b].bodyB);
 		}
 
+		if(pairTable && (i + 1) < endIndex && pairTable[header.mConstraintType] && headers[i+1].mConstraintType == header.mConstraintType)
+		{
+			PxSolverConstraintDesc* PX_RESTRICT block1 = &constraintList[headers[i+1].mStartIndex];
+
+			Ps::prefetch(block1[0].constraint, 384);
+
+			for(PxI32 b = 0; b < 4; ++b)
+			{
+				Ps::prefetchLine(block1[b].bodyA);
+				Ps::prefetchLine(block1[b].bodyB);
+			}
+
+			pairTable[header.mConstraintType](block, block1, cache);
+			++i;
+			continue;
+		}
+
 		//OK. We have a number of constraints to run...
 		solveTable[header.mConstraintType](block, PxU32(numToGrab), cache);
 	}
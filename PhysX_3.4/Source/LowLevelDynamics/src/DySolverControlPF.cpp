@@ -222,6 +222,7 @@ void SolverCoreGeneralPF::solveV_Blocks(SolverIslandParams& params) const
 	cache.mThresholdStreamLength	= TempThresholdStreamSize;
 	cache.mThresholdStreamIndex		= 0;
 	cache.writeBackIteration = false;
+	cache.residual = 0.0f;
 
 	PxI32 batchCount = PxI32(params.numConstraintHeaders);
 
@@ -242,6 +243,10 @@ void SolverCoreGeneralPF::solveV_Blocks(SolverIslandParams& params) const
 	PX_ASSERT(velocityIterations >= 1);
 	PX_ASSERT(positionIterations >= 1);
 
+	//Residual-based early termination is not supported by this solver, it always runs all iterations
+	params.positionIterationsUsed = PxI32(positionIterations);
+	params.velocityIterationsUsed = PxI32(velocityIterations);
+
 	if(numConstraintHeaders == 0)
 	{
 		for (PxU32 baIdx = 0; baIdx < bodyListSize; baIdx++)
@@ -364,8 +369,11 @@ void SolverCoreGeneralPF::solveV_Blocks(SolverIslandParams& params) const
 
 PxI32 SolverCoreGeneralPF::solveVParallelAndWriteBack(SolverIslandParams& params) const
 {
+	SolverBarrier barrier(params.barrierStats);
+
 	SolverContext cache;
 	cache.solverBodyArray = params.bodyDataList;
+	cache.residual = 0.0f;
 
 	const PxI32 UnrollCount = PxI32(params.batchSize);
 	const PxI32 SaveUnrollCount = 64;
@@ -389,6 +397,10 @@ PxI32 SolverCoreGeneralPF::solveVParallelAndWriteBack(SolverIslandParams& params
 	PX_ASSERT(velocityIterations >= 1);
 	PX_ASSERT(positionIterations >= 1);
 
+	//Residual-based early termination is not supported by this solver, it always runs all iterations
+	Ps::atomicMax(&params.positionIterationsUsed, positionIterations);
+	Ps::atomicMax(&params.velocityIterationsUsed, PxI32(velocityIterations));
+
 	PxI32* constraintIndex = &params.constraintIndex;
 	PxI32* constraintIndex2 = &params.constraintIndex2;
 	PxI32* frictionConstraintIndex = &params.frictionConstraintIndex;
@@ -426,7 +438,7 @@ PxI32 SolverCoreGeneralPF::solveVParallelAndWriteBack(SolverIslandParams& params
 		{
 			for(PxU32 b = 0; b < nbPartitions; ++b)
 			{
-				WAIT_FOR_PROGRESS(constraintIndex2, maxProgress);
+				barrier.wait(constraintIndex2, maxProgress, b);
 				maxNormalIndex += headersPerPartition[b];
 				maxProgress += headersPerPartition[b];
 				PxI32 nbSolved = 0;
@@ -464,7 +476,7 @@ PxI32 SolverCoreGeneralPF::solveVParallelAndWriteBack(SolverIslandParams& params
 		{
 			for(PxU32 b = 0; b < nbFrictionPartitions; ++b)
 			{
-				WAIT_FOR_PROGRESS(constraintIndex2, maxProgress);
+				barrier.waitFriction(constraintIndex2, maxProgress, b);
 				maxProgress += frictionHeadersPerPartition[b];
 				maxFrictionIndex += frictionHeadersPerPartition[b];
 				PxI32 nbSolved = 0;
@@ -494,7 +506,7 @@ PxI32 SolverCoreGeneralPF::solveVParallelAndWriteBack(SolverIslandParams& params
 
 	}
 
-	WAIT_FOR_PROGRESS(constraintIndex2, maxProgress);
+	barrier.wait(constraintIndex2, maxProgress, SolverBarrier::eVELOCITY_SAVE);
 
 	
 	PxI32* bodyListIndex = &params.bodyListIndex;
@@ -567,14 +579,14 @@ PxI32 SolverCoreGeneralPF::solveVParallelAndWriteBack(SolverIslandParams& params
 	}
 
 
-	WAIT_FOR_PROGRESS(bodyListIndex2, (bodyListSize + articulationListSize));
+	barrier.wait(bodyListIndex2, (bodyListSize + articulationListSize), SolverBarrier::eVELOCITY_SAVE);
 
 	a = 0;
 	for(; a < velocityIterations-1; ++a)
 	{
 		for(PxU32 b = 0; b < nbPartitions; ++b)
 		{
-			WAIT_FOR_PROGRESS(constraintIndex2, maxProgress);
+			barrier.wait(constraintIndex2, maxProgress, b);
 			maxNormalIndex += headersPerPartition[b];
 			maxProgress += headersPerPartition[b];
 			
@@ -602,7 +614,7 @@ PxI32 SolverCoreGeneralPF::solveVParallelAndWriteBack(SolverIslandParams& params
 
 		for(PxU32 b = 0; b < nbFrictionPartitions; ++b)
 		{
-			WAIT_FOR_PROGRESS(constraintIndex2, maxProgress);
+			barrier.waitFriction(constraintIndex2, maxProgress, b);
 			maxFrictionIndex += frictionHeadersPerPartition[b];
 			maxProgress += frictionHeadersPerPartition[b];
 
@@ -643,7 +655,7 @@ PxI32 SolverCoreGeneralPF::solveVParallelAndWriteBack(SolverIslandParams& params
 	{
 		for(PxU32 b = 0; b < nbPartitions; ++b)
 		{
-			WAIT_FOR_PROGRESS(constraintIndex2, maxProgress);
+			barrier.wait(constraintIndex2, maxProgress, b);
 			maxNormalIndex += headersPerPartition[b];
 			maxProgress += headersPerPartition[b];
 			
@@ -679,7 +691,7 @@ PxI32 SolverCoreGeneralPF::solveVParallelAndWriteBack(SolverIslandParams& params
 
 		for(PxU32 b = 0; b < nbFrictionPartitions; ++b)
 		{
-			WAIT_FOR_PROGRESS(constraintIndex2, maxProgress);
+			barrier.waitFriction(constraintIndex2, maxProgress, b);
 			maxFrictionIndex += frictionHeadersPerPartition[b];
 			maxProgress += frictionHeadersPerPartition[b];
 
@@ -721,6 +733,8 @@ PxI32 SolverCoreGeneralPF::solveVParallelAndWriteBack(SolverIslandParams& params
 		++frictionIteration;
 	}
 
+	barrier.flush();
+
 	return normalIteration * batchCount + frictionIteration * frictionBatchCount;
 }
 
@@ -34,6 +34,10 @@
 #include "PxvConfig.h"
 #include "PsArray.h"
 #include "PsThread.h"
+#include "PsTime.h"
+#include "PsAtomic.h"
+#include "foundation/PxMemory.h"
+#include "PxSimulationStatistics.h"
 
 
 namespace physx
@@ -57,100 +61,183 @@ typedef void (*WriteBackMethod)(const PxSolverConstraintDesc& desc, SolverContex
 typedef void (*SolveMethod)(const PxSolverConstraintDesc& desc, SolverContext& cache);
 typedef void (*SolveBlockMethod)(const PxSolverConstraintDesc* desc, const PxU32 constraintCount, SolverContext& cache);
 typedef void (*SolveWriteBackBlockMethod)(const PxSolverConstraintDesc* desc, const PxU32 constraintCount, SolverContext& cache);
+typedef void (*SolveBlockPairMethod)(const PxSolverConstraintDesc* descA, const PxSolverConstraintDesc* descB, SolverContext& cache);
 typedef void (*WriteBackBlockMethod)(const PxSolverConstraintDesc* desc, const PxU32 constraintCount, SolverContext& cache);
 
-#define PX_PROFILE_SOLVE_STALLS 0
-#if PX_PROFILE_SOLVE_STALLS
-#if PX_WINDOWS
-#include <windows.h>
+/**
+\brief Number of polls of a solver progress counter between two checks of whether the counter is still advancing.
+*/
+#define SOLVER_BARRIER_SPIN_COUNT 2048
 
+/**
+\brief Number of polls after a yield before the waiting thread checks again whether it should yield.
+*/
+#define SOLVER_BARRIER_SPIN_COUNT_AFTER_YIELD 256
 
-PX_FORCE_INLINE PxU64 readTimer()
-{
-	//return __rdtsc();
+/**
+\brief Waits until *pGlobalIndex reaches targetIndex.
+
+Spinning is only worthwhile while the other solver threads are making progress. The counter is therefore polled in
+windows of SOLVER_BARRIER_SPIN_COUNT reads: as long as it advances from one window to the next the thread keeps
+spinning. If it did not move for a whole window, the threads holding the outstanding work are most likely not running
+(e.g. when several scenes oversubscribe the machine), so the waiting thread yields its core to them instead of burning it.
 
-	LARGE_INTEGER i;
-	QueryPerformanceCounter(&i);
-	return i.QuadPart;
+\return The number of times the thread yielded.
+*/
+PX_INLINE PxU32 WaitForProgressCount(volatile PxI32* pGlobalIndex, const PxI32 targetIndex)
+{
+	PxU32 nbYields = 0;
+	PxI32 windowStart = *pGlobalIndex;
+	PxU32 count = SOLVER_BARRIER_SPIN_COUNT;
+	PxI32 progress;
+	while((progress = *pGlobalIndex) < targetIndex)
+	{
+		if(--count == 0)
+		{
+			if(progress == windowStart)
+			{
+				Ps::Thread::yield();
+				nbYields++;
+				count = SOLVER_BARRIER_SPIN_COUNT_AFTER_YIELD;
+			}
+			else
+			{
+				count = SOLVER_BARRIER_SPIN_COUNT;
+			}
+			windowStart = progress;
+		}
+	}
+	return nbYields;
 }
 
-#endif
-#endif
+#define WAIT_FOR_PROGRESS_NO_TIMER(pGlobalIndex, targetIndex) if(*pGlobalIndex < targetIndex) WaitForProgressCount(pGlobalIndex, targetIndex)
+
+/**
+\brief Time spent by the parallel solver threads at the barriers between constraint partitions, summed over all threads and islands of a simulation step.
+*/
+struct SolverBarrierStats
+{
+	enum
+	{
+		eMAX_PARTITIONS = PxSimulationStatistics::eMAX_SOLVER_BARRIER_PARTITIONS	//!< Waits on later partitions are accumulated in the last entry
+	};
 
+	void clear() { PxMemZero(this, sizeof(SolverBarrierStats)); }
 
-#define YIELD_THREADS 1
+	PxI32 partitionWaitTime[eMAX_PARTITIONS];			//!< In microseconds
+	PxI32 frictionPartitionWaitTime[eMAX_PARTITIONS];	//!< In microseconds, friction partitions of the 1D/2D friction models
+	PxI32 velocitySaveWaitTime;							//!< In microseconds
+	PxI32 nbWaits;
+	PxI32 nbYields;
+};
 
-#if YIELD_THREADS
+/**
+\brief Number of solver iterations the islands of a simulation step actually used.
+*/
+struct SolverIterationStats
+{
+	void clear() { PxMemZero(this, sizeof(SolverIterationStats)); }
+
+	PxI32 nbIslands;
+	PxI32 nbIslandsTerminatedEarly;
+	PxI32 positionIterations;
+	PxI32 velocityIterations;
+	PxI32 maxPositionIterations;
+	PxI32 maxVelocityIterations;
+};
+
+/**
+\brief Constraint partitions and batches of the islands of a simulation step.
+*/
+struct SolverPartitionStats
+{
+	void clear() { PxMemZero(this, sizeof(SolverPartitionStats)); }
 
-#define ATTEMPTS_BEFORE_BACKOFF 30000
-#define ATTEMPTS_BEFORE_RETEST 10000
+	PxI32 nbPartitions;
+	PxI32 maxPartitions;
+	PxI32 nbMergedPartitions;
+	PxI32 nbBatches;
+	PxI32 nbBatchedConstraints;
+};
 
-#endif
+/**
+\brief Per-thread front end to the solver barriers.
 
-PX_INLINE void WaitForProgressCount(volatile PxI32* pGlobalIndex, const PxI32 targetIndex)
+Waits are only timed when the barrier is not already satisfied. The results are gathered locally and added to the shared
+SolverBarrierStats once in flush(), so the shared counters are not contended while the solver runs.
+*/
+class SolverBarrier
 {
-#if YIELD_THREADS
-	if(*pGlobalIndex < targetIndex)
+public:
+	enum
 	{
-		bool satisfied = false;
-		PxU32 count = ATTEMPTS_BEFORE_BACKOFF;
-		do
-		{
-			satisfied = true;
-			while(*pGlobalIndex < targetIndex)
-			{
-				if(--count == 0)
-				{
-					satisfied = false;
-					break;
-				}
-			}
-			if(!satisfied)
-				Ps::Thread::yield();
-			count = ATTEMPTS_BEFORE_RETEST;
-		}
-		while(!satisfied);
+		eVELOCITY_SAVE = 0xffffffff	//!< Passed instead of a partition index for the barriers around saving the body velocities
+	};
+
+	PX_FORCE_INLINE SolverBarrier(SolverBarrierStats* stats) : mStats(stats), mNbWaits(0), mNbYields(0)
+	{
+		PxMemZero(mWaitTicks, sizeof(mWaitTicks));
 	}
-#else
-	while(*pGlobalIndex < targetIndex);
-#endif
-}
 
+	PX_FORCE_INLINE void wait(volatile PxI32* pGlobalIndex, const PxI32 targetIndex, const PxU32 partition)
+	{
+		if(*pGlobalIndex < targetIndex)
+			waitInternal(pGlobalIndex, targetIndex, partition == PxU32(eVELOCITY_SAVE) ? PxU32(eVELOCITY_SAVE_SLOT) : 
+				PxMin(partition, PxU32(SolverBarrierStats::eMAX_PARTITIONS - 1)));
+	}
 
-#if PX_PROFILE_SOLVE_STALLS
-PX_INLINE void WaitForProgressCount(volatile PxI32* pGlobalIndex, const PxI32 targetIndex, PxU64& stallTime)
-{
-	if(*pGlobalIndex < targetIndex)
+	//Same as wait() for the barriers in front of the friction partitions of the 1D/2D friction models
+	PX_FORCE_INLINE void waitFriction(volatile PxI32* pGlobalIndex, const PxI32 targetIndex, const PxU32 partition)
+	{
+		if(*pGlobalIndex < targetIndex)
+			waitInternal(pGlobalIndex, targetIndex, eFRICTION_SLOTS + PxMin(partition, PxU32(SolverBarrierStats::eMAX_PARTITIONS - 1)));
+	}
+
+	void flush()
 	{
-		bool satisfied = false;
-		PxU32 count = ATTEMPTS_BEFORE_BACKOFF;
-		do
+		if(mStats == NULL || mNbWaits == 0)
+			return;
+
+		const Ps::CounterFrequencyToTensOfNanos& freq = Ps::Time::getBootCounterFrequency();
+		for(PxU32 a = 0; a < SolverBarrierStats::eMAX_PARTITIONS; ++a)
 		{
-			satisfied = true;
-			PxU64 startTime = readTimer();
-			while(*pGlobalIndex < targetIndex)
-			{
-				if(--count == 0)
-				{
-					satisfied = false;
-					break;
-				}
-			}
-			PxU64 endTime = readTimer();
-			stallTime += (endTime - startTime);
-			if(!satisfied)
-				Ps::Thread::yield();
-			count = ATTEMPTS_BEFORE_BACKOFF;
+			if(mWaitTicks[a])
+				Ps::atomicAdd(&mStats->partitionWaitTime[a], toMicroSeconds(freq, mWaitTicks[a]));
+			if(mWaitTicks[eFRICTION_SLOTS + a])
+				Ps::atomicAdd(&mStats->frictionPartitionWaitTime[a], toMicroSeconds(freq, mWaitTicks[eFRICTION_SLOTS + a]));
 		}
-		while(!satisfied);
+		if(mWaitTicks[eVELOCITY_SAVE_SLOT])
+			Ps::atomicAdd(&mStats->velocitySaveWaitTime, toMicroSeconds(freq, mWaitTicks[eVELOCITY_SAVE_SLOT]));
+		Ps::atomicAdd(&mStats->nbWaits, PxI32(mNbWaits));
+		Ps::atomicAdd(&mStats->nbYields, PxI32(mNbYields));
 	}
-}
 
-#define WAIT_FOR_PROGRESS(pGlobalIndex, targetIndex) if(*pGlobalIndex < targetIndex) WaitForProgressCount(pGlobalIndex, targetIndex, stallCount)
-#else
-#define WAIT_FOR_PROGRESS(pGlobalIndex, targetIndex) if(*pGlobalIndex < targetIndex) WaitForProgressCount(pGlobalIndex, targetIndex)
-#endif
-#define WAIT_FOR_PROGRESS_NO_TIMER(pGlobalIndex, targetIndex) if(*pGlobalIndex < targetIndex) WaitForProgressCount(pGlobalIndex, targetIndex)
+private:
+	enum
+	{
+		eFRICTION_SLOTS = SolverBarrierStats::eMAX_PARTITIONS,				//!< First slot of the friction partitions
+		eVELOCITY_SAVE_SLOT = 2 * SolverBarrierStats::eMAX_PARTITIONS,
+		eNB_SLOTS
+	};
+
+	PX_NOINLINE void waitInternal(volatile PxI32* pGlobalIndex, const PxI32 targetIndex, const PxU32 slot)
+	{
+		const PxU64 startTime = Ps::Time::getCurrentCounterValue();
+		mNbYields += WaitForProgressCount(pGlobalIndex, targetIndex);
+		mWaitTicks[slot] += Ps::Time::getCurrentCounterValue() - startTime;
+		mNbWaits++;
+	}
+
+	static PX_FORCE_INLINE PxI32 toMicroSeconds(const Ps::CounterFrequencyToTensOfNanos& freq, const PxU64 ticks)
+	{
+		return PxI32(freq.toTensOfNanos(ticks) / 100);
+	}
+
+	SolverBarrierStats*	mStats;
+	PxU64				mWaitTicks[eNB_SLOTS];
+	PxU32				mNbWaits;
+	PxU32				mNbYields;
+};
 
 
 struct SolverIslandParams
@@ -199,6 +286,21 @@ struct SolverIslandParams
 	PxU32 thresholdStreamLength;
 
 	PxI32* outThresholdPairs;
+
+	//Shared barrier wait statistics, may be NULL
+	SolverBarrierStats* barrierStats;
+
+	//Residual-based early termination, disabled if residualTolerance is 0
+	PxReal residualTolerance;
+	PxI32* iterationResiduals;			//largest impulse change of each iteration (as float bits), one entry per position and velocity iteration
+	PxI32 positionIterationsUsed;
+	PxI32 velocityIterationsUsed;
+
+	//Substepping, 1 if disabled. Otherwise equal to positionIterations, each position iteration solves one substep
+	PxU32 nbSubsteps;
+	PxReal substepErrorScale;	//substep duration times the joints' bias inverse time step, 1 unless the bias was clamped
+	PxI32 substepBodyIndex;
+	PxI32 substepBodyIndex2;
 };
 
 
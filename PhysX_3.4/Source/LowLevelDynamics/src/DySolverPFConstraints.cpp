@@ -51,7 +51,7 @@ namespace physx
 namespace Dy
 {
 
-void solveContactCoulomb(const PxSolverConstraintDesc& desc, SolverContext& /*cache*/)
+void solveContactCoulomb(const PxSolverConstraintDesc& desc, SolverContext& cache)
 {
 	PxSolverBody& b0 = *desc.bodyA;
 	PxSolverBody& b1 = *desc.bodyB;
@@ -61,6 +61,8 @@ void solveContactCoulomb(const PxSolverConstraintDesc& desc, SolverContext& /*ca
 	Vec3V angState0 = V3LoadA(b0.angularState);
 	Vec3V angState1 = V3LoadA(b1.angularState);
 
+	FloatV residual = FLoad(cache.residual);
+
 	SolverContactCoulombHeader* PX_RESTRICT firstHeader = reinterpret_cast<SolverContactCoulombHeader*>(desc.constraint);
 	const PxU8* PX_RESTRICT last = desc.constraint + firstHeader->frictionOffset;//getConstraintLength(desc);
 
@@ -92,9 +94,11 @@ void solveContactCoulomb(const PxSolverConstraintDesc& desc, SolverContext& /*ca
 		Ps::prefetchLine(appliedImpulse);
 
 		solveDynamicContacts(contacts, numNormalConstr, normal, invMassDom0, invMassDom1, 
-			angD0, angD1, linVel0, angState0, linVel1, angState1, appliedImpulse); 
+			angD0, angD1, linVel0, angState0, linVel1, angState1, appliedImpulse, residual); 
 	}
 
+	FStore(residual, &cache.residual);
+
 	// Write back
 	V3StoreA(linVel0, b0.linearVelocity);
 	V3StoreA(linVel1, b1.linearVelocity);
@@ -205,7 +209,7 @@ void solveFriction(const PxSolverConstraintDesc& desc, SolverContext& /*cache*/)
 	PX_ASSERT(currPtr == last);
 }
 
-void solveContactCoulomb_BStatic(const PxSolverConstraintDesc& desc, SolverContext& /*cache*/)
+void solveContactCoulomb_BStatic(const PxSolverConstraintDesc& desc, SolverContext& cache)
 {
 	PxSolverBody& b0 = *desc.bodyA;
 
@@ -213,6 +217,8 @@ void solveContactCoulomb_BStatic(const PxSolverConstraintDesc& desc, SolverConte
 	Vec3V linVel0 = V3LoadA(b0.linearVelocity);
 	Vec3V angState0 = V3LoadA(b0.angularState);
 
+	FloatV residual = FLoad(cache.residual);
+
 	SolverContactCoulombHeader* firstHeader = reinterpret_cast<SolverContactCoulombHeader*>(desc.constraint);
 	const PxU8* PX_RESTRICT last = desc.constraint + firstHeader->frictionOffset;//getConstraintLength(desc);
 
@@ -242,9 +248,11 @@ void solveContactCoulomb_BStatic(const PxSolverConstraintDesc& desc, SolverConte
 		const FloatV angD0 = FLoad(hdr->angDom0);
 		
 		solveStaticContacts(contacts, numNormalConstr, normal, invMassDom0, 
-			angD0, linVel0, angState0, appliedImpulse); 
+			angD0, linVel0, angState0, appliedImpulse, residual); 
 	}
 
+	FStore(residual, &cache.residual);
+
 	// Write back
 	V3StoreA(linVel0, b0.linearVelocity);
 	V3StoreA(angState0, b0.angularState);
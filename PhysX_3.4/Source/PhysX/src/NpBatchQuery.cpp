@@ -48,6 +48,9 @@ PX_COMPILE_TIME_ASSERT(0==(sizeof(PxSweepHit)& 0x0f));
 PX_COMPILE_TIME_ASSERT(0==(sizeof(PxOverlapHit)& 0x0f));
 #endif
 
+// number of queries run by each task in executeAsync()
+#define NP_BATCH_QUERY_CHUNK_SIZE	32
+
 #define CHECK_RUNNING(QueryMessage) \
 	if(Ps::atomicCompareExchange(&mBatchQueryIsRunning, -1, 0) == 1)\
 	{\
@@ -55,7 +58,8 @@ PX_COMPILE_TIME_ASSERT(0==(sizeof(PxOverlapHit)& 0x0f));
 	}
 
 NpBatchQuery::NpBatchQuery(NpScene& owner, const PxBatchQueryDesc& d)
-	: mNpScene(&owner), mNbRaycasts(0), mNbOverlaps(0), mNbSweeps(0), mBatchQueryIsRunning(0), mDesc(d), mPrevOffset(PxU32(eTERMINAL))
+	: mNpScene(&owner), mNbRaycasts(0), mNbOverlaps(0), mNbSweeps(0), mBatchQueryIsRunning(0), mDesc(d), mPrevOffset(PxU32(eTERMINAL)),
+	mFinalizeTask(owner.getContextId(), this, "NpBatchQuery.finalizeAsyncExecute", PxSceneMemoryCategory::eSCENE_QUERY)
 {
 	mHasMtdSweep = false;
 }
@@ -278,99 +282,57 @@ struct PxOverflowBuffer : PxHitBuffer<HitType>
 	}
 };
 
-void NpBatchQuery::execute()
+bool NpBatchQuery::checkUserMemory() const
 {
-	NP_READ_CHECK(mNpScene);
-
 	if(mNbRaycasts)
 	{
-		PX_CHECK_AND_RETURN(mDesc.queryMemory.userRaycastResultBuffer!=NULL, "PxBatchQuery execute: userRaycastResultBuffer is NULL");
-		PX_CHECK_AND_RETURN(mDesc.queryMemory.raycastTouchBufferSize > 0 ? 
-			(mDesc.queryMemory.userRaycastTouchBuffer != NULL)	: true, "PxBatchQuery execute: userRaycastTouchBuffer is NULL");
+		PX_CHECK_AND_RETURN_VAL(mDesc.queryMemory.userRaycastResultBuffer!=NULL, "PxBatchQuery execute: userRaycastResultBuffer is NULL", false);
+		PX_CHECK_AND_RETURN_VAL(mDesc.queryMemory.raycastTouchBufferSize > 0 ? 
+			(mDesc.queryMemory.userRaycastTouchBuffer != NULL)	: true, "PxBatchQuery execute: userRaycastTouchBuffer is NULL", false);
 	}
 	if(mNbOverlaps)
 	{
-		PX_CHECK_AND_RETURN(mDesc.queryMemory.userOverlapResultBuffer!=NULL, "PxBatchQuery execute: userOverlapResultBuffer is NULL");
-		PX_CHECK_AND_RETURN(mDesc.queryMemory.overlapTouchBufferSize > 0 ? 
-			(mDesc.queryMemory.userOverlapTouchBuffer != NULL)	: true, "PxBatchQuery execute: userOverlapTouchBuffer is NULL");
+		PX_CHECK_AND_RETURN_VAL(mDesc.queryMemory.userOverlapResultBuffer!=NULL, "PxBatchQuery execute: userOverlapResultBuffer is NULL", false);
+		PX_CHECK_AND_RETURN_VAL(mDesc.queryMemory.overlapTouchBufferSize > 0 ? 
+			(mDesc.queryMemory.userOverlapTouchBuffer != NULL)	: true, "PxBatchQuery execute: userOverlapTouchBuffer is NULL", false);
 	}
 	if(mNbSweeps)
 	{
-		PX_CHECK_AND_RETURN(mDesc.queryMemory.userSweepResultBuffer!=NULL, "PxBatchQuery execute: userSweepResultBuffer is NULL");
-		PX_CHECK_AND_RETURN(mDesc.queryMemory.sweepTouchBufferSize > 0 ? 
-			(mDesc.queryMemory.userSweepTouchBuffer != NULL)	: true, "PxBatchQuery execute: userSweepTouchBuffer is NULL");
+		PX_CHECK_AND_RETURN_VAL(mDesc.queryMemory.userSweepResultBuffer!=NULL, "PxBatchQuery execute: userSweepResultBuffer is NULL", false);
+		PX_CHECK_AND_RETURN_VAL(mDesc.queryMemory.sweepTouchBufferSize > 0 ? 
+			(mDesc.queryMemory.userSweepTouchBuffer != NULL)	: true, "PxBatchQuery execute: userSweepTouchBuffer is NULL", false);
 	}
+	return true;
+}
 
-	PX_SIMD_GUARD;
-
-	PX_PROFILE_ZONE("BatchedSceneQuery.execute", mNpScene->getContextId());
+bool NpBatchQuery::startExecute(const char* methodName)
+{
 	PxI32 ret = Ps::atomicCompareExchange(&mBatchQueryIsRunning, 1, 0);
 	if(ret == 1)
 	{
-		Ps::getFoundation().error(PxErrorCode::eINVALID_OPERATION, __FILE__, __LINE__, "PxBatchQuery::execute: This batch is already executing"); 
-		return;
+		Ps::getFoundation().error(PxErrorCode::eINVALID_OPERATION, __FILE__, __LINE__, "%s: This batch is already executing", methodName); 
+		return false;
 	}
 	else if(ret == -1)
 	{
-		Ps::getFoundation().error(PxErrorCode::eINVALID_OPERATION, __FILE__, __LINE__, "PxBatchQuery::execute: Another thread is still adding queries to this batch"); 
-		return;
+		Ps::getFoundation().error(PxErrorCode::eINVALID_OPERATION, __FILE__, __LINE__, "%s: Another thread is still adding queries to this batch", methodName); 
+		return false;
 	}
+	return true;
+}
 
-	resetResultBuffers();
-
-	// If PVD is connected and IS_PVD_SQ_ENABLED, record the offsets for queries in pvd buffers and run the queries on PPU
-	bool isSqCollectorLocked = false;
-	PX_UNUSED(isSqCollectorLocked);
-
-#if PX_SUPPORT_PVD	
-	PxU32 pvdRayQstartIdx = 0;
-	PxU32 pvdOverlapQstartIdx = 0;
-	PxU32 pvdSweepQstartIdx = 0;
-
-	Vd::ScbScenePvdClient& pvdClient = mNpScene->mScene.getScenePvdClient();
-	const bool needUpdatePvd = pvdClient.checkPvdDebugFlag() && (pvdClient.getScenePvdFlagsFast() & PxPvdSceneFlag::eTRANSMIT_SCENEQUERIES);
-
-	if(needUpdatePvd)
-	{
-		mNpScene->getBatchedSqCollector().getLock().lock();
-		isSqCollectorLocked = true;
-	
-		pvdRayQstartIdx = mNpScene->getBatchedSqCollector().mAccumulatedRaycastQueries.size();
-		pvdOverlapQstartIdx = mNpScene->getBatchedSqCollector().mAccumulatedOverlapQueries.size();
-		pvdSweepQstartIdx = mNpScene->getBatchedSqCollector().mAccumulatedSweepQueries.size();
-	}
-#endif
-
-	PxClientID clientId = mDesc.ownerClient;
-
-	// setup local pointers to user provided output buffers
-	PxRaycastHit* raycastHits = mDesc.queryMemory.userRaycastTouchBuffer;					PX_UNUSED(raycastHits);
-	PxRaycastQueryResult* raycastResults = mDesc.queryMemory.userRaycastResultBuffer;		PX_UNUSED(raycastResults);
-	PxU32 raycastHitsSize = mDesc.queryMemory.raycastTouchBufferSize;						PX_UNUSED(raycastHitsSize);
-
-	PxOverlapHit* overlapHits = mDesc.queryMemory.userOverlapTouchBuffer;					PX_UNUSED(overlapHits);
-	PxOverlapQueryResult* overlapResults = mDesc.queryMemory.userOverlapResultBuffer;		PX_UNUSED(overlapResults);
-	PxU32 overlapHitsSize = mDesc.queryMemory.overlapTouchBufferSize;						PX_UNUSED(overlapHitsSize);
+void NpBatchQuery::executeQueries(PxU32 queryOffset, PxU32 nbQueries, BatchQueryOutput& output, BatchQueryFilterData& bfd)
+{
+	const PxClientID clientId = mDesc.ownerClient;
 
-	PxSweepHit* sweepHits = mDesc.queryMemory.userSweepTouchBuffer;							PX_UNUSED(sweepHits);
-	PxSweepQueryResult* sweepResults = mDesc.queryMemory.userSweepResultBuffer;				PX_UNUSED(sweepResults);
-	PxU32 sweepHitsSize = mDesc.queryMemory.sweepTouchBufferSize;							PX_UNUSED(sweepHitsSize);
+	PxU32 curQueryOffset = queryOffset;
+	PxU32 hitsSpaceLeft;
 
-	BatchQueryFilterData bfd(mDesc.filterShaderData, mDesc.filterShaderDataSize, mDesc.preFilterShader, mDesc.postFilterShader);
-
-	// data declarations for double buffering the input stream
-	PxU32 curQueryOffset = 0; // first query starts at 0
-	if (mPrevOffset == eTERMINAL) // except if zero queries were queued
+	// ====================== parse and execute the batch query memory stream ====================== 
+	for(PxU32 queryCount = 0; queryCount < nbQueries; queryCount++)
 	{
-		finalizeExecute();
-		return;
-	}
+		PX_ASSERT(curQueryOffset != eTERMINAL);
 
-	PxU32 hitsSpaceLeft; PX_UNUSED(hitsSpaceLeft);
-
-	// ====================== parse and execute the batch query memory stream ====================== 
-	PxU32 queryCount = 0;
-	do {
 		// parse a query from the input stream, create a stream reader at current double buffer
 		BatchQueryStreamReader reader(mStream.begin()+curQueryOffset);
 		BatchStreamHeader& h = *reader.read<BatchStreamHeader>();
@@ -383,60 +345,105 @@ void NpBatchQuery::execute()
 		MultiQueryInput& input = *readQueryInput(reader);
 
 		// ====================== switch over query type - QTypeROS::eRAYCAST, eOVERLAP, eSWEEP =====================
+		// AP: previously the stream parsing was aborted on queries which ran out of touch buffer space (hitCount==-1)..
+		// but it was easier to just continue, the perf implications for aborted queries are not a significant consideration
+		// and this allows to avoid writing special case code for filling the query buffers after aborted query
 		switch (h.hitTypeId)
 		{
 			// =============== Current query is a raycast =====================
 			case QTypeROS::eRAYCAST:
 			{
-				PxU32 nbRaycastHits = PxU32(raycastHits - mDesc.queryMemory.userRaycastTouchBuffer);
-				PX_ASSERT(nbRaycastHits <= raycastHitsSize);
-				hitsSpaceLeft = raycastHitsSize - nbRaycastHits;
-				PxOverflowBuffer<PxRaycastHit> hits(raycastHits, PxMin<PxU32>(h.maxTouchHits, hitsSpaceLeft));
+				hitsSpaceLeft = PxU32(output.raycastHitsEnd - output.raycastHits);
+				PxOverflowBuffer<PxRaycastHit> hits(output.raycastHits, PxMin<PxU32>(h.maxTouchHits, hitsSpaceLeft));
 				mNpScene->NpScene::multiQuery<PxRaycastHit>(input, hits, h.hitFlags, h.cache, h.fd, NULL, &bfd);
 				hits.overflow |= (hitsSpaceLeft == 0 && h.maxTouchHits > 0); // report overflow if 0 space left and maxTouchHits>0
-				writeStatus<PxRaycastQueryResult, PxRaycastHit>(raycastResults++, hits, h.userData, hits.overflow);
-				raycastHits += hits.nbTouches;
+				writeStatus<PxRaycastQueryResult, PxRaycastHit>(output.raycastResults++, hits, h.userData, hits.overflow);
+				output.raycastHits += hits.nbTouches;
 			} break;
 
 			// ================ Current query is an overlap ====================
 			case QTypeROS::eOVERLAP:
 			{
-				PxU32 nbOverlapHits = PxU32(overlapHits - mDesc.queryMemory.userOverlapTouchBuffer);
-				PX_ASSERT(nbOverlapHits <= overlapHitsSize);
-				hitsSpaceLeft = overlapHitsSize - nbOverlapHits;
-				PxOverflowBuffer<PxOverlapHit> hits(overlapHits, PxMin<PxU32>(h.maxTouchHits, hitsSpaceLeft));
+				hitsSpaceLeft = PxU32(output.overlapHitsEnd - output.overlapHits);
+				PxOverflowBuffer<PxOverlapHit> hits(output.overlapHits, PxMin<PxU32>(h.maxTouchHits, hitsSpaceLeft));
 				mNpScene->NpScene::multiQuery<PxOverlapHit>(input, hits, h.hitFlags, h.cache, h.fd, NULL, &bfd);
 				hits.overflow |= (hitsSpaceLeft == 0 && h.maxTouchHits > 0); // report overflow if 0 space left and maxTouchHits>0
-				writeStatus<PxOverlapQueryResult, PxOverlapHit>(overlapResults++, hits, h.userData, hits.overflow);
-				overlapHits += hits.nbTouches;
+				writeStatus<PxOverlapQueryResult, PxOverlapHit>(output.overlapResults++, hits, h.userData, hits.overflow);
+				output.overlapHits += hits.nbTouches;
 			} break;
 
 			// ================== Current query is a sweep =========================
 			case QTypeROS::eSWEEP:
 			{
-
-				PxU32 nbSweepHits = PxU32(sweepHits - mDesc.queryMemory.userSweepTouchBuffer);
-				PX_ASSERT(nbSweepHits <= sweepHitsSize);
-				hitsSpaceLeft = sweepHitsSize - nbSweepHits;
-				PxOverflowBuffer<PxSweepHit> hits(sweepHits, PxMin<PxU32>(h.maxTouchHits, hitsSpaceLeft));
+				hitsSpaceLeft = PxU32(output.sweepHitsEnd - output.sweepHits);
+				PxOverflowBuffer<PxSweepHit> hits(output.sweepHits, PxMin<PxU32>(h.maxTouchHits, hitsSpaceLeft));
 				mNpScene->NpScene::multiQuery<PxSweepHit>(input, hits, h.hitFlags, h.cache, h.fd, NULL, &bfd);
 				hits.overflow |= (hitsSpaceLeft == 0 && h.maxTouchHits > 0); // report overflow if 0 space left and maxTouchHits>0
-				writeStatus<PxSweepQueryResult, PxSweepHit>(sweepResults++, hits, h.userData, hits.overflow);
-				sweepHits += hits.nbTouches;
+				writeStatus<PxSweepQueryResult, PxSweepHit>(output.sweepResults++, hits, h.userData, hits.overflow);
+				output.sweepHits += hits.nbTouches;
 			} break;
 			default:
 				PX_ALWAYS_ASSERT_MESSAGE("Unexpected batch query type (raycast/overlap/sweep).");
 		}
+	}
+}
+
+void NpBatchQuery::execute()
+{
+	NP_READ_CHECK(mNpScene);
+
+	if(!checkUserMemory())
+		return;
 
-		if (h.nextQueryOffset == eTERMINAL) // end of stream
-			// AP: previously also had a break on hitCount==-1 which is aborted due to out of space
-			// abort stream parsing if we ran into an aborted query (hitCount==-1).. but it was easier to just continue
-			// the perf implications for aborted queries are not a significant consideration and this allows to avoid
-			// writing special case code for filling the query buffers after aborted query
-			break;
-		#undef MULTIQ
-		queryCount++;
-	} while (queryCount < 1000000);
+	PX_SIMD_GUARD;
+
+	PX_PROFILE_ZONE("BatchedSceneQuery.execute", mNpScene->getContextId());
+	Cm::MemoryTrackingScope memoryScope(mNpScene->getContextId(), PxSceneMemoryCategory::eSCENE_QUERY);
+	if(!startExecute("PxBatchQuery::execute"))
+		return;
+
+	resetResultBuffers();
+
+	// If PVD is connected and IS_PVD_SQ_ENABLED, record the offsets for queries in pvd buffers and run the queries on PPU
+	bool isSqCollectorLocked = false;
+	PX_UNUSED(isSqCollectorLocked);
+
+#if PX_SUPPORT_PVD	
+	PxU32 pvdRayQstartIdx = 0;
+	PxU32 pvdOverlapQstartIdx = 0;
+	PxU32 pvdSweepQstartIdx = 0;
+
+	Vd::ScbScenePvdClient& pvdClient = mNpScene->mScene.getScenePvdClient();
+	const bool needUpdatePvd = pvdClient.checkPvdDebugFlag() && (pvdClient.getScenePvdFlagsFast() & PxPvdSceneFlag::eTRANSMIT_SCENEQUERIES);
+
+	if(needUpdatePvd)
+	{
+		mNpScene->getBatchedSqCollector().getLock().lock();
+		isSqCollectorLocked = true;
+	
+		pvdRayQstartIdx = mNpScene->getBatchedSqCollector().mAccumulatedRaycastQueries.size();
+		pvdOverlapQstartIdx = mNpScene->getBatchedSqCollector().mAccumulatedOverlapQueries.size();
+		pvdSweepQstartIdx = mNpScene->getBatchedSqCollector().mAccumulatedSweepQueries.size();
+	}
+#endif
+
+	// setup local pointers to user provided output buffers
+	BatchQueryOutput output;
+	output.raycastResults = mDesc.queryMemory.userRaycastResultBuffer;
+	output.raycastHits = mDesc.queryMemory.userRaycastTouchBuffer;
+	output.raycastHitsEnd = output.raycastHits + mDesc.queryMemory.raycastTouchBufferSize;
+	output.overlapResults = mDesc.queryMemory.userOverlapResultBuffer;
+	output.overlapHits = mDesc.queryMemory.userOverlapTouchBuffer;
+	output.overlapHitsEnd = output.overlapHits + mDesc.queryMemory.overlapTouchBufferSize;
+	output.sweepResults = mDesc.queryMemory.userSweepResultBuffer;
+	output.sweepHits = mDesc.queryMemory.userSweepTouchBuffer;
+	output.sweepHitsEnd = output.sweepHits + mDesc.queryMemory.sweepTouchBufferSize;
+
+	BatchQueryFilterData bfd(mDesc.filterShaderData, mDesc.filterShaderDataSize, mDesc.preFilterShader, mDesc.postFilterShader);
+
+	// first query starts at 0, except if zero queries were queued
+	if (mPrevOffset != eTERMINAL)
+		executeQueries(0, mNbRaycasts + mNbOverlaps + mNbSweeps, output, bfd);
 
 #if PX_SUPPORT_PVD
 	if( isSqCollectorLocked && needUpdatePvd)	
@@ -457,6 +464,161 @@ void NpBatchQuery::execute()
 	finalizeExecute();
 }
 
+void NpBatchQueryTask::runInternal()
+{
+	const PxBatchQueryDesc& desc = mOwner->getDesc();
+	BatchQueryFilterData bfd(desc.filterShaderData, desc.filterShaderDataSize, desc.preFilterShader, desc.postFilterShader);
+	mOwner->executeQueries(mQueryOffset, mNbQueries, mOutput, bfd);
+}
+
+// Each chunk of executeAsync() writes its touches at the position they would have if every query before it had
+// returned maxTouchHits touches. finalizeAsyncExecute() then packs them, so the buffers have the same layout as
+// after execute().
+static void setChunkOutputStart(BatchQueryOutput& output, const PxBatchQueryMemory& mem, const PxU32* nbQueries, const PxU32* nbTouches)
+{
+	output.raycastResults = mem.userRaycastResultBuffer + nbQueries[QTypeROS::eRAYCAST];
+	output.raycastHits = mem.userRaycastTouchBuffer + PxMin(nbTouches[QTypeROS::eRAYCAST], mem.raycastTouchBufferSize);
+	output.overlapResults = mem.userOverlapResultBuffer + nbQueries[QTypeROS::eOVERLAP];
+	output.overlapHits = mem.userOverlapTouchBuffer + PxMin(nbTouches[QTypeROS::eOVERLAP], mem.overlapTouchBufferSize);
+	output.sweepResults = mem.userSweepResultBuffer + nbQueries[QTypeROS::eSWEEP];
+	output.sweepHits = mem.userSweepTouchBuffer + PxMin(nbTouches[QTypeROS::eSWEEP], mem.sweepTouchBufferSize);
+}
+
+static void setChunkOutputEnd(BatchQueryOutput& output, const PxBatchQueryMemory& mem, const PxU32* nbTouches)
+{
+	output.raycastHitsEnd = mem.userRaycastTouchBuffer + PxMin(nbTouches[QTypeROS::eRAYCAST], mem.raycastTouchBufferSize);
+	output.overlapHitsEnd = mem.userOverlapTouchBuffer + PxMin(nbTouches[QTypeROS::eOVERLAP], mem.overlapTouchBufferSize);
+	output.sweepHitsEnd = mem.userSweepTouchBuffer + PxMin(nbTouches[QTypeROS::eSWEEP], mem.sweepTouchBufferSize);
+}
+
+// Moves the touches written by a chunk down to dst and patches the touch pointers of its results. Returns the new end of
+// the packed touches.
+template<typename ResultType, typename HitType>
+static HitType* packChunkTouches(HitType* dst, HitType* chunkHits, HitType* chunkHitsEnd, ResultType* results, ResultType* resultsEnd)
+{
+	const PxU32 nbHits = PxU32(chunkHitsEnd - chunkHits);
+	if(dst != chunkHits)
+	{
+		PxMemMove(dst, chunkHits, nbHits*sizeof(HitType));
+		for(ResultType* result = results; result < resultsEnd; result++)
+		{
+			if(result->touches)
+				result->touches = dst + (result->touches - chunkHits);
+		}
+	}
+	return dst + nbHits;
+}
+
+void NpBatchQuery::executeAsync(PxBaseTask* completionTask)
+{
+	NP_READ_CHECK(mNpScene);
+	PX_CHECK_AND_RETURN(completionTask, "PxBatchQuery::executeAsync: completionTask is NULL");
+
+	if(!checkUserMemory())
+		return;
+
+#if PX_SUPPORT_PVD
+	// the batched query collector of PVD cannot be filled from multiple threads
+	Vd::ScbScenePvdClient& pvdClient = mNpScene->mScene.getScenePvdClient();
+	if(pvdClient.checkPvdDebugFlag() && (pvdClient.getScenePvdFlagsFast() & PxPvdSceneFlag::eTRANSMIT_SCENEQUERIES))
+	{
+		execute();
+		return;
+	}
+#endif
+
+	PX_PROFILE_ZONE("BatchedSceneQuery.executeAsync", mNpScene->getContextId());
+	if(!startExecute("PxBatchQuery::executeAsync"))
+		return;
+
+	resetResultBuffers();
+
+	if (mPrevOffset == eTERMINAL) // zero queries were queued
+	{
+		finalizeExecute();
+		return;
+	}
+
+	// count the touches requested by all queries
+	const PxBatchQueryMemory& mem = mDesc.queryMemory;
+	PxU32 totalTouches[3] = { 0, 0, 0 };
+	PxU32 curQueryOffset = 0;
+	do
+	{
+		const BatchStreamHeader& h = *reinterpret_cast<const BatchStreamHeader*>(mStream.begin()+curQueryOffset);
+		totalTouches[PxU32(h.hitTypeId)] += h.maxTouchHits;
+		curQueryOffset = h.nextQueryOffset;
+	} while(curQueryOffset != eTERMINAL);
+
+	// When the touch buffers cannot hold maxTouchHits for every query, which queries overflow depends on the touches
+	// found by the queries before them. The batch then runs as a single chunk so that the results match execute().
+	const bool touchBuffersFit =	totalTouches[QTypeROS::eRAYCAST] <= mem.raycastTouchBufferSize &&
+									totalTouches[QTypeROS::eOVERLAP] <= mem.overlapTouchBufferSize &&
+									totalTouches[QTypeROS::eSWEEP] <= mem.sweepTouchBufferSize;
+	const PxU32 chunkSize = touchBuffersFit ? NP_BATCH_QUERY_CHUNK_SIZE : 0xffffffff;
+
+	// split the query stream into chunks of consecutive queries
+	const PxU64 contextID = mNpScene->getContextId();
+	PxU32 nbQueries[3] = { 0, 0, 0 };
+	PxU32 nbTouches[3] = { 0, 0, 0 };
+	mTasks.clear();
+	curQueryOffset = 0;
+	do
+	{
+		if(mTasks.empty() || mTasks.back().mNbQueries == chunkSize)
+		{
+			if(!mTasks.empty())
+				setChunkOutputEnd(mTasks.back().mOutput, mem, nbTouches);
+			NpBatchQueryTask& task = mTasks.pushBack(NpBatchQueryTask(*this, contextID, curQueryOffset));
+			setChunkOutputStart(task.mOutput, mem, nbQueries, nbTouches);
+		}
+
+		const BatchStreamHeader& h = *reinterpret_cast<const BatchStreamHeader*>(mStream.begin()+curQueryOffset);
+		nbQueries[PxU32(h.hitTypeId)]++;
+		nbTouches[PxU32(h.hitTypeId)] += h.maxTouchHits;
+		mTasks.back().mNbQueries++;
+		curQueryOffset = h.nextQueryOffset;
+	} while(curQueryOffset != eTERMINAL);
+	if(!touchBuffersFit)
+	{
+		nbTouches[QTypeROS::eRAYCAST] = mem.raycastTouchBufferSize;
+		nbTouches[QTypeROS::eOVERLAP] = mem.overlapTouchBufferSize;
+		nbTouches[QTypeROS::eSWEEP] = mem.sweepTouchBufferSize;
+	}
+	setChunkOutputEnd(mTasks.back().mOutput, mem, nbTouches);
+
+	for(PxU32 i=0; i<mTasks.size(); i++)
+		mTasks[i].mOutputStart = mTasks[i].mOutput;
+
+	PX_ASSERT(nbQueries[QTypeROS::eRAYCAST] == mNbRaycasts && nbQueries[QTypeROS::eOVERLAP] == mNbOverlaps && nbQueries[QTypeROS::eSWEEP] == mNbSweeps);
+
+	mFinalizeTask.setContinuation(*mNpScene->getTaskManager(), completionTask);
+	for(PxU32 i=0; i<mTasks.size(); i++)
+	{
+		mTasks[i].setContinuation(&mFinalizeTask);
+		mTasks[i].removeReference();
+	}
+	mFinalizeTask.removeReference();
+}
+
+void NpBatchQuery::finalizeAsyncExecute(PxBaseTask*)
+{
+	const PxBatchQueryMemory& mem = mDesc.queryMemory;
+	PxRaycastHit* raycastHits = mem.userRaycastTouchBuffer;
+	PxOverlapHit* overlapHits = mem.userOverlapTouchBuffer;
+	PxSweepHit* sweepHits = mem.userSweepTouchBuffer;
+	for(PxU32 i=0; i<mTasks.size(); i++)
+	{
+		const BatchQueryOutput& start = mTasks[i].mOutputStart;
+		const BatchQueryOutput& end = mTasks[i].mOutput;
+		raycastHits = packChunkTouches(raycastHits, start.raycastHits, end.raycastHits, start.raycastResults, end.raycastResults);
+		overlapHits = packChunkTouches(overlapHits, start.overlapHits, end.overlapHits, start.overlapResults, end.overlapResults);
+		sweepHits = packChunkTouches(sweepHits, start.sweepHits, end.sweepHits, start.sweepResults, end.sweepResults);
+	}
+
+	finalizeExecute();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void NpBatchQuery::writeBatchHeader(const BatchStreamHeader& h)
 {
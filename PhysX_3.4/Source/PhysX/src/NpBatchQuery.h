@@ -37,6 +37,7 @@
 #include "PsArray.h"
 #include "PsUserAllocated.h"
 #include "CmPhysXCommon.h"
+#include "CmTask.h"
 #include "PsSync.h"
 
 namespace physx
@@ -51,6 +52,40 @@ namespace Sq
 class SceneQueryManager;
 }
 
+class NpBatchQuery;
+struct BatchQueryFilterData;
+
+// write positions in the user result and touch buffers for a range of queries of a batch
+struct BatchQueryOutput
+{
+	PxRaycastQueryResult*	raycastResults;
+	PxRaycastHit*			raycastHits;
+	PxRaycastHit*			raycastHitsEnd;
+	PxOverlapQueryResult*	overlapResults;
+	PxOverlapHit*			overlapHits;
+	PxOverlapHit*			overlapHitsEnd;
+	PxSweepQueryResult*		sweepResults;
+	PxSweepHit*				sweepHits;
+	PxSweepHit*				sweepHitsEnd;
+};
+
+// runs a chunk of consecutive queries of a batch for PxBatchQuery::executeAsync()
+class NpBatchQueryTask : public Cm::Task
+{
+public:
+							NpBatchQueryTask(NpBatchQuery& owner, PxU64 contextID, PxU32 queryOffset) :
+								Cm::Task(contextID, PxSceneMemoryCategory::eSCENE_QUERY), mOwner(&owner), mQueryOffset(queryOffset), mNbQueries(0) {}
+
+	virtual void			runInternal();
+	virtual const char*		getName() const { return "NpBatchQuery.executeChunk"; }
+
+	NpBatchQuery*			mOwner;
+	PxU32					mQueryOffset;	// offset in the query stream of the first query of the chunk
+	PxU32					mNbQueries;
+	BatchQueryOutput		mOutputStart;	// first results and touches of the chunk
+	BatchQueryOutput		mOutput;		// advanced by the chunk's queries as they write their results
+};
+
 struct BatchQueryStream : Ps::Array<char>
 {
 	BatchQueryStream() { rewind(); }
@@ -115,6 +150,7 @@ public:
 
 	// PxBatchQuery interface
 	virtual	void							execute();
+	virtual	void							executeAsync(physx::PxBaseTask* completionTask);
 	virtual void							release();
 	virtual	PxBatchQueryPreFilterShader		getPreFilterShader() const;
 	virtual	PxBatchQueryPostFilterShader	getPostFilterShader() const;
@@ -144,9 +180,13 @@ public:
 
 	// sync object for batch query completion wait
 	shdfnd::Sync							mSync;
+			void							executeQueries(PxU32 queryOffset, PxU32 nbQueries, BatchQueryOutput& output, BatchQueryFilterData& bfd);
 private:
+			bool							checkUserMemory() const;
+			bool							startExecute(const char* methodName);
 			void							resetResultBuffers();
 			void							finalizeExecute();
+			void							finalizeAsyncExecute(physx::PxBaseTask* continuation);
 			void							writeBatchHeader(const BatchStreamHeader& h);
 
 						NpScene*			mNpScene;
@@ -158,6 +198,9 @@ private:
 						PxU32				mPrevOffset;
 						bool				mHasMtdSweep;
 
+						Ps::Array<NpBatchQueryTask>	mTasks;
+						Cm::DelegateTask<NpBatchQuery, &NpBatchQuery::finalizeAsyncExecute>	mFinalizeTask;
+
 	friend class physx::Sq::SceneQueryManager;
 };
 
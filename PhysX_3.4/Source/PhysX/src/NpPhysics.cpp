@@ -132,6 +132,9 @@ NpPhysics::~NpPhysics()
 		PX_DELETE_AND_RESET(scenes[i]);
 	mSceneArray.clear();
 
+	// the memory trackers of the scenes are gone, their allocation listener is not needed anymore
+	Cm::releaseMemoryTracking();
+
 	//PxU32 matCount = mMasterMaterialTable.size();
 	//while (mMasterMaterialTable.size() > 0)
 	//{
@@ -320,29 +323,48 @@ PxScene* NpPhysics::createScene(const PxSceneDesc& desc)
 
 	Ps::Mutex::ScopedLock lock(mSceneAndMaterialMutex);  // done here because scene constructor accesses profiling manager of the SDK
 
-	NpScene* npScene = PX_NEW (NpScene)(desc);
+	// the tracker is registered once the scene exists, until then the allocations of this thread are charged to it explicitly
+	Cm::MemoryTracker* memoryTracker = NULL;
+	if(desc.flags & PxSceneFlag::eENABLE_MEMORY_TRACKING)
+		memoryTracker = PX_NEW(Cm::MemoryTracker)();
+
+	NpScene* npScene;
+	{
+		Cm::MemoryTrackingScope memoryScope(memoryTracker, PxSceneMemoryCategory::eOTHER);
+		npScene = PX_NEW (NpScene)(desc);
+	}
 	if(!npScene)
 	{
+		if(memoryTracker)
+			PX_DELETE(memoryTracker);
 		Ps::getFoundation().error(PxErrorCode::eINTERNAL_ERROR, __FILE__, __LINE__, "Unable to create scene.");
 		return NULL;
 	}
+	if(memoryTracker)
+		npScene->setMemoryTracker(memoryTracker);
 	if(!npScene->getTaskManager())
 	{
 		Ps::getFoundation().error(PxErrorCode::eINTERNAL_ERROR, __FILE__, __LINE__, "Unable to create scene. Task manager creation failed.");
 		return NULL;
 	}
 
-	npScene->loadFromDesc(desc);
+	bool valid;
+	{
+		Cm::MemoryTrackingScope memoryScope(memoryTracker, PxSceneMemoryCategory::eOTHER);
+		npScene->loadFromDesc(desc);
 
 #if PX_SUPPORT_PVD
-	if(mPvd)
-	{
-		npScene->mScene.getScenePvdClient().setPsPvd(mPvd);		
-		mPvd->addClient(&npScene->mScene.getScenePvdClient());
-	}
+		if(mPvd)
+		{
+			npScene->mScene.getScenePvdClient().setPsPvd(mPvd);		
+			mPvd->addClient(&npScene->mScene.getScenePvdClient());
+		}
 #endif
 
-	if (!sendMaterialTable(*npScene) || !npScene->getScene().isValid())
+		valid = sendMaterialTable(*npScene) && npScene->getScene().isValid();
+	}
+
+	if (!valid)
 	{
 		PX_DELETE(npScene);
 		Ps::getFoundation().error(PxErrorCode::eOUT_OF_MEMORY, __FILE__, __LINE__, "Unable to create scene.");
@@ -100,8 +100,8 @@ NpSceneQueries::NpSceneQueries(const PxSceneDesc& desc) :
 	mCachedRaycastFuncs		(Gu::getRaycastFuncTable()),
 	mCachedSweepFuncs		(Gu::getSweepFuncTable()),
 	mCachedOverlapFuncs		(Gu::getOverlapFuncTable()),
-	mSceneQueriesStaticPrunerUpdate		(getContextId(), 0, "NpSceneQueries.sceneQueriesStaticPrunerUpdate"),
-	mSceneQueriesDynamicPrunerUpdate(getContextId(), 0, "NpSceneQueries.sceneQueriesDynamicPrunerUpdate"),
+	mSceneQueriesStaticPrunerUpdate		(getContextId(), 0, "NpSceneQueries.sceneQueriesStaticPrunerUpdate", PxSceneMemoryCategory::eSCENE_QUERY),
+	mSceneQueriesDynamicPrunerUpdate(getContextId(), 0, "NpSceneQueries.sceneQueriesDynamicPrunerUpdate", PxSceneMemoryCategory::eSCENE_QUERY),
 	mSceneQueryUpdateMode	(desc.sceneQueryUpdateMode)
 #if PX_SUPPORT_PVD
 	, mSingleSqCollector	(mScene, false),
@@ -140,6 +140,10 @@ NpScene::NpScene(const PxSceneDesc& desc) :
 	mConcurrentErrorCount	(0),	
 	mCurrentWriter			(0),
 	mSceneQueriesUpdateRunning	(false),
+	mTaskGraphRecorder		(NULL),
+	mMemoryTracker			(NULL),
+	mMemoryBudget			(0),
+	mMemoryBudgetCallback	(NULL),
 	mHasSimulatedOnce		(false),
 	mBetweenFetchResults	(false)
 {
@@ -211,6 +215,12 @@ NpScene::~NpScene()
 		PX_DELETE(mBatchQueries[numSq]);
 	mBatchQueries.clear();
 
+	if(mTaskGraphRecorder)
+		PX_DELETE(mTaskGraphRecorder);
+
+	if(mMemoryTracker)
+		PX_DELETE(mMemoryTracker);
+
 	mScene.release();
 
 	// unlock the lock taken in release(), must unlock before 
@@ -360,6 +370,7 @@ static PX_FORCE_INLINE void addRigidActorToArray(T& a, Ps::Array<PxRigidActor*>&
 
 void NpScene::addActor(PxActor& actor)
 {
+	Cm::MemoryTrackingScope memoryScope(getContextId(), PxSceneMemoryCategory::eOTHER);
 	PX_PROFILE_ZONE("API.addActor", getContextId());
 	NP_WRITE_CHECK(this);
 	PX_SIMD_GUARD;
@@ -510,6 +521,7 @@ void NpScene::addActors(const PxPruningStructure& ps)
 
 void NpScene::addActorsInternal(PxActor*const* PX_RESTRICT actors, PxU32 nbActors, const Sq::PruningStructure* pS)
 {
+	Cm::MemoryTrackingScope memoryScope(getContextId(), PxSceneMemoryCategory::eOTHER);
 	PX_PROFILE_ZONE("API.addActors", getContextId());
 	NP_WRITE_CHECK(this);	
 	PX_SIMD_GUARD;
@@ -612,6 +624,7 @@ void NpScene::addActorsInternal(PxActor*const* PX_RESTRICT actors, PxU32 nbActor
 	// merge sq PrunerStructure
 	if(pS)
 	{		
+		Cm::MemoryCategoryScope memoryScope(PxSceneMemoryCategory::eSCENE_QUERY);
 		if(pS->getTreeNodes(PruningIndex::eSTATIC))
 		{
 			AABBPrunerMergeData params(pS->getTreeNbNodes(PruningIndex::eSTATIC), pS->getTreeNodes(PruningIndex::eSTATIC),
@@ -649,6 +662,7 @@ void NpScene::addActorsInternal(PxActor*const* PX_RESTRICT actors, PxU32 nbActor
 
 void NpScene::removeActors(PxActor*const* PX_RESTRICT actors, PxU32 nbActors, bool wakeOnLostTouch)
 {
+	Cm::MemoryTrackingScope memoryScope(getContextId(), PxSceneMemoryCategory::eOTHER);
 	PX_PROFILE_ZONE("API.removeActors", getContextId());
 	NP_WRITE_CHECK(this);	
 	
@@ -728,6 +742,7 @@ void NpScene::removeActors(PxActor*const* PX_RESTRICT actors, PxU32 nbActors, bo
 
 void NpScene::removeActor(PxActor& actor, bool wakeOnLostTouch)
 {
+	Cm::MemoryTrackingScope memoryScope(getContextId(), PxSceneMemoryCategory::eOTHER);
 	PX_PROFILE_ZONE("API.removeActor", getContextId());
 	NP_WRITE_CHECK(this);	
 	if (removeFromSceneCheck(this, actor.getScene(), "PxScene::removeActor(): Actor"))
@@ -906,6 +921,7 @@ void NpScene::removeRigidDynamic(NpRigidDynamic& body, bool wakeOnLostTouch, boo
 
 void NpScene::addArticulation(PxArticulation& articulation)
 {
+	Cm::MemoryTrackingScope memoryScope(getContextId(), PxSceneMemoryCategory::eOTHER);
 	PX_PROFILE_ZONE("API.addArticulation", getContextId());
 	NP_WRITE_CHECK(this);
 
@@ -1014,6 +1030,7 @@ void NpScene::addArticulationInternal(PxArticulation& articulation)
 
 void NpScene::removeArticulation(PxArticulation& articulation, bool wakeOnLostTouch)
 {
+	Cm::MemoryTrackingScope memoryScope(getContextId(), PxSceneMemoryCategory::eOTHER);
 	PX_PROFILE_ZONE("API.removeArticulation", getContextId());
 	NP_WRITE_CHECK(this);
 
@@ -1122,6 +1139,7 @@ void NpScene::removeArticulationLink(NpArticulationLink& link, bool wakeOnLostTo
 
 void NpScene::addAggregate(PxAggregate& aggregate)
 {
+	Cm::MemoryTrackingScope memoryScope(getContextId(), PxSceneMemoryCategory::eOTHER);
 	PX_PROFILE_ZONE("API.addAggregate", getContextId());
 	NP_WRITE_CHECK(this);
 	PX_SIMD_GUARD;
@@ -1161,6 +1179,7 @@ void NpScene::addAggregate(PxAggregate& aggregate)
 
 void NpScene::removeAggregate(PxAggregate& aggregate, bool wakeOnLostTouch)
 {
+	Cm::MemoryTrackingScope memoryScope(getContextId(), PxSceneMemoryCategory::eOTHER);
 	PX_PROFILE_ZONE("API.removeAggregate", getContextId());
 	NP_WRITE_CHECK(this);	
 	if(!removeFromSceneCheck(this, aggregate.getScene(), "PxScene::removeAggregate(): Aggregate"))
@@ -1219,6 +1238,7 @@ PxU32 NpScene::getAggregates(PxAggregate** userBuffer, PxU32 bufferSize, PxU32 s
 
 void NpScene::addCollection(const PxCollection& collection)
 {
+	Cm::MemoryTrackingScope memoryScope(getContextId(), PxSceneMemoryCategory::eOTHER);
 	PX_PROFILE_ZONE("API.addCollection", getContextId());
 	const Cm::Collection& col = static_cast<const Cm::Collection&>(collection);
 
@@ -1606,6 +1626,80 @@ void NpScene::getSimulationStatistics(PxSimulationStatistics& s) const
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void NpScene::setTaskGraphRecording(bool enable, PxU32 maxNbEvents)
+{
+	NP_WRITE_CHECK(this);
+	PX_CHECK_AND_RETURN(getSimulationStage() == Sc::SimulationStage::eCOMPLETE, "PxScene::setTaskGraphRecording: not allowed while simulation is running. Call will be ignored.");
+
+	if(mTaskGraphRecorder)
+	{
+		PX_DELETE(mTaskGraphRecorder);
+		mTaskGraphRecorder = NULL;
+	}
+
+	if(enable)
+		mTaskGraphRecorder = PX_NEW(Cm::TaskGraphRecorder)(getContextId(), maxNbEvents);
+}
+
+bool NpScene::getTaskGraphFrame(PxTaskGraphFrame& frame) const
+{
+	NP_READ_CHECK(this);
+
+	if(getSimulationStage() != Sc::SimulationStage::eCOMPLETE)
+	{
+		Ps::getFoundation().error(PxErrorCode::eDEBUG_WARNING, __FILE__, __LINE__, "PxScene::getTaskGraphFrame() not allowed while simulation is running. Call will be ignored.");
+		return false;
+	}
+
+	return mTaskGraphRecorder && mTaskGraphRecorder->getFrame(frame);
+}
+
+void NpScene::setMemoryTracking(bool enable)
+{
+	NP_WRITE_CHECK(this);
+	PX_CHECK_AND_RETURN(getSimulationStage() == Sc::SimulationStage::eCOMPLETE, "PxScene::setMemoryTracking: not allowed while simulation is running. Call will be ignored.");
+
+	if(mMemoryTracker)
+	{
+		PX_DELETE(mMemoryTracker);
+		mMemoryTracker = NULL;
+	}
+
+	if(enable)
+		setMemoryTracker(PX_NEW(Cm::MemoryTracker)());
+}
+
+void NpScene::setMemoryTracker(Cm::MemoryTracker* tracker)
+{
+	PX_ASSERT(!mMemoryTracker);
+	mMemoryTracker = tracker;
+	mMemoryTracker->registerContext(getContextId(), *this);
+	mMemoryTracker->setBudget(mMemoryBudget, mMemoryBudgetCallback);
+}
+
+bool NpScene::getMemoryStats(PxSceneMemoryStats& stats) const
+{
+	NP_READ_CHECK(this);
+
+	if(!mMemoryTracker)
+		return false;
+
+	mMemoryTracker->getStats(stats);
+	return true;
+}
+
+void NpScene::setMemoryBudget(PxU64 budget, PxSceneMemoryBudgetCallback* callback)
+{
+	NP_WRITE_CHECK(this);
+
+	mMemoryBudget = budget;
+	mMemoryBudgetCallback = callback;
+	if(mMemoryTracker)
+		mMemoryTracker->setBudget(budget, callback);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 //Multiclient 
 
 PxClientID NpScene::createClient()
@@ -1649,6 +1743,12 @@ PxFrictionType::Enum NpScene::getFrictionType() const
 	return mScene.getFrictionType();
 }
 
+PxSolverType::Enum NpScene::getSolverType() const
+{
+	NP_READ_CHECK(this);
+	return mScene.getSolverType();
+}
+
 #if PX_USE_CLOTH_API
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1954,6 +2054,7 @@ void NpScene::updateDirtyShaders()
 ///////////////////////////////////////////////////////////////////////////////
 void NpScene::simulateOrCollide(PxReal elapsedTime, physx::PxBaseTask* completionTask, void* scratchBlock, PxU32 scratchBlockSize, bool controlSimulation, const char* invalidCallMsg, Sc::SimulationStage::Enum simStage)
 {
+	Cm::MemoryTrackingScope memoryScope(getContextId(), PxSceneMemoryCategory::eOTHER);
 	PX_SIMD_GUARD;
 
 	{
@@ -1994,6 +2095,12 @@ void NpScene::simulateOrCollide(PxReal elapsedTime, physx::PxBaseTask* completio
 
 		mScene.getScScene().setScratchBlock(scratchBlock, scratchBlockSize);
 
+		if(mTaskGraphRecorder)
+			mTaskGraphRecorder->startFrame();
+
+		if(mMemoryTracker)
+			mMemoryTracker->startFrame();
+
 		mElapsedTime = elapsedTime;
 		if (simStage == Sc::SimulationStage::eCOLLIDE)
 			mScene.getScScene().setElapsedTime(elapsedTime);
@@ -2072,6 +2179,7 @@ void NpScene::simulate(PxReal elapsedTime, physx::PxBaseTask* completionTask, vo
 
 void NpScene::advance( physx::PxBaseTask* completionTask)
 {
+	Cm::MemoryTrackingScope memoryScope(getContextId(), PxSceneMemoryCategory::eOTHER);
 	NP_WRITE_CHECK(this);
 	//issue error if advance() doesn't get called between fetchCollision() and fetchResult()
 	if(getSimulationStage() != Sc::SimulationStage::eFETCHCOLLIDE)
@@ -2189,6 +2297,7 @@ void NpScene::fireOutOfBoundsCallbacks()
 
 bool NpScene::fetchCollision(bool block)
 {
+	Cm::MemoryTrackingScope memoryScope(getContextId(), PxSceneMemoryCategory::eOTHER);
 	if(getSimulationStage() != Sc::SimulationStage::eCOLLIDE)
 	{
 		Ps::getFoundation().error(PxErrorCode::eINVALID_OPERATION, __FILE__, __LINE__, "PxScene::fetchCollision: fetchCollision() should be called after collide() and before advance()!");
@@ -2233,6 +2342,9 @@ void NpScene::fetchResultsPreContactCallbacks()
 	mScene.getScenePvdClient().updateContacts();
 #endif
 
+	if(mTaskGraphRecorder)
+		mTaskGraphRecorder->endFrame();
+
 	mScene.prepareOutOfBoundsCallbacks();
 	mScene.processPendingRemove();
 	mScene.endSimulation();
@@ -2250,14 +2362,18 @@ void NpScene::fetchResultsPostContactCallbacks()
 	mScene.postCallbacksPreSync();
 	mScene.syncEntireScene();	// double buffering
 
-	SqRefFinder sqRefFinder;
-	mScene.getScScene().syncSceneQueryBounds(mSQManager.getDynamicBoundsSync(), sqRefFinder);
+	{
+		Cm::MemoryCategoryScope memoryScope(PxSceneMemoryCategory::eSCENE_QUERY);
+
+		SqRefFinder sqRefFinder;
+		mScene.getScScene().syncSceneQueryBounds(mSQManager.getDynamicBoundsSync(), sqRefFinder);
 
-	// A.B. temp check if eSUPPRESS_EAGER_SCENE_QUERY_REFIT was set and update mode not, then replicate the flag to the enum
-	PxSceneQueryUpdateMode::Enum updateMode = getSceneQueryUpdateModeFast();
-	if((getFlagsFast() & PxSceneFlag::eSUPPRESS_EAGER_SCENE_QUERY_REFIT) && updateMode == PxSceneQueryUpdateMode::eBUILD_ENABLED_COMMIT_ENABLED)
-		updateMode = PxSceneQueryUpdateMode::eBUILD_ENABLED_COMMIT_DISABLED;
-	mSQManager.afterSync(updateMode);
+		// A.B. temp check if eSUPPRESS_EAGER_SCENE_QUERY_REFIT was set and update mode not, then replicate the flag to the enum
+		PxSceneQueryUpdateMode::Enum updateMode = getSceneQueryUpdateModeFast();
+		if((getFlagsFast() & PxSceneFlag::eSUPPRESS_EAGER_SCENE_QUERY_REFIT) && updateMode == PxSceneQueryUpdateMode::eBUILD_ENABLED_COMMIT_ENABLED)
+			updateMode = PxSceneQueryUpdateMode::eBUILD_ENABLED_COMMIT_DISABLED;
+		mSQManager.afterSync(updateMode);
+	}
 
 #if PX_DEBUG && 0
 	mSQManager.validateSimUpdates();
@@ -2304,6 +2420,7 @@ void NpScene::fetchResultsPostContactCallbacks()
 
 bool NpScene::fetchResults(bool block, PxU32* errorState)
 {
+	Cm::MemoryTrackingScope memoryScope(getContextId(), PxSceneMemoryCategory::eOTHER);
 	if(getSimulationStage() != Sc::SimulationStage::eADVANCE)
 	{
 		Ps::getFoundation().error(PxErrorCode::eINVALID_OPERATION, __FILE__, __LINE__, "PxScene::fetchResults: fetchResults() called illegally! It must be called after advance() or simulate()");
@@ -2355,6 +2472,7 @@ bool NpScene::fetchResults(bool block, PxU32* errorState)
 
 bool NpScene::fetchResultsStart(const PxContactPairHeader*& contactPairs, PxU32& nbContactPairs, bool block)
 {
+	Cm::MemoryTrackingScope memoryScope(getContextId(), PxSceneMemoryCategory::eOTHER);
 	if (getSimulationStage() != Sc::SimulationStage::eADVANCE)
 	{
 		Ps::getFoundation().error(PxErrorCode::eINVALID_OPERATION, __FILE__, __LINE__, "PXScene::fetchResultsStart: fetchResultsStart() called illegally! It must be called after advance() or simulate()");
@@ -2449,6 +2567,7 @@ void NpScene::processCallbacks(physx::PxBaseTask* continuation)
 
 void NpScene::fetchResultsFinish(PxU32* errorState)
 {
+	Cm::MemoryTrackingScope memoryScope(getContextId(), PxSceneMemoryCategory::eOTHER);
 	{
 		PX_SIMD_GUARD;
 		PX_PROFILE_STOP_CROSSTHREAD("Basic.processCallbacks", getContextId());
@@ -2473,6 +2592,7 @@ void NpScene::fetchResultsFinish(PxU32* errorState)
 
 void NpScene::flushSimulation(bool sendPendingReports)
 {
+	Cm::MemoryTrackingScope memoryScope(getContextId(), PxSceneMemoryCategory::eOTHER);
 	PX_PROFILE_ZONE("API.flushSimulation", getContextId());
 	NP_WRITE_CHECK_NOREENTRY(this);
 	PX_SIMD_GUARD;
@@ -2492,6 +2612,7 @@ void NpScene::flushSimulation(bool sendPendingReports)
 
 void NpScene::flushQueryUpdates()
 {
+	Cm::MemoryTrackingScope memoryScope(getContextId(), PxSceneMemoryCategory::eSCENE_QUERY);
 	// DS: how do we profile const methods??????
 	PX_PROFILE_ZONE("API.flushQueryUpdates", getContextId());
 	NP_READ_CHECK(this);
@@ -3213,6 +3334,7 @@ PxPvdSceneClient* NpScene::getScenePvdClient()
 
 void NpScene::sceneQueriesUpdate(physx::PxBaseTask* completionTask, bool controlSimulation)
 {
+	Cm::MemoryTrackingScope memoryScope(getContextId(), PxSceneMemoryCategory::eSCENE_QUERY);
 	PX_SIMD_GUARD;
 
 	bool runUpdateTasks[PruningIndex::eCOUNT] = {true, true};
@@ -3280,6 +3402,7 @@ bool NpScene::checkQueries(bool block)
 
 bool NpScene::fetchQueries(bool block)
 {
+	Cm::MemoryTrackingScope memoryScope(getContextId(), PxSceneMemoryCategory::eSCENE_QUERY);
 	if(!mSceneQueriesUpdateRunning)
 	{
 		//fetchSceneQueries doesn't get called
@@ -165,6 +165,11 @@ class NpScene : public NpSceneQueries, public Ps::UserAllocated
 
 	// Run
 	virtual			void							getSimulationStatistics(PxSimulationStatistics& s) const;
+	virtual			void							setTaskGraphRecording(bool enable, PxU32 maxNbEvents);
+	virtual			bool							getTaskGraphFrame(PxTaskGraphFrame& frame) const;
+	virtual			void							setMemoryTracking(bool enable);
+	virtual			bool							getMemoryStats(PxSceneMemoryStats& stats) const;
+	virtual			void							setMemoryBudget(PxU64 budget, PxSceneMemoryBudgetCallback* callback);
 
 	// Multiclient 
 	virtual			PxClientID						createClient();
@@ -174,6 +179,7 @@ class NpScene : public NpSceneQueries, public Ps::UserAllocated
 	// FrictionModel
 	virtual			void							setFrictionType(PxFrictionType::Enum frictionType);
 	virtual			PxFrictionType::Enum			getFrictionType() const;
+	virtual			PxSolverType::Enum				getSolverType() const;
 
 #if PX_USE_CLOTH_API
 	// Cloth
@@ -321,6 +327,9 @@ class NpScene : public NpSceneQueries, public Ps::UserAllocated
 
 					bool							loadFromDesc(const PxSceneDesc&);
 
+					// takes ownership of a tracker which recorded the creation of the scene, see PxSceneFlag::eENABLE_MEMORY_TRACKING
+					void							setMemoryTracker(Cm::MemoryTracker* tracker);
+
 					void							removeFromRigidActorList(const PxU32&);
 	PX_FORCE_INLINE	void							removeFromArticulationList(PxArticulation&);
 	PX_FORCE_INLINE	void							removeFromAggregateList(PxAggregate&);
@@ -495,6 +504,12 @@ private:
 
 					bool							mSceneQueriesUpdateRunning;
 
+					Cm::TaskGraphRecorder*			mTaskGraphRecorder;
+
+					Cm::MemoryTracker*				mMemoryTracker;
+					PxU64							mMemoryBudget;
+					PxSceneMemoryBudgetCallback*	mMemoryBudgetCallback;
+
 					bool							mHasSimulatedOnce;
 					bool							mBetweenFetchResults;
 };
@@ -681,6 +681,8 @@ bool NpSceneQueries::multiQuery(
 	const MultiQueryInput& input, PxHitCallback<HitType>& hits, PxHitFlags hitFlags, const PxQueryCache* cache,
 	const PxQueryFilterData& filterData, PxQueryFilterCallback* filterCall, BatchQueryFilterData* bfd) const
 {
+	Cm::MemoryTrackingScope memoryScope(getContextId(), PxSceneMemoryCategory::eSCENE_QUERY);
+
 	const bool anyHit = (filterData.flags & PxQueryFlag::eANY_HIT) == PxQueryFlag::eANY_HIT;
 
 	PxI32 retval = 0; PX_UNUSED(retval);
@@ -213,6 +213,7 @@ void NpShapeManager::setupAllSceneQuery(NpScene* scene, const PxRigidActor& acto
 { 
 	PX_ASSERT(scene);		// shouldn't get here unless we're in a scene
 	SceneQueryManager& sqManager = scene->getSceneQueryManagerFast();
+	Cm::MemoryCategoryScope memoryScope(PxSceneMemoryCategory::eSCENE_QUERY);
 
 	const PxU32 nbShapes = getNbShapes();
 	NpShape*const *shapes = getShapes();
@@ -229,6 +230,7 @@ void NpShapeManager::setupAllSceneQuery(NpScene* scene, const PxRigidActor& acto
 
 void NpShapeManager::teardownAllSceneQuery(SceneQueryManager& sqManager)
 {
+	Cm::MemoryCategoryScope memoryScope(PxSceneMemoryCategory::eSCENE_QUERY);
 	NpShape*const *shapes = getShapes();
 	const PxU32 nbShapes = getNbShapes();
 
@@ -267,6 +269,7 @@ Sq::PrunerData NpShapeManager::findSceneQueryData(const NpShape& shape) const
 
 void NpShapeManager::setupSceneQuery(SceneQueryManager& sqManager, const PxRigidActor& actor, PxU32 index)
 { 
+	Cm::MemoryCategoryScope memoryScope(PxSceneMemoryCategory::eSCENE_QUERY);
 	const PxType actorType = actor.getConcreteType();
 	const bool isDynamic = actorType == PxConcreteType::eRIGID_DYNAMIC || actorType == PxConcreteType::eARTICULATION_LINK;
 	setPrunerData(index, sqManager.addPrunerShape(*(getShapes()[index]), actor, isDynamic));
@@ -274,6 +277,7 @@ void NpShapeManager::setupSceneQuery(SceneQueryManager& sqManager, const PxRigid
 
 void NpShapeManager::teardownSceneQuery(SceneQueryManager& sqManager, PxU32 index)
 {
+	Cm::MemoryCategoryScope memoryScope(PxSceneMemoryCategory::eSCENE_QUERY);
 	sqManager.removePrunerShape(getPrunerData(index));
 	setPrunerData(index, SQ_INVALID_PRUNER_DATA);
 }
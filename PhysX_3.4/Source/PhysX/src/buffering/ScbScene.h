@@ -186,6 +186,7 @@ namespace Scb
 
 		PX_INLINE void						setFrictionType(PxFrictionType::Enum type)	{ mScene.setFrictionType(type);		}
 		PX_INLINE PxFrictionType::Enum		getFrictionType()					const	{ return mScene.getFrictionType();	}
+		PX_INLINE PxSolverType::Enum		getSolverType()						const	{ return mScene.getSolverType();	}
 
 		void 								addActor(Scb::RigidStatic&, bool noSim, PxBounds3* uninflatedBounds);
 		void 								removeActor(Scb::RigidStatic&, bool wakeOnLostTouch, bool noSim);
@@ -38,7 +38,14 @@ using namespace physx;
 
 Ext::CpuWorkerThread::CpuWorkerThread()
 :	mQueueEntryPool(EXT_TASK_QUEUE_ENTRY_POOL_SIZE),
-	mThreadId(0)
+	mThreadId(0),
+	mRandomState(1),
+	mWorkStealing(false),
+	mSleeping(0),
+	mNbSpins(0),
+	mNbYields(0),
+	mNbParks(0),
+	mNbWakes(0)
 {
 }
 
@@ -48,58 +55,165 @@ Ext::CpuWorkerThread::~CpuWorkerThread()
 }
 
 
-void Ext::CpuWorkerThread::initialize(DefaultCpuDispatcher* ownerDispatcher)
+void Ext::CpuWorkerThread::initialize(DefaultCpuDispatcher* ownerDispatcher, PxU32 workerIndex)
 {
 	mOwner = ownerDispatcher;
+	mWorkStealing = ownerDispatcher->getQueueMode() == PxDefaultCpuDispatcherQueueMode::eWORK_STEALING;
+	mRandomState = (workerIndex + 1) * 0x9e3779b9;	// must not be zero
 }
 
 
-bool Ext::CpuWorkerThread::tryAcceptJobToLocalQueue(PxBaseTask& task, Ps::Thread::Id taskSubmitionThread)
+// Must be called from this worker's thread only.
+bool Ext::CpuWorkerThread::tryAcceptJobToLocalQueue(PxBaseTask& task)
 {
-	if(taskSubmitionThread == mThreadId)
+	if(mWorkStealing)
+		return mLocalDeque.push(task);
+
+	SharedQueueEntry* entry = mQueueEntryPool.getEntry(&task);
+	if (entry)
 	{
-		SharedQueueEntry* entry = mQueueEntryPool.getEntry(&task);
-		if (entry)
-		{
-			mLocalJobList.push(*entry);
-			return true;
-		}
-		else
-			return false;
+		mLocalJobList.push(*entry);
+		return true;
 	}
-
-	return false;
+	else
+		return false;
 }
 
 
+// Called by other workers which ran out of jobs.
 PxBaseTask* Ext::CpuWorkerThread::giveUpJob()
 {
+	if(mWorkStealing)
+		return mLocalDeque.steal();
+
+	return TaskQueueHelper::fetchTask(mLocalJobList, mQueueEntryPool);
+}
+
+
+PxBaseTask* Ext::CpuWorkerThread::fetchLocalJob()
+{
+	if(mWorkStealing)
+		return mLocalDeque.pop();
+
 	return TaskQueueHelper::fetchTask(mLocalJobList, mQueueEntryPool);
 }
 
 
+// Called by a submitting thread. Only one caller can win the transition out of the parked state.
+bool Ext::CpuWorkerThread::tryWake()
+{
+	if(mSleeping && Ps::atomicCompareExchange(&mSleeping, 0, 1) == 1)
+	{
+		mOwner->removeSleepingWorker();
+		mWakeSignal.set();
+		return true;
+	}
+	return false;
+}
+
+
+void Ext::CpuWorkerThread::wakeForQuit()
+{
+	tryWake();
+	mWakeSignal.set();
+}
+
+
+void Ext::CpuWorkerThread::accumulateStatistics(PxDefaultCpuDispatcherStatistics& stats) const
+{
+	stats.nbSpins += mNbSpins;
+	stats.nbYields += mNbYields;
+	stats.nbParks += mNbParks;
+	stats.nbWakes += mNbWakes;
+}
+
+
+PxBaseTask* Ext::CpuWorkerThread::park()
+{
+	mWakeSignal.reset();
+
+	// Announce that we are about to sleep, then look for work one last time. Submitters queue their
+	// task before they check for sleepers, so either we find the task here or they find us asleep.
+	Ps::atomicExchange(&mSleeping, 1);
+	mOwner->addSleepingWorker();
+
+	PxBaseTask* task = NULL;
+	if(!quitIsSignalled())
+	{
+		task = fetchLocalJob();
+		if(!task)
+			task = mOwner->fetchNextTask(*this);
+	}
+
+	if(task || quitIsSignalled())
+	{
+		// Cancel the sleep. If a submitter got there first the wake signal is set and
+		// will be cleared the next time we park.
+		if(Ps::atomicCompareExchange(&mSleeping, 0, 1) == 1)
+			mOwner->removeSleepingWorker();
+		return task;
+	}
+
+	mNbParks++;
+	mWakeSignal.wait();
+	mNbWakes++;
+	return NULL;
+}
+
+
+PxBaseTask* Ext::CpuWorkerThread::waitForWork()
+{
+	const PxDefaultCpuDispatcherWaitForWorkMode::Enum mode = mOwner->getWaitForWorkMode();
+	const PxU32 spinCount = mOwner->getSpinCount();
+
+	for(PxU32 nbPolls = 0; !quitIsSignalled(); nbPolls++)
+	{
+		if(mode == PxDefaultCpuDispatcherWaitForWorkMode::eSPIN || nbPolls < spinCount)
+		{
+			mNbSpins++;
+		}
+		else if(mode == PxDefaultCpuDispatcherWaitForWorkMode::eSPIN_THEN_YIELD)
+		{
+			mNbYields++;
+			Ps::Thread::yield();
+		}
+		else
+		{
+			// back to the main loop after a wake-up, the task may have been taken by another worker
+			return park();
+		}
+
+		PxBaseTask* task = fetchLocalJob();
+		if(!task)
+			task = mOwner->fetchNextTask(*this);
+		if(task)
+			return task;
+	}
+
+	return NULL;
+}
+
+
 void Ext::CpuWorkerThread::execute()
 {
 	mThreadId = getId();
+	Ps::TlsSet(mOwner->getWorkerTlsIndex(), this);
 
 	while (!quitIsSignalled())
     {
-        mOwner->resetWakeSignal();
+		PxBaseTask* task = fetchLocalJob();
 
-		PxBaseTask* task = TaskQueueHelper::fetchTask(mLocalJobList, mQueueEntryPool);
+		if(!task)
+			task = mOwner->fetchNextTask(*this);
 
 		if(!task)
-			task = mOwner->fetchNextTask();
+			task = waitForWork();
 		
 		if (task)
 		{
 			mOwner->runTask(*task);
 			task->release();
 		}
-		else
-		{
-			mOwner->waitForWork();
-		}
 	}
 
 	quit();
@@ -33,8 +33,10 @@
 
 #include "CmPhysXCommon.h"
 #include "PsThread.h"
+#include "PsSync.h"
 #include "ExtDefaultCpuDispatcher.h"
 #include "ExtSharedQueueEntryPool.h"
+#include "ExtTaskQueueHelper.h"
 
 
 namespace physx
@@ -55,17 +57,46 @@ class DefaultCpuDispatcher;
         CpuWorkerThread();
         ~CpuWorkerThread();
 		
-		void					initialize(DefaultCpuDispatcher* ownerDispatcher);
+		void					initialize(DefaultCpuDispatcher* ownerDispatcher, PxU32 workerIndex);
 		void					execute();
-		bool					tryAcceptJobToLocalQueue(PxBaseTask& task, Ps::Thread::Id taskSubmitionThread);
+		bool					tryAcceptJobToLocalQueue(PxBaseTask& task);
 		PxBaseTask*				giveUpJob();
 		Ps::Thread::Id			getWorkerThreadId() const { return mThreadId; }
 
+		bool					tryWake();
+		void					wakeForQuit();
+		void					accumulateStatistics(PxDefaultCpuDispatcherStatistics& stats) const;
+
+		PX_FORCE_INLINE	PxU32	getRandomNumber()
+		{
+			// xorshift32, only used to pick steal victims
+			mRandomState ^= mRandomState << 13;
+			mRandomState ^= mRandomState >> 17;
+			mRandomState ^= mRandomState << 5;
+			return mRandomState;
+		}
+
 	protected:
+		PxBaseTask*				fetchLocalJob();
+		PxBaseTask*				waitForWork();
+		PxBaseTask*				park();
+
 		SharedQueueEntryPool<>			mQueueEntryPool;
 		DefaultCpuDispatcher*			mOwner;
 		Ps::SList      				    mLocalJobList;
+		WorkStealingQueue				mLocalDeque;		// only used in PxDefaultCpuDispatcherQueueMode::eWORK_STEALING
 		Ps::Thread::Id					mThreadId;
+		PxU32							mRandomState;
+		bool							mWorkStealing;
+
+		Ps::Sync						mWakeSignal;
+		volatile PxI32					mSleeping;			// 1 while parked, reset by whoever wakes the worker up
+
+		// idle statistics, only written by the worker thread itself
+		PxU64							mNbSpins;
+		PxU64							mNbYields;
+		PxU64							mNbParks;
+		PxU64							mNbWakes;
 	};
 
 #if PX_VC
@@ -37,12 +37,14 @@ using namespace physx;
 
 namespace physx
 {
-	PxDefaultCpuDispatcher* PxDefaultCpuDispatcherCreate(PxU32 numThreads, PxU32* affinityMasks);
+	PxDefaultCpuDispatcher* PxDefaultCpuDispatcherCreate(PxU32 numThreads, PxU32* affinityMasks, PxDefaultCpuDispatcherQueueMode::Enum queueMode,
+														 PxDefaultCpuDispatcherWaitForWorkMode::Enum waitForWorkMode, PxU32 spinCount);
 }
 
-PxDefaultCpuDispatcher* physx::PxDefaultCpuDispatcherCreate(PxU32 numThreads, PxU32* affinityMasks)
+PxDefaultCpuDispatcher* physx::PxDefaultCpuDispatcherCreate(PxU32 numThreads, PxU32* affinityMasks, PxDefaultCpuDispatcherQueueMode::Enum queueMode,
+															PxDefaultCpuDispatcherWaitForWorkMode::Enum waitForWorkMode, PxU32 spinCount)
 {
-	return PX_NEW(Ext::DefaultCpuDispatcher)(numThreads, affinityMasks);
+	return PX_NEW(Ext::DefaultCpuDispatcher)(numThreads, affinityMasks, queueMode, waitForWorkMode, spinCount);
 }
 
 #if !PX_PS4 && !PX_XBOXONE && !PX_SWITCH
@@ -55,8 +57,10 @@ void Ext::DefaultCpuDispatcher::getAffinityMasks(PxU32* affinityMasks, PxU32 thr
 }
 #endif
 
-Ext::DefaultCpuDispatcher::DefaultCpuDispatcher(PxU32 numThreads, PxU32* affinityMasks)
-	: mQueueEntryPool(EXT_TASK_QUEUE_ENTRY_POOL_SIZE, "QueueEntryPool"), mNumThreads(numThreads), mShuttingDown(false)
+Ext::DefaultCpuDispatcher::DefaultCpuDispatcher(PxU32 numThreads, PxU32* affinityMasks, PxDefaultCpuDispatcherQueueMode::Enum queueMode,
+												 PxDefaultCpuDispatcherWaitForWorkMode::Enum waitForWorkMode, PxU32 spinCount)
+	: mQueueEntryPool(EXT_TASK_QUEUE_ENTRY_POOL_SIZE, "QueueEntryPool"), mNumThreads(numThreads), mWorkerTlsIndex(Ps::TlsAlloc()),
+	mQueueMode(queueMode), mWaitForWorkMode(waitForWorkMode), mSpinCount(spinCount), mNbSleepingWorkers(0)
 #if PX_PROFILE
 	,mRunProfiled(true)
 #else
@@ -83,7 +87,7 @@ Ext::DefaultCpuDispatcher::DefaultCpuDispatcher(PxU32 numThreads, PxU32* affinit
 		for(PxU32 i = 0; i < numThreads; ++i)
 		{
 			PX_PLACEMENT_NEW(mWorkerThreads+i, CpuWorkerThread)();
-			mWorkerThreads[i].initialize(this);
+			mWorkerThreads[i].initialize(this, i);
 		}
 
 		for(PxU32 i = 0; i < numThreads; ++i)
@@ -113,8 +117,11 @@ Ext::DefaultCpuDispatcher::~DefaultCpuDispatcher()
 	for(PxU32 i = 0; i < mNumThreads; ++i)
 		mWorkerThreads[i].signalQuit();
 
-	mShuttingDown = true;
-	mWorkReady.set();
+	// workers check the quit signal after announcing that they go to sleep, so they either
+	// see it or they are already waiting for this wake-up
+	for(PxU32 i = 0; i < mNumThreads; ++i)
+		mWorkerThreads[i].wakeForQuit();
+
 	for(PxU32 i = 0; i < mNumThreads; ++i)
 		mWorkerThreads[i].waitForQuit();
 
@@ -125,6 +132,8 @@ Ext::DefaultCpuDispatcher::~DefaultCpuDispatcher()
 
 	if (mThreadNames)
 		PX_FREE(mThreadNames);
+
+	Ps::TlsFree(mWorkerTlsIndex);
 }
 
 void Ext::DefaultCpuDispatcher::submitTask(PxBaseTask& task)
@@ -137,28 +146,51 @@ void Ext::DefaultCpuDispatcher::submitTask(PxBaseTask& task)
 		return;
 	}	
 
-	// TODO: Could use TLS to make this more efficient
-	const Ps::Thread::Id currentThread = Ps::Thread::getId();
-	for(PxU32 i = 0; i < mNumThreads; ++i)
-	{
-		if(mWorkerThreads[i].tryAcceptJobToLocalQueue(task, currentThread))
-			return mWorkReady.set();
-	}
+	// tasks submitted from one of our workers stay with that worker
+	CpuWorkerThread* worker = reinterpret_cast<CpuWorkerThread*>(Ps::TlsGet(mWorkerTlsIndex));
+	if(worker && worker->tryAcceptJobToLocalQueue(task))
+		return wakeWorker();
 
 	SharedQueueEntry* entry = mQueueEntryPool.getEntry(&task);
 	if (entry)
 	{
 		mJobList.push(*entry);
-		mWorkReady.set();
+		wakeWorker();
+	}
+}
+
+void Ext::DefaultCpuDispatcher::wakeWorker()
+{
+	// One task was queued, so wake at most one sleeping worker. The task must be visible before
+	// we read the sleeper count, see CpuWorkerThread::park().
+	Ps::memoryBarrier();
+	if(!mNbSleepingWorkers)
+		return;
+
+	for(PxU32 i = 0; i < mNumThreads; ++i)
+	{
+		if(mWorkerThreads[i].tryWake())
+			return;
 	}
 }
 
-PxBaseTask* Ext::DefaultCpuDispatcher::fetchNextTask()
+void Ext::DefaultCpuDispatcher::getStatistics(PxDefaultCpuDispatcherStatistics& stats) const
+{
+	stats.nbSpins = 0;
+	stats.nbYields = 0;
+	stats.nbParks = 0;
+	stats.nbWakes = 0;
+
+	for(PxU32 i = 0; i < mNumThreads; ++i)
+		mWorkerThreads[i].accumulateStatistics(stats);
+}
+
+PxBaseTask* Ext::DefaultCpuDispatcher::fetchNextTask(CpuWorkerThread& worker)
 {
 	PxBaseTask* task = getJob();
 
 	if(!task)
-		task = stealJob();
+		task = stealJob(worker);
 
 	return task;
 }
@@ -173,39 +205,36 @@ PxBaseTask* Ext::DefaultCpuDispatcher::getJob(void)
 	return TaskQueueHelper::fetchTask(mJobList, mQueueEntryPool);
 }
 
-PxBaseTask* Ext::DefaultCpuDispatcher::stealJob()
+PxBaseTask* Ext::DefaultCpuDispatcher::stealJob(CpuWorkerThread& thief)
 {
 	PxBaseTask* ret = NULL;
 
-	for(PxU32 i = 0; i < mNumThreads; ++i)
+	if(mQueueMode == PxDefaultCpuDispatcherQueueMode::eWORK_STEALING)
+	{
+		// start at a random victim so that workers do not all pile up on the same deque
+		const PxU32 start = thief.getRandomNumber() % mNumThreads;
+		for(PxU32 i = 0; i < mNumThreads; ++i)
+		{
+			CpuWorkerThread& victim = mWorkerThreads[(start + i) % mNumThreads];
+			if(&victim == &thief)
+				continue;
+
+			ret = victim.giveUpJob();
+
+			if(ret != NULL)
+				break;
+		}
+	}
+	else
 	{
-		ret = mWorkerThreads[i].giveUpJob();
+		for(PxU32 i = 0; i < mNumThreads; ++i)
+		{
+			ret = mWorkerThreads[i].giveUpJob();
 
-		if(ret != NULL)
-			break;
+			if(ret != NULL)
+				break;
+		}
 	}
 
 	return ret;
 }
-
-void Ext::DefaultCpuDispatcher::resetWakeSignal()
-{
-	mWorkReady.reset();
-	
-	// The code below is necessary to avoid deadlocks on shut down.
-	// A thread usually loops as follows:
-	// while quit is not signaled
-	// 1)  reset wake signal
-	// 2)  fetch work
-	// 3)  if work -> process
-	// 4)  else -> wait for wake signal
-	//
-	// If a thread reaches 1) after the thread pool signaled wake up,
-	// the wake up sync gets reset and all other threads which have not
-	// passed 4) already will wait forever.
-	// The code below makes sure that on shutdown, the wake up signal gets
-	// sent again after it was reset
-	//
-	if (mShuttingDown)
-		mWorkReady.set();
-}
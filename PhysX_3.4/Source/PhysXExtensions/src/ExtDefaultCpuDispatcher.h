@@ -33,8 +33,8 @@
 
 #include "CmPhysXCommon.h"
 #include "PsUserAllocated.h"
-#include "PsSync.h"
 #include "PsSList.h"
+#include "PsAtomic.h"
 #include "PxDefaultCpuDispatcher.h"
 #include "ExtSharedQueueEntryPool.h"
 #include "foundation/PxProfiler.h"
@@ -60,7 +60,8 @@ namespace Ext
 												DefaultCpuDispatcher() : mQueueEntryPool(0) {}
 												~DefaultCpuDispatcher();
 	public:
-												DefaultCpuDispatcher(PxU32 numThreads, PxU32* affinityMasks);
+												DefaultCpuDispatcher(PxU32 numThreads, PxU32* affinityMasks, PxDefaultCpuDispatcherQueueMode::Enum queueMode,
+																	 PxDefaultCpuDispatcherWaitForWorkMode::Enum waitForWorkMode, PxU32 spinCount);
 
 		//---------------------------------------------------------------------------------
 		// PxCpuDispatcher implementation
@@ -77,12 +78,16 @@ namespace Ext
 
 		virtual			bool					getRunProfiled()	const	{ return mRunProfiled;	}
 
+		virtual			PxDefaultCpuDispatcherQueueMode::Enum	getQueueMode()	const	{ return mQueueMode;	}
+
+		virtual			void					getStatistics(PxDefaultCpuDispatcherStatistics& stats)	const;
+
 		//---------------------------------------------------------------------------------
 		// DefaultCpuDispatcher
 		//---------------------------------------------------------------------------------
 						PxBaseTask*				getJob();
-						PxBaseTask*				stealJob();
-						PxBaseTask*				fetchNextTask();
+						PxBaseTask*				stealJob(CpuWorkerThread& thief);
+						PxBaseTask*				fetchNextTask(CpuWorkerThread& worker);
 		PX_FORCE_INLINE	void					runTask(PxBaseTask& task)
 												{
 #if PX_SUPPORT_PXTASK_PROFILING
@@ -96,19 +101,27 @@ namespace Ext
 														task.run();
 												}
 
-    					void					waitForWork() { mWorkReady.wait(); }
-						void					resetWakeSignal();
+						void					wakeWorker();
+		PX_FORCE_INLINE	void					addSleepingWorker()		{ Ps::atomicIncrement(&mNbSleepingWorkers);	}
+		PX_FORCE_INLINE	void					removeSleepingWorker()	{ Ps::atomicDecrement(&mNbSleepingWorkers);	}
 
 		static			void					getAffinityMasks(PxU32* affinityMasks, PxU32 threadCount);
 
+		PX_FORCE_INLINE	PxU32					getWorkerTlsIndex()		const	{ return mWorkerTlsIndex;	}
+		PX_FORCE_INLINE	PxDefaultCpuDispatcherWaitForWorkMode::Enum	getWaitForWorkMode()	const	{ return mWaitForWorkMode;	}
+		PX_FORCE_INLINE	PxU32					getSpinCount()			const	{ return mSpinCount;		}
+
 	protected:
 						CpuWorkerThread*		mWorkerThreads;
 						SharedQueueEntryPool<>	mQueueEntryPool;
 						Ps::SList				mJobList;
-						Ps::Sync				mWorkReady;
 						PxU8*					mThreadNames;
 						PxU32					mNumThreads;
-						bool					mShuttingDown;
+						PxU32					mWorkerTlsIndex;	// TLS slot holding the CpuWorkerThread of the current thread, if any
+						PxDefaultCpuDispatcherQueueMode::Enum		mQueueMode;
+						PxDefaultCpuDispatcherWaitForWorkMode::Enum	mWaitForWorkMode;
+						PxU32					mSpinCount;
+						volatile PxI32			mNbSleepingWorkers;
 						bool					mRunProfiled;
 	};
 
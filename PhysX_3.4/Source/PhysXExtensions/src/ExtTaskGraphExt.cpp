@@ -0,0 +1,88 @@
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Copyright (c) 2008-2018 NVIDIA Corporation. All rights reserved.
+// Copyright (c) 2004-2008 AGEIA Technologies, Inc. All rights reserved.
+// Copyright (c) 2001-2004 NovodeX AG. All rights reserved.  
+
+
+#include "PxTaskGraphExt.h"
+#include "foundation/PxIO.h"
+#include "CmPhysXCommon.h"
+#include "PsString.h"
+
+using namespace physx;
+
+namespace
+{
+	void writeString(PxOutputStream& stream, const char* str)
+	{
+		stream.write(str, PxU32(strlen(str)));
+	}
+
+	// task names are compile time literals, but escape them anyway so the output stays valid JSON
+	void writeEscapedName(PxOutputStream& stream, const char* name)
+	{
+		if(!name)
+			name = "<unnamed>";
+
+		for(const char* c = name; *c; c++)
+		{
+			if(*c == '"' || *c == '\\')
+				stream.write("\\", 1);
+			if(PxU8(*c) >= 0x20)
+				stream.write(c, 1);
+		}
+	}
+}
+
+void PxTaskGraphExt::writeChromeTrace(const PxTaskGraphFrame& frame, PxOutputStream& stream)
+{
+	char buffer[256];
+
+	writeString(stream, "{\"traceEvents\":[\n");
+
+	for(PxU32 i=0; i<frame.nbEvents; i++)
+	{
+		const PxTaskGraphEvent& e = frame.events[i];
+
+		writeString(stream, i ? ",\n{\"name\":\"" : "{\"name\":\"");
+		writeEscapedName(stream, e.name);
+
+		const PxI32 predecessor = e.criticalPredecessor == 0xffffffff ? -1 : PxI32(e.criticalPredecessor);
+		Ps::snprintf(buffer, sizeof(buffer),
+			"\",\"cat\":\"task\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":%u%s,\"args\":{\"event\":%u,\"critical\":%s,\"criticalPredecessor\":%d}}",
+			double(e.startTime), double(e.endTime - e.startTime), e.threadIndex,
+			e.onCriticalPath ? ",\"cname\":\"terrible\"" : "",
+			i, e.onCriticalPath ? "true" : "false", predecessor);
+		writeString(stream, buffer);
+	}
+
+	Ps::snprintf(buffer, sizeof(buffer),
+		"\n],\"otherData\":{\"nbEvents\":%u,\"nbDroppedEvents\":%u,\"nbThreads\":%u,\"wallTime\":%.3f,\"totalWork\":%.3f,\"criticalPathLength\":%.3f}}\n",
+		frame.nbEvents, frame.nbDroppedEvents, frame.nbThreads,
+		double(frame.wallTime), double(frame.totalWork), double(frame.criticalPathLength));
+	writeString(stream, buffer);
+}
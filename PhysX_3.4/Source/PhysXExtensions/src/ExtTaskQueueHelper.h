@@ -34,11 +34,14 @@
 #include "task/PxTask.h"
 #include "CmPhysXCommon.h"
 #include "ExtSharedQueueEntryPool.h"
+#include "PsAtomic.h"
+#include "PsIntrinsics.h"
 
 namespace physx
 {
 
 #define EXT_TASK_QUEUE_ENTRY_POOL_SIZE 128
+#define EXT_WORK_STEALING_QUEUE_SIZE 256	// must be a power of two
 
 namespace Ext
 {
@@ -59,6 +62,89 @@ namespace Ext
 		}
 	};
 
+	/**
+	\brief Fixed capacity Chase-Lev work-stealing deque.
+
+	The owning worker pushes and pops at the bottom end, other workers steal from the top end.
+	push() and pop() must only be called from the owning thread, steal() can be called from any thread.
+	push() fails if the deque is full, in which case the caller falls back to the shared job list.
+	Indices are free running and compared through their signed difference so wrap-around is harmless.
+	*/
+	class WorkStealingQueue
+	{
+	public:
+		WorkStealingQueue() : mTop(0), mBottom(0)
+		{
+			for(PxU32 i=0; i<EXT_WORK_STEALING_QUEUE_SIZE; i++)
+				mTasks[i] = NULL;
+		}
+
+		bool push(PxBaseTask& task)
+		{
+			const PxU32 b = PxU32(mBottom);
+			const PxU32 t = PxU32(mTop);
+			if(PxI32(b - t) >= PxI32(EXT_WORK_STEALING_QUEUE_SIZE))
+				return false;
+
+			mTasks[b & (EXT_WORK_STEALING_QUEUE_SIZE-1)] = &task;
+			Ps::memoryBarrier();	// the task must be visible before the new bottom
+			mBottom = PxI32(b + 1);
+			return true;
+		}
+
+		PxBaseTask* pop()
+		{
+			const PxU32 b = PxU32(mBottom) - 1;
+			mBottom = PxI32(b);
+			Ps::memoryBarrier();	// publish the reservation before reading top
+			const PxU32 t = PxU32(mTop);
+
+			if(PxI32(b - t) < 0)
+			{
+				// empty, restore bottom
+				mBottom = PxI32(b + 1);
+				return NULL;
+			}
+
+			PxBaseTask* task = mTasks[b & (EXT_WORK_STEALING_QUEUE_SIZE-1)];
+			if(b == t)
+			{
+				// last element, race against thieves for it
+				if(Ps::atomicCompareExchange(&mTop, PxI32(t + 1), PxI32(t)) != PxI32(t))
+					task = NULL;
+				mBottom = PxI32(t + 1);
+			}
+			return task;
+		}
+
+		PxBaseTask* steal()
+		{
+			const PxU32 t = PxU32(mTop);
+			Ps::memoryBarrier();	// read top before bottom
+			const PxU32 b = PxU32(mBottom);
+
+			if(PxI32(b - t) <= 0)
+				return NULL;
+
+			PxBaseTask* task = mTasks[t & (EXT_WORK_STEALING_QUEUE_SIZE-1)];
+			if(Ps::atomicCompareExchange(&mTop, PxI32(t + 1), PxI32(t)) != PxI32(t))
+				return NULL;	// lost the race against the owner or another thief
+
+			return task;
+		}
+
+		bool isEmpty() const
+		{
+			return PxI32(PxU32(mBottom) - PxU32(mTop)) <= 0;
+		}
+
+	private:
+		volatile PxI32			mTop;
+		PxU32					mPad[15];	// keep top and bottom on separate cache lines
+		volatile PxI32			mBottom;
+		PxBaseTask* volatile	mTasks[EXT_WORK_STEALING_QUEUE_SIZE];
+	};
+
 } // namespace Ext
 
 }
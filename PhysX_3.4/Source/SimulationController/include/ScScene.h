@@ -269,6 +269,7 @@ namespace Sc
 
 					void						setFrictionType(PxFrictionType::Enum model);
 					PxFrictionType::Enum 		getFrictionType() const;
+					PxSolverType::Enum 			getSolverType() const;
 					void						setPCM(bool enabled);
 					void						setContactCache(bool enabled);
 
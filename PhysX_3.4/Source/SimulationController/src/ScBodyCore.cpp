@@ -410,6 +410,7 @@ void Sc::BodyCore::setFlags(Ps::Pool<SimStateData>* simStateDataPool, PxRigidBod
 						sim->getScene().resetSpeculativeCCDRigidBody(sim->getNodeIndex().index());
 
 					sim->getLowLevelBody().mInternalFlags &= (~PxcRigidBody::eSPECULATIVE_CCD);
+					sim->resetContactDistance();
 				}
 				else
 				{
@@ -251,7 +251,11 @@ void Sc::BodySim::updateContactDistance(PxReal* contactDistance, const PxReal dt
 	{
 		Sc::ShapeSim* sim;
 
-		const PxVec3 linVel = getLowLevelBody().getLinearVelocity();
+		//Predict the motion over the next step: the solver integrates gravity before it sees the contacts,
+		//so a falling body travels further than its current velocity suggests.
+		PxVec3 linVel = getLowLevelBody().getLinearVelocity();
+		if (!(getLowLevelBody().mInternalFlags & PxcRigidBody::eDISABLE_GRAVITY))
+			linVel += getScene().getGravityFast() * dt;
 		const PxVec3 aVel = getLowLevelBody().getAngularVelocity();
 		const PxReal inflation = linVel.magnitude() * dt;
 
@@ -260,6 +264,15 @@ void Sc::BodySim::updateContactDistance(PxReal* contactDistance, const PxReal dt
 	}
 }
 
+void Sc::BodySim::resetContactDistance()
+{
+	//Speculative CCD was turned off. Restore the shapes' contact offsets, otherwise the last velocity-inflated
+	//distances would stick around and keep generating far away contacts.
+	Sc::ShapeSim* sim;
+	for (Sc::ShapeIterator iterator(*this); (sim = iterator.getNext()) != NULL;)
+		sim->onContactOffsetChange();
+}
+
 void Sc::BodySim::onDeactivate()
 {
 	PX_ASSERT((!isKinematic()) || notInScene() || !readInternalFlag(BF_KINEMATIC_MOVED));	// kinematics should only get deactivated when no target is set.
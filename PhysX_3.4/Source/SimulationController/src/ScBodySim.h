@@ -98,6 +98,7 @@ namespace Sc
 						void					updateCached(Cm::BitMapPinned* shapeChangedMap);
 						void					updateCached(PxsTransformCache& transformCache, Bp::BoundsArray& boundsArray);
 						void					updateContactDistance(PxReal* contactDistance, const PxReal dt, Bp::BoundsArray& boundsArray);
+						void					resetContactDistance();
 
 		// hooks for actions in body core when it's attached to a sim object. Generally
 		// we get called after the attribute changed.
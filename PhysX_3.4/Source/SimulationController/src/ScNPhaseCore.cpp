@@ -151,7 +151,7 @@ Sc::NPhaseCore::NPhaseCore(Scene& scene, const PxSceneDesc& sceneDesc) :
 #if PX_USE_CLOTH_API
 	,mClothPool						(PX_DEBUG_EXP("clothPool"))
 #endif
-	,mMergeProcessedTriggerInteractions (scene.getContextId(), this, "ScNPhaseCore.mergeProcessedTriggerInteractions")
+	,mMergeProcessedTriggerInteractions (scene.getContextId(), this, "ScNPhaseCore.mergeProcessedTriggerInteractions", PxSceneMemoryCategory::eNARROW_PHASE)
 	,mTmpTriggerProcessingBlock		(NULL)
 	,mTriggerPairsToDeactivateCount	(0)
 {
@@ -1639,7 +1639,7 @@ public:
 						TriggerInteraction** pairsToDeactivate, volatile PxI32& pairsToDeactivateCount,
 						Scene& scene)
 		:
-		Cm::Task(scene.getContextId()),
+		Cm::Task(scene.getContextId(), PxSceneMemoryCategory::eNARROW_PHASE),
 		mTriggerPairs(triggerPairs),
 		mTriggerPairCount(triggerPairCount),
 		mLock(lock),
@@ -599,46 +599,46 @@ Sc::Scene::Scene(const PxSceneDesc& desc, PxU64 contextID) :
 	mNbRigidStatics					(0),
 	mNbRigidDynamics				(0),
 	mClothPreprocessing				(contextID, this, "ScScene.clothPreprocessing"),
-	mSecondPassNarrowPhase			(contextID, this, "ScScene.secondPassNarrowPhase"),
-	mPostNarrowPhase				(contextID, this, "ScScene.postNarrowPhase"),
+	mSecondPassNarrowPhase			(contextID, this, "ScScene.secondPassNarrowPhase", PxSceneMemoryCategory::eNARROW_PHASE),
+	mPostNarrowPhase				(contextID, this, "ScScene.postNarrowPhase", PxSceneMemoryCategory::eNARROW_PHASE),
 	mParticlePostCollPrep			(contextID, "ScScene.particlePostCollPrep"),
 	mParticlePostShapeGen			(contextID, this, "ScScene.particlePostShapeGen"),
 	mFinalizationPhase				(contextID, this, "ScScene.finalizationPhase"),
-	mUpdateCCDMultiPass				(contextID, this, "ScScene.updateCCDMultiPass"),
-	mAfterIntegration				(contextID, this, "ScScene.afterIntegration"),
-	mConstraintProjection			(contextID, this, "ScScene.constraintProjection"),
-	mPostSolver						(contextID, this, "ScScene.postSolver"),
-	mSolver							(contextID, this, "ScScene.rigidBodySolver"),
-	mUpdateBodiesAndShapes			(contextID, this, "ScScene.updateBodiesAndShapes"),
-	mUpdateSimulationController		(contextID, this, "ScScene.updateSimulationController"),
-	mUpdateDynamics					(contextID, this, "ScScene.updateDynamics"),
-	mProcessLostContactsTask		(contextID, this, "ScScene.processLostContact"),
-	mProcessLostContactsTask2		(contextID, this, "ScScene.processLostContact2"),
-	mProcessLostContactsTask3		(contextID, this, "ScScene.processLostContact3"),
-	mDestroyManagersTask			(contextID, this, "ScScene.destroyManagers"),
-	mLostTouchReportsTask			(contextID, this, "ScScene.lostTouchReports"),
-	mUnregisterInteractionsTask		(contextID, this, "ScScene.unregisterInteractions"),
-	mProcessNarrowPhaseLostTouchTasks(contextID, this, "ScScene.processNpLostTouchTask"),
-	mProcessNPLostTouchEvents		(contextID, this, "ScScene.processNPLostTouchEvents"),
-	mPostThirdPassIslandGenTask		(contextID, this, "ScScene.postThirdPassIslandGenTask"),
-	mPostIslandGen					(contextID, this, "ScScene.postIslandGen"),
-	mIslandGen						(contextID, this, "ScScene.islandGen"),
-	mPreRigidBodyNarrowPhase		(contextID, this, "ScScene.preRigidBodyNarrowPhase"),
-	mSetEdgesConnectedTask			(contextID, this, "ScScene.setEdgesConnectedTask"),
-	mFetchPatchEventsTask			(contextID, this, "ScScene.fetchPatchEventsTask"),
-	mProcessLostPatchesTask			(contextID, this, "ScScene.processLostSolverPatchesTask"),
-	mRigidBodyNarrowPhase			(contextID, this, "ScScene.rigidBodyNarrowPhase"),
-	mRigidBodyNPhaseUnlock			(contextID, this, "ScScene.unblockNarrowPhase"),
-	mPostBroadPhase					(contextID, this, "ScScene.postBroadPhase"),
-	mPostBroadPhaseCont				(contextID, this, "ScScene.postBroadPhaseCont"),
-	mPostBroadPhase2				(contextID, this, "ScScene.postBroadPhase2"),
-	mPostBroadPhase3				(contextID, this, "ScScene.postBroadPhase3"),
-	mPreallocateContactManagers		(contextID, this, "ScScene.preallocateContactManagers"),
-	mIslandInsertion				(contextID, this, "ScScene.islandInsertion"),
-	mRegisterContactManagers		(contextID, this, "ScScene.registerContactManagers"),
-	mRegisterInteractions			(contextID, this, "ScScene.registerInteractions"),
-	mRegisterSceneInteractions		(contextID, this, "ScScene.registerSceneInteractions"),
-	mBroadPhase						(contextID, this, "ScScene.broadPhase"),
+	mUpdateCCDMultiPass				(contextID, this, "ScScene.updateCCDMultiPass", PxSceneMemoryCategory::eCCD),
+	mAfterIntegration				(contextID, this, "ScScene.afterIntegration", PxSceneMemoryCategory::eSOLVER),
+	mConstraintProjection			(contextID, this, "ScScene.constraintProjection", PxSceneMemoryCategory::eSOLVER),
+	mPostSolver						(contextID, this, "ScScene.postSolver", PxSceneMemoryCategory::eSOLVER),
+	mSolver							(contextID, this, "ScScene.rigidBodySolver", PxSceneMemoryCategory::eSOLVER),
+	mUpdateBodiesAndShapes			(contextID, this, "ScScene.updateBodiesAndShapes", PxSceneMemoryCategory::eSOLVER),
+	mUpdateSimulationController		(contextID, this, "ScScene.updateSimulationController", PxSceneMemoryCategory::eSOLVER),
+	mUpdateDynamics					(contextID, this, "ScScene.updateDynamics", PxSceneMemoryCategory::eSOLVER),
+	mProcessLostContactsTask		(contextID, this, "ScScene.processLostContact", PxSceneMemoryCategory::eNARROW_PHASE),
+	mProcessLostContactsTask2		(contextID, this, "ScScene.processLostContact2", PxSceneMemoryCategory::eNARROW_PHASE),
+	mProcessLostContactsTask3		(contextID, this, "ScScene.processLostContact3", PxSceneMemoryCategory::eNARROW_PHASE),
+	mDestroyManagersTask			(contextID, this, "ScScene.destroyManagers", PxSceneMemoryCategory::eNARROW_PHASE),
+	mLostTouchReportsTask			(contextID, this, "ScScene.lostTouchReports", PxSceneMemoryCategory::eNARROW_PHASE),
+	mUnregisterInteractionsTask		(contextID, this, "ScScene.unregisterInteractions", PxSceneMemoryCategory::eNARROW_PHASE),
+	mProcessNarrowPhaseLostTouchTasks(contextID, this, "ScScene.processNpLostTouchTask", PxSceneMemoryCategory::eISLANDS),
+	mProcessNPLostTouchEvents		(contextID, this, "ScScene.processNPLostTouchEvents", PxSceneMemoryCategory::eISLANDS),
+	mPostThirdPassIslandGenTask		(contextID, this, "ScScene.postThirdPassIslandGenTask", PxSceneMemoryCategory::eISLANDS),
+	mPostIslandGen					(contextID, this, "ScScene.postIslandGen", PxSceneMemoryCategory::eISLANDS),
+	mIslandGen						(contextID, this, "ScScene.islandGen", PxSceneMemoryCategory::eISLANDS),
+	mPreRigidBodyNarrowPhase		(contextID, this, "ScScene.preRigidBodyNarrowPhase", PxSceneMemoryCategory::eNARROW_PHASE),
+	mSetEdgesConnectedTask			(contextID, this, "ScScene.setEdgesConnectedTask", PxSceneMemoryCategory::eISLANDS),
+	mFetchPatchEventsTask			(contextID, this, "ScScene.fetchPatchEventsTask", PxSceneMemoryCategory::eNARROW_PHASE),
+	mProcessLostPatchesTask			(contextID, this, "ScScene.processLostSolverPatchesTask", PxSceneMemoryCategory::eNARROW_PHASE),
+	mRigidBodyNarrowPhase			(contextID, this, "ScScene.rigidBodyNarrowPhase", PxSceneMemoryCategory::eNARROW_PHASE),
+	mRigidBodyNPhaseUnlock			(contextID, this, "ScScene.unblockNarrowPhase", PxSceneMemoryCategory::eNARROW_PHASE),
+	mPostBroadPhase					(contextID, this, "ScScene.postBroadPhase", PxSceneMemoryCategory::eBROAD_PHASE),
+	mPostBroadPhaseCont				(contextID, this, "ScScene.postBroadPhaseCont", PxSceneMemoryCategory::eBROAD_PHASE),
+	mPostBroadPhase2				(contextID, this, "ScScene.postBroadPhase2", PxSceneMemoryCategory::eBROAD_PHASE),
+	mPostBroadPhase3				(contextID, this, "ScScene.postBroadPhase3", PxSceneMemoryCategory::eBROAD_PHASE),
+	mPreallocateContactManagers		(contextID, this, "ScScene.preallocateContactManagers", PxSceneMemoryCategory::eNARROW_PHASE),
+	mIslandInsertion				(contextID, this, "ScScene.islandInsertion", PxSceneMemoryCategory::eISLANDS),
+	mRegisterContactManagers		(contextID, this, "ScScene.registerContactManagers", PxSceneMemoryCategory::eNARROW_PHASE),
+	mRegisterInteractions			(contextID, this, "ScScene.registerInteractions", PxSceneMemoryCategory::eNARROW_PHASE),
+	mRegisterSceneInteractions		(contextID, this, "ScScene.registerSceneInteractions", PxSceneMemoryCategory::eNARROW_PHASE),
+	mBroadPhase						(contextID, this, "ScScene.broadPhase", PxSceneMemoryCategory::eBROAD_PHASE),
 	mAdvanceStep					(contextID, this, "ScScene.advanceStep"),
 	mCollideStep					(contextID, this, "ScScene.collideStep"),	
 	mTaskPool						(16384),
@@ -764,6 +764,9 @@ Sc::Scene::Scene(const PxSceneDesc& desc, PxU64 contextID) :
 			desc.limits.maxNbStaticShapes, 
 			desc.limits.maxNbDynamicShapes,
 			contextID);
+
+		if(mPublicFlags & PxSceneFlag::eENABLE_ADAPTIVE_BROADPHASE_REGIONS)
+			mBP->setAdaptiveRegions(true);
 	}
 	else
 	{
@@ -870,6 +873,7 @@ Sc::Scene::Scene(const PxSceneDesc& desc, PxU64 contextID) :
 	mDynamicsContext->setFrictionOffsetThreshold(desc.frictionOffsetThreshold);
 	mDynamicsContext->setCCDSeparationThreshold(desc.ccdMaxSeparation);
 	mDynamicsContext->setSolverOffsetSlop(desc.solverOffsetSlop);
+	mDynamicsContext->setSolverResidualTolerance(desc.solverResidualTolerance);
 
 	const PxTolerancesScale& scale = Physics::getInstance().getTolerancesScale();
 	mDynamicsContext->setCorrelationDistance(0.025f * scale.length);
@@ -906,6 +910,7 @@ Sc::Scene::Scene(const PxSceneDesc& desc, PxU64 contextID) :
 	setGravity(desc.gravity);
 
 	setFrictionType(desc.frictionType);
+	mDynamicsContext->setSolverType(desc.solverType);
 
 	setPCM(desc.flags & PxSceneFlag::eENABLE_PCM);
 
@@ -1534,6 +1539,11 @@ PxFrictionType::Enum Sc::Scene::getFrictionType() const
 	return mDynamicsContext->getFrictionType();
 }
 
+PxSolverType::Enum Sc::Scene::getSolverType() const
+{
+	return mDynamicsContext->getSolverType();
+}
+
 void Sc::Scene::setPCM(bool enabled)
 {
 	mLLContext->setPCM(enabled);
@@ -3154,12 +3164,12 @@ void Sc::Scene::updateCCDMultiPass(PxBaseTask* parentContinuation)
 			mCCDBroadPhaseAABB.reserve(2);
 			for (int j = 0; j < 2; j++)
 			{
-				mPostCCDPass.pushBack(Cm::DelegateTask<Sc::Scene, &Sc::Scene::postCCDPass>(getContextId(), this, "ScScene.postCCDPass"));
-				mUpdateCCDSinglePass.pushBack(Cm::DelegateTask<Sc::Scene, &Sc::Scene::updateCCDSinglePass>(getContextId(), this, "ScScene.updateCCDSinglePass"));
-				mUpdateCCDSinglePass2.pushBack(Cm::DelegateTask<Sc::Scene, &Sc::Scene::updateCCDSinglePassStage2>(getContextId(), this, "ScScene.updateCCDSinglePassStage2"));
-				mUpdateCCDSinglePass3.pushBack(Cm::DelegateTask<Sc::Scene, &Sc::Scene::updateCCDSinglePassStage3>(getContextId(), this, "ScScene.updateCCDSinglePassStage3"));
-				mCCDBroadPhase.pushBack(Cm::DelegateTask<Sc::Scene, &Sc::Scene::ccdBroadPhase>(getContextId(), this, "ScScene.ccdBroadPhase"));
-				mCCDBroadPhaseAABB.pushBack(Cm::DelegateTask<Sc::Scene, &Sc::Scene::ccdBroadPhaseAABB>(getContextId(), this, "ScScene.ccdBroadPhaseAABB"));
+				mPostCCDPass.pushBack(Cm::DelegateTask<Sc::Scene, &Sc::Scene::postCCDPass>(getContextId(), this, "ScScene.postCCDPass", PxSceneMemoryCategory::eCCD));
+				mUpdateCCDSinglePass.pushBack(Cm::DelegateTask<Sc::Scene, &Sc::Scene::updateCCDSinglePass>(getContextId(), this, "ScScene.updateCCDSinglePass", PxSceneMemoryCategory::eCCD));
+				mUpdateCCDSinglePass2.pushBack(Cm::DelegateTask<Sc::Scene, &Sc::Scene::updateCCDSinglePassStage2>(getContextId(), this, "ScScene.updateCCDSinglePassStage2", PxSceneMemoryCategory::eCCD));
+				mUpdateCCDSinglePass3.pushBack(Cm::DelegateTask<Sc::Scene, &Sc::Scene::updateCCDSinglePassStage3>(getContextId(), this, "ScScene.updateCCDSinglePassStage3", PxSceneMemoryCategory::eCCD));
+				mCCDBroadPhase.pushBack(Cm::DelegateTask<Sc::Scene, &Sc::Scene::ccdBroadPhase>(getContextId(), this, "ScScene.ccdBroadPhase", PxSceneMemoryCategory::eCCD));
+				mCCDBroadPhaseAABB.pushBack(Cm::DelegateTask<Sc::Scene, &Sc::Scene::ccdBroadPhaseAABB>(getContextId(), this, "ScScene.ccdBroadPhaseAABB", PxSceneMemoryCategory::eCCD));
 			}
 		}
 
@@ -3621,6 +3631,7 @@ void Sc::Scene::postSolver(PxBaseTask* continuation)
 
 #if PX_ENABLE_SIM_STATS
 	mLLContext->getSimStats().mPeakConstraintBlockAllocations = blockPool.getPeakConstraintBlockCount();
+	mLLContext->getSimStats().mPeakContactDataBlocks = blockPool.getFramePeakUsedBlockCount();
 #endif
 
 	integrateKinematicPose();
@@ -5043,6 +5054,7 @@ void Sc::Scene::getStats(PxSimulationStatistics& s) const
 	s.nbAggregates = mAABBManager->getNbActiveAggregates();
 	for(PxU32 i=0; i<PxGeometryType::eGEOMETRY_COUNT; i++)
 		s.nbShapes[i] = mNbGeometries[i];
+	mAABBManager->getBroadPhase()->getRegionStatistics(s);
 }
 
 void Sc::Scene::addShapes(void *const* shapes, PxU32 nbShapes, size_t ptrOffset, RigidSim& bodySim, PxBounds3* outBounds)
@@ -121,6 +121,7 @@ void Sc::SimStats::readOut(PxSimulationStatistics& s, const PxvSimStats& simStat
 	s.nbDiscreteContactPairsTotal = simStats.mNbDiscreteContactPairsTotal;
 	s.nbDiscreteContactPairsWithCacheHits = simStats.mNbDiscreteContactPairsWithCacheHits;
 	s.nbDiscreteContactPairsWithContacts = simStats.mNbDiscreteContactPairsWithContacts;
+	s.nbDiscreteContactPairsReplayed = simStats.mNbDiscreteContactPairsReplayed;
 	s.nbActiveConstraints = simStats.mNbActiveConstraints;
 	s.nbActiveDynamicBodies = simStats.mNbActiveDynamicBodies;
 	s.nbActiveKinematicBodies = simStats.mNbActiveKinematicBodies;
@@ -128,6 +129,9 @@ void Sc::SimStats::readOut(PxSimulationStatistics& s, const PxvSimStats& simStat
 	s.nbAxisSolverConstraints = simStats.mNbAxisSolverConstraints;
 
 	s.peakConstraintMemory = simStats.mPeakConstraintBlockAllocations * 16 * 1024;
+	s.peakContactDataBlocks = simStats.mPeakContactDataBlocks;
+	s.nbNarrowPhaseArenaBlocks = simStats.mNbNpArenaBlocks;
+	s.nbNarrowPhaseArenaOverflowBlocks = simStats.mNbNpArenaOverflowBlocks;
 	s.compressedContactSize = simStats.mTotalCompressedContactSize;
 	s.requiredContactConstraintMemory = simStats.mTotalConstraintSize;
 	s.nbNewPairs = simStats.mNbNewPairs;
@@ -136,6 +140,34 @@ void Sc::SimStats::readOut(PxSimulationStatistics& s, const PxvSimStats& simStat
 	s.nbLostTouches = simStats.mNbLostTouches;
 	s.nbPartitions = simStats.mNbPartitions;
 
+	for(PxU32 i=0; i < PxSimulationStatistics::eMAX_SOLVER_BARRIER_PARTITIONS; i++)
+	{
+		s.solverPartitionWaitTime[i] = simStats.mSolverPartitionWaitTime[i];
+		s.solverFrictionPartitionWaitTime[i] = simStats.mSolverFrictionPartitionWaitTime[i];
+	}
+	s.solverVelocitySaveWaitTime = simStats.mSolverVelocitySaveWaitTime;
+	s.nbSolverBarrierWaits = simStats.mNbSolverBarrierWaits;
+	s.nbSolverBarrierYields = simStats.mNbSolverBarrierYields;
+
+	s.nbSolverIslands = simStats.mNbSolverIslands;
+	s.nbSolverIslandsTerminatedEarly = simStats.mNbSolverIslandsTerminatedEarly;
+	s.solverPositionIterations = simStats.mSolverPositionIterations;
+	s.solverVelocityIterations = simStats.mSolverVelocityIterations;
+	s.maxSolverPositionIterations = simStats.mMaxSolverPositionIterations;
+	s.maxSolverVelocityIterations = simStats.mMaxSolverVelocityIterations;
+
+	s.nbSolverPartitions = simStats.mNbSolverPartitions;
+	s.maxSolverPartitions = simStats.mMaxSolverPartitions;
+	s.nbSolverMergedPartitions = simStats.mNbSolverMergedPartitions;
+	s.nbSolverConstraintBatches = simStats.mNbSolverConstraintBatches;
+	s.nbSolverBatchedConstraints = simStats.mNbSolverBatchedConstraints;
+
+	s.nbCCDPasses = simStats.mNbCCDPasses;
+	for(PxU32 i=0; i < PxSimulationStatistics::eMAX_CCD_PASSES; i++)
+		s.ccdPassTime[i] = simStats.mCCDPassTime[i];
+	s.nbCCDSweeps = simStats.mNbCCDSweeps;
+	s.nbCCDSkippedSweeps = simStats.mNbCCDSkippedSweeps;
+
 #else
 	PX_UNUSED(s);
 	PX_UNUSED(simStats);
@@ -5,10 +5,12 @@ PhysXCommon_cfiles   += ./../../../../Externals/android-ndk-r9d/sources/android/
 PhysXCommon_cppfiles   += ./../../Common/src/CmBoxPruning.cpp
 PhysXCommon_cppfiles   += ./../../Common/src/CmCollection.cpp
 PhysXCommon_cppfiles   += ./../../Common/src/CmMathUtils.cpp
+PhysXCommon_cppfiles   += ./../../Common/src/CmMemoryTracker.cpp
 PhysXCommon_cppfiles   += ./../../Common/src/CmPtrTable.cpp
 PhysXCommon_cppfiles   += ./../../Common/src/CmRadixSort.cpp
 PhysXCommon_cppfiles   += ./../../Common/src/CmRadixSortBuffered.cpp
 PhysXCommon_cppfiles   += ./../../Common/src/CmRenderOutput.cpp
+PhysXCommon_cppfiles   += ./../../Common/src/CmTaskGraphRecorder.cpp
 PhysXCommon_cppfiles   += ./../../Common/src/CmVisualization.cpp
 PhysXCommon_cppfiles   += ./../../GeomUtils/src/GuBounds.cpp
 PhysXCommon_cppfiles   += ./../../GeomUtils/src/GuBox.cpp
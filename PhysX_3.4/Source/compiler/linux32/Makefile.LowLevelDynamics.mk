@@ -19,6 +19,7 @@ LowLevelDynamics_cppfiles   += ./../../LowLevelDynamics/src/DyFrictionCorrelatio
 LowLevelDynamics_cppfiles   += ./../../LowLevelDynamics/src/DyRigidBodyToSolverBody.cpp
 LowLevelDynamics_cppfiles   += ./../../LowLevelDynamics/src/DySolverConstraints.cpp
 LowLevelDynamics_cppfiles   += ./../../LowLevelDynamics/src/DySolverConstraintsBlock.cpp
+LowLevelDynamics_cppfiles   += ./../../LowLevelDynamics/src/DySolverConstraintsBlockAVX.cpp
 LowLevelDynamics_cppfiles   += ./../../LowLevelDynamics/src/DySolverControl.cpp
 LowLevelDynamics_cppfiles   += ./../../LowLevelDynamics/src/DySolverControlPF.cpp
 LowLevelDynamics_cppfiles   += ./../../LowLevelDynamics/src/DySolverPFConstraints.cpp
@@ -4,10 +4,12 @@ ProjectName = PhysXCommon
 PhysXCommon_cppfiles   += ./../../Common/src/CmBoxPruning.cpp
 PhysXCommon_cppfiles   += ./../../Common/src/CmCollection.cpp
 PhysXCommon_cppfiles   += ./../../Common/src/CmMathUtils.cpp
+PhysXCommon_cppfiles   += ./../../Common/src/CmMemoryTracker.cpp
 PhysXCommon_cppfiles   += ./../../Common/src/CmPtrTable.cpp
 PhysXCommon_cppfiles   += ./../../Common/src/CmRadixSort.cpp
 PhysXCommon_cppfiles   += ./../../Common/src/CmRadixSortBuffered.cpp
 PhysXCommon_cppfiles   += ./../../Common/src/CmRenderOutput.cpp
+PhysXCommon_cppfiles   += ./../../Common/src/CmTaskGraphRecorder.cpp
 PhysXCommon_cppfiles   += ./../../Common/src/CmVisualization.cpp
 PhysXCommon_cppfiles   += ./../../GeomUtils/src/GuBounds.cpp
 PhysXCommon_cppfiles   += ./../../GeomUtils/src/GuBox.cpp
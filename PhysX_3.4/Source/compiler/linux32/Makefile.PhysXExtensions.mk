@@ -36,6 +36,7 @@ PhysXExtensions_cppfiles   += ./../../PhysXExtensions/src/ExtSimpleFactory.cpp
 PhysXExtensions_cppfiles   += ./../../PhysXExtensions/src/ExtSmoothNormals.cpp
 PhysXExtensions_cppfiles   += ./../../PhysXExtensions/src/ExtSphericalJoint.cpp
 PhysXExtensions_cppfiles   += ./../../PhysXExtensions/src/ExtSphericalJointSolverPrep.cpp
+PhysXExtensions_cppfiles   += ./../../PhysXExtensions/src/ExtTaskGraphExt.cpp
 PhysXExtensions_cppfiles   += ./../../PhysXExtensions/src/ExtTriangleMeshExt.cpp
 PhysXExtensions_cppfiles   += ./../../PhysXExtensions/src/serialization/SnSerialUtils.cpp
 PhysXExtensions_cppfiles   += ./../../PhysXExtensions/src/serialization/SnSerialization.cpp
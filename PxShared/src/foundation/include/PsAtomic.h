@@ -57,6 +57,15 @@ PX_FOUNDATION_API int32_t atomicAdd(volatile int32_t* val, int32_t delta);
 /* compute the maximum of dest and val. Return the new value */
 PX_FOUNDATION_API int32_t atomicMax(volatile int32_t* val, int32_t val2);
 
+/* if *dest == comp, replace with exch. Return original value of *dest */
+PX_FOUNDATION_API int64_t atomicCompareExchange64(volatile int64_t* dest, int64_t exch, int64_t comp);
+
+/* add delta to *val. Return the new value */
+PX_FOUNDATION_API int64_t atomicAdd64(volatile int64_t* val, int64_t delta);
+
+/* compute the maximum of dest and val. Return the new value */
+PX_FOUNDATION_API int64_t atomicMax64(volatile int64_t* val, int64_t val2);
+
 } // namespace shdfnd
 } // namespace physx
 
@@ -51,6 +51,21 @@ or the physics processing thread(s).
 class AllocationListener
 {
   public:
+	/**
+	\brief callback before memory is requested from the allocator.
+	\param size Size of the allocation in bytes.
+	\param typeName Type this data is being allocated for.
+	\param filename File the allocation came from.
+	\param line the allocation came from.
+	*/
+	virtual void onAllocationRequest(size_t size, const char* typeName, const char* filename, int line)
+	{
+		PX_UNUSED(size);
+		PX_UNUSED(typeName);
+		PX_UNUSED(filename);
+		PX_UNUSED(line);
+	}
+
 	/**
 	\brief callback when memory is allocated.
 	\param size Size of the allocation in bytes.
@@ -192,6 +207,9 @@ class BroadcastingAllocator : public Broadcast<AllocationListener, PxAllocatorCa
 	*/
 	void* allocate(size_t size, const char* typeName, const char* filename, int line)
 	{
+		for(uint32_t i = 0; i < mListeners.size(); i++)
+			mListeners[i]->onAllocationRequest(size, typeName, filename, line);
+
 		void* mem = mAllocator.allocate(size, typeName, filename, line);
 
 		if(!mem)
@@ -98,5 +98,34 @@ int32_t atomicExchange(volatile int32_t* val, int32_t val2)
 	return oldVal;
 }
 
+int64_t atomicCompareExchange64(volatile int64_t* dest, int64_t exch, int64_t comp)
+{
+	return __sync_val_compare_and_swap(dest, comp, exch);
+}
+
+int64_t atomicAdd64(volatile int64_t* val, int64_t delta)
+{
+	return __sync_add_and_fetch(val, delta);
+}
+
+int64_t atomicMax64(volatile int64_t* val, int64_t val2)
+{
+	int64_t oldVal, newVal;
+
+	do
+	{
+		PAUSE();
+		oldVal = *val;
+
+		if(val2 > oldVal)
+			newVal = val2;
+		else
+			newVal = oldVal;
+
+	} while(atomicCompareExchange64(val, newVal, oldVal) != oldVal);
+
+	return newVal;
+}
+
 } // namespace shdfnd
 } // namespace physx
@@ -92,5 +92,40 @@ int32_t atomicMax(volatile int32_t* val, int32_t val2)
 	return newValue;
 }
 
+int64_t atomicCompareExchange64(volatile int64_t* dest, int64_t exch, int64_t comp)
+{
+	return (int64_t)InterlockedCompareExchange64((volatile LONGLONG*)dest, exch, comp);
+}
+
+int64_t atomicAdd64(volatile int64_t* val, int64_t delta)
+{
+	LONGLONG newValue, oldValue;
+	do
+	{
+		oldValue = *val;
+		newValue = oldValue + delta;
+	} while(InterlockedCompareExchange64((volatile LONGLONG*)val, newValue, oldValue) != oldValue);
+
+	return newValue;
+}
+
+int64_t atomicMax64(volatile int64_t* val, int64_t val2)
+{
+	LONGLONG newValue, oldValue;
+
+	do
+	{
+		oldValue = *val;
+
+		if(val2 > oldValue)
+			newValue = val2;
+		else
+			newValue = oldValue;
+
+	} while(InterlockedCompareExchange64((volatile LONGLONG*)val, newValue, oldValue) != oldValue);
+
+	return newValue;
+}
+
 } // namespace shdfnd
 } // namespace physx